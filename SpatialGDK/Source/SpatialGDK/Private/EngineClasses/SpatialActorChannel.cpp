@@ -41,6 +41,11 @@ DECLARE_CYCLE_STAT(TEXT("ClientProcessOwnershipChange"), STAT_ClientProcessOwner
 DECLARE_CYCLE_STAT(TEXT("CallUpdateEntityACLs"), STAT_CallUpdateEntityACLs, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("OnUpdateEntityACLSuccess"), STAT_OnUpdateEntityACLSuccess, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("IsAuthoritativeServer"), STAT_IsAuthoritativeServer, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Condition Map Filters Built"), STAT_SpatialConditionMapFiltersBuilt, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Channels Prewarmed For Authority"), STAT_SpatialChannelsPrewarmedForAuthority, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Handovers Prefetched"), STAT_SpatialHandoversPrefetched, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("First Replications After Authority Gain"), STAT_SpatialFirstReplicationsAfterAuthorityGain, STATGROUP_SpatialNet);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Time To First Replication After Authority Gain Total (ms)"), STAT_SpatialTimeToFirstReplicationAfterAuthorityGain, STATGROUP_SpatialNet);
 
 namespace
 {
@@ -210,6 +215,10 @@ USpatialActorChannel::USpatialActorChannel(const FObjectInitializer& ObjectIniti
 	, NetDriver(nullptr)
 	, LastPositionSinceUpdate(FVector::ZeroVector)
 	, TimeWhenPositionLastUpdated(0.0f)
+	, bConditionMapFilterIsClient(false)
+	, NumConditionMapFiltersBuilt(0)
+	, bPrewarmedForAuthority(false)
+	, bAwaitingFirstReplicationSinceAuthority(false)
 {
 }
 
@@ -228,6 +237,8 @@ void USpatialActorChannel::Init(UNetConnection* InConnection, int32 ChannelIndex
 	LastPositionSinceUpdate = FVector::ZeroVector;
 	TimeWhenPositionLastUpdated = 0.0f;
 	AuthorityReceivedTimestamp = 0;
+	bPrewarmedForAuthority = false;
+	bAwaitingFirstReplicationSinceAuthority = false;
 
 	PendingDynamicSubobjects.Empty();
 	SavedConnectionOwningWorkerId.Empty();
@@ -238,6 +249,9 @@ void USpatialActorChannel::Init(UNetConnection* InConnection, int32 ChannelIndex
 	ActorHandoverShadowData = nullptr;
 	HandoverShadowDataMap.Empty();
 
+	ReplicationCache.Invalidate();
+	ConditionMapFilter.Reset();
+
 	NetDriver = Cast<USpatialNetDriver>(Connection->Driver);
 	check(NetDriver);
 	Sender = NetDriver->Sender;
@@ -320,6 +334,8 @@ bool USpatialActorChannel::CleanUp(const bool bForDestroy, EChannelCloseReason C
 		{
 			Receiver->ClearPendingRPCs(EntityId);
 			Sender->ClearPendingRPCs(EntityId);
+			Sender->ClearUpdatesQueuedUntilAuthority(EntityId);
+			Sender->ResetLastSentPosition(EntityId);
 		}
 		NetDriver->RemoveActorChannel(EntityId, *this);
 	}
@@ -386,6 +402,62 @@ void USpatialActorChannel::UpdateShadowData()
 	}
 }
 
+void USpatialActorChannel::SetServerAuthority(const bool IsAuth)
+{
+	if (IsAuth && !bIsAuthServer)
+	{
+		AuthorityReceivedTimestamp = FPlatformTime::Cycles64();
+		bAwaitingFirstReplicationSinceAuthority = !bCreatedEntity;
+
+		if (bPrewarmedForAuthority && Actor != nullptr)
+		{
+			Actor->ForceNetUpdate();
+		}
+	}
+	else if (!IsAuth)
+	{
+		bPrewarmedForAuthority = false;
+		bAwaitingFirstReplicationSinceAuthority = false;
+	}
+	bIsAuthServer = IsAuth;
+}
+
+void USpatialActorChannel::PrewarmForAuthority()
+{
+	check(Actor);
+
+	// Dormant Actors don't refresh their shadow data when authority arrives either.
+	if (bIsAuthServer || bPrewarmedForAuthority || !ActorReplicator.IsValid() || Actor->NetDormancy >= DORM_DormantAll)
+	{
+		return;
+	}
+
+	// Do the allocations UpdateShadowData would otherwise do when authority arrives, so it only has to copy the latest state.
+	UpdateShadowData();
+	bPrewarmedForAuthority = true;
+
+	INC_DWORD_STAT(STAT_SpatialChannelsPrewarmedForAuthority);
+}
+
+void USpatialActorChannel::PrefetchHandover()
+{
+	const float LookaheadSeconds = GetDefault<USpatialGDKSettings>()->HandoverPrefetchLookaheadSeconds;
+	if (LookaheadSeconds <= 0.f)
+	{
+		return;
+	}
+
+	const VirtualWorkerId PredictedVirtualWorkerId = NetDriver->LoadBalanceStrategy->PredictWhoShouldHaveAuthority(*Actor, LookaheadSeconds);
+	if (PredictedVirtualWorkerId != SpatialConstants::INVALID_VIRTUAL_WORKER_ID
+		&& PredictedVirtualWorkerId != NetDriver->LoadBalanceStrategy->GetLocalVirtualWorkerId())
+	{
+		// Handover data is sent whenever the Actor replicates, so replicating every tick keeps it up to date for the worker
+		// the Actor is heading for, and sends the authority intent as soon as the Actor crosses over.
+		Actor->ForceNetUpdate();
+		INC_DWORD_STAT(STAT_SpatialHandoversPrefetched);
+	}
+}
+
 void USpatialActorChannel::UpdateSpatialPositionWithFrequencyCheck()
 {
 	// Check that there has been a sufficient amount of time since the last update.
@@ -534,6 +606,15 @@ int64 USpatialActorChannel::ReplicateActor()
 		return 0;
 	}
 
+	if (bAwaitingFirstReplicationSinceAuthority)
+	{
+		bAwaitingFirstReplicationSinceAuthority = false;
+		// Accumulated with a count, so the average over the handovers is the total divided by the count.
+		INC_DWORD_STAT(STAT_SpatialFirstReplicationsAfterAuthorityGain);
+		INC_FLOAT_STAT_BY(STAT_SpatialTimeToFirstReplicationAfterAuthorityGain,
+			double(FPlatformTime::Cycles64() - AuthorityReceivedTimestamp) * FPlatformTime::GetSecondsPerCycle64() * 1000.0);
+	}
+
 	bIsReplicatingActor = true;
 	FReplicationFlags RepFlags;
 
@@ -702,9 +783,21 @@ int64 USpatialActorChannel::ReplicateActor()
 		// the same SpatialActorChannel::ReplicateSubobject.
 		Actor->ReplicateSubobjects(this, &DummyOutBunch, &RepFlags);
 
-		for (auto& SubobjectInfoPair : GetHandoverSubobjects())
+		const FSubobjectReplicationCache::FHandoverSubobjects* HandoverSubobjects = ReplicationCache.FindHandoverSubobjects();
+		if (HandoverSubobjects == nullptr)
+		{
+			FSubobjectReplicationCache::FHandoverSubobjects FoundSubobjects;
+			for (auto& SubobjectInfoPair : GetHandoverSubobjects())
+			{
+				FoundSubobjects.Emplace(SubobjectInfoPair.Key, SubobjectInfoPair.Value);
+			}
+			ReplicationCache.SetHandoverSubobjects(MoveTemp(FoundSubobjects));
+			HandoverSubobjects = ReplicationCache.FindHandoverSubobjects();
+		}
+
+		for (auto& SubobjectInfoPair : *HandoverSubobjects)
 		{
-			UObject* Subobject = SubobjectInfoPair.Key;
+			UObject* Subobject = SubobjectInfoPair.Key.Get();
 			const FClassInfo& SubobjectInfo = *SubobjectInfoPair.Value;
 
 			// Handover shadow data should already exist for this object. If it doesn't, it must have
@@ -745,10 +838,9 @@ int64 USpatialActorChannel::ReplicateActor()
 
 	// TODO: the 'bWroteSomethingImportant' check causes problems for actors that need to transition in groups (ex. Character, PlayerController, PlayerState),
 	// so disabling it for now.  Figure out a way to deal with this to recover the perf lost by calling ShouldChangeAuthority() frequently. [UNR-2387]
-	if (NetDriver->LoadBalanceStrategy != nullptr &&
-		NetDriver->StaticComponentView->HasAuthority(EntityId, SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID))
+	if (IsLoadBalancingEligible())
 	{
-		if (!NetDriver->LoadBalanceStrategy->ShouldHaveAuthority(*Actor) && !NetDriver->LockingPolicy->IsLocked(Actor))
+		if (!NetDriver->LoadBalanceStrategy->ShouldKeepAuthority(*Actor) && !NetDriver->LockingPolicy->IsLocked(Actor))
 		{
 			const AActor* NetOwner = Actor->GetNetOwner();
 
@@ -789,6 +881,10 @@ int64 USpatialActorChannel::ReplicateActor()
 				}
 			}
 		}
+		else if (!NetDriver->LockingPolicy->IsLocked(Actor))
+		{
+			PrefetchHandover();
+		}
 
 		if (SpatialGDK::SpatialDebugging* DebuggingInfo = NetDriver->StaticComponentView->GetComponentData<SpatialGDK::SpatialDebugging>(EntityId))
 		{
@@ -848,6 +944,8 @@ void USpatialActorChannel::DynamicallyAttachSubobject(UObject* Object)
 
 	check(Info != nullptr);
 
+	ReplicationCache.InvalidateSubobject(Object);
+
 	// Check to see if we already have authority over the subobject to be added
 	if (NetDriver->StaticComponentView->HasAuthority(EntityId, Info->SchemaComponents[SCHEMA_Data]))
 	{
@@ -950,15 +1048,22 @@ bool USpatialActorChannel::ReplicateSubobject(UObject* Object, const FReplicatio
 	{
 		FRepChangeState RepChangeState = { RepChanged, GetObjectRepLayout(Object) };
 
-		FUnrealObjectRef ObjectRef = NetDriver->PackageMap->GetUnrealObjectRefFromObject(Object);
-		if (!ObjectRef.IsValid())
+		// Only subobjects with a valid ObjectRef are cached, so dynamic components that haven't attached yet are checked again next time.
+		const FClassInfo* Info = ReplicationCache.FindSubobjectInfo(Object);
+		if (Info == nullptr)
 		{
-			UE_LOG(LogSpatialActorChannel, Verbose, TEXT("Attempted to replicate an invalid ObjectRef. This may be a dynamic component that couldn't attach: %s"), *Object->GetName());
-			return false;
+			FUnrealObjectRef ObjectRef = NetDriver->PackageMap->GetUnrealObjectRefFromObject(Object);
+			if (!ObjectRef.IsValid())
+			{
+				UE_LOG(LogSpatialActorChannel, Verbose, TEXT("Attempted to replicate an invalid ObjectRef. This may be a dynamic component that couldn't attach: %s"), *Object->GetName());
+				return false;
+			}
+
+			Info = &NetDriver->ClassInfoManager->GetOrCreateClassInfoByObject(Object);
+			ReplicationCache.AddSubobjectInfo(Object, Info);
 		}
 
-		const FClassInfo& Info = NetDriver->ClassInfoManager->GetOrCreateClassInfoByObject(Object);
-		Sender->SendComponentUpdates(Object, Info, this, &RepChangeState, nullptr, ReplicationBytesWritten);
+		Sender->SendComponentUpdates(Object, *Info, this, &RepChangeState, nullptr, ReplicationBytesWritten);
 
 		SendingRepState->HistoryEnd++;
 	}
@@ -1035,51 +1140,83 @@ TMap<UObject*, const FClassInfo*> USpatialActorChannel::GetHandoverSubobjects()
 
 void USpatialActorChannel::InitializeHandoverShadowData(TArray<uint8>& ShadowData, UObject* Object)
 {
-	const FClassInfo& ClassInfo = NetDriver->ClassInfoManager->GetOrCreateClassInfoByClass(Object->GetClass());
+	InitializeHandoverShadowData(NetDriver->ClassInfoManager->GetOrCreateClassInfoByClass(Object->GetClass()), ShadowData);
+}
 
-	uint32 Size = 0;
-	for (const FHandoverPropertyInfo& PropertyInfo : ClassInfo.HandoverProperties)
+void USpatialActorChannel::InitializeHandoverShadowData(const FClassInfo& ClassInfo, TArray<uint8>& ShadowData)
+{
+	if (ClassInfo.HandoverProperties.Num() == 0)
 	{
-		if (PropertyInfo.ArrayIdx == 0) // For static arrays, the first element will handle the whole array
-		{
-			// Make sure we conform to Unreal's alignment requirements; this is matched below and in ReplicateActor()
-			Size = Align(Size, PropertyInfo.Property->GetMinAlignment());
-			Size += PropertyInfo.Property->GetSize();
-		}
+		return;
 	}
-	ShadowData.AddZeroed(Size);
-	uint32 Offset = 0;
+
+	// The shadow data layout, including alignment, is computed alongside the handover properties by the class info manager.
+	const FHandoverPropertyInfo& LastPropertyInfo = ClassInfo.HandoverProperties.Last();
+	ShadowData.AddZeroed(LastPropertyInfo.ShadowOffset + LastPropertyInfo.Property->ElementSize);
+
 	for (const FHandoverPropertyInfo& PropertyInfo : ClassInfo.HandoverProperties)
 	{
-		if (PropertyInfo.ArrayIdx == 0)
+		if (PropertyInfo.ArrayIdx == 0) // For static arrays, the first element will handle the whole array
 		{
-			Offset = Align(Offset, PropertyInfo.Property->GetMinAlignment());
-			PropertyInfo.Property->InitializeValue(ShadowData.GetData() + Offset);
-			Offset += PropertyInfo.Property->GetSize();
+			PropertyInfo.Property->InitializeValue(ShadowData.GetData() + PropertyInfo.ShadowOffset);
 		}
 	}
 }
 
 FHandoverChangeState USpatialActorChannel::GetHandoverChangeList(TArray<uint8>& ShadowData, UObject* Object)
+{
+	const FClassInfo& ClassInfo = NetDriver->ClassInfoManager->GetOrCreateClassInfoByClass(Object->GetClass());
+
+	return GetHandoverChangeList(ClassInfo, ShadowData, Object, bCreatingNewEntity);
+}
+
+FHandoverChangeState USpatialActorChannel::GetHandoverChangeList(const FClassInfo& ClassInfo, TArray<uint8>& ShadowData, const UObject* Object, bool bForceAllChanged)
 {
 	FHandoverChangeState HandoverChanged;
 
-	const FClassInfo& ClassInfo = NetDriver->ClassInfoManager->GetOrCreateClassInfoByClass(Object->GetClass());
+	const uint8* ObjectData = reinterpret_cast<const uint8*>(Object);
+	uint8* ShadowBase = ShadowData.GetData();
 
-	uint32 ShadowDataOffset = 0;
-	for (const FHandoverPropertyInfo& PropertyInfo : ClassInfo.HandoverProperties)
+	for (const FHandoverPropertyRange& Range : ClassInfo.HandoverPropertyRanges)
 	{
-		ShadowDataOffset = Align(ShadowDataOffset, PropertyInfo.Property->GetMinAlignment());
+		const FHandoverPropertyInfo& RangeStart = ClassInfo.HandoverProperties[Range.FirstIndex];
+
+		if (Range.bIsPOD)
+		{
+			const uint8* Data = ObjectData + RangeStart.Offset;
+			uint8* StoredData = ShadowBase + RangeStart.ShadowOffset;
+
+			// Most ranges are unchanged, so compare the whole range before looking at individual properties.
+			if (!bForceAllChanged && FMemory::Memcmp(StoredData, Data, Range.Size) == 0)
+			{
+				continue;
+			}
+
+			for (int32 Index = Range.FirstIndex; Index < Range.FirstIndex + Range.Num; ++Index)
+			{
+				const FHandoverPropertyInfo& PropertyInfo = ClassInfo.HandoverProperties[Index];
+				if (bForceAllChanged || FMemory::Memcmp(ShadowBase + PropertyInfo.ShadowOffset, ObjectData + PropertyInfo.Offset, PropertyInfo.Property->ElementSize) != 0)
+				{
+					HandoverChanged.Add(PropertyInfo.Handle);
+				}
+			}
 
-		const uint8* Data = (uint8*)Object + PropertyInfo.Offset;
-		uint8* StoredData = ShadowData.GetData() + ShadowDataOffset;
-		// Compare and assign.
-		if (bCreatingNewEntity || !PropertyInfo.Property->Identical(StoredData, Data))
+			FMemory::Memcpy(StoredData, Data, Range.Size);
+		}
+		else
 		{
-			HandoverChanged.Add(PropertyInfo.Handle);
-			PropertyInfo.Property->CopySingleValue(StoredData, Data);
+			check(Range.Num == 1);
+
+			const uint8* Data = ObjectData + RangeStart.Offset;
+			uint8* StoredData = ShadowBase + RangeStart.ShadowOffset;
+
+			// Compare and assign.
+			if (bForceAllChanged || !RangeStart.Property->Identical(StoredData, Data))
+			{
+				HandoverChanged.Add(RangeStart.Handle);
+				RangeStart.Property->CopySingleValue(StoredData, Data);
+			}
 		}
-		ShadowDataOffset += PropertyInfo.Property->ElementSize;
 	}
 
 	return HandoverChanged;
@@ -1088,6 +1225,8 @@ FHandoverChangeState USpatialActorChannel::GetHandoverChangeList(TArray<uint8>&
 void USpatialActorChannel::SetChannelActor(AActor* InActor, ESetChannelActorFlags Flags)
 {
 	Super::SetChannelActor(InActor, Flags);
+	ReplicationCache.Invalidate();
+
 	USpatialPackageMapClient* PackageMap = NetDriver->PackageMap;
 	EntityId = PackageMap->GetEntityIdFromObject(InActor);
 
@@ -1144,6 +1283,9 @@ bool USpatialActorChannel::TryResolveActor()
 	// Inform USpatialNetDriver of this new actor channel/entity pairing
 	NetDriver->AddActorChannel(EntityId, this);
 
+	// Subobjects are resolved through the entity ID once it is known.
+	ReplicationCache.Invalidate();
+
 	return true;
 }
 
@@ -1175,6 +1317,25 @@ void USpatialActorChannel::PostReceiveSpatialUpdate(UObject* TargetObject, const
 	Replicator.CallRepNotifies(false);
 }
 
+const FSpatialConditionMapFilter& USpatialActorChannel::GetConditionMapFilter(bool bIsClient)
+{
+	if (!ConditionMapFilter.IsSet() || bConditionMapFilterIsClient != bIsClient)
+	{
+		ConditionMapFilter.Emplace(this, bIsClient);
+		bConditionMapFilterIsClient = bIsClient;
+		NumConditionMapFiltersBuilt++;
+		INC_DWORD_STAT(STAT_SpatialConditionMapFiltersBuilt);
+	}
+
+	return ConditionMapFilter.GetValue();
+}
+
+TArray<UProperty*>& USpatialActorChannel::GetRepNotifiesBuffer()
+{
+	RepNotifiesBuffer.Reset();
+	return RepNotifiesBuffer;
+}
+
 void USpatialActorChannel::OnCreateEntityResponse(const Worker_CreateEntityResponseOp& Op)
 {
 	check(NetDriver->GetNetMode() < NM_Client);
@@ -1414,6 +1575,7 @@ void USpatialActorChannel::ClientProcessOwnershipChange(bool bNewNetOwned)
 void USpatialActorChannel::OnSubobjectDeleted(const FUnrealObjectRef& ObjectRef, UObject* Object)
 {
 	CreateSubObjects.Remove(Object);
+	ReplicationCache.InvalidateSubobject(Object);
 
 	Receiver->MoveMappedObjectToUnmapped(ObjectRef);
 	if (FSpatialObjectRepState* SubObjectRefMap = ObjectReferenceMap.Find(Object))
@@ -1421,6 +1583,48 @@ void USpatialActorChannel::OnSubobjectDeleted(const FUnrealObjectRef& ObjectRef,
 		Receiver->CleanupRepStateMap(*SubObjectRefMap);
 		ObjectReferenceMap.Remove(Object);
 	}
+
+	for (auto It = FastArrayItemDeltaSenderStates.CreateIterator(); It; ++It)
+	{
+		if (It->Key.Key == Object || !It->Key.Key.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+	for (auto It = FastArrayItemDeltaReceiverStates.CreateIterator(); It; ++It)
+	{
+		if (It->Key.Key == Object || !It->Key.Key.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+bool USpatialActorChannel::IsLoadBalancingEligible()
+{
+	bool bEligible = false;
+	if (!ReplicationCache.FindLoadBalancingEligibility(NetDriver->LoadBalanceStrategy, bEligible))
+	{
+		bEligible = NetDriver->LoadBalanceStrategy != nullptr &&
+			NetDriver->StaticComponentView->HasAuthority(EntityId, SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID);
+		ReplicationCache.SetLoadBalancingEligibility(NetDriver->LoadBalanceStrategy, bEligible);
+	}
+
+	return bEligible;
+}
+
+SpatialGDK::FFastArrayItemDeltaSenderState& USpatialActorChannel::GetFastArrayItemDeltaSenderState(UObject* Object, uint16 Handle)
+{
+	const FFastArrayPropertyKey Key(Object, Handle);
+	FastArrayItemDeltaReceiverStates.Remove(Key);
+	return FastArrayItemDeltaSenderStates.FindOrAdd(Key);
+}
+
+SpatialGDK::FFastArrayItemDeltaReceiverState& USpatialActorChannel::GetFastArrayItemDeltaReceiverState(UObject* Object, uint16 Handle)
+{
+	const FFastArrayPropertyKey Key(Object, Handle);
+	FastArrayItemDeltaSenderStates.Remove(Key);
+	return FastArrayItemDeltaReceiverStates.FindOrAdd(Key);
 }
 
 void USpatialActorChannel::ResetShadowData(FRepLayout& RepLayout, FRepStateStaticBuffer& StaticBuffer, UObject* TargetObject)
@@ -50,6 +50,48 @@ bool FSpatialNetDeltaSerializeInfo::DeltaSerializeWrite(USpatialNetDriver* NetDr
 	return CppStructOps->NetDeltaSerialize(NetDeltaInfo, Source);
 }
 
+bool FSpatialNetDeltaSerializeInfo::NativeDeltaSerializeRead(USpatialNetDriver* NetDriver, FSpatialNetBitReader& Reader, void* FastArray, UScriptStruct* NetDeltaStruct)
+{
+	FSpatialNetDeltaSerializeInfo NetDeltaInfo;
+	NetDeltaInfo.bIsSpatialType = false;
+
+	SpatialFastArrayNetSerializeCB SerializeCB(NetDriver);
+
+	NetDeltaInfo.Reader = &Reader;
+	NetDeltaInfo.Map = Reader.PackageMap;
+	NetDeltaInfo.NetSerializeCB = &SerializeCB;
+
+	UScriptStruct::ICppStructOps* CppStructOps = NetDeltaStruct->GetCppStructOps();
+	check(CppStructOps);
+
+	return CppStructOps->NetDeltaSerialize(NetDeltaInfo, FastArray);
+}
+
+bool FSpatialNetDeltaSerializeInfo::NativeDeltaSerializeWrite(USpatialNetDriver* NetDriver, FSpatialNetBitWriter& Writer, void* FastArray, UScriptStruct* NetDeltaStruct, INetDeltaBaseState* OldState, TSharedPtr<INetDeltaBaseState>& OutNewState)
+{
+	FSpatialNetDeltaSerializeInfo NetDeltaInfo;
+	NetDeltaInfo.bIsSpatialType = false;
+
+	SpatialFastArrayNetSerializeCB SerializeCB(NetDriver);
+
+	NetDeltaInfo.Writer = &Writer;
+	NetDeltaInfo.Map = Writer.PackageMap;
+	NetDeltaInfo.NetSerializeCB = &SerializeCB;
+	NetDeltaInfo.OldState = OldState;
+	NetDeltaInfo.NewState = &OutNewState;
+
+	UScriptStruct::ICppStructOps* CppStructOps = NetDeltaStruct->GetCppStructOps();
+	check(CppStructOps);
+
+	return CppStructOps->NetDeltaSerialize(NetDeltaInfo, FastArray);
+}
+
+void SpatialFastArrayNetSerializeCB::NetSerializeStruct(FNetDeltaSerializeInfo& Params)
+{
+	FBitArchive& Ar = Params.Reader != nullptr ? static_cast<FBitArchive&>(*Params.Reader) : static_cast<FBitArchive&>(*Params.Writer);
+	NetSerializeStruct(CastChecked<UScriptStruct>(Params.Struct), Ar, Params.Map, Params.Data, Params.bOutHasMoreUnmapped);
+}
+
 void SpatialFastArrayNetSerializeCB::NetSerializeStruct(UScriptStruct* Struct, FBitArchive& Ar, UPackageMap* PackageMap, void* Data, bool& bHasUnmapped)
 {
 	// Check if struct has custom NetSerialize function, otherwise call standard struct replication
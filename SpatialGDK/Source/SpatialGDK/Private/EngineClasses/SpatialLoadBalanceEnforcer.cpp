@@ -9,10 +9,38 @@
 #include "SpatialCommonTypes.h"
 #include "SpatialGDKSettings.h"
 
+#include "Misc/Crc.h"
+
 DEFINE_LOG_CATEGORY(LogSpatialLoadBalanceEnforcer);
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("ACL Assignments Queued"), STAT_SpatialAclAssignmentsQueued, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("ACL Assignments Processed"), STAT_SpatialAclAssignmentsProcessed, STATGROUP_SpatialNet);
+
 using namespace SpatialGDK;
 
+namespace
+{
+
+struct WriteAclTemplateKey
+{
+	VirtualWorkerId OwningVirtualWorkerId;
+	// Sorted, so the same components give the same key whatever order they were added in.
+	TArray<Worker_ComponentId> ComponentIds;
+
+	bool operator==(const WriteAclTemplateKey& Other) const
+	{
+		return OwningVirtualWorkerId == Other.OwningVirtualWorkerId && ComponentIds == Other.ComponentIds;
+	}
+
+	friend uint32 GetTypeHash(const WriteAclTemplateKey& Key)
+	{
+		return HashCombine(::GetTypeHash(Key.OwningVirtualWorkerId),
+			FCrc::MemCrc32(Key.ComponentIds.GetData(), Key.ComponentIds.Num() * sizeof(Worker_ComponentId)));
+	}
+};
+
+} // anonymous namespace
+
 SpatialLoadBalanceEnforcer::SpatialLoadBalanceEnforcer(const PhysicalWorkerName& InWorkerId, const USpatialStaticComponentView* InStaticComponentView, const SpatialVirtualWorkerTranslator* InVirtualWorkerTranslator)
 	: WorkerId(InWorkerId)
 	, StaticComponentView(InStaticComponentView)
@@ -45,7 +73,7 @@ void SpatialLoadBalanceEnforcer::OnLoadBalancingComponentRemoved(const Worker_Re
 		UE_LOG(LogSpatialLoadBalanceEnforcer, Log,
 			TEXT("Component %d for entity %lld removed. Can no longer enforce the previous request for this entity."),
 			Op.component_id, Op.entity_id);
-		AclWriteAuthAssignmentRequests.Remove(Op.entity_id);
+		DequeueAclAssignmentRequest(Op.entity_id);
 	}
 }
 
@@ -55,7 +83,7 @@ void SpatialLoadBalanceEnforcer::OnEntityRemoved(const Worker_RemoveEntityOp& Op
 	{
 		UE_LOG(LogSpatialLoadBalanceEnforcer, Log, TEXT("Entity %lld removed. Can no longer enforce the previous request for this entity."),
 			Op.entity_id);
-		AclWriteAuthAssignmentRequests.Remove(Op.entity_id);
+		DequeueAclAssignmentRequest(Op.entity_id);
 	}
 }
 
@@ -71,7 +99,7 @@ void SpatialLoadBalanceEnforcer::OnAclAuthorityChanged(const Worker_AuthorityCha
 			UE_LOG(LogSpatialLoadBalanceEnforcer, Log,
 				TEXT("ACL authority lost for entity %lld. Can no longer enforce the previous request for this entity."),
 				AuthOp.entity_id);
-			AclWriteAuthAssignmentRequests.Remove(AuthOp.entity_id);
+			DequeueAclAssignmentRequest(AuthOp.entity_id);
 		}
 		return;
 	}
@@ -125,24 +153,44 @@ void SpatialLoadBalanceEnforcer::MaybeQueueAclAssignmentRequest(const Worker_Ent
 
 bool SpatialLoadBalanceEnforcer::AclAssignmentRequestIsQueued(const Worker_EntityId EntityId) const
 {
-	return AclWriteAuthAssignmentRequests.Contains(EntityId);
+	return QueuedAclAssignmentRequests.Contains(EntityId);
 }
 
-TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> SpatialLoadBalanceEnforcer::ProcessQueuedAclAssignmentRequests()
+int32 SpatialLoadBalanceEnforcer::GetNumQueuedAclAssignmentRequests() const
+{
+	return QueuedAclAssignmentRequests.Num();
+}
+
+TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> SpatialLoadBalanceEnforcer::ProcessQueuedAclAssignmentRequests(int32 MaxRequests)
 {
 	TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> PendingRequests;
 
-	TArray<Worker_EntityId> CompletedRequests;
-	CompletedRequests.Reserve(AclWriteAuthAssignmentRequests.Num());
+	// Mass authority transfers move many entities with the same components to the same worker, so their write ACLs are only built once.
+	TMap<WriteAclTemplateKey, TSharedRef<const WriteAclTemplate>> WriteAclTemplates;
 
-	for (Worker_EntityId EntityId : AclWriteAuthAssignmentRequests)
+	// Requests which can't be processed yet, which are queued again behind the others.
+	TArray<Worker_EntityId> DeferredRequests;
+
+	int32 NumConsumed = 0;
+	for (; NumConsumed < AclWriteAuthAssignmentRequests.Num(); NumConsumed++)
 	{
+		if (MaxRequests > 0 && PendingRequests.Num() >= MaxRequests)
+		{
+			break;
+		}
+
+		const Worker_EntityId EntityId = AclWriteAuthAssignmentRequests[NumConsumed];
+		if (QueuedAclAssignmentRequests.Remove(EntityId) == 0)
+		{
+			// Dequeued since it was queued, or a duplicate of an entry which was dequeued and queued again.
+			continue;
+		}
+
 		const SpatialGDK::AuthorityIntent* AuthorityIntentComponent = StaticComponentView->GetComponentData<SpatialGDK::AuthorityIntent>(EntityId);
 		if (AuthorityIntentComponent == nullptr)
 		{
 			// This happens if the authority intent component is removed in the same tick as a request is queued, but the request was not removed from the queue - shouldn't happen.
 			UE_LOG(LogSpatialLoadBalanceEnforcer, Error, TEXT("Cannot process entity as AuthIntent component has been removed since the request was queued. EntityId: %lld"), EntityId);
-			CompletedRequests.Add(EntityId);
 			continue;
 		}
 
@@ -151,7 +199,6 @@ TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> SpatialLoadBalanceE
 		{
 			// This happens if the NetOwningClientWorker component is removed in the same tick as a request is queued, but the request was not removed from the queue - shouldn't happen.
 			UE_LOG(LogSpatialLoadBalanceEnforcer, Error, TEXT("Cannot process entity as NetOwningClientWorker component has been removed since the request was queued. EntityId: %lld"), EntityId);
-			CompletedRequests.Add(EntityId);
 			continue;
 		}
 
@@ -160,14 +207,12 @@ TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> SpatialLoadBalanceE
 		{
 			// This happens if the ComponentPresence component is removed in the same tick as a request is queued, but the request was not removed from the queue - shouldn't happen.
 			UE_LOG(LogSpatialLoadBalanceEnforcer, Error, TEXT("Cannot process entity as ComponentPresence component has been removed since the request was queued. EntityId: %lld"), EntityId);
-			CompletedRequests.Add(EntityId);
 			continue;
 		}
 
 		if (AuthorityIntentComponent->VirtualWorkerId == SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
 		{
 			UE_LOG(LogSpatialLoadBalanceEnforcer, Warning, TEXT("Entity with invalid virtual worker ID assignment will not be processed. EntityId: %lld. This should not happen - investigate if you see this warning."), EntityId);
-			CompletedRequests.Add(EntityId);
 			continue;
 		}
 
@@ -176,6 +221,7 @@ TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> SpatialLoadBalanceE
 		if (DestinationWorkerId == nullptr)
 		{
 			UE_LOG(LogSpatialLoadBalanceEnforcer, Error, TEXT("This worker is not assigned a virtual worker. This shouldn't happen! Worker: %s"), *WorkerId);
+			DeferredRequests.Add(EntityId);
 			continue;
 		}
 
@@ -183,19 +229,30 @@ TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> SpatialLoadBalanceE
 		{
 			UE_LOG(LogSpatialLoadBalanceEnforcer, Log, TEXT("Failed to update the EntityACL to match the authority intent; this worker lost authority over the EntityACL since the request was queued."
 				" Source worker ID: %s. Entity ID %lld. Desination worker ID: %s."), *WorkerId, EntityId, **DestinationWorkerId);
-			CompletedRequests.Add(EntityId);
 			continue;
 		}
 
-		TArray<Worker_ComponentId> ComponentIds;
+		WriteAclTemplateKey TemplateKey{ AuthorityIntentComponent->VirtualWorkerId, {} };
 
 		EntityAcl* Acl = StaticComponentView->GetComponentData<EntityAcl>(EntityId);
-		Acl->ComponentWriteAcl.GetKeys(ComponentIds);
+		TemplateKey.ComponentIds.Reserve(Acl->ComponentWriteAcl.Num() + ComponentPresenceComponent->ComponentList.Num());
+		Acl->ComponentWriteAcl.GetKeys(TemplateKey.ComponentIds);
 
 		// Ensure that every component ID in ComponentPresence is set in the write ACL.
-		for (const auto& RequiredComponentId : ComponentPresenceComponent->ComponentList)
+		TemplateKey.ComponentIds.Append(ComponentPresenceComponent->ComponentList);
+		TemplateKey.ComponentIds.Sort();
+		for (int32 Index = TemplateKey.ComponentIds.Num() - 1; Index > 0; Index--)
+		{
+			if (TemplateKey.ComponentIds[Index] == TemplateKey.ComponentIds[Index - 1])
+			{
+				TemplateKey.ComponentIds.RemoveAt(Index, 1, false);
+			}
+		}
+
+		TSharedRef<const WriteAclTemplate>* Template = WriteAclTemplates.Find(TemplateKey);
+		if (Template == nullptr)
 		{
-			ComponentIds.AddUnique(RequiredComponentId);
+			Template = &WriteAclTemplates.Add(TemplateKey, CreateWriteAclTemplate(*DestinationWorkerId, TemplateKey.ComponentIds));
 		}
 
 		// Get the client worker ID net-owning this Actor from the NetOwningClientWorker.
@@ -209,13 +266,22 @@ TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> SpatialLoadBalanceE
 				*DestinationWorkerId,
 				Acl->ReadAcl,
 				{ { PossessingClientId } },
-				ComponentIds
+				MoveTemp(TemplateKey.ComponentIds),
+				*Template
 			});
+	}
+
+	AclWriteAuthAssignmentRequests.RemoveAt(0, NumConsumed, false);
 
-		CompletedRequests.Add(EntityId);
+	for (Worker_EntityId EntityId : DeferredRequests)
+	{
+		QueueAclAssignmentRequest(EntityId);
 	}
 
-	AclWriteAuthAssignmentRequests.RemoveAll([CompletedRequests](const Worker_EntityId& EntityId) { return CompletedRequests.Contains(EntityId); });
+	NumWriteAclTemplatesBuiltLastProcess = WriteAclTemplates.Num();
+
+	INC_DWORD_STAT_BY(STAT_SpatialAclAssignmentsProcessed, PendingRequests.Num());
+	SET_DWORD_STAT(STAT_SpatialAclAssignmentsQueued, QueuedAclAssignmentRequests.Num());
 
 	return PendingRequests;
 }
@@ -223,9 +289,48 @@ TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> SpatialLoadBalanceE
 void SpatialLoadBalanceEnforcer::QueueAclAssignmentRequest(const Worker_EntityId EntityId)
 {
 	UE_LOG(LogSpatialLoadBalanceEnforcer, Verbose, TEXT("Queueing ACL assignment request for entity %lld on worker %s."), EntityId, *WorkerId);
+	QueuedAclAssignmentRequests.Add(EntityId);
 	AclWriteAuthAssignmentRequests.Add(EntityId);
 }
 
+void SpatialLoadBalanceEnforcer::DequeueAclAssignmentRequest(const Worker_EntityId EntityId)
+{
+	QueuedAclAssignmentRequests.Remove(EntityId);
+
+	if (QueuedAclAssignmentRequests.Num() == 0)
+	{
+		AclWriteAuthAssignmentRequests.Reset();
+	}
+}
+
+TSharedRef<const SpatialLoadBalanceEnforcer::WriteAclTemplate> SpatialLoadBalanceEnforcer::CreateWriteAclTemplate(const PhysicalWorkerName& OwningWorkerId, const TArray<Worker_ComponentId>& ComponentIds)
+{
+	TSharedRef<WriteAclTemplate> Template = MakeShared<WriteAclTemplate>();
+
+	const WorkerRequirementSet OwningServerWorkerRequirementSet = { { FString::Printf(TEXT("workerId:%s"), *OwningWorkerId) } };
+	const Worker_ComponentId ClientAuthorityComponentId = SpatialConstants::GetClientAuthorityComponent(GetDefault<USpatialGDKSettings>()->UseRPCRingBuffer());
+
+	Template->ServerWriteAcl.Reserve(ComponentIds.Num());
+	for (const Worker_ComponentId ComponentId : ComponentIds)
+	{
+		if (ComponentId == SpatialConstants::HEARTBEAT_COMPONENT_ID || ComponentId == ClientAuthorityComponentId)
+		{
+			Template->OwningClientComponentIds.Add(ComponentId);
+			continue;
+		}
+
+		if (ComponentId == SpatialConstants::ENTITY_ACL_COMPONENT_ID)
+		{
+			Template->ServerWriteAcl.Add(ComponentId, { SpatialConstants::UnrealServerAttributeSet });
+			continue;
+		}
+
+		Template->ServerWriteAcl.Add(ComponentId, OwningServerWorkerRequirementSet);
+	}
+
+	return Template;
+}
+
 bool SpatialLoadBalanceEnforcer::CanEnforce(Worker_EntityId EntityId) const
 {
 	// We need to be able to see the ACL component
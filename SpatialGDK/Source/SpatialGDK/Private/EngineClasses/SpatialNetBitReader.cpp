@@ -9,26 +9,57 @@
 
 DEFINE_LOG_CATEGORY(LogSpatialNetBitReader);
 
-FSpatialNetBitReader::FSpatialNetBitReader(USpatialPackageMapClient* InPackageMap, uint8* Source, int64 CountBits, TSet<FUnrealObjectRef>& InDynamicRefs, TSet<FUnrealObjectRef>& InUnresolvedRefs)
-	: FNetBitReader(InPackageMap, Source, CountBits)
+FSpatialNetBitReader::FSpatialNetBitReader(USpatialPackageMapClient* InPackageMap, const uint8* Source, int64 CountBits, TSet<FUnrealObjectRef>& InDynamicRefs, TSet<FUnrealObjectRef>& InUnresolvedRefs)
+	// FBitReader copies the source into its own buffer, so it is safe to read from views into schema-owned memory.
+	: FNetBitReader(InPackageMap, const_cast<uint8*>(Source), CountBits)
 	, DynamicRefs(InDynamicRefs)
 	, UnresolvedRefs(InUnresolvedRefs) {}
 
+uint64 FSpatialNetBitReader::DeserializeVarint()
+{
+	uint64 Value = 0;
+	for (int32 Shift = 0; Shift < 64 && !IsError(); Shift += 7)
+	{
+		uint8 Byte = 0;
+		*this << Byte;
+		Value |= static_cast<uint64>(Byte & 0x7F) << Shift;
+		if ((Byte & 0x80) == 0)
+		{
+			break;
+		}
+	}
+
+	return Value;
+}
+
 void FSpatialNetBitReader::DeserializeObjectRef(FUnrealObjectRef& ObjectRef)
 {
-	int64 EntityId;
-	*this << EntityId;
-	ObjectRef.Entity = EntityId;
-	*this << ObjectRef.Offset;
+	ObjectRef.Entity = static_cast<Worker_EntityId>(DeserializeVarint());
+	ObjectRef.Offset = static_cast<uint32>(DeserializeVarint());
 
 	uint8 HasPath;
 	SerializeBits(&HasPath, 1);
 	if (HasPath)
 	{
-		FString Path;
-		*this << Path;
-
-		ObjectRef.Path = Path;
+		const uint64 PathIndex = DeserializeVarint();
+		if (PathIndex == 0)
+		{
+			FString Path;
+			*this << Path;
+
+			Paths.Add(Path);
+			ObjectRef.Path = MoveTemp(Path);
+		}
+		else if (PathIndex <= static_cast<uint64>(Paths.Num()))
+		{
+			ObjectRef.Path = Paths[PathIndex - 1];
+		}
+		else
+		{
+			UE_LOG(LogSpatialNetBitReader, Error, TEXT("DeserializeObjectRef: Path index %llu is out of range, only %d paths have been read."), PathIndex, Paths.Num());
+			SetError();
+			return;
+		}
 	}
 
 	uint8 HasOuter;
@@ -12,21 +12,47 @@
 
 DEFINE_LOG_CATEGORY(LogSpatialNetSerialize);
 
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("ObjectRef Bits Written"), STAT_SpatialObjectRefBitsWritten, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("ObjectRef Bits Saved"), STAT_SpatialObjectRefBitsSaved, STATGROUP_SpatialNet);
+
 FSpatialNetBitWriter::FSpatialNetBitWriter(USpatialPackageMapClient* InPackageMap)
 	: FNetBitWriter(InPackageMap, 0)
 {}
 
+void FSpatialNetBitWriter::SerializeVarint(uint64 Value)
+{
+	do
+	{
+		uint8 Byte = Value & 0x7F;
+		Value >>= 7;
+		if (Value != 0)
+		{
+			Byte |= 0x80;
+		}
+		*this << Byte;
+	} while (Value != 0);
+}
+
 void FSpatialNetBitWriter::SerializeObjectRef(FUnrealObjectRef& ObjectRef)
 {
-	int64 EntityId = ObjectRef.Entity;
-	*this << EntityId;
-	*this << ObjectRef.Offset;
+	SerializeVarint(static_cast<uint64>(ObjectRef.Entity));
+	SerializeVarint(ObjectRef.Offset);
 
 	uint8 HasPath = ObjectRef.Path.IsSet();
 	SerializeBits(&HasPath, 1);
 	if (HasPath)
 	{
-		*this << ObjectRef.Path.GetValue();
+		// Index 0 means the path follows inline, otherwise it refers to a path already written to this buffer.
+		if (const uint32* PathIndex = PathIndices.Find(ObjectRef.Path.GetValue()))
+		{
+			SerializeVarint(*PathIndex);
+		}
+		else
+		{
+			SerializeVarint(0);
+			*this << ObjectRef.Path.GetValue();
+			PathIndices.Add(ObjectRef.Path.GetValue(), PathIndices.Num() + 1);
+		}
 	}
 
 	uint8 HasOuter = ObjectRef.Outer.IsSet();
@@ -40,10 +66,37 @@ void FSpatialNetBitWriter::SerializeObjectRef(FUnrealObjectRef& ObjectRef)
 	SerializeBits(&ObjectRef.bUseClassPathToLoadObject, 1);
 }
 
+int64 FSpatialNetBitWriter::GetUncompressedObjectRefBits(const FUnrealObjectRef& ObjectRef)
+{
+	// Entity ID, offset, the has-path, has-outer, no-load-on-client and use-class-path flags.
+	int64 NumBits = (sizeof(int64) + sizeof(uint32)) * CHAR_BIT + 4;
+
+	if (ObjectRef.Path.IsSet())
+	{
+		// Matches FString serialization: length prefix plus null-terminated ANSI or UCS-2 characters.
+		const FString& Path = ObjectRef.Path.GetValue();
+		const int32 CharSize = FCString::IsPureAnsi(*Path) ? sizeof(ANSICHAR) : sizeof(UCS2CHAR);
+		NumBits += (sizeof(int32) + (Path.Len() + 1) * CharSize) * CHAR_BIT;
+	}
+
+	if (ObjectRef.Outer.IsSet())
+	{
+		NumBits += GetUncompressedObjectRefBits(*ObjectRef.Outer);
+	}
+
+	return NumBits;
+}
+
 FArchive& FSpatialNetBitWriter::operator<<(UObject*& Value)
 {
 	FUnrealObjectRef ObjectRef = FUnrealObjectRef::FromObjectPtr(Value, Cast<USpatialPackageMapClient>(PackageMap));
+
+	const int64 NumBitsStart = GetNumBits();
 	SerializeObjectRef(ObjectRef);
+	const int64 NumBitsWritten = GetNumBits() - NumBitsStart;
+
+	INC_DWORD_STAT_BY(STAT_SpatialObjectRefBitsWritten, NumBitsWritten);
+	INC_DWORD_STAT_BY(STAT_SpatialObjectRefBitsSaved, FMath::Max<int64>(GetUncompressedObjectRefBits(ObjectRef) - NumBitsWritten, 0));
 
 	return *this;
 }
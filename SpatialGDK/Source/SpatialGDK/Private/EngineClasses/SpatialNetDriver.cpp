@@ -65,8 +65,10 @@ DEFINE_LOG_CATEGORY(LogSpatialOSNetDriver);
 DECLARE_CYCLE_STAT(TEXT("ServerReplicateActors"), STAT_SpatialServerReplicateActors, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("ProcessPrioritizedActors"), STAT_SpatialProcessPrioritizedActors, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("PrioritizeActors"), STAT_SpatialPrioritizeActors, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("ProcessDormancyWakeUps"), STAT_SpatialProcessDormancyWakeUps, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("ProcessOps"), STAT_SpatialProcessOps, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("UpdateAuthority"), STAT_SpatialUpdateAuthority, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("HandoverPrefetch"), STAT_SpatialHandoverPrefetch, STATGROUP_SpatialNet);
 DEFINE_STAT(STAT_SpatialConsiderList);
 DEFINE_STAT(STAT_SpatialActorsRelevant);
 DEFINE_STAT(STAT_SpatialActorsChanged);
@@ -84,6 +86,9 @@ USpatialNetDriver::USpatialNetDriver(const FObjectInitializer& ObjectInitializer
 	, SessionId(0)
 	, NextRPCIndex(0)
 	, TimeWhenPositionLastUpdated(0.f)
+	, TimeWhenLoadLastReported(0.f)
+	, AppliedPartitionVersion(0)
+	, TimeWhenHandoverPrefetchLastEvaluated(0.f)
 {
 	// Due to changes in 4.23, we now use an outdated flow in ComponentReader::ApplySchemaObject
 	// Native Unreal now iterates over all commands on clients, and no longer has access to a BaseHandleToCmdIndex
@@ -392,9 +397,12 @@ void USpatialNetDriver::CreateAndInitializeCoreClasses()
 
 	if (SpatialSettings->UseRPCRingBuffer())
 	{
-		RPCService = MakeUnique<SpatialGDK::SpatialRPCService>(ExtractRPCDelegate::CreateUObject(Receiver, &USpatialReceiver::OnExtractIncomingRPC), StaticComponentView, USpatialLatencyTracer::GetTracer(GetWorld()));
+		RPCService = MakeUnique<SpatialGDK::SpatialRPCService>(ExtractRPCDelegate::CreateUObject(Receiver, &USpatialReceiver::OnExtractIncomingRPC), StaticComponentView, USpatialLatencyTracer::GetTracer(GetWorld()),
+			SpatialSettings->bBundleMulticastRPCs);
 	}
 
+	DormancyWakeUpQueue.SetTimeBudget(SpatialSettings->DormancyWakeUpTimeBudgetMS / 1000.0f);
+
 	Dispatcher->Init(Receiver, StaticComponentView, SpatialMetrics, SpatialWorkerFlags);
 	Sender->Init(this, &TimerManager, RPCService.Get());
 	Receiver->Init(this, &TimerManager, RPCService.Get());
@@ -425,7 +433,9 @@ void USpatialNetDriver::CreateAndInitializeLoadBalancingClasses()
 	const ASpatialWorldSettings* WorldSettings = GetWorld() ? Cast<ASpatialWorldSettings>(GetWorld()->GetWorldSettings()) : nullptr;
 	if (IsServer())
 	{
-		LoadBalanceStrategy = NewObject<ULayeredLBStrategy>(this);
+		ULayeredLBStrategy* LayeredLBStrategy = NewObject<ULayeredLBStrategy>(this);
+		LayeredLBStrategy->SetClassInfoManager(ClassInfoManager);
+		LoadBalanceStrategy = LayeredLBStrategy;
 		LoadBalanceStrategy->Init();
 		LoadBalanceStrategy->SetVirtualWorkerIds(1, LoadBalanceStrategy->GetMinimumRequiredWorkers());
 	}
@@ -435,6 +445,7 @@ void USpatialNetDriver::CreateAndInitializeLoadBalancingClasses()
 	if (IsServer())
 	{
 		LoadBalanceEnforcer = MakeUnique<SpatialLoadBalanceEnforcer>(Connection->GetWorkerId(), StaticComponentView, VirtualWorkerTranslator.Get());
+		VirtualWorkerRoutingTable = MakeUnique<SpatialVirtualWorkerRoutingTable>(VirtualWorkerTranslator.Get());
 
 		const bool bIsMultiWorkerEnabled = WorldSettings != nullptr && WorldSettings->IsMultiWorkerEnabled();
 		if (!bIsMultiWorkerEnabled)
@@ -897,6 +908,8 @@ void USpatialNetDriver::NotifyActorDestroyed(AActor* ThisActor, bool IsSeamlessT
 	// Remove the actor from the property tracker map
 	RepChangedPropertyTrackerMap.Remove(ThisActor);
 
+	DormancyWakeUpQueue.Remove(ThisActor);
+
 	const bool bIsServer = ServerConnection == nullptr;
 	if (bIsServer)
 	{
@@ -1195,6 +1208,14 @@ int32 USpatialNetDriver::ServerReplicateActors_PrioritizeActors(UNetConnection*
 				Channel->StartBecomingDormant();
 			}
 
+			// SpatialGDK - The first replication of an actor woken from dormancy serializes all of its state, so it's
+			// staged and replicated within the dormancy wake up time budget instead.
+			if (DormancyWakeUpQueue.IsEnabled() && IsWakingFromDormancy(Actor, Channel))
+			{
+				StageDormancyWakeUp(Actor, ConnectionViewers);
+				continue;
+			}
+
 			UE_LOG(LogSpatialOSNetDriver, Verbose, TEXT("Actor %s will be replicated on the catch-all connection"), *Actor->GetName());
 
 			// Check actor relevancy if Net Relevancy is enabled in the GDK settings
@@ -1421,6 +1442,11 @@ void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConne
 		}
 	}
 
+	// SpatialGDK - Actors woken from dormancy are replicated within what's left of the same rate limits.
+	int32 EntitiesToCreateLeft = MaxEntitiesToCreate - FinalCreationCount;
+	int32 ActorsToReplicateLeft = MaxActorsToReplicate - FinalReplicatedCount;
+	ProcessDormancyWakeUps(InConnection, EntitiesToCreateLeft, ActorsToReplicateLeft, OutUpdated);
+
 	SET_DWORD_STAT(STAT_SpatialActorsRelevant, ActorUpdatesThisConnection);
 	SET_DWORD_STAT(STAT_SpatialActorsChanged, ActorUpdatesThisConnectionSent);
 
@@ -1428,6 +1454,76 @@ void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConne
 	// In Spatial we use ActorReplicationRateLimit and EntityCreationRateLimit to limit replication so this return value is not relevant.
 }
 
+bool USpatialNetDriver::IsWakingFromDormancy(AActor* Actor, UActorChannel* Channel)
+{
+	// A dormant actor's channel is closed, but its entity is kept until it wakes up and a new channel is opened for it.
+	if (Channel != nullptr || !Actor->HasAuthority())
+	{
+		return false;
+	}
+
+	const Worker_EntityId EntityId = PackageMap->GetEntityIdFromObject(Actor);
+	return EntityId != SpatialConstants::INVALID_ENTITY_ID && IsDormantEntity(EntityId);
+}
+
+void USpatialNetDriver::StageDormancyWakeUp(AActor* Actor, const TArray<FNetViewer>& ConnectionViewers)
+{
+	bool bRelevantToClients = false;
+	float DistanceSqToNearestViewer = MAX_flt;
+
+	const FVector ActorLocation = Actor->GetActorLocation();
+	for (const FNetViewer& Viewer : ConnectionViewers)
+	{
+		bRelevantToClients = bRelevantToClients || Actor->IsNetRelevantFor(Viewer.InViewer, Viewer.ViewTarget, Viewer.ViewLocation);
+		DistanceSqToNearestViewer = FMath::Min(DistanceSqToNearestViewer, FVector::DistSquared(ActorLocation, Viewer.ViewLocation));
+	}
+
+	DormancyWakeUpQueue.Stage(Actor, bRelevantToClients, DistanceSqToNearestViewer);
+}
+
+void USpatialNetDriver::ProcessDormancyWakeUps(UNetConnection* InConnection, int32& InOutEntitiesToCreateLeft, int32& InOutActorsToReplicateLeft, int32& OutUpdated)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SpatialProcessDormancyWakeUps);
+
+	const int32 MaxActors = static_cast<int32>(FMath::Min<int64>(static_cast<int64>(InOutEntitiesToCreateLeft) + InOutActorsToReplicateLeft, MAX_int32));
+
+	OutUpdated += DormancyWakeUpQueue.Process(MaxActors, [this, InConnection, &InOutEntitiesToCreateLeft, &InOutActorsToReplicateLeft](AActor* Actor)
+	{
+		// Like any other actor without a channel, a woken actor uses up entity creation rate before actor replication rate.
+		if (InOutEntitiesToCreateLeft > 0)
+		{
+			InOutEntitiesToCreateLeft--;
+		}
+		else
+		{
+			InOutActorsToReplicateLeft--;
+		}
+
+		// The actor may have gone dormant again, or lost authority, since it was staged.
+		const TSharedPtr<FNetworkObjectInfo>* ActorInfo = GetNetworkObjectList().Find(Actor);
+		if (ActorInfo == nullptr || IsActorDormant(ActorInfo->Get(), InConnection) || !IsWakingFromDormancy(Actor, InConnection->ActorChannelMap().FindRef(Actor)))
+		{
+			return false;
+		}
+
+		USpatialActorChannel* Channel = GetOrCreateSpatialActorChannel(Actor);
+		if (Channel == nullptr)
+		{
+			return false;
+		}
+
+		Channel->RelevantTime = Time + 0.5f * FMath::SRand();
+
+		if (!Channel->ReplicateActor())
+		{
+			return false;
+		}
+
+		(*ActorInfo)->LastNetReplicateTime = World->TimeSeconds;
+		return true;
+	});
+}
+
 #endif // WITH_SERVER_CODE
 
 void USpatialNetDriver::ProcessRPC(AActor* Actor, UObject* SubObject, UFunction* Function, void* Parameters)
@@ -1638,14 +1734,100 @@ void USpatialNetDriver::TickDispatch(float DeltaTime)
 		if (LoadBalanceEnforcer.IsValid())
 		{
 			SCOPE_CYCLE_COUNTER(STAT_SpatialUpdateAuthority);
-			for (const auto& AclAssignmentRequest : LoadBalanceEnforcer->ProcessQueuedAclAssignmentRequests())
+			for (const auto& AclAssignmentRequest : LoadBalanceEnforcer->ProcessQueuedAclAssignmentRequests(SpatialGDKSettings->AclAssignmentRateLimit))
 			{
 				Sender->SetAclWriteAuthority(AclAssignmentRequest);
 			}
 		}
+
+		if (IsServer() && LoadBalanceStrategy != nullptr && LoadBalanceStrategy->IsReady())
+		{
+			TickLoadBalancingPartition();
+			TickHandoverPrefetch();
+		}
+	}
+}
+
+void USpatialNetDriver::TickLoadBalancingPartition()
+{
+	const float RebalanceInterval = LoadBalanceStrategy->GetRebalanceInterval();
+	if (RebalanceInterval > 0.f && (Time - TimeWhenLoadLastReported) >= RebalanceInterval)
+	{
+		TimeWhenLoadLastReported = Time;
+		Sender->UpdateServerWorkerEntityLoad(GetLocalWorkerLoad());
+
+		// Only the worker authoritative over the virtual worker translation has a manager, and rebalances.
+		if (VirtualWorkerTranslationManager.IsValid())
+		{
+			VirtualWorkerTranslationManager->RebalanceFromReportedLoads();
+		}
+	}
+
+	// The partition changed, so the region this worker is interested in did too.
+	const uint32 PartitionVersion = LoadBalanceStrategy->GetPartitionVersion();
+	if (PartitionVersion != AppliedPartitionVersion)
+	{
+		AppliedPartitionVersion = PartitionVersion;
+		Sender->UpdateServerWorkerEntityInterestAndPosition();
+	}
+}
+
+void USpatialNetDriver::TickHandoverPrefetch()
+{
+	// Predictions are made this many times over the lookahead, so an Actor is found well before it arrives.
+	constexpr float EvaluationsPerLookahead = 4.f;
+
+	const float LookaheadSeconds = GetDefault<USpatialGDKSettings>()->HandoverPrefetchLookaheadSeconds;
+	if (LookaheadSeconds <= 0.f || (Time - TimeWhenHandoverPrefetchLastEvaluated) < LookaheadSeconds / EvaluationsPerLookahead)
+	{
+		return;
+	}
+	TimeWhenHandoverPrefetchLastEvaluated = Time;
+
+	SCOPE_CYCLE_COUNTER(STAT_SpatialHandoverPrefetch);
+
+	const VirtualWorkerId LocalVirtualWorkerId = LoadBalanceStrategy->GetLocalVirtualWorkerId();
+	for (const TPair<Worker_EntityId_Key, USpatialActorChannel*>& EntityChannelPair : EntityToActorChannel)
+	{
+		USpatialActorChannel* Channel = EntityChannelPair.Value;
+		if (Channel == nullptr || Channel->Actor == nullptr || Channel->IsAuthoritativeServer())
+		{
+			continue;
+		}
+
+		if (LoadBalanceStrategy->PredictWhoShouldHaveAuthority(*Channel->Actor, LookaheadSeconds) == LocalVirtualWorkerId)
+		{
+			Channel->PrewarmForAuthority();
+		}
+		else if (Channel->IsPrewarmedForAuthority())
+		{
+			// The Actor turned away, so it shouldn't be forced to replicate if authority arrives anyway.
+			Channel->CancelPrewarmForAuthority();
+		}
 	}
 }
 
+float USpatialNetDriver::GetLocalWorkerLoad() const
+{
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	if (SpatialMetrics != nullptr && SpatialGDKSettings->bEnableMetrics)
+	{
+		return static_cast<float>(SpatialMetrics->GetWorkerLoad());
+	}
+
+	// Without metrics, the number of replicated Actors this worker is authoritative over stands in for its load.
+	int32 NumAuthoritativeActors = 0;
+	for (const TSharedPtr<FNetworkObjectInfo>& ObjectInfo : GetNetworkObjectList().GetActiveObjects())
+	{
+		const AActor* Actor = ObjectInfo->Actor;
+		if (Actor != nullptr && Actor->HasAuthority())
+		{
+			NumAuthoritativeActors++;
+		}
+	}
+	return static_cast<float>(NumAuthoritativeActors);
+}
+
 void USpatialNetDriver::ProcessRemoteFunction(
 	AActor* Actor,
 	UFunction* Function,
@@ -1778,6 +1960,11 @@ void USpatialNetDriver::TickFlush(float DeltaTime)
 		}
 		LastUpdateCount = Updated;
 
+		if (SpatialGDKSettings->bBatchSpatialEntityCreation && Sender != nullptr)
+		{
+			Sender->FlushEntityCreations();
+		}
+
 		if (SpatialGDKSettings->bBatchSpatialPositionUpdates && Sender != nullptr)
 		{
 			if ((Time - TimeWhenPositionLastUpdated) >= (1.0f / SpatialGDKSettings->PositionUpdateFrequency))
@@ -2618,4 +2805,5 @@ void USpatialNetDriver::InitializeVirtualWorkerTranslationManager()
 {
 	VirtualWorkerTranslationManager = MakeUnique<SpatialVirtualWorkerTranslationManager>(Receiver, Connection, VirtualWorkerTranslator.Get());
 	VirtualWorkerTranslationManager->SetNumberOfVirtualWorkers(LoadBalanceStrategy->GetMinimumRequiredWorkers());
+	VirtualWorkerTranslationManager->SetLoadBalanceStrategy(LoadBalanceStrategy);
 }
@@ -0,0 +1,68 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "EngineClasses/SpatialVirtualWorkerRoutingTable.h"
+
+#include "EngineClasses/SpatialVirtualWorkerTranslator.h"
+#include "SpatialConstants.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Virtual Worker Routing Lookups"), STAT_SpatialVirtualWorkerRoutingLookups, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Virtual Worker Stale Route Retries"), STAT_SpatialVirtualWorkerStaleRouteRetries, STATGROUP_SpatialNet);
+
+SpatialVirtualWorkerRoutingTable::SpatialVirtualWorkerRoutingTable(SpatialVirtualWorkerTranslator* InTranslator)
+	: Translator(InTranslator)
+	, NumLookups(0)
+	, NumStaleRouteRetries(0)
+{
+	check(Translator != nullptr);
+	MappingChangedHandle = Translator->OnVirtualWorkerMappingChanged.AddRaw(this, &SpatialVirtualWorkerRoutingTable::UpdateRoute);
+}
+
+SpatialVirtualWorkerRoutingTable::~SpatialVirtualWorkerRoutingTable()
+{
+	Translator->OnVirtualWorkerMappingChanged.Remove(MappingChangedHandle);
+}
+
+const VirtualWorkerRoute* SpatialVirtualWorkerRoutingTable::FindRoute(VirtualWorkerId Id)
+{
+	NumLookups++;
+	INC_DWORD_STAT(STAT_SpatialVirtualWorkerRoutingLookups);
+
+	if (const VirtualWorkerRoute* Route = Routes.Find(Id))
+	{
+		return Route;
+	}
+
+	// The mapping may have been applied before this table was created.
+	UpdateRoute(Id);
+	return Routes.Find(Id);
+}
+
+Worker_EntityId SpatialVirtualWorkerRoutingTable::GetServerWorkerEntity(VirtualWorkerId Id)
+{
+	const VirtualWorkerRoute* Route = FindRoute(Id);
+	return Route != nullptr ? Route->ServerWorkerEntityId : SpatialConstants::INVALID_ENTITY_ID;
+}
+
+Worker_EntityId SpatialVirtualWorkerRoutingTable::GetServerWorkerEntityForRetry(VirtualWorkerId Id, Worker_EntityId SentToServerWorkerEntityId)
+{
+	const Worker_EntityId ServerWorkerEntityId = GetServerWorkerEntity(Id);
+	if (ServerWorkerEntityId != SentToServerWorkerEntityId)
+	{
+		NumStaleRouteRetries++;
+		INC_DWORD_STAT(STAT_SpatialVirtualWorkerStaleRouteRetries);
+	}
+
+	return ServerWorkerEntityId;
+}
+
+void SpatialVirtualWorkerRoutingTable::UpdateRoute(VirtualWorkerId Id)
+{
+	const PhysicalWorkerName* PhysicalWorker = Translator->GetPhysicalWorkerForVirtualWorker(Id);
+	if (PhysicalWorker == nullptr)
+	{
+		Routes.Remove(Id);
+		return;
+	}
+
+	Routes.Add(Id, VirtualWorkerRoute{ *PhysicalWorker, Translator->GetServerWorkerEntityForVirtualWorker(Id) });
+}
@@ -4,6 +4,7 @@
 #include "EngineClasses/SpatialVirtualWorkerTranslator.h"
 #include "Interop/Connection/SpatialWorkerConnection.h"
 #include "Interop/SpatialOSDispatcherInterface.h"
+#include "LoadBalancing/AbstractLBStrategy.h"
 #include "SpatialConstants.h"
 #include "Utils/SchemaUtils.h"
 
@@ -16,6 +17,8 @@ SpatialVirtualWorkerTranslationManager::SpatialVirtualWorkerTranslationManager(
 	: Receiver(InReceiver)
 	, Connection(InConnection)
 	, Translator(InTranslator)
+	, MappingVersion(0)
+	, SnapshotVersion(0)
 	, bWorkerEntityQueryInFlight(false)
 {}
 
@@ -45,6 +48,14 @@ void SpatialVirtualWorkerTranslationManager::AuthorityChanged(const Worker_Autho
 
 	UE_LOG(LogSpatialVirtualWorkerTranslationManager, Log, TEXT("This worker now has authority over the VirtualWorker translation."));
 
+	// Carry on from the version this worker's translator last applied, so other workers don't take the mapping this
+	// manager publishes as stale, and publish it as a new snapshot.
+	if (Translator != nullptr)
+	{
+		MappingVersion = FMath::Max(MappingVersion, Translator->GetMappingVersion());
+	}
+	SnapshotVersion = 0;
+
 	// TODO(zoning): The prototype had an unassigned workers list. Need to follow up with Tim/Chris about whether
 	// that is necessary or we can continue to use the (possibly) stale list until we receive the query response.
 
@@ -53,15 +64,55 @@ void SpatialVirtualWorkerTranslationManager::AuthorityChanged(const Worker_Autho
 	QueryForServerWorkerEntities();
 }
 
-// For each entry in the map, write a VirtualWorkerMapping type object to the Schema object.
-void SpatialVirtualWorkerTranslationManager::WriteMappingToSchema(Schema_Object* Object) const
+// Updates replace the whole list of changes, so it grows with every entry changed since the last snapshot. Once that is most
+// of the mapping, a new snapshot is no bigger, and empties the list of changes.
+bool SpatialVirtualWorkerTranslationManager::ShouldWriteSnapshot() const
 {
+	if (SnapshotVersion == 0)
+	{
+		return true;
+	}
+
+	int32 NumChangedSinceSnapshot = 0;
+	for (const auto& Entry : EntryVersions)
+	{
+		if (Entry.Value > SnapshotVersion)
+		{
+			NumChangedSinceSnapshot++;
+		}
+	}
+
+	return NumChangedSinceSnapshot * 2 > VirtualToPhysicalWorkerMapping.Num();
+}
+
+// For each entry in the snapshot, or changed since it, write a VirtualWorkerMapping type object to the Schema object.
+void SpatialVirtualWorkerTranslationManager::WriteMappingToSchema(Schema_Object* Object, bool bWriteSnapshot) const
+{
+	Schema_AddUint32(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_VERSION_ID, MappingVersion);
+	if (bWriteSnapshot)
+	{
+		Schema_AddUint32(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_SNAPSHOT_VERSION_ID, MappingVersion);
+	}
+
+	const Schema_FieldId FieldId = bWriteSnapshot ? SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_ID : SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_CHANGES_ID;
 	for (const auto& Entry : VirtualToPhysicalWorkerMapping)
 	{
-		Schema_Object* EntryObject = Schema_AddObject(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_ID);
+		const uint32 EntryVersion = EntryVersions.FindRef(Entry.Key);
+		if (!bWriteSnapshot && EntryVersion <= SnapshotVersion)
+		{
+			continue;
+		}
+
+		Schema_Object* EntryObject = Schema_AddObject(Object, FieldId);
 		Schema_AddUint32(EntryObject, SpatialConstants::MAPPING_VIRTUAL_WORKER_ID, Entry.Key);
 		SpatialGDK::AddStringToSchema(EntryObject, SpatialConstants::MAPPING_PHYSICAL_WORKER_NAME, Entry.Value.Key);
 		Schema_AddEntityId(EntryObject, SpatialConstants::MAPPING_SERVER_WORKER_ENTITY_ID, Entry.Value.Value);
+		Schema_AddUint32(EntryObject, SpatialConstants::MAPPING_VERSION_ID, EntryVersion);
+	}
+
+	if (LoadBalanceStrategy.IsValid())
+	{
+		LoadBalanceStrategy->WritePartitionToSchema(Object);
 	}
 }
 
@@ -108,13 +159,33 @@ void SpatialVirtualWorkerTranslationManager::ConstructVirtualWorkerMappingFromQu
 // to the SpatialOS storage.
 void SpatialVirtualWorkerTranslationManager::SendVirtualWorkerMappingUpdate()
 {
+	// Stamp the entries which changed since the last update with a new version. An update which only carries new
+	// partitions keeps the version, so workers don't apply the mapping again.
+	if (PendingChanges.Num() > 0)
+	{
+		MappingVersion++;
+		for (const VirtualWorkerId Id : PendingChanges)
+		{
+			EntryVersions.Add(Id, MappingVersion);
+		}
+		PendingChanges.Empty();
+	}
+
+	const bool bWriteSnapshot = ShouldWriteSnapshot();
+
 	// Construct the mapping update based on the local virtual worker to physical worker mapping.
 	FWorkerComponentUpdate Update = {};
 	Update.component_id = SpatialConstants::VIRTUAL_WORKER_TRANSLATION_COMPONENT_ID;
 	Update.schema_type = Schema_CreateComponentUpdate();
 	Schema_Object* UpdateObject = Schema_GetComponentUpdateFields(Update.schema_type);
 
-	WriteMappingToSchema(UpdateObject);
+	WriteMappingToSchema(UpdateObject, bWriteSnapshot);
+
+	if (bWriteSnapshot)
+	{
+		SnapshotVersion = MappingVersion;
+		Schema_AddComponentUpdateClearedField(Update.schema_type, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_CHANGES_ID);
+	}
 
 	check(Connection != nullptr);
 	Connection->SendComponentUpdate(SpatialConstants::INITIAL_VIRTUAL_WORKER_TRANSLATOR_ENTITY_ID, &Update);
@@ -135,6 +206,35 @@ void SpatialVirtualWorkerTranslationManager::QueryForServerWorkerEntities()
 		return;
 	}
 
+	Worker_RequestId RequestID = SendServerWorkerEntityQuery();
+	bWorkerEntityQueryInFlight = true;
+
+	// Register a method to handle the query response.
+	EntityQueryDelegate ServerWorkerEntityQueryDelegate;
+	ServerWorkerEntityQueryDelegate.BindRaw(this, &SpatialVirtualWorkerTranslationManager::ServerWorkerEntityQueryDelegate);
+	check(Receiver != nullptr);
+	Receiver->AddEntityQueryDelegate(RequestID, ServerWorkerEntityQueryDelegate);
+}
+
+void SpatialVirtualWorkerTranslationManager::RebalanceFromReportedLoads()
+{
+	// Only rebalance once every virtual worker has been assigned, and the mapping queries are done.
+	if (!LoadBalanceStrategy.IsValid() || !UnassignedVirtualWorkers.IsEmpty() || bWorkerEntityQueryInFlight)
+	{
+		return;
+	}
+
+	Worker_RequestId RequestID = SendServerWorkerEntityQuery();
+	bWorkerEntityQueryInFlight = true;
+
+	EntityQueryDelegate LoadReportQueryDelegate;
+	LoadReportQueryDelegate.BindRaw(this, &SpatialVirtualWorkerTranslationManager::LoadReportQueryDelegate);
+	check(Receiver != nullptr);
+	Receiver->AddEntityQueryDelegate(RequestID, LoadReportQueryDelegate);
+}
+
+Worker_RequestId SpatialVirtualWorkerTranslationManager::SendServerWorkerEntityQuery()
+{
 	// Create a query for all the server worker entities. This will be used
 	// to find physical workers which the virtual workers will map to.
 	Worker_ComponentConstraint WorkerEntityComponentConstraint{};
@@ -150,14 +250,7 @@ void SpatialVirtualWorkerTranslationManager::QueryForServerWorkerEntities()
 
 	// Make the query.
 	check(Connection != nullptr);
-	Worker_RequestId RequestID = Connection->SendEntityQueryRequest(&WorkerEntityQuery);
-	bWorkerEntityQueryInFlight = true;
-
-	// Register a method to handle the query response.
-	EntityQueryDelegate ServerWorkerEntityQueryDelegate;
-	ServerWorkerEntityQueryDelegate.BindRaw(this, &SpatialVirtualWorkerTranslationManager::ServerWorkerEntityQueryDelegate);
-	check(Receiver != nullptr);
-	Receiver->AddEntityQueryDelegate(RequestID, ServerWorkerEntityQueryDelegate);
+	return Connection->SendEntityQueryRequest(&WorkerEntityQuery);
 }
 
 // This method allows the translation manager to deal with the returned list of server worker entities when they are received.
@@ -189,6 +282,50 @@ void SpatialVirtualWorkerTranslationManager::ServerWorkerEntityQueryDelegate(con
 	}
 }
 
+// This method gathers the load each server worker reported on its worker entity, and has the strategy rebalance from it.
+void SpatialVirtualWorkerTranslationManager::LoadReportQueryDelegate(const Worker_EntityQueryResponseOp& Op)
+{
+	bWorkerEntityQueryInFlight = false;
+
+	if (Op.status_code != WORKER_STATUS_CODE_SUCCESS)
+	{
+		UE_LOG(LogSpatialVirtualWorkerTranslationManager, Warning, TEXT("Could not query ServerWorker entities for their load: %s, will retry at the next rebalance."), UTF8_TO_TCHAR(Op.message));
+		return;
+	}
+
+	if (!LoadBalanceStrategy.IsValid())
+	{
+		return;
+	}
+
+	TMap<VirtualWorkerId, float> LoadPerVirtualWorker;
+	for (uint32_t i = 0; i < Op.result_count; ++i)
+	{
+		const Worker_Entity& Entity = Op.results[i];
+		for (uint32_t j = 0; j < Entity.component_count; j++)
+		{
+			const Worker_ComponentData& Data = Entity.components[j];
+			if (Data.component_id != SpatialConstants::SERVER_WORKER_COMPONENT_ID)
+			{
+				continue;
+			}
+
+			const Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data.schema_type);
+			const VirtualWorkerId* Id = PhysicalToVirtualWorkerMapping.Find(SpatialGDK::GetStringFromSchema(ComponentObject, SpatialConstants::SERVER_WORKER_NAME_ID));
+			// The load is only set once the worker has reported it. Workers which haven't are left out, so the strategy waits for them.
+			if (Id != nullptr && Schema_GetFloatCount(ComponentObject, SpatialConstants::SERVER_WORKER_LOAD_ID) == 1)
+			{
+				LoadPerVirtualWorker.Add(*Id, Schema_GetFloat(ComponentObject, SpatialConstants::SERVER_WORKER_LOAD_ID));
+			}
+		}
+	}
+
+	if (LoadBalanceStrategy->RebalanceFromLoads(LoadPerVirtualWorker))
+	{
+		SendVirtualWorkerMappingUpdate();
+	}
+}
+
 void SpatialVirtualWorkerTranslationManager::AssignWorker(const PhysicalWorkerName& Name, const Worker_EntityId& ServerWorkerEntityId)
 {
 	if (PhysicalToVirtualWorkerMapping.Contains(Name))
@@ -202,6 +339,7 @@ void SpatialVirtualWorkerTranslationManager::AssignWorker(const PhysicalWorkerNa
 
 	VirtualToPhysicalWorkerMapping.Add(Id, MakeTuple(Name, ServerWorkerEntityId));
 	PhysicalToVirtualWorkerMapping.Add(Name, Id);
+	PendingChanges.Add(Id);
 
 	UE_LOG(LogSpatialVirtualWorkerTranslationManager, Log, TEXT("Assigned VirtualWorker %d to simulate on Worker %s"), Id, *Name);
 }
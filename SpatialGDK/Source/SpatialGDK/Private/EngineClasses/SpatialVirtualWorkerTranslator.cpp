@@ -11,6 +11,7 @@ SpatialVirtualWorkerTranslator::SpatialVirtualWorkerTranslator(UAbstractLBStrate
 	PhysicalWorkerName InPhysicalWorkerName)
 	: LoadBalanceStrategy(InLoadBalanceStrategy)
 	, bIsReady(false)
+	, MappingVersion(0)
 	, LocalPhysicalWorkerName(InPhysicalWorkerName)
 	, LocalVirtualWorkerId(SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
 {}
@@ -41,28 +42,18 @@ void SpatialVirtualWorkerTranslator::ApplyVirtualWorkerManagerData(Schema_Object
 
 	// The translation schema is a list of Mappings, where each entry has a virtual and physical worker ID. 
 	ApplyMappingFromSchema(ComponentObject);
-
-	for (const auto& Entry : VirtualToPhysicalWorkerMapping)
-	{
-		UE_LOG(LogSpatialVirtualWorkerTranslator, Log, TEXT("Translator assignment: Virtual Worker %d to %s with server worker entity: %lld"), Entry.Key, *(Entry.Value.Key), Entry.Value.Value);
-	}
 }
 
 // Check to see if this worker's physical worker name is in the mapping. If it isn't, it's possibly an old mapping.
-// This is needed to give good behaviour across restarts. It's not very efficient, but it should happen only a few times
-// after a PiE restart.
-bool SpatialVirtualWorkerTranslator::IsValidMapping(Schema_Object* Object) const
+// This is needed to give good behaviour across restarts. Once this worker has its virtual worker, versioned mappings
+// only carry the entries which changed, so they needn't include it.
+bool SpatialVirtualWorkerTranslator::IsValidMapping(const TArray<MappingEntry>& Entries) const
 {
-	int32 TranslationCount = (int32)Schema_GetObjectCount(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_ID);
-
-	for (int32 i = 0; i < TranslationCount; i++)
+	for (const MappingEntry& Entry : Entries)
 	{
-		// Get each entry of the list and then unpack the virtual and physical IDs from the entry.
-		Schema_Object* MappingObject = Schema_IndexObject(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_ID, i);
-		if (SpatialGDK::GetStringFromSchema(MappingObject, SpatialConstants::MAPPING_PHYSICAL_WORKER_NAME) == LocalPhysicalWorkerName)
+		if (Entry.Name == LocalPhysicalWorkerName)
 		{
-			VirtualWorkerId ReceivedVirtualWorkerId = Schema_GetUint32(MappingObject, SpatialConstants::MAPPING_VIRTUAL_WORKER_ID);
-			if (LocalVirtualWorkerId != SpatialConstants::INVALID_VIRTUAL_WORKER_ID && LocalVirtualWorkerId != ReceivedVirtualWorkerId)
+			if (LocalVirtualWorkerId != SpatialConstants::INVALID_VIRTUAL_WORKER_ID && LocalVirtualWorkerId != Entry.Id)
 			{
 				UE_LOG(LogSpatialVirtualWorkerTranslator, Error, TEXT("Received mapping containing a new and updated virtual worker ID, this shouldn't happen."));
 				return false;
@@ -79,33 +70,126 @@ bool SpatialVirtualWorkerTranslator::IsValidMapping(Schema_Object* Object) const
 // a worker first becomes authoritative for the mapping.
 void SpatialVirtualWorkerTranslator::ApplyMappingFromSchema(Schema_Object* Object)
 {
-	if (!IsValidMapping(Object))
+	const bool bIsVersioned = Schema_GetUint32Count(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_VERSION_ID) == 1;
+	const bool bApplied = bIsVersioned ? ApplyVersionedMappingFromSchema(Object) : ApplyFullMappingFromSchema(Object);
+	if (!bApplied)
 	{
 		UE_LOG(LogSpatialVirtualWorkerTranslator, Log, TEXT("Received invalid mapping, likely due to PiE restart, will wait for a valid version."));
 		return;
 	}
 
-	// Resize the map to accept the new data.
-	VirtualToPhysicalWorkerMapping.Empty();
-	int32 TranslationCount = (int32)Schema_GetObjectCount(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_ID);
-	VirtualToPhysicalWorkerMapping.Reserve(TranslationCount);
+	// Strategies whose regions move at runtime receive them alongside the mapping.
+	if (LoadBalanceStrategy.IsValid())
+	{
+		LoadBalanceStrategy->ApplyPartitionFromSchema(Object);
+	}
+}
+
+// A mapping without a version is the whole mapping, and replaces the current one.
+bool SpatialVirtualWorkerTranslator::ApplyFullMappingFromSchema(Schema_Object* Object)
+{
+	TArray<MappingEntry> Entries;
+	TSet<VirtualWorkerId> Ids;
+	ReadChangedEntries(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_ID, Entries, &Ids);
+
+	if (!IsValidMapping(Entries))
+	{
+		return false;
+	}
 
+	RemoveMappingsNotIn(Ids);
+	for (const MappingEntry& Entry : Entries)
+	{
+		UpdateMapping(Entry.Id, Entry.Name, Entry.ServerWorkerEntityId);
+	}
+
+	return true;
+}
+
+// A versioned mapping is applied on top of the last version applied, skipping the entries which haven't changed since.
+bool SpatialVirtualWorkerTranslator::ApplyVersionedMappingFromSchema(Schema_Object* Object)
+{
+	const uint32 Version = Schema_GetUint32(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_VERSION_ID);
+	if (Version <= MappingVersion)
+	{
+		// Nothing new, or older than what has been applied, as when a query response arrives after later updates.
+		UE_LOG(LogSpatialVirtualWorkerTranslator, Verbose, TEXT("Ignoring mapping version %u, version %u has already been applied."), Version, MappingVersion);
+		return true;
+	}
+
+	// The snapshot is only present when it was rewritten, or in the component data a late joining worker receives.
+	// The changes since the snapshot are newer than any entry in it, so are applied after it.
+	const bool bHasSnapshot = Schema_GetUint32Count(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_SNAPSHOT_VERSION_ID) == 1;
+	TArray<MappingEntry> ChangedEntries;
+	TSet<VirtualWorkerId> SnapshotIds;
+	if (bHasSnapshot)
+	{
+		ReadChangedEntries(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_ID, ChangedEntries, &SnapshotIds);
+	}
+	ReadChangedEntries(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_CHANGES_ID, ChangedEntries, nullptr);
+
+	const bool bValid = IsValidMapping(ChangedEntries) || (bIsReady && !ChangedEntries.ContainsByPredicate([this](const MappingEntry& Entry)
+	{
+		return Entry.Name == LocalPhysicalWorkerName;
+	}));
+	if (!bValid)
+	{
+		return false;
+	}
+
+	if (bHasSnapshot)
+	{
+		for (const MappingEntry& Entry : ChangedEntries)
+		{
+			SnapshotIds.Add(Entry.Id);
+		}
+		RemoveMappingsNotIn(SnapshotIds);
+	}
+
+	for (const MappingEntry& Entry : ChangedEntries)
+	{
+		UpdateMapping(Entry.Id, Entry.Name, Entry.ServerWorkerEntityId);
+	}
+
+	MappingVersion = Version;
+	return true;
+}
+
+// Reads the entries of a list of Mappings which changed after the last version applied. Entries without a version always count as changed.
+void SpatialVirtualWorkerTranslator::ReadChangedEntries(Schema_Object* Object, Schema_FieldId FieldId, TArray<MappingEntry>& OutEntries, TSet<VirtualWorkerId>* OutIds) const
+{
+	const int32 TranslationCount = (int32)Schema_GetObjectCount(Object, FieldId);
 	for (int32 i = 0; i < TranslationCount; i++)
 	{
 		// Get each entry of the list and then unpack the virtual and physical IDs from the entry.
-		Schema_Object* MappingObject = Schema_IndexObject(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_ID, i);
-		VirtualWorkerId VirtualWorkerId = Schema_GetUint32(MappingObject, SpatialConstants::MAPPING_VIRTUAL_WORKER_ID);
-		PhysicalWorkerName PhysicalWorkerName = SpatialGDK::GetStringFromSchema(MappingObject, SpatialConstants::MAPPING_PHYSICAL_WORKER_NAME);
-		Worker_EntityId ServerWorkerEntityId = Schema_GetEntityId(MappingObject, SpatialConstants::MAPPING_SERVER_WORKER_ENTITY_ID);
+		Schema_Object* MappingObject = Schema_IndexObject(Object, FieldId, i);
+		const VirtualWorkerId Id = Schema_GetUint32(MappingObject, SpatialConstants::MAPPING_VIRTUAL_WORKER_ID);
+		if (OutIds != nullptr)
+		{
+			OutIds->Add(Id);
+		}
+
+		if (Schema_GetUint32Count(MappingObject, SpatialConstants::MAPPING_VERSION_ID) == 1
+			&& Schema_GetUint32(MappingObject, SpatialConstants::MAPPING_VERSION_ID) <= MappingVersion)
+		{
+			continue;
+		}
 
-		// Insert each into the provided map.
-		UpdateMapping(VirtualWorkerId, PhysicalWorkerName, ServerWorkerEntityId);
+		OutEntries.Add(MappingEntry{ Id,
+			SpatialGDK::GetStringFromSchema(MappingObject, SpatialConstants::MAPPING_PHYSICAL_WORKER_NAME),
+			Schema_GetEntityId(MappingObject, SpatialConstants::MAPPING_SERVER_WORKER_ENTITY_ID) });
 	}
 }
 
 void SpatialVirtualWorkerTranslator::UpdateMapping(VirtualWorkerId Id, PhysicalWorkerName Name, Worker_EntityId ServerWorkerEntityId)
 {
-	VirtualToPhysicalWorkerMapping.Add(Id, MakeTuple(Name, ServerWorkerEntityId));
+	const TPair<PhysicalWorkerName, Worker_EntityId>* ExistingMapping = VirtualToPhysicalWorkerMapping.Find(Id);
+	const bool bChanged = ExistingMapping == nullptr || ExistingMapping->Key != Name || ExistingMapping->Value != ServerWorkerEntityId;
+	if (bChanged)
+	{
+		VirtualToPhysicalWorkerMapping.Add(Id, MakeTuple(Name, ServerWorkerEntityId));
+		UE_LOG(LogSpatialVirtualWorkerTranslator, Log, TEXT("Translator assignment: Virtual Worker %d to %s with server worker entity: %lld"), Id, *Name, ServerWorkerEntityId);
+	}
 
 	if (LocalVirtualWorkerId == SpatialConstants::INVALID_VIRTUAL_WORKER_ID && Name == LocalPhysicalWorkerName)
 	{
@@ -121,4 +205,27 @@ void SpatialVirtualWorkerTranslator::UpdateMapping(VirtualWorkerId Id, PhysicalW
 
 		UE_LOG(LogSpatialVirtualWorkerTranslator, Log, TEXT("VirtualWorkerTranslator is now ready for loadbalancing."));
 	}
+
+	if (bChanged)
+	{
+		OnVirtualWorkerMappingChanged.Broadcast(Id);
+	}
+}
+
+void SpatialVirtualWorkerTranslator::RemoveMappingsNotIn(const TSet<VirtualWorkerId>& Ids)
+{
+	TArray<VirtualWorkerId> RemovedIds;
+	for (auto It = VirtualToPhysicalWorkerMapping.CreateIterator(); It; ++It)
+	{
+		if (!Ids.Contains(It.Key()))
+		{
+			RemovedIds.Add(It.Key());
+			It.RemoveCurrent();
+		}
+	}
+
+	for (const VirtualWorkerId Id : RemovedIds)
+	{
+		OnVirtualWorkerMappingChanged.Broadcast(Id);
+	}
 }
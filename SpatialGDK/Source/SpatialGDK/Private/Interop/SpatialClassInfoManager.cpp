@@ -9,6 +9,7 @@
 #include "Misc/MessageDialog.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "UObject/Class.h"
+#include "UObject/EnumProperty.h"
 #include "UObject/UObjectIterator.h"
 
 #if WITH_EDITOR
@@ -19,6 +20,7 @@
 #include "EngineClasses/SpatialPackageMapClient.h"
 #include "EngineClasses/SpatialWorldSettings.h"
 #include "LoadBalancing/AbstractLBStrategy.h"
+#include "LoadBalancing/LayeredLBStrategy.h"
 #include "Utils/RepLayoutUtils.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialClassInfoManager);
@@ -119,6 +121,14 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 		return;
 	}
 
+	if (const ULayeredLBStrategy* LayeredLBStrategy = Cast<ULayeredLBStrategy>(NetDriver->LoadBalanceStrategy))
+	{
+		if (Class->IsChildOf(AActor::StaticClass()))
+		{
+			Info->LayerName = LayeredLBStrategy->ResolveLayerNameForClass(Class);
+		}
+	}
+
 	TArray<UFunction*> RelevantClassFunctions = SpatialGDK::GetClassRPCFunctions(Class);
 
 	for (UFunction* RemoteFunction : RelevantClassFunctions)
@@ -136,25 +146,15 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 		Info->RPCInfoMap.Add(RemoteFunction, RPCInfo);
 	}
 
-	const bool bTrackHandoverProperties = ShouldTrackHandoverProperties();
+	if (ShouldTrackHandoverProperties())
+	{
+		CreateHandoverPropertyInfo(Class, Info.Get());
+	}
+
 	for (TFieldIterator<UProperty> PropertyIt(Class); PropertyIt; ++PropertyIt)
 	{
 		UProperty* Property = *PropertyIt;
 
-		if (bTrackHandoverProperties && (Property->PropertyFlags & CPF_Handover))
-		{
-			for (int32 ArrayIdx = 0; ArrayIdx < PropertyIt->ArrayDim; ++ArrayIdx)
-			{
-				FHandoverPropertyInfo HandoverInfo;
-				HandoverInfo.Handle = Info->HandoverProperties.Num() + 1; // 1-based index
-				HandoverInfo.Offset = Property->GetOffset_ForGC() + Property->ElementSize * ArrayIdx;
-				HandoverInfo.ArrayIdx = ArrayIdx;
-				HandoverInfo.Property = Property;
-
-				Info->HandoverProperties.Add(HandoverInfo);
-			}
-		}
-
 		if (Property->PropertyFlags & CPF_AlwaysInterested)
 		{
 			for (int32 ArrayIdx = 0; ArrayIdx < PropertyIt->ArrayDim; ++ArrayIdx)
@@ -178,6 +178,70 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 	}
 }
 
+void USpatialClassInfoManager::CreateHandoverPropertyInfo(UClass* Class, FClassInfo& Info)
+{
+	int32 ShadowOffset = 0;
+
+	for (TFieldIterator<UProperty> PropertyIt(Class); PropertyIt; ++PropertyIt)
+	{
+		UProperty* Property = *PropertyIt;
+
+		if ((Property->PropertyFlags & CPF_Handover) == 0)
+		{
+			continue;
+		}
+
+		const bool bIsPOD = IsBitwiseComparableHandoverProperty(Property);
+
+		// Make sure we conform to Unreal's alignment requirements in the shadow data.
+		// Static array elements are a multiple of the alignment, so only the first element needs aligning.
+		ShadowOffset = Align(ShadowOffset, Property->GetMinAlignment());
+
+		for (int32 ArrayIdx = 0; ArrayIdx < PropertyIt->ArrayDim; ++ArrayIdx)
+		{
+			FHandoverPropertyInfo HandoverInfo;
+			HandoverInfo.Handle = Info.HandoverProperties.Num() + 1; // 1-based index
+			HandoverInfo.Offset = Property->GetOffset_ForGC() + Property->ElementSize * ArrayIdx;
+			HandoverInfo.ArrayIdx = ArrayIdx;
+			HandoverInfo.Property = Property;
+			HandoverInfo.ShadowOffset = ShadowOffset;
+
+			ShadowOffset += Property->ElementSize;
+
+			// Extend the previous range if this property directly follows it in both the object and the shadow data.
+			if (bIsPOD && Info.HandoverPropertyRanges.Num() > 0)
+			{
+				FHandoverPropertyRange& LastRange = Info.HandoverPropertyRanges.Last();
+				const FHandoverPropertyInfo& RangeStart = Info.HandoverProperties[LastRange.FirstIndex];
+
+				if (LastRange.bIsPOD &&
+					RangeStart.Offset + LastRange.Size == HandoverInfo.Offset &&
+					RangeStart.ShadowOffset + LastRange.Size == HandoverInfo.ShadowOffset)
+				{
+					LastRange.Num++;
+					LastRange.Size += Property->ElementSize;
+					Info.HandoverProperties.Add(HandoverInfo);
+					continue;
+				}
+			}
+
+			Info.HandoverPropertyRanges.Add(FHandoverPropertyRange{ Info.HandoverProperties.Num(), 1, Property->ElementSize, bIsPOD });
+			Info.HandoverProperties.Add(HandoverInfo);
+		}
+	}
+}
+
+bool USpatialClassInfoManager::IsBitwiseComparableHandoverProperty(const UProperty* Property)
+{
+	// Floating point is excluded since +0/-0 compare equal and NaNs never do, and bools since bitfields share bytes.
+	if (const UNumericProperty* NumericProperty = Cast<UNumericProperty>(Property))
+	{
+		return NumericProperty->IsInteger();
+	}
+
+	return Property->IsA<UEnumProperty>();
+}
+
 void USpatialClassInfoManager::FinishConstructingActorClassInfo(const FString& ClassPath, TSharedRef<FClassInfo>& Info)
 {
 	ForAllSchemaComponentTypes([&](ESchemaComponentType Type)
@@ -307,6 +371,12 @@ const FClassInfo& USpatialClassInfoManager::GetOrCreateClassInfoByClass(UClass*
 	return ClassInfoMap[Class].Get();
 }
 
+const FClassInfo* USpatialClassInfoManager::FindClassInfoByClass(const UClass* Class) const
+{
+	const TSharedRef<FClassInfo>* Info = ClassInfoMap.Find(const_cast<UClass*>(Class));
+	return Info != nullptr ? &Info->Get() : nullptr;
+}
+
 const FClassInfo& USpatialClassInfoManager::GetOrCreateClassInfoByObject(UObject* Object)
 {
 	if (AActor* Actor = Cast<AActor>(Object))
@@ -274,7 +274,7 @@ void USpatialPlayerSpawner::ForwardSpawnRequestToStrategizedServer(const Schema_
 		*ClientWorkerId, *GetNameSafe(PlayerStart), SpawningVirtualWorker);
 
 	// Find the server worker entity corresponding to the PlayerStart strategized virtual worker.
-	const Worker_EntityId ServerWorkerEntity = NetDriver->VirtualWorkerTranslator->GetServerWorkerEntityForVirtualWorker(SpawningVirtualWorker);
+	const Worker_EntityId ServerWorkerEntity = NetDriver->VirtualWorkerRoutingTable->GetServerWorkerEntity(SpawningVirtualWorker);
 	if (ServerWorkerEntity == SpatialConstants::INVALID_ENTITY_ID)
 	{
 		UE_LOG(LogSpatialPlayerSpawner, Error, TEXT("Player spawning failed. Virtual worker translator returned invalid server worker entity ID. Virtual worker: %d. "
@@ -301,7 +301,7 @@ void USpatialPlayerSpawner::ForwardSpawnRequestToStrategizedServer(const Schema_
 
 	const Worker_RequestId RequestId = NetDriver->Connection->SendCommandRequest(ServerWorkerEntity, &ForwardSpawnPlayerRequest, SpatialConstants::SERVER_WORKER_FORWARD_SPAWN_REQUEST_COMMAND_ID);
 
-	OutgoingForwardPlayerSpawnRequests.Add(RequestId, TUniquePtr<Schema_CommandRequest, ForwardSpawnRequestDeleter>(ForwardSpawnPlayerSchemaRequest));
+	OutgoingForwardPlayerSpawnRequests.Add(RequestId, ForwardSpawnRequest{ TUniquePtr<Schema_CommandRequest, ForwardSpawnRequestDeleter>(ForwardSpawnPlayerSchemaRequest), SpawningVirtualWorker });
 }
 
 void USpatialPlayerSpawner::ReceiveForwardedPlayerSpawnRequest(const Worker_CommandRequestOp& Op)
@@ -390,8 +390,9 @@ void USpatialPlayerSpawner::RetryForwardSpawnPlayerRequest(const Worker_EntityId
 		return;
 	}
 
-	Schema_CommandRequest* OldRequest = OutgoingForwardPlayerSpawnRequests.FindAndRemoveChecked(RequestId).Get();
-	Schema_Object* OldRequestPayload = Schema_GetCommandRequestObject(OldRequest);
+	// Keep the request alive until it's resent, or the spawn data in it has been processed.
+	ForwardSpawnRequest OldRequest = OutgoingForwardPlayerSpawnRequests.FindAndRemoveChecked(RequestId);
+	Schema_Object* OldRequestPayload = Schema_GetCommandRequestObject(OldRequest.Request.Get());
 
 	// If the chosen PlayerStart is deleted or being deleted, we will pick another.
 	const FUnrealObjectRef PlayerStartRef = GetObjectRefFromSchema(OldRequestPayload, SpatialConstants::FORWARD_SPAWN_PLAYER_START_ACTOR_ID);
@@ -405,10 +406,26 @@ void USpatialPlayerSpawner::RetryForwardSpawnPlayerRequest(const Worker_EntityId
 		return;
 	}
 
+	// The virtual worker may be simulated by another server worker since the request was sent, if its worker was replaced.
+	const Worker_EntityId ServerWorkerEntity = NetDriver->VirtualWorkerRoutingTable->GetServerWorkerEntityForRetry(OldRequest.SpawningVirtualWorker, EntityId);
+	if (ServerWorkerEntity == SpatialConstants::INVALID_ENTITY_ID)
+	{
+		UE_LOG(LogSpatialPlayerSpawner, Error, TEXT("Player spawning failed. Virtual worker %d is no longer simulated by a server worker. Defaulting to normal player spawning flow."),
+			OldRequest.SpawningVirtualWorker);
+		PassSpawnRequestToNetDriver(Schema_GetObject(OldRequestPayload, SpatialConstants::FORWARD_SPAWN_PLAYER_DATA_ID), nullptr);
+		return;
+	}
+
+	if (ServerWorkerEntity != EntityId)
+	{
+		UE_LOG(LogSpatialPlayerSpawner, Log, TEXT("Rerouting forwarded player spawn request for virtual worker %d from server worker entity %lld to %lld."),
+			OldRequest.SpawningVirtualWorker, EntityId, ServerWorkerEntity);
+	}
+
 	// Resend the ForwardSpawnPlayer request.
-	Worker_CommandRequest ForwardSpawnPlayerRequest = ServerWorker::CreateForwardPlayerSpawnRequest(Schema_CopyCommandRequest(OldRequest));
-	const Worker_RequestId NewRequestId = NetDriver->Connection->SendCommandRequest(EntityId, &ForwardSpawnPlayerRequest, SpatialConstants::SERVER_WORKER_FORWARD_SPAWN_REQUEST_COMMAND_ID);
+	Worker_CommandRequest ForwardSpawnPlayerRequest = ServerWorker::CreateForwardPlayerSpawnRequest(Schema_CopyCommandRequest(OldRequest.Request.Get()));
+	const Worker_RequestId NewRequestId = NetDriver->Connection->SendCommandRequest(ServerWorkerEntity, &ForwardSpawnPlayerRequest, SpatialConstants::SERVER_WORKER_FORWARD_SPAWN_REQUEST_COMMAND_ID);
 
 	// Move the request data from the old request ID map entry across to the new ID entry.
-	OutgoingForwardPlayerSpawnRequests.Add(NewRequestId, TUniquePtr<Schema_CommandRequest, ForwardSpawnRequestDeleter>(OldRequest));
+	OutgoingForwardPlayerSpawnRequests.Add(NewRequestId, MoveTemp(OldRequest));
 }
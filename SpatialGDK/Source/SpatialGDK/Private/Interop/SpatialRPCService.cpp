@@ -10,13 +10,17 @@
 
 DEFINE_LOG_CATEGORY(LogSpatialRPCService);
 
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Multicast RPC Bundles Sent"), STAT_SpatialMulticastRPCBundlesSent, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Multicast RPCs Bundled"), STAT_SpatialMulticastRPCsBundled, STATGROUP_SpatialNet);
+
 namespace SpatialGDK
 {
 
-SpatialRPCService::SpatialRPCService(ExtractRPCDelegate ExtractRPCCallback, const USpatialStaticComponentView* View, USpatialLatencyTracer* SpatialLatencyTracer)
+SpatialRPCService::SpatialRPCService(ExtractRPCDelegate ExtractRPCCallback, const USpatialStaticComponentView* View, USpatialLatencyTracer* SpatialLatencyTracer, bool bInBundleMulticastRPCs)
 	: ExtractRPCCallback(ExtractRPCCallback)
 	, View(View)
 	, SpatialLatencyTracer(SpatialLatencyTracer)
+	, bBundleMulticastRPCs(bInBundleMulticastRPCs)
 {
 }
 
@@ -69,6 +73,26 @@ EPushRPCResult SpatialRPCService::PushRPCInternal(Worker_EntityId EntityId, ERPC
 			return EPushRPCResult::NoRingBufferAuthority;
 		}
 
+		if (Type == ERPCType::NetMulticast && bBundleMulticastRPCs)
+		{
+			// Multicast RPCs are auto-acked, so a bundle always fits. It takes up a single ring buffer element,
+			// which is written in GetRPCsAndAcksToSend once no more RPCs can be added to it.
+			PendingMulticastBundle* Bundle = PendingMulticastBundles.Find(EntityId);
+			if (Bundle == nullptr)
+			{
+				const uint64 NewRPCId = LastSentRPCIds.FindRef(EntityType) + 1;
+				LastSentRPCIds.Add(EntityType, NewRPCId);
+				Bundle = &PendingMulticastBundles.Add(EntityId, PendingMulticastBundle{ NewRPCId, {} });
+			}
+
+#if TRACE_LIB_ACTIVE
+			AddPendingTrace(EntityComponent, Payload.Trace);
+#endif
+
+			Bundle->Payloads.Add(MoveTemp(Payload));
+			return EPushRPCResult::Success;
+		}
+
 		EndpointObject = Schema_GetComponentUpdateFields(GetOrCreateComponentUpdate(EntityComponent));
 
 		if (Type == ERPCType::NetMulticast)
@@ -108,17 +132,7 @@ EPushRPCResult SpatialRPCService::PushRPCInternal(Worker_EntityId EntityId, ERPC
 		RPCRingBufferUtils::WriteRPCToSchema(EndpointObject, Type, NewRPCId, Payload);
 
 #if TRACE_LIB_ACTIVE
-		if (SpatialLatencyTracer != nullptr && Payload.Trace != InvalidTraceKey)
-		{
-			if (PendingTraces.Find(EntityComponent) == nullptr)
-			{
-				PendingTraces.Add(EntityComponent, Payload.Trace);
-			}
-			else
-			{
-				SpatialLatencyTracer->WriteAndEndTrace(Payload.Trace, TEXT("Multiple rpc updates in single update, ending further stack tracing"), true);
-			}
-		}
+		AddPendingTrace(EntityComponent, Payload.Trace);
 #endif
 
 		LastSentRPCIds.Add(EntityType, NewRPCId);
@@ -207,6 +221,8 @@ TArray<SpatialRPCService::UpdateToSend> SpatialRPCService::GetRPCsAndAcksToSend(
 {
 	TArray<SpatialRPCService::UpdateToSend> UpdatesToSend;
 
+	WritePendingMulticastBundles();
+
 	for (auto& It : PendingComponentUpdatesToSend)
 	{
 		SpatialRPCService::UpdateToSend& UpdateToSend = UpdatesToSend.AddZeroed_GetRef();
@@ -317,6 +333,7 @@ void SpatialRPCService::OnCheckoutMulticastRPCComponentOnEntity(Worker_EntityId
 void SpatialRPCService::OnRemoveMulticastRPCComponentForEntity(Worker_EntityId EntityId)
 {
 	LastSeenMulticastRPCIds.Remove(EntityId);
+	PartiallyExtractedMulticastBundles.Remove(EntityId);
 }
 
 void SpatialRPCService::OnEndpointAuthorityGained(Worker_EntityId EntityId, Worker_ComponentId ComponentId)
@@ -395,6 +412,9 @@ void SpatialRPCService::OnEndpointAuthorityLost(Worker_EntityId EntityId, Worker
 		// Set last seen to last sent, so we don't process own RPCs after crossing the boundary.
 		LastSeenMulticastRPCIds.Add(EntityId, LastSentRPCIds[EntityRPCType(EntityId, ERPCType::NetMulticast)]);
 		LastSentRPCIds.Remove(EntityRPCType(EntityId, ERPCType::NetMulticast));
+		PartiallyExtractedMulticastBundles.Remove(EntityId);
+		// The bundle can no longer be sent, as its RPC ID may be taken by the new authoritative worker.
+		PendingMulticastBundles.Remove(EntityId);
 		break;
 	}
 	default:
@@ -432,14 +452,45 @@ void SpatialRPCService::ExtractRPCsForType(Worker_EntityId EntityId, ERPCType Ty
 			FirstRPCIdToRead = Buffer.LastSentRPCId - BufferSize + 1;
 		}
 
+		// If extraction previously stopped midway through a multicast bundle, don't extract its first RPCs again.
+		int32 NumAlreadyExtracted = 0;
+		if (Type == ERPCType::NetMulticast)
+		{
+			int32 NumExtractedFromBundle = 0;
+			if (PartiallyExtractedMulticastBundles.RemoveAndCopyValue(EntityId, NumExtractedFromBundle) && FirstRPCIdToRead == LastSeenRPCId + 1)
+			{
+				NumAlreadyExtracted = NumExtractedFromBundle;
+			}
+		}
+
 		for (uint64 RPCId = FirstRPCIdToRead; RPCId <= Buffer.LastSentRPCId; RPCId++)
 		{
 			const TOptional<RPCPayload>& Element = Buffer.GetRingBufferElement(RPCId);
 			if (Element.IsSet())
 			{
-				bool bKeepExtracting = ExtractRPCCallback.Execute(EntityId, Type, Element.GetValue());
+				const TArray<RPCPayload>& BundledRPCs = Buffer.GetBundledRPCs(RPCId);
+				const int32 NumInElement = 1 + BundledRPCs.Num();
+
+				int32 NumExtracted = NumAlreadyExtracted;
+				NumAlreadyExtracted = 0;
+
+				bool bKeepExtracting = true;
+				while (bKeepExtracting && NumExtracted < NumInElement)
+				{
+					const RPCPayload& Payload = NumExtracted == 0 ? Element.GetValue() : BundledRPCs[NumExtracted - 1];
+					bKeepExtracting = ExtractRPCCallback.Execute(EntityId, Type, Payload);
+					if (bKeepExtracting)
+					{
+						NumExtracted++;
+					}
+				}
+
 				if (!bKeepExtracting)
 				{
+					if (NumExtracted > 0)
+					{
+						PartiallyExtractedMulticastBundles.Add(EntityId, NumExtracted);
+					}
 					break;
 				}
 				LastProcessedRPCId = RPCId;
@@ -474,6 +525,23 @@ void SpatialRPCService::ExtractRPCsForType(Worker_EntityId EntityId, ERPCType Ty
 	}
 }
 
+void SpatialRPCService::WritePendingMulticastBundles()
+{
+	for (const auto& It : PendingMulticastBundles)
+	{
+		const PendingMulticastBundle& Bundle = It.Value;
+		const EntityComponentId EntityComponent = { It.Key, SpatialConstants::MULTICAST_RPCS_COMPONENT_ID };
+
+		Schema_Object* EndpointObject = Schema_GetComponentUpdateFields(GetOrCreateComponentUpdate(EntityComponent));
+		RPCRingBufferUtils::WriteRPCBundleToSchema(EndpointObject, ERPCType::NetMulticast, Bundle.RPCId, Bundle.Payloads);
+
+		INC_DWORD_STAT(STAT_SpatialMulticastRPCBundlesSent);
+		INC_DWORD_STAT_BY(STAT_SpatialMulticastRPCsBundled, Bundle.Payloads.Num());
+	}
+
+	PendingMulticastBundles.Empty();
+}
+
 void SpatialRPCService::AddOverflowedRPC(EntityRPCType EntityType, RPCPayload&& Payload)
 {
 	OverflowedRPCs.FindOrAdd(EntityType).Add(MoveTemp(Payload));
@@ -543,6 +611,21 @@ Schema_ComponentData* SpatialRPCService::GetOrCreateComponentData(EntityComponen
 }
 
 #if TRACE_LIB_ACTIVE
+void SpatialRPCService::AddPendingTrace(const EntityComponentId& EntityComponent, const TraceKey Trace)
+{
+	if (SpatialLatencyTracer != nullptr && Trace != InvalidTraceKey)
+	{
+		if (PendingTraces.Find(EntityComponent) == nullptr)
+		{
+			PendingTraces.Add(EntityComponent, Trace);
+		}
+		else
+		{
+			SpatialLatencyTracer->WriteAndEndTrace(Trace, TEXT("Multiple rpc updates in single update, ending further stack tracing"), true);
+		}
+	}
+}
+
 void SpatialRPCService::ProcessResultToLatencyTrace(const EPushRPCResult Result, const TraceKey Trace)
 {
 	if (SpatialLatencyTracer != nullptr && Trace != InvalidTraceKey)
@@ -28,6 +28,7 @@
 #include "SpatialConstants.h"
 #include "Utils/ComponentReader.h"
 #include "Utils/ErrorCodeRemapping.h"
+#include "Utils/FastArrayItemDelta.h"
 #include "Utils/RepLayoutUtils.h"
 #include "Utils/SpatialDebugger.h"
 #include "Utils/SpatialMetrics.h"
@@ -493,6 +494,17 @@ void USpatialReceiver::OnAuthorityChange(const Worker_AuthorityChangeOp& Op)
 	// This way systems that depend on having non-stale state can function correctly.
 	StaticComponentView->OnAuthorityChange(Op);
 
+	// Cached replication state depends on authority, so drop it as soon as the view changes.
+	if (USpatialActorChannel* Channel = NetDriver->GetActorChannelByEntityId(Op.entity_id))
+	{
+		Channel->InvalidateReplicationCache();
+	}
+
+	if (Op.component_id == SpatialConstants::POSITION_COMPONENT_ID && Sender != nullptr)
+	{
+		Sender->ResetLastSentPosition(Op.entity_id);
+	}
+
 	if (Op.component_id == SpatialConstants::SERVER_WORKER_COMPONENT_ID && Op.authority == WORKER_AUTHORITY_AUTHORITATIVE)
 	{
 		GlobalStateManager->TrySendWorkerReadyToBeginPlay();
@@ -757,6 +769,11 @@ void USpatialReceiver::HandleActorAuthority(const Worker_AuthorityChangeOp& Op)
 		if (Actor->IsA<APawn>() || Actor->IsA<APlayerController>())
 		{
 			Actor->Role = (Op.authority == WORKER_AUTHORITY_AUTHORITATIVE) ? ROLE_AutonomousProxy : ROLE_SimulatedProxy;
+
+			if (Channel != nullptr)
+			{
+				Channel->InvalidateConditionMapFilter();
+			}
 		}
 	}
 
@@ -1936,8 +1953,8 @@ ERPCResult USpatialReceiver::ApplyRPCInternal(UObject* TargetObject, UFunction*
 
 	TSet<FUnrealObjectRef> UnresolvedRefs;
 	TSet<FUnrealObjectRef> MappedRefs;
-	RPCPayload PayloadCopy = Payload;
-	FSpatialNetBitReader PayloadReader(PackageMap, PayloadCopy.PayloadData.GetData(), PayloadCopy.CountDataBits(), MappedRefs, UnresolvedRefs);
+	// The bit reader copies the bytes into its own buffer, so the payload doesn't need to be copied first.
+	FSpatialNetBitReader PayloadReader(PackageMap, Payload.PayloadData.GetData(), Payload.CountDataBits(), MappedRefs, UnresolvedRefs);
 
 	TSharedPtr<FRepLayout> RepLayout = NetDriver->GetFunctionRepLayout(Function);
 	RepLayout_ReceivePropertiesForRPC(*RepLayout, PayloadReader, Parms);
@@ -2049,6 +2066,11 @@ void USpatialReceiver::OnCreateEntityResponse(const Worker_CreateEntityResponseO
 		CreateEntityDelegates.Remove(Op.request_id);
 	}
 
+	if (Sender != nullptr)
+	{
+		Sender->OnCreateEntityResponse(Op);
+	}
+
 	TWeakObjectPtr<USpatialActorChannel> Channel = PopPendingActorRequest(Op.request_id);
 
 	// It's possible for the ActorChannel to have been closed by the time we receive a response. Actor validity is checked within the channel.
@@ -2405,12 +2427,23 @@ void USpatialReceiver::ResolveObjectReferences(FRepLayout& RepLayout, UObject* R
 			{
 				TSet<FUnrealObjectRef> NewMappedRefs;
 				TSet<FUnrealObjectRef> NewUnresolvedRefs;
-				FSpatialNetBitReader ValueDataReader(PackageMap, ObjectReferences.Buffer.GetData(), ObjectReferences.NumBufferBits, NewMappedRefs, NewUnresolvedRefs);
 
 				check(Property->IsA<UArrayProperty>());
-				UScriptStruct* NetDeltaStruct = GetFastArraySerializerProperty(Cast<UArrayProperty>(Property));
+				UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property);
+				UScriptStruct* NetDeltaStruct = GetFastArraySerializerProperty(ArrayProperty);
+
+				// Buffer is empty if only the item delta references objects.
+				if (ObjectReferences.Buffer.Num() > 0)
+				{
+					FSpatialNetBitReader ValueDataReader(PackageMap, ObjectReferences.Buffer.GetData(), ObjectReferences.NumBufferBits, NewMappedRefs, NewUnresolvedRefs);
+					FSpatialNetDeltaSerializeInfo::DeltaSerializeRead(NetDriver, ValueDataReader, ReplicatedObject, Parent->ArrayIndex, Parent->Property, NetDeltaStruct);
+				}
 
-				FSpatialNetDeltaSerializeInfo::DeltaSerializeRead(NetDriver, ValueDataReader, ReplicatedObject, Parent->ArrayIndex, Parent->Property, NetDeltaStruct);
+				if (ObjectReferences.ItemDeltaBuffer.Num() > 0)
+				{
+					void* FastArray = Parent->Property->ContainerPtrToValuePtr<void>(ReplicatedObject, Parent->ArrayIndex);
+					FFastArrayItemDelta::ApplySerializedDelta(NetDriver, ObjectReferences.ItemDeltaBuffer, FastArray, ArrayProperty, NetDeltaStruct, NewMappedRefs, NewUnresolvedRefs);
+				}
 
 				ObjectReferences.MappedRefs.Append(NewMappedRefs);
 			}
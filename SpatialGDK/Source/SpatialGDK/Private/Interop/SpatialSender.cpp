@@ -46,6 +46,10 @@ DECLARE_CYCLE_STAT(TEXT("Sender QueueOutgoingUpdate"), STAT_SpatialSenderQueueOu
 DECLARE_CYCLE_STAT(TEXT("Sender UpdateInterestComponent"), STAT_SpatialSenderUpdateInterestComponent, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("Sender FlushRetryRPCs"), STAT_SpatialSenderFlushRetryRPCs, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("Sender SendRPC"), STAT_SpatialSenderSendRPC, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Sender Schema Updates Created"), STAT_SpatialSenderSchemaUpdatesCreated, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Sender Schema Updates Discarded"), STAT_SpatialSenderSchemaUpdatesDiscarded, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Sender Schema Updates Skipped"), STAT_SpatialSenderSchemaUpdatesSkipped, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Sender Update Buffer Reallocations"), STAT_SpatialSenderUpdateBufferReallocations, STATGROUP_SpatialNet);
 
 FReliableRPCForRetry::FReliableRPCForRetry(UObject* InTargetObject, UFunction* InFunction, Worker_ComponentId InComponentId, Schema_FieldId InRPCIndex, const TArray<uint8>& InPayload, int InRetryIndex)
 	: TargetObject(InTargetObject)
@@ -71,6 +75,11 @@ void USpatialSender::Init(USpatialNetDriver* InNetDriver, FTimerManager* InTimer
 
 	OutgoingRPCs.BindProcessingFunction(FProcessRPCDelegate::CreateUObject(this, &USpatialSender::SendRPC));
 
+	UpdatesQueuedUntilAuthority.SetMaxBytes(GetDefault<USpatialGDKSettings>()->MaxBytesQueuedUntilAuthority);
+	PositionUpdates.SetPrecision(GetDefault<USpatialGDKSettings>()->PositionQuantizationPrecision);
+
+	UpdateFactory = MakeUnique<ComponentFactory>(false, NetDriver, nullptr);
+
 	// Attempt to send RPCs that might have been queued while waiting for authority over entities this worker created.
 	if (GetDefault<USpatialGDKSettings>()->QueuedOutgoingRPCRetryTime > 0.0f)
 	{
@@ -80,7 +89,17 @@ void USpatialSender::Init(USpatialNetDriver* InNetDriver, FTimerManager* InTimer
 
 Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel, uint32& OutBytesWritten)
 {
-	EntityFactory DataFactory(NetDriver, PackageMap, ClassInfoManager, RPCService);
+	TArray<FWorkerComponentData> ComponentDatas = CreateEntityComponentDatas(Channel, OutBytesWritten);
+
+	Worker_EntityId EntityId = Channel->GetEntityId();
+	Worker_RequestId CreateEntityRequestId = Connection->SendCreateEntityRequest(MoveTemp(ComponentDatas), &EntityId);
+
+	return CreateEntityRequestId;
+}
+
+TArray<FWorkerComponentData> USpatialSender::CreateEntityComponentDatas(USpatialActorChannel* Channel, uint32& OutBytesWritten)
+{
+	EntityFactory DataFactory(NetDriver, PackageMap, ClassInfoManager, RPCService, &EntityPrototypes);
 	TArray<FWorkerComponentData> ComponentDatas = DataFactory.CreateEntityComponents(Channel, OutgoingOnCreateEntityRPCs, OutBytesWritten);
 
 	// If the Actor was loaded rather than dynamically spawned, associate it with its owning sublevel.
@@ -88,10 +107,7 @@ Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel, uin
 
 	ComponentDatas.Add(ComponentPresence(EntityFactory::GetComponentPresenceList(ComponentDatas)).CreateComponentPresenceData());
 
-	Worker_EntityId EntityId = Channel->GetEntityId();
-	Worker_RequestId CreateEntityRequestId = Connection->SendCreateEntityRequest(MoveTemp(ComponentDatas), &EntityId);
-
-	return CreateEntityRequestId;
+	return ComponentDatas;
 }
 
 Worker_ComponentData USpatialSender::CreateLevelComponentData(AActor* Actor)
@@ -414,6 +430,28 @@ void USpatialSender::UpdateServerWorkerEntityInterestAndPosition()
 	}
 }
 
+void USpatialSender::UpdateServerWorkerEntityLoad(float Load)
+{
+	check(Connection != nullptr);
+	check(NetDriver != nullptr);
+	if (NetDriver->WorkerEntityId == SpatialConstants::INVALID_ENTITY_ID
+		|| !NetDriver->StaticComponentView->HasAuthority(NetDriver->WorkerEntityId, SpatialConstants::SERVER_WORKER_COMPONENT_ID))
+	{
+		// No worker entity to update yet.
+		return;
+	}
+
+	FWorkerComponentUpdate ComponentUpdate = {};
+
+	ComponentUpdate.component_id = SpatialConstants::SERVER_WORKER_COMPONENT_ID;
+	ComponentUpdate.schema_type = Schema_CreateComponentUpdate();
+	Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(ComponentUpdate.schema_type);
+
+	Schema_AddFloat(ComponentObject, SpatialConstants::SERVER_WORKER_LOAD_ID, Load);
+
+	Connection->SendComponentUpdate(NetDriver->WorkerEntityId, &ComponentUpdate);
+}
+
 void USpatialSender::SendComponentUpdates(UObject* Object, const FClassInfo& Info, USpatialActorChannel* Channel, const FRepChangeState* RepChanges, const FHandoverChangeState* HandoverChanges, uint32& OutBytesWritten)
 {
 	SCOPE_CYCLE_COUNTER(STAT_SpatialSenderSendComponentUpdates);
@@ -422,9 +460,28 @@ void USpatialSender::SendComponentUpdates(UObject* Object, const FClassInfo& Inf
 	UE_LOG(LogSpatialSender, Verbose, TEXT("Sending component update (object: %s, entity: %lld)"), *Object->GetName(), EntityId);
 
 	USpatialLatencyTracer* Tracer = USpatialLatencyTracer::GetTracer(Object);
-	ComponentFactory UpdateFactory(Channel->GetInterestDirty(), NetDriver, Tracer);
+	UpdateFactory->Reset(Channel->GetInterestDirty(), Tracer);
+
+#if STATS
+	const ComponentFactory::AllocationStats AllocationsBefore = UpdateFactory->GetAllocationStats();
+	const int32 UpdatesCapacityBefore = ComponentUpdatesScratch.Max();
+#endif
 
-	TArray<FWorkerComponentUpdate> ComponentUpdates = UpdateFactory.CreateComponentUpdates(Object, Info, EntityId, RepChanges, HandoverChanges, OutBytesWritten);
+	// The connection takes ownership of the schema updates, so only the array holding them is kept for the next object.
+	TArray<FWorkerComponentUpdate>& ComponentUpdates = ComponentUpdatesScratch;
+	ComponentUpdates.Reset();
+	UpdateFactory->CreateComponentUpdates(Object, Info, EntityId, RepChanges, HandoverChanges, ComponentUpdates, OutBytesWritten);
+
+#if STATS
+	const ComponentFactory::AllocationStats& AllocationsAfter = UpdateFactory->GetAllocationStats();
+	INC_DWORD_STAT_BY(STAT_SpatialSenderSchemaUpdatesCreated, AllocationsAfter.NumSchemaUpdatesCreated - AllocationsBefore.NumSchemaUpdatesCreated);
+	INC_DWORD_STAT_BY(STAT_SpatialSenderSchemaUpdatesDiscarded, AllocationsAfter.NumSchemaUpdatesDiscarded - AllocationsBefore.NumSchemaUpdatesDiscarded);
+	INC_DWORD_STAT_BY(STAT_SpatialSenderSchemaUpdatesSkipped, AllocationsAfter.NumSchemaUpdatesSkipped - AllocationsBefore.NumSchemaUpdatesSkipped);
+	if (ComponentUpdates.Max() != UpdatesCapacityBefore)
+	{
+		INC_DWORD_STAT(STAT_SpatialSenderUpdateBufferReallocations);
+	}
+#endif
 
 	for(int i = 0; i < ComponentUpdates.Num(); i++)
 	{
@@ -436,8 +493,7 @@ void USpatialSender::SendComponentUpdates(UObject* Object, const FClassInfo& Inf
 			// This is a temporary fix. A task to improve this has been created: UNR-955
 			// It may be the case that upon resolving a component, we do not have authority to send the update. In this case, we queue the update, to send upon receiving authority.
 			// Note: This will break in a multi-worker context, if we try to create an entity that we don't intend to have authority over. For this reason, this fix is only temporary.
-			TArray<FWorkerComponentUpdate>& UpdatesQueuedUntilAuthority = UpdatesQueuedUntilAuthorityMap.FindOrAdd(EntityId);
-			UpdatesQueuedUntilAuthority.Add(Update);
+			UpdatesQueuedUntilAuthority.Add(EntityId, Update);
 			continue;
 		}
 
@@ -448,22 +504,42 @@ void USpatialSender::SendComponentUpdates(UObject* Object, const FClassInfo& Inf
 // Apply (and clean up) any updates queued, due to being sent previously when they didn't have authority.
 void USpatialSender::ProcessUpdatesQueuedUntilAuthority(Worker_EntityId EntityId, Worker_ComponentId ComponentId)
 {
-	if (TArray<FWorkerComponentUpdate>* UpdatesQueuedUntilAuthority = UpdatesQueuedUntilAuthorityMap.Find(EntityId))
+	UpdatesQueuedUntilAuthority.Send(EntityId, ComponentId, *Connection, [this, EntityId, ComponentId](FWorkerComponentUpdate& OutUpdate)
 	{
-		for (auto It = UpdatesQueuedUntilAuthority->CreateIterator(); It; It++)
-		{
-			if (ComponentId == It->component_id)
-			{
-				Connection->SendComponentUpdate(EntityId, &(*It));
-				It.RemoveCurrent();
-			}
-		}
+		return CreateWholeComponentUpdate(EntityId, ComponentId, OutUpdate);
+	});
+}
 
-		if (UpdatesQueuedUntilAuthority->Num() == 0)
-		{
-			UpdatesQueuedUntilAuthorityMap.Remove(EntityId);
-		}
+bool USpatialSender::CreateWholeComponentUpdate(Worker_EntityId EntityId, Worker_ComponentId ComponentId, FWorkerComponentUpdate& OutUpdate)
+{
+	USpatialActorChannel* Channel = NetDriver->GetActorChannelByEntityId(EntityId);
+	uint32 Offset = 0;
+	if (Channel == nullptr || Channel->Actor == nullptr || !ClassInfoManager->GetOffsetByComponentId(ComponentId, Offset))
+	{
+		return false;
 	}
+
+	UObject* Object = Offset == 0 ? Channel->Actor : PackageMap->GetObjectFromUnrealObjectRef(FUnrealObjectRef(EntityId, Offset)).Get();
+	if (Object == nullptr)
+	{
+		return false;
+	}
+
+	const FClassInfo& Info = ClassInfoManager->GetClassInfoByComponentId(ComponentId);
+	const FRepChangeState RepChanges = Channel->CreateInitialRepChangeState(Object);
+	const FHandoverChangeState HandoverChanges = Channel->CreateInitialHandoverChangeState(Info);
+
+	UpdateFactory->Reset(false, nullptr);
+
+	uint32 BytesWritten = 0;
+	OutUpdate = UpdateFactory->CreateWholeComponentUpdate(ComponentId, Object, Info, EntityId, RepChanges, HandoverChanges, BytesWritten);
+
+	return OutUpdate.schema_type != nullptr;
+}
+
+void USpatialSender::ClearUpdatesQueuedUntilAuthority(Worker_EntityId EntityId)
+{
+	UpdatesQueuedUntilAuthority.RemoveEntity(EntityId);
 }
 
 void USpatialSender::FlushRPCService()
@@ -548,10 +624,21 @@ void USpatialSender::SendPositionUpdate(Worker_EntityId EntityId, const FVector&
 	}
 #endif
 
-	FWorkerComponentUpdate Update = Position::CreatePositionUpdate(Coordinates::FromFVector(Location));
+	FVector PositionToSend;
+	if (!PositionUpdates.ShouldSend(EntityId, Location, PositionToSend))
+	{
+		return;
+	}
+
+	FWorkerComponentUpdate Update = Position::CreatePositionUpdate(Coordinates::FromFVector(PositionToSend));
 	Connection->SendComponentUpdate(EntityId, &Update);
 }
 
+void USpatialSender::ResetLastSentPosition(Worker_EntityId EntityId)
+{
+	PositionUpdates.RemoveEntity(EntityId);
+}
+
 void USpatialSender::SendAuthorityIntentUpdate(const AActor& Actor, VirtualWorkerId NewAuthoritativeVirtualWorkerId)
 {
 	const Worker_EntityId EntityId = PackageMap->GetEntityIdFromObject(&Actor);
@@ -590,29 +677,15 @@ void USpatialSender::SetAclWriteAuthority(const SpatialLoadBalanceEnforcer::AclW
 	check(NetDriver);
 	check(StaticComponentView->HasComponent(Request.EntityId, SpatialConstants::ENTITY_ACL_COMPONENT_ID));
 
-	const FString& WriteWorkerId = FString::Printf(TEXT("workerId:%s"), *Request.OwningWorkerId);
-
-	const WorkerAttributeSet OwningServerWorkerAttributeSet = { WriteWorkerId };
+	check(Request.WriteAcl.IsValid());
 
 	EntityAcl* NewAcl = StaticComponentView->GetComponentData<EntityAcl>(Request.EntityId);
 	NewAcl->ReadAcl = Request.ReadAcl;
+	NewAcl->ComponentWriteAcl = Request.WriteAcl->ServerWriteAcl;
 
-	for (const Worker_ComponentId& ComponentId : Request.ComponentIds)
+	for (const Worker_ComponentId& ComponentId : Request.WriteAcl->OwningClientComponentIds)
 	{
-		if (ComponentId == SpatialConstants::HEARTBEAT_COMPONENT_ID
-			|| ComponentId == SpatialConstants::GetClientAuthorityComponent(GetDefault<USpatialGDKSettings>()->UseRPCRingBuffer()))
-		{
-			NewAcl->ComponentWriteAcl.Add(ComponentId, Request.ClientRequirementSet);
-			continue;
-		}
-
-		if (ComponentId == SpatialConstants::ENTITY_ACL_COMPONENT_ID)
-		{
-			NewAcl->ComponentWriteAcl.Add(ComponentId, { SpatialConstants::UnrealServerAttributeSet } );
-			continue;
-		}
-
-		NewAcl->ComponentWriteAcl.Add(ComponentId, { OwningServerWorkerAttributeSet });
+		NewAcl->ComponentWriteAcl.Add(ComponentId, Request.ClientRequirementSet);
 	}
 
 	UE_LOG(LogSpatialLoadBalanceEnforcer, Verbose, TEXT("(%s) Setting Acl WriteAuth for entity %lld to %s"), *NetDriver->Connection->GetWorkerId(), Request.EntityId, *Request.OwningWorkerId);
@@ -683,9 +756,7 @@ void USpatialSender::SendOnEntityCreationRPC(UObject* TargetObject, UFunction* F
 	const FRPCInfo& RPCInfo = ClassInfoManager->GetRPCInfo(TargetObject, Function);
 
 	OutgoingOnCreateEntityRPCs.FindOrAdd(Channel->Actor).RPCs.Add(Payload);
-#if !UE_BUILD_SHIPPING
 	TrackRPC(Channel->Actor, Function, Payload, RPCInfo.Type);
-#endif // !UE_BUILD_SHIPPING
 }
 
 void USpatialSender::SendCrossServerRPC(UObject* TargetObject, UFunction* Function, const SpatialGDK::RPCPayload& Payload, USpatialActorChannel* Channel, const FUnrealObjectRef& TargetObjectRef)
@@ -711,9 +782,7 @@ void USpatialSender::SendCrossServerRPC(UObject* TargetObject, UFunction* Functi
 		UE_LOG(LogSpatialSender, Verbose, TEXT("Sending unreliable command request (entity: %lld, component: %d, function: %s)"),
 			EntityId, CommandRequest.component_id, *Function->GetName());
 	}
-#if !UE_BUILD_SHIPPING
 	TrackRPC(Channel->Actor, Function, Payload, RPCInfo.Type);
-#endif // !UE_BUILD_SHIPPING
 }
 
 FRPCErrorInfo USpatialSender::SendLegacyRPC(UObject* TargetObject, UFunction* Function, const RPCPayload& Payload, USpatialActorChannel* Channel, const FUnrealObjectRef& TargetObjectRef)
@@ -749,9 +818,7 @@ FRPCErrorInfo USpatialSender::SendLegacyRPC(UObject* TargetObject, UFunction* Fu
 
 	Connection->SendComponentUpdate(EntityId, &ComponentUpdate);
 	Connection->MaybeFlush();
-#if !UE_BUILD_SHIPPING
 	TrackRPC(Channel->Actor, Function, Payload, RPCInfo.Type);
-#endif // !UE_BUILD_SHIPPING
 
 	return FRPCErrorInfo{ TargetObject, Function, ERPCResult::Success };
 }
@@ -761,17 +828,18 @@ bool USpatialSender::SendRingBufferedRPC(UObject* TargetObject, UFunction* Funct
 	const FRPCInfo& RPCInfo = ClassInfoManager->GetRPCInfo(TargetObject, Function);
 	const EPushRPCResult Result = RPCService->PushRPC(TargetObjectRef.Entity, RPCInfo.Type, Payload, Channel->bCreatedEntity);
 
-	if (Result == EPushRPCResult::Success)
+	// Bundled multicast RPCs are sent when the RPC service is flushed at the end of the tick.
+	const bool bIsBundled = RPCInfo.Type == ERPCType::NetMulticast && RPCService->IsBundlingMulticastRPCs();
+
+	if (Result == EPushRPCResult::Success && !bIsBundled)
 	{
 		FlushRPCService();
 	}
 
-#if !UE_BUILD_SHIPPING
 	if (Result == EPushRPCResult::Success || Result == EPushRPCResult::QueueOverflowed)
 	{
 		TrackRPC(Channel->Actor, Function, Payload, RPCInfo.Type);
 	}
-#endif // !UE_BUILD_SHIPPING
 
 	switch (Result)
 	{
@@ -804,13 +872,11 @@ bool USpatialSender::SendRingBufferedRPC(UObject* TargetObject, UFunction* Funct
 	}
 }
 
-#if !UE_BUILD_SHIPPING
 void USpatialSender::TrackRPC(AActor* Actor, UFunction* Function, const RPCPayload& Payload, const ERPCType RPCType)
 {
 	NETWORK_PROFILER(GNetworkProfiler.TrackSendRPC(Actor, Function, 0, Payload.CountDataBits(), 0, NetDriver->GetSpatialOSNetConnection()));
 	NetDriver->SpatialMetrics->TrackSentRPC(Function, RPCType, Payload.PayloadData.Num());
 }
-#endif
 
 bool USpatialSender::WillHaveAuthorityOverActor(AActor* TargetActor, Worker_EntityId TargetEntity)
 {
@@ -896,11 +962,32 @@ void USpatialSender::SendCreateEntityRequest(USpatialActorChannel* Channel, uint
 {
 	UE_LOG(LogSpatialSender, Log, TEXT("Sending create entity request for %s with EntityId %lld, HasAuthority: %d"), *Channel->Actor->GetName(), Channel->GetEntityId(), Channel->Actor->HasAuthority());
 
+	if (GetDefault<USpatialGDKSettings>()->bBatchSpatialEntityCreation)
+	{
+		// The component data is built now, while the channel's initial replication state is current, and sent with
+		// the rest of this tick's creations in FlushEntityCreations.
+		PendingEntityCreations.Add(Channel->GetEntityId(), CreateEntityComponentDatas(Channel, OutBytesWritten), Channel);
+		return;
+	}
+
 	Worker_RequestId RequestId = CreateEntity(Channel, OutBytesWritten);
 
 	Receiver->AddPendingActorRequest(RequestId, Channel);
 }
 
+void USpatialSender::FlushEntityCreations()
+{
+	PendingEntityCreations.Flush(*Connection, [this](Worker_RequestId RequestId, Worker_EntityId EntityId, const TWeakObjectPtr<USpatialActorChannel>& Channel)
+	{
+		Receiver->AddPendingActorRequest(RequestId, Channel.Get());
+	});
+}
+
+void USpatialSender::OnCreateEntityResponse(const Worker_CreateEntityResponseOp& Op)
+{
+	PendingEntityCreations.OnCreateEntityResponse(Op);
+}
+
 void USpatialSender::SendRequestToClearRPCsOnEntityCreation(Worker_EntityId EntityId)
 {
 	Worker_CommandRequest CommandRequest = RPCsOnEntityCreation::CreateClearFieldsCommandRequest();
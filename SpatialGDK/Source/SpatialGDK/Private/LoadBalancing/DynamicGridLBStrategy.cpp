@@ -0,0 +1,393 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "LoadBalancing/DynamicGridLBStrategy.h"
+
+#include "SpatialConstants.h"
+#include "Utils/SpatialActorUtils.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+DEFINE_LOG_CATEGORY(LogDynamicGridLBStrategy);
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Dynamic Grid Rebalances"), STAT_SpatialDynamicGridRebalances, STATGROUP_SpatialNet);
+
+namespace
+{
+// Boundaries which would move less than this, in cm, are left where they are, so that tiny load changes don't publish a new partition.
+constexpr float MIN_BOUNDARY_MOVE = 1.f;
+
+FString BoundariesToString(const TArray<float>& Boundaries)
+{
+	FString Result;
+	for (const float Boundary : Boundaries)
+	{
+		Result += Result.IsEmpty() ? FString::SanitizeFloat(Boundary) : TEXT(", ") + FString::SanitizeFloat(Boundary);
+	}
+	return Result;
+}
+}
+
+UDynamicGridLBStrategy::UDynamicGridLBStrategy()
+	: Super()
+	, Rows(1)
+	, Cols(1)
+	, WorldWidth(1000000.f)
+	, WorldHeight(1000000.f)
+	, InterestBorder(0.f)
+	, RebalanceInterval(10.f)
+	, MaxBoundaryMovePerRebalance(5000.f)
+	, MinimumCellSize(10000.f)
+	, ImbalanceThreshold(0.2f)
+	, PartitionVersion(0)
+	, LocalCellId(0)
+	, bIsStrategyUsedOnLocalWorker(false)
+{
+}
+
+void UDynamicGridLBStrategy::Init()
+{
+	Super::Init();
+
+	UE_LOG(LogDynamicGridLBStrategy, Log, TEXT("DynamicGridLBStrategy initialized with Rows = %d and Cols = %d."), Rows, Cols);
+
+	// Start from an even grid. Each boundary is computed on its own, so the outer edges are exactly at the edges of the world.
+	// +x is forward, so rows are perpendicular to the x-axis and columns are perpendicular to the y-axis.
+	RowBoundaries.Reset(Rows + 1);
+	for (uint32 Row = 0; Row <= Rows; ++Row)
+	{
+		RowBoundaries.Add(WorldHeight * (static_cast<float>(Row) / Rows - 0.5f));
+	}
+
+	ColumnBoundaries.Reset(Cols + 1);
+	for (uint32 Col = 0; Col <= Cols; ++Col)
+	{
+		ColumnBoundaries.Add(WorldWidth * (static_cast<float>(Col) / Cols - 0.5f));
+	}
+
+	PartitionVersion = 0;
+}
+
+void UDynamicGridLBStrategy::SetLocalVirtualWorkerId(VirtualWorkerId InLocalVirtualWorkerId)
+{
+	if (!VirtualWorkerIds.Contains(InLocalVirtualWorkerId))
+	{
+		// This worker is simulating a layer which is not part of the grid.
+		LocalCellId = Rows * Cols;
+		bIsStrategyUsedOnLocalWorker = false;
+	}
+	else
+	{
+		LocalCellId = VirtualWorkerIds.IndexOfByKey(InLocalVirtualWorkerId);
+		bIsStrategyUsedOnLocalWorker = true;
+	}
+	LocalVirtualWorkerId = InLocalVirtualWorkerId;
+}
+
+TSet<VirtualWorkerId> UDynamicGridLBStrategy::GetVirtualWorkerIds() const
+{
+	return TSet<VirtualWorkerId>(VirtualWorkerIds);
+}
+
+bool UDynamicGridLBStrategy::ShouldHaveAuthority(const AActor& Actor) const
+{
+	if (!IsReady())
+	{
+		UE_LOG(LogDynamicGridLBStrategy, Warning, TEXT("DynamicGridLBStrategy not ready to relinquish authority for Actor %s."), *AActor::GetDebugName(&Actor));
+		return false;
+	}
+
+	if (!bIsStrategyUsedOnLocalWorker)
+	{
+		return false;
+	}
+
+	const FVector2D Actor2DLocation = FVector2D(SpatialGDK::GetActorSpatialPosition(&Actor));
+	return IsInside(GetCell(LocalCellId), Actor2DLocation);
+}
+
+VirtualWorkerId UDynamicGridLBStrategy::WhoShouldHaveAuthority(const AActor& Actor) const
+{
+	if (!IsReady())
+	{
+		UE_LOG(LogDynamicGridLBStrategy, Warning, TEXT("DynamicGridLBStrategy not ready to decide on authority for Actor %s."), *AActor::GetDebugName(&Actor));
+		return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	}
+
+	return WhoShouldHaveAuthorityForLocation(FVector2D(SpatialGDK::GetActorSpatialPosition(&Actor)));
+}
+
+VirtualWorkerId UDynamicGridLBStrategy::PredictWhoShouldHaveAuthority(const AActor& Actor, float LookaheadSeconds) const
+{
+	if (!IsReady())
+	{
+		return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	}
+
+	// As for a grid-based strategy, cells are convex, and Actors leaving the grid stay with the worker they are leaving.
+	const FVector2D Location = FVector2D(SpatialGDK::GetActorSpatialPosition(&Actor));
+	const VirtualWorkerId PredictedVirtualWorkerId = WhoShouldHaveAuthorityForLocation(Location + FVector2D(SpatialGDK::GetActorSpatialVelocity(&Actor)) * LookaheadSeconds);
+	return PredictedVirtualWorkerId != SpatialConstants::INVALID_VIRTUAL_WORKER_ID ? PredictedVirtualWorkerId : WhoShouldHaveAuthorityForLocation(Location);
+}
+
+VirtualWorkerId UDynamicGridLBStrategy::WhoShouldHaveAuthorityForLocation(const FVector2D& Location) const
+{
+	check(VirtualWorkerIds.Num() == static_cast<int32>(Rows * Cols));
+
+	const int32 CellIndex = GetCellIndex(Location);
+	return CellIndex != INDEX_NONE ? VirtualWorkerIds[CellIndex] : SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+}
+
+SpatialGDK::QueryConstraint UDynamicGridLBStrategy::GetWorkerInterestQueryConstraint() const
+{
+	// As for a grid-based strategy, the interest area is the cell that the worker is authoritative over plus some border region.
+	check(IsReady());
+	check(bIsStrategyUsedOnLocalWorker);
+
+	const FBox2D Interest2D = GetCell(LocalCellId).ExpandBy(InterestBorder);
+
+	const FVector2D Center2D = Interest2D.GetCenter();
+	const FVector Center3D{ Center2D.X, Center2D.Y, 0.0f };
+
+	const FVector2D EdgeLengths2D = Interest2D.GetSize();
+	check(EdgeLengths2D.X > 0.0f && EdgeLengths2D.Y > 0.0f);
+	const FVector EdgeLengths3D{ EdgeLengths2D.X, EdgeLengths2D.Y, FLT_MAX };
+
+	SpatialGDK::QueryConstraint Constraint;
+	Constraint.BoxConstraint = SpatialGDK::BoxConstraint{ SpatialGDK::Coordinates::FromFVector(Center3D), SpatialGDK::EdgeLength::FromFVector(EdgeLengths3D) };
+	return Constraint;
+}
+
+FVector UDynamicGridLBStrategy::GetWorkerEntityPosition() const
+{
+	check(IsReady());
+	check(bIsStrategyUsedOnLocalWorker);
+	const FVector2D Centre = GetCell(LocalCellId).GetCenter();
+	return FVector{ Centre.X, Centre.Y, 0.f };
+}
+
+uint32 UDynamicGridLBStrategy::GetMinimumRequiredWorkers() const
+{
+	return Rows * Cols;
+}
+
+void UDynamicGridLBStrategy::SetVirtualWorkerIds(const VirtualWorkerId& FirstVirtualWorkerId, const VirtualWorkerId& LastVirtualWorkerId)
+{
+	UE_LOG(LogDynamicGridLBStrategy, Log, TEXT("Setting VirtualWorkerIds %d to %d"), FirstVirtualWorkerId, LastVirtualWorkerId);
+	for (VirtualWorkerId CurrentVirtualWorkerId = FirstVirtualWorkerId; CurrentVirtualWorkerId <= LastVirtualWorkerId; CurrentVirtualWorkerId++)
+	{
+		VirtualWorkerIds.Add(CurrentVirtualWorkerId);
+	}
+}
+
+bool UDynamicGridLBStrategy::RebalanceFromLoads(const TMap<VirtualWorkerId, float>& LoadPerVirtualWorker)
+{
+	if (VirtualWorkerIds.Num() != static_cast<int32>(Rows * Cols))
+	{
+		return false;
+	}
+
+	// Rows and columns span the whole grid, so each is balanced on the total load of its cells.
+	TArray<float> RowLoads;
+	TArray<float> ColumnLoads;
+	RowLoads.SetNumZeroed(Rows);
+	ColumnLoads.SetNumZeroed(Cols);
+
+	for (int32 CellIndex = 0; CellIndex < static_cast<int32>(Rows * Cols); CellIndex++)
+	{
+		const float* Load = LoadPerVirtualWorker.Find(VirtualWorkerIds[CellIndex]);
+		if (Load == nullptr)
+		{
+			UE_LOG(LogDynamicGridLBStrategy, Verbose, TEXT("Not rebalancing until virtual worker %d reports its load."), VirtualWorkerIds[CellIndex]);
+			return false;
+		}
+
+		RowLoads[CellIndex % Rows] += FMath::Max(*Load, 0.f);
+		ColumnLoads[CellIndex / Rows] += FMath::Max(*Load, 0.f);
+	}
+
+	bool bChanged = RebalanceBoundaries(RowBoundaries, RowLoads);
+	bChanged |= RebalanceBoundaries(ColumnBoundaries, ColumnLoads);
+
+	if (bChanged)
+	{
+		PartitionVersion++;
+		INC_DWORD_STAT(STAT_SpatialDynamicGridRebalances);
+		UE_LOG(LogDynamicGridLBStrategy, Log, TEXT("Rebalanced grid to version %u. Row boundaries: %s. Column boundaries: %s."), PartitionVersion,
+			*BoundariesToString(RowBoundaries), *BoundariesToString(ColumnBoundaries));
+	}
+
+	return bChanged;
+}
+
+bool UDynamicGridLBStrategy::RebalanceBoundaries(TArray<float>& Boundaries, const TArray<float>& IntervalLoads) const
+{
+	const int32 NumIntervals = IntervalLoads.Num();
+	check(Boundaries.Num() == NumIntervals + 1);
+
+	if (NumIntervals < 2)
+	{
+		return false;
+	}
+
+	float TotalLoad = 0.f;
+	float MaxLoad = 0.f;
+	for (const float Load : IntervalLoads)
+	{
+		TotalLoad += Load;
+		MaxLoad = FMath::Max(MaxLoad, Load);
+	}
+
+	if (TotalLoad <= 0.f || MaxLoad <= (TotalLoad / NumIntervals) * (1.f + ImbalanceThreshold))
+	{
+		return false;
+	}
+
+	// Place each interior boundary where the cumulative load reaches its share, assuming the load is spread evenly within each interval.
+	TArray<float> NewBoundaries = Boundaries;
+	int32 Interval = 0;
+	float LoadBefore = 0.f;
+	for (int32 i = 1; i < NumIntervals; i++)
+	{
+		const float TargetLoad = TotalLoad * i / NumIntervals;
+		while (Interval < NumIntervals - 1 && LoadBefore + IntervalLoads[Interval] < TargetLoad)
+		{
+			LoadBefore += IntervalLoads[Interval];
+			Interval++;
+		}
+
+		const float Fraction = IntervalLoads[Interval] > 0.f ? FMath::Clamp((TargetLoad - LoadBefore) / IntervalLoads[Interval], 0.f, 1.f) : 0.f;
+		const float Target = FMath::Lerp(Boundaries[Interval], Boundaries[Interval + 1], Fraction);
+
+		NewBoundaries[i] = FMath::Clamp(Target, Boundaries[i] - MaxBoundaryMovePerRebalance, Boundaries[i] + MaxBoundaryMovePerRebalance);
+	}
+
+	// Keep every interval at least the minimum size, or an even split if the grid is too small for that.
+	const float MinIntervalSize = FMath::Min(MinimumCellSize, (Boundaries[NumIntervals] - Boundaries[0]) / NumIntervals);
+	for (int32 i = 1; i < NumIntervals; i++)
+	{
+		NewBoundaries[i] = FMath::Max(NewBoundaries[i], NewBoundaries[i - 1] + MinIntervalSize);
+	}
+	for (int32 i = NumIntervals - 1; i > 0; i--)
+	{
+		NewBoundaries[i] = FMath::Min(NewBoundaries[i], NewBoundaries[i + 1] - MinIntervalSize);
+	}
+
+	bool bChanged = false;
+	for (int32 i = 1; i < NumIntervals; i++)
+	{
+		if (FMath::Abs(NewBoundaries[i] - Boundaries[i]) >= MIN_BOUNDARY_MOVE)
+		{
+			Boundaries[i] = NewBoundaries[i];
+			bChanged = true;
+		}
+	}
+
+	return bChanged;
+}
+
+void UDynamicGridLBStrategy::WritePartitionToSchema(Schema_Object* TranslationObject) const
+{
+	if (VirtualWorkerIds.Num() == 0)
+	{
+		return;
+	}
+
+	Schema_Object* PartitionObject = Schema_AddObject(TranslationObject, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_GRID_PARTITIONS_ID);
+	Schema_AddUint32(PartitionObject, SpatialConstants::GRID_PARTITION_FIRST_VIRTUAL_WORKER_ID, VirtualWorkerIds[0]);
+	Schema_AddUint32(PartitionObject, SpatialConstants::GRID_PARTITION_VERSION_ID, PartitionVersion);
+	Schema_AddFloatList(PartitionObject, SpatialConstants::GRID_PARTITION_ROW_BOUNDARIES_ID, RowBoundaries.GetData(), RowBoundaries.Num());
+	Schema_AddFloatList(PartitionObject, SpatialConstants::GRID_PARTITION_COLUMN_BOUNDARIES_ID, ColumnBoundaries.GetData(), ColumnBoundaries.Num());
+}
+
+void UDynamicGridLBStrategy::ApplyPartitionFromSchema(Schema_Object* TranslationObject)
+{
+	if (VirtualWorkerIds.Num() == 0)
+	{
+		return;
+	}
+
+	const uint32 PartitionCount = Schema_GetObjectCount(TranslationObject, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_GRID_PARTITIONS_ID);
+	for (uint32 i = 0; i < PartitionCount; i++)
+	{
+		Schema_Object* PartitionObject = Schema_IndexObject(TranslationObject, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_GRID_PARTITIONS_ID, i);
+		if (Schema_GetUint32(PartitionObject, SpatialConstants::GRID_PARTITION_FIRST_VIRTUAL_WORKER_ID) != VirtualWorkerIds[0])
+		{
+			continue;
+		}
+
+		// Only the worker authoritative over the translation rebalances, so a newer version always supersedes what we have.
+		const uint32 ReceivedVersion = Schema_GetUint32(PartitionObject, SpatialConstants::GRID_PARTITION_VERSION_ID);
+		if (ReceivedVersion <= PartitionVersion)
+		{
+			return;
+		}
+
+		const uint32 RowBoundaryCount = Schema_GetFloatCount(PartitionObject, SpatialConstants::GRID_PARTITION_ROW_BOUNDARIES_ID);
+		const uint32 ColumnBoundaryCount = Schema_GetFloatCount(PartitionObject, SpatialConstants::GRID_PARTITION_COLUMN_BOUNDARIES_ID);
+		if (RowBoundaryCount != Rows + 1 || ColumnBoundaryCount != Cols + 1)
+		{
+			UE_LOG(LogDynamicGridLBStrategy, Error, TEXT("Received grid partition with %u row and %u column boundaries, but the grid has %u rows and %u columns."),
+				RowBoundaryCount, ColumnBoundaryCount, Rows, Cols);
+			return;
+		}
+
+		Schema_GetFloatList(PartitionObject, SpatialConstants::GRID_PARTITION_ROW_BOUNDARIES_ID, RowBoundaries.GetData());
+		Schema_GetFloatList(PartitionObject, SpatialConstants::GRID_PARTITION_COLUMN_BOUNDARIES_ID, ColumnBoundaries.GetData());
+		PartitionVersion = ReceivedVersion;
+
+		UE_LOG(LogDynamicGridLBStrategy, Log, TEXT("Applied grid partition version %u."), PartitionVersion);
+		return;
+	}
+}
+
+FBox2D UDynamicGridLBStrategy::GetCell(int32 CellIndex) const
+{
+	const int32 Row = CellIndex % Rows;
+	const int32 Col = CellIndex / Rows;
+	return FBox2D(FVector2D(RowBoundaries[Row], ColumnBoundaries[Col]), FVector2D(RowBoundaries[Row + 1], ColumnBoundaries[Col + 1]));
+}
+
+int32 UDynamicGridLBStrategy::GetCellIndex(const FVector2D& Location) const
+{
+	const int32 Row = FindInterval(RowBoundaries, Location.X);
+	const int32 Col = FindInterval(ColumnBoundaries, Location.Y);
+	if (Row == INDEX_NONE || Col == INDEX_NONE)
+	{
+		return INDEX_NONE;
+	}
+
+	return Col * static_cast<int32>(Rows) + Row;
+}
+
+int32 UDynamicGridLBStrategy::FindInterval(const TArray<float>& Boundaries, float Value)
+{
+	// Written so that NaN is outside too.
+	if (!(Value >= Boundaries[0] && Value < Boundaries.Last()))
+	{
+		return INDEX_NONE;
+	}
+
+	// Boundaries[Low] <= Value < Boundaries[High] throughout.
+	int32 Low = 0;
+	int32 High = Boundaries.Num() - 1;
+	while (High - Low > 1)
+	{
+		const int32 Mid = (Low + High) / 2;
+		if (Value < Boundaries[Mid])
+		{
+			High = Mid;
+		}
+		else
+		{
+			Low = Mid;
+		}
+	}
+
+	return Low;
+}
+
+bool UDynamicGridLBStrategy::IsInside(const FBox2D& Box, const FVector2D& Location)
+{
+	return Location.X >= Box.Min.X && Location.Y >= Box.Min.Y
+		&& Location.X < Box.Max.X && Location.Y < Box.Max.Y;
+}
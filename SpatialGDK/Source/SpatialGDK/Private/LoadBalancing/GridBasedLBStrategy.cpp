@@ -9,6 +9,15 @@
 
 DEFINE_LOG_CATEGORY(LogGridBasedLBStrategy);
 
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Grid Authority Transfers Suppressed"), STAT_SpatialGridAuthorityTransfersSuppressed, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Grid Authority Transfers Pending"), STAT_SpatialGridAuthorityTransfersPending, STATGROUP_SpatialNet);
+
+namespace
+{
+// Pending transfers are only looked at again when their Actor is, so this is how often the rest are checked for being stale.
+constexpr double PENDING_TRANSFERS_PURGE_INTERVAL_SECONDS = 10.0;
+}
+
 UGridBasedLBStrategy::UGridBasedLBStrategy()
 	: Super()
 	, Rows(1)
@@ -16,8 +25,14 @@ UGridBasedLBStrategy::UGridBasedLBStrategy()
 	, WorldWidth(1000000.f)
 	, WorldHeight(1000000.f)
 	, InterestBorder(0.f)
+	, AuthorityHysteresisDistance(0.f)
+	, AuthorityTransferDwellTime(0.f)
 	, LocalCellId(0)
 	, bIsStrategyUsedOnLocalWorker(false)
+	, InvRowHeight(0.f)
+	, InvColumnWidth(0.f)
+	, LastPendingTransfersPurgeTime(0.0)
+	, AuthorityTransferStats{}
 {
 }
 
@@ -27,6 +42,12 @@ void UGridBasedLBStrategy::Init()
 
 	UE_LOG(LogGridBasedLBStrategy, Log, TEXT("GridBasedLBStrategy initialized with Rows = %d and Cols = %d."), Rows, Cols);
 
+	if (AuthorityHysteresisDistance > InterestBorder)
+	{
+		UE_LOG(LogGridBasedLBStrategy, Warning, TEXT("GridBasedLBStrategy AuthorityHysteresisDistance (%f) is larger than InterestBorder (%f), so is being reduced to it."), AuthorityHysteresisDistance, InterestBorder);
+		AuthorityHysteresisDistance = InterestBorder;
+	}
+
 	const float WorldWidthMin = -(WorldWidth / 2.f);
 	const float WorldHeightMin = -(WorldHeight / 2.f);
 
@@ -39,13 +60,25 @@ void UGridBasedLBStrategy::Init()
 	float YMin = WorldWidthMin;
 	float XMax, YMax;
 
+	RowBoundaries.Reset(Rows + 1);
+	ColumnBoundaries.Reset(Cols + 1);
+	RowBoundaries.Add(XMin);
+	ColumnBoundaries.Add(YMin);
+	InvRowHeight = 1.f / RowHeight;
+	InvColumnWidth = 1.f / ColumnWidth;
+
 	for (uint32 Col = 0; Col < Cols; ++Col)
 	{
 		YMax = YMin + ColumnWidth;
+		ColumnBoundaries.Add(YMax);
 
 		for (uint32 Row = 0; Row < Rows; ++Row)
 		{
 			XMax = XMin + RowHeight;
+			if (Col == 0)
+			{
+				RowBoundaries.Add(XMax);
+			}
 
 			FVector2D Min(XMin, YMin);
 			FVector2D Max(XMax, YMax);
@@ -109,16 +142,186 @@ VirtualWorkerId UGridBasedLBStrategy::WhoShouldHaveAuthority(const AActor& Actor
 	const FVector2D Actor2DLocation = FVector2D(SpatialGDK::GetActorSpatialPosition(&Actor));
 
 	check(VirtualWorkerIds.Num() == WorkerCells.Num());
-	for (int i = 0; i < WorkerCells.Num(); i++)
+	const int32 CellIndex = GetCellIndex(Actor2DLocation);
+	if (CellIndex == INDEX_NONE)
+	{
+		return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	}
+
+	UE_LOG(LogGridBasedLBStrategy, Verbose, TEXT("Actor: %s, grid %d, worker %d for position %f, %f"), *AActor::GetDebugName(&Actor), CellIndex, VirtualWorkerIds[CellIndex], Actor2DLocation.X, Actor2DLocation.Y);
+	return VirtualWorkerIds[CellIndex];
+}
+
+bool UGridBasedLBStrategy::ShouldKeepAuthority(const AActor& Actor)
+{
+	return ShouldKeepAuthorityAtLocation(Actor, FVector2D(SpatialGDK::GetActorSpatialPosition(&Actor)), GetClockSeconds());
+}
+
+VirtualWorkerId UGridBasedLBStrategy::PredictWhoShouldHaveAuthority(const AActor& Actor, float LookaheadSeconds) const
+{
+	if (!IsReady())
+	{
+		return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	}
+
+	return PredictWhoShouldHaveAuthorityForLocation(FVector2D(SpatialGDK::GetActorSpatialPosition(&Actor)),
+		FVector2D(SpatialGDK::GetActorSpatialVelocity(&Actor)), LookaheadSeconds);
+}
+
+VirtualWorkerId UGridBasedLBStrategy::PredictWhoShouldHaveAuthorityForLocation(const FVector2D& Location, const FVector2D& Velocity, float LookaheadSeconds) const
+{
+	check(VirtualWorkerIds.Num() == WorkerCells.Num());
+
+	// Actors leaving the grid stay with the worker they are leaving, as WhoShouldHaveAuthority won't move them.
+	FVector2D PredictedLocation = Location + Velocity * LookaheadSeconds;
+	int32 CellIndex = GetCellIndex(PredictedLocation);
+	if (CellIndex == INDEX_NONE)
+	{
+		PredictedLocation = Location;
+		CellIndex = GetCellIndex(Location);
+	}
+
+	if (CellIndex == INDEX_NONE)
+	{
+		return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	}
+
+	// Within AuthorityHysteresisDistance of another cell, the worker with authority depends on which cell the Actor came from, not
+	// which one it is in. Predicting the cell it is in would have an Actor kept past a boundary predicted to leave even while it stands still.
+	if (AuthorityHysteresisDistance > 0.f && IsWithinHysteresisOfOtherCell(PredictedLocation, CellIndex))
+	{
+		return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	}
+
+	return VirtualWorkerIds[CellIndex];
+}
+
+bool UGridBasedLBStrategy::IsWithinHysteresisOfOtherCell(const FVector2D& Location, int32 CellIndex) const
+{
+	// Cells are axis-aligned boxes, so the square around the location only reaches another cell if one of its corners does.
+	const float Distance = AuthorityHysteresisDistance;
+	for (const FVector2D& Offset : { FVector2D(-Distance, -Distance), FVector2D(-Distance, Distance), FVector2D(Distance, -Distance), FVector2D(Distance, Distance) })
+	{
+		const int32 CornerCellIndex = GetCellIndex(Location + Offset);
+		if (CornerCellIndex != INDEX_NONE && CornerCellIndex != CellIndex)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool UGridBasedLBStrategy::ShouldKeepAuthorityAtLocation(const AActor& Actor, const FVector2D& Location, double Now)
+{
+	if (!IsReady())
+	{
+		UE_LOG(LogGridBasedLBStrategy, Warning, TEXT("GridBasedLBStrategy not ready to relinquish authority for Actor %s."), *AActor::GetDebugName(&Actor));
+		return false;
+	}
+
+	if (!bIsStrategyUsedOnLocalWorker)
+	{
+		return false;
+	}
+
+	PurgePendingTransfers(Now);
+
+	const FBox2D& LocalCell = WorkerCells[LocalCellId];
+	if (IsInside(LocalCell, Location))
 	{
-		if (IsInside(WorkerCells[i], Actor2DLocation))
+		PendingTransfers.Remove(&Actor);
+		return true;
+	}
+
+	if (AuthorityHysteresisDistance > 0.f && IsInside(LocalCell.ExpandBy(AuthorityHysteresisDistance), Location))
+	{
+		PendingTransfers.Remove(&Actor);
+		AuthorityTransferStats.NumSuppressedByHysteresis++;
+		INC_DWORD_STAT(STAT_SpatialGridAuthorityTransfersSuppressed);
+		return true;
+	}
+
+	if (AuthorityTransferDwellTime > 0.f)
+	{
+		// The dwell time restarts whenever the Actor heads for a different cell, so it is only handed over once it has settled.
+		const int32 CellIndex = GetCellIndex(Location);
+		const FPendingTransfer* PendingTransfer = PendingTransfers.Find(&Actor);
+		if (PendingTransfer == nullptr || PendingTransfer->CellIndex != CellIndex)
+		{
+			PendingTransfer = &PendingTransfers.Add(&Actor, FPendingTransfer{ CellIndex, Now });
+		}
+
+		if (Now - PendingTransfer->StartTime < AuthorityTransferDwellTime)
+		{
+			AuthorityTransferStats.NumSuppressedByDwellTime++;
+			INC_DWORD_STAT(STAT_SpatialGridAuthorityTransfersSuppressed);
+			SET_DWORD_STAT(STAT_SpatialGridAuthorityTransfersPending, PendingTransfers.Num());
+			return true;
+		}
+
+		PendingTransfers.Remove(&Actor);
+	}
+
+	AuthorityTransferStats.NumTransfersAllowed++;
+	SET_DWORD_STAT(STAT_SpatialGridAuthorityTransfersPending, PendingTransfers.Num());
+	return false;
+}
+
+void UGridBasedLBStrategy::PurgePendingTransfers(double Now)
+{
+	if (Now - LastPendingTransfersPurgeTime < PENDING_TRANSFERS_PURGE_INTERVAL_SECONDS)
+	{
+		return;
+	}
+	LastPendingTransfersPurgeTime = Now;
+
+	for (auto It = PendingTransfers.CreateIterator(); It; ++It)
+	{
+		const AActor* Actor = It.Key().Get();
+		if (Actor == nullptr || !Actor->HasAuthority())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	SET_DWORD_STAT(STAT_SpatialGridAuthorityTransfersPending, PendingTransfers.Num());
+}
+
+void UGridBasedLBStrategy::WhoShouldHaveAuthorityForLocations(TArrayView<const FVector2D> Locations, TArrayView<VirtualWorkerId> OutVirtualWorkerIds) const
+{
+	check(Locations.Num() == OutVirtualWorkerIds.Num());
+
+	if (!IsReady())
+	{
+		UE_LOG(LogGridBasedLBStrategy, Warning, TEXT("GridBasedLBStrategy not ready to decide on authority for %d locations."), Locations.Num());
+		for (VirtualWorkerId& OutVirtualWorkerId : OutVirtualWorkerIds)
 		{
-			UE_LOG(LogGridBasedLBStrategy, Log, TEXT("Actor: %s, grid %d, worker %d for position %f, %f"), *AActor::GetDebugName(&Actor), i, VirtualWorkerIds[i], Actor2DLocation.X, Actor2DLocation.Y);
-			return VirtualWorkerIds[i];
+			OutVirtualWorkerId = SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
 		}
+		return;
 	}
 
-	return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	check(VirtualWorkerIds.Num() == WorkerCells.Num());
+	for (int32 i = 0; i < Locations.Num(); i++)
+	{
+		const int32 CellIndex = GetCellIndex(Locations[i]);
+		OutVirtualWorkerIds[i] = CellIndex != INDEX_NONE ? VirtualWorkerIds[CellIndex] : SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	}
+}
+
+void UGridBasedLBStrategy::WhoShouldHaveAuthorityForActors(TArrayView<const AActor* const> Actors, TArrayView<VirtualWorkerId> OutVirtualWorkerIds) const
+{
+	check(Actors.Num() == OutVirtualWorkerIds.Num());
+
+	// Gather the positions first, so the lookups run over one contiguous array rather than chasing each actor's components.
+	TArray<FVector2D> Locations;
+	Locations.Reserve(Actors.Num());
+	for (const AActor* Actor : Actors)
+	{
+		Locations.Add(FVector2D(SpatialGDK::GetActorSpatialPosition(Actor)));
+	}
+
+	WhoShouldHaveAuthorityForLocations(Locations, OutVirtualWorkerIds);
 }
 
 SpatialGDK::QueryConstraint UGridBasedLBStrategy::GetWorkerInterestQueryConstraint() const
@@ -163,6 +366,55 @@ void UGridBasedLBStrategy::SetVirtualWorkerIds(const VirtualWorkerId& FirstVirtu
 	}
 }
 
+int32 UGridBasedLBStrategy::GetCellIndex(const FVector2D& Location) const
+{
+	// Lookups can be made from several threads at once, so the count is local and discarded.
+	uint64 NumBoundariesTested = 0;
+	return GetCellIndex(Location, NumBoundariesTested);
+}
+
+int32 UGridBasedLBStrategy::GetCellIndex(const FVector2D& Location, uint64& InOutNumBoundariesTested) const
+{
+	// Rows are perpendicular to the x-axis and columns to the y-axis, and cells are stored column by column.
+	const int32 Row = FindInterval(RowBoundaries, InvRowHeight, Location.X, InOutNumBoundariesTested);
+	const int32 Col = FindInterval(ColumnBoundaries, InvColumnWidth, Location.Y, InOutNumBoundariesTested);
+	if (Row == INDEX_NONE || Col == INDEX_NONE)
+	{
+		return INDEX_NONE;
+	}
+
+	return Col * static_cast<int32>(Rows) + Row;
+}
+
+int32 UGridBasedLBStrategy::FindInterval(const TArray<float>& Boundaries, float InvIntervalSize, float Value, uint64& InOutNumBoundariesTested)
+{
+	const int32 NumIntervals = Boundaries.Num() - 1;
+
+	// Written so that NaN is outside too.
+	InOutNumBoundariesTested += 2;
+	if (!(Value >= Boundaries[0] && Value < Boundaries[NumIntervals]))
+	{
+		return INDEX_NONE;
+	}
+
+	// The estimate can be off by one because of rounding, so settle it against the boundaries, which are what IsInside compares against.
+	const float Estimate = FMath::Clamp((Value - Boundaries[0]) * InvIntervalSize, 0.f, static_cast<float>(NumIntervals - 1));
+	int32 Index = FMath::TruncToInt(Estimate);
+	InOutNumBoundariesTested += 2;
+	while (Value < Boundaries[Index])
+	{
+		Index--;
+		InOutNumBoundariesTested++;
+	}
+	while (Value >= Boundaries[Index + 1])
+	{
+		Index++;
+		InOutNumBoundariesTested++;
+	}
+
+	return Index;
+}
+
 bool UGridBasedLBStrategy::IsInside(const FBox2D& Box, const FVector2D& Location)
 {
 	return Location.X >= Box.Min.X && Location.Y >= Box.Min.Y
@@ -4,6 +4,7 @@
 
 #include "EngineClasses/SpatialNetDriver.h"
 #include "EngineClasses/SpatialWorldSettings.h"
+#include "Interop/SpatialClassInfoManager.h"
 #include "LoadBalancing/GridBasedLBStrategy.h"
 #include "Utils/LayerInfo.h"
 #include "Utils/SpatialActorUtils.h"
@@ -14,6 +15,7 @@ DEFINE_LOG_CATEGORY(LogLayeredLBStrategy);
 
 ULayeredLBStrategy::ULayeredLBStrategy()
 	: Super()
+	, ClassInfoManager(nullptr)
 {
 }
 
@@ -58,7 +60,6 @@ void ULayeredLBStrategy::Init()
 		{
 			UE_LOG(LogLayeredLBStrategy, Log, TEXT(" - Adding class %s."), *ClassPtr.GetAssetName());
 			ClassPathToLayer.Add(ClassPtr, LayerName);
-
 		}
 	}
 
@@ -108,11 +109,23 @@ TSet<VirtualWorkerId> ULayeredLBStrategy::GetVirtualWorkerIds() const
 }
 
 bool ULayeredLBStrategy::ShouldHaveAuthority(const AActor& Actor) const
+{
+	const UAbstractLBStrategy* LayerLBStrategy = GetLocalLBStrategyForActor(Actor);
+	return LayerLBStrategy != nullptr && LayerLBStrategy->ShouldHaveAuthority(Actor);
+}
+
+bool ULayeredLBStrategy::ShouldKeepAuthority(const AActor& Actor)
+{
+	UAbstractLBStrategy* LayerLBStrategy = GetLocalLBStrategyForActor(Actor);
+	return LayerLBStrategy != nullptr && LayerLBStrategy->ShouldKeepAuthority(Actor);
+}
+
+UAbstractLBStrategy* ULayeredLBStrategy::GetLocalLBStrategyForActor(const AActor& Actor) const
 {
 	if (!IsReady())
 	{
 		UE_LOG(LogLayeredLBStrategy, Warning, TEXT("LayeredLBStrategy not ready to relinquish authority for Actor %s."), *AActor::GetDebugName(&Actor));
-		return false;
+		return nullptr;
 	}
 
 	const AActor* RootOwner = &Actor;
@@ -125,16 +138,16 @@ bool ULayeredLBStrategy::ShouldHaveAuthority(const AActor& Actor) const
 	if (!LayerNameToLBStrategy.Contains(LayerName))
 	{
 		UE_LOG(LogLayeredLBStrategy, Error, TEXT("LayeredLBStrategy doesn't have a LBStrategy for Actor %s which is in Layer %s."), *AActor::GetDebugName(RootOwner), *LayerName.ToString());
-		return false;
+		return nullptr;
 	}
 
-	// If this worker is not responsible for the Actor's layer, just return false.
+	// If this worker is not responsible for the Actor's layer, just return nullptr.
 	if (VirtualWorkerIdToLayerName.Contains(LocalVirtualWorkerId) && VirtualWorkerIdToLayerName[LocalVirtualWorkerId] != LayerName)
 	{
-		return false;
+		return nullptr;
 	}
 
-	return LayerNameToLBStrategy[LayerName]->ShouldHaveAuthority(Actor);
+	return LayerNameToLBStrategy[LayerName];
 }
 
 VirtualWorkerId ULayeredLBStrategy::WhoShouldHaveAuthority(const AActor& Actor) const
@@ -164,6 +177,23 @@ VirtualWorkerId ULayeredLBStrategy::WhoShouldHaveAuthority(const AActor& Actor)
 	return ReturnedWorkerId;
 }
 
+VirtualWorkerId ULayeredLBStrategy::PredictWhoShouldHaveAuthority(const AActor& Actor, float LookaheadSeconds) const
+{
+	if (!IsReady())
+	{
+		return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	}
+
+	const AActor* RootOwner = &Actor;
+	while (RootOwner->GetOwner() != nullptr && RootOwner->GetOwner()->GetIsReplicated())
+	{
+		RootOwner = RootOwner->GetOwner();
+	}
+
+	UAbstractLBStrategy* const* LayerLBStrategy = LayerNameToLBStrategy.Find(GetLayerNameForActor(*RootOwner));
+	return LayerLBStrategy != nullptr ? (*LayerLBStrategy)->PredictWhoShouldHaveAuthority(*RootOwner, LookaheadSeconds) : SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+}
+
 SpatialGDK::QueryConstraint ULayeredLBStrategy::GetWorkerInterestQueryConstraint() const
 {
 	check(IsReady());
@@ -247,6 +277,67 @@ void ULayeredLBStrategy::SetVirtualWorkerIds(const VirtualWorkerId& FirstVirtual
 	}
 }
 
+float ULayeredLBStrategy::GetRebalanceInterval() const
+{
+	// Rebalance as often as the most frequently rebalanced layer needs.
+	float RebalanceInterval = 0.f;
+	for (const auto& Elem : LayerNameToLBStrategy)
+	{
+		const float LayerRebalanceInterval = Elem.Value->GetRebalanceInterval();
+		if (LayerRebalanceInterval > 0.f && (RebalanceInterval == 0.f || LayerRebalanceInterval < RebalanceInterval))
+		{
+			RebalanceInterval = LayerRebalanceInterval;
+		}
+	}
+	return RebalanceInterval;
+}
+
+bool ULayeredLBStrategy::RebalanceFromLoads(const TMap<VirtualWorkerId, float>& LoadPerVirtualWorker)
+{
+	bool bChanged = false;
+	for (const auto& Elem : LayerNameToLBStrategy)
+	{
+		bChanged |= Elem.Value->RebalanceFromLoads(LoadPerVirtualWorker);
+	}
+	return bChanged;
+}
+
+void ULayeredLBStrategy::WritePartitionToSchema(Schema_Object* TranslationObject) const
+{
+	for (const auto& Elem : LayerNameToLBStrategy)
+	{
+		Elem.Value->WritePartitionToSchema(TranslationObject);
+	}
+}
+
+void ULayeredLBStrategy::ApplyPartitionFromSchema(Schema_Object* TranslationObject)
+{
+	for (const auto& Elem : LayerNameToLBStrategy)
+	{
+		Elem.Value->ApplyPartitionFromSchema(TranslationObject);
+	}
+}
+
+uint32 ULayeredLBStrategy::GetPartitionVersion() const
+{
+	// Layer versions only go up, so their sum changes whenever any of them does.
+	uint32 PartitionVersion = 0;
+	for (const auto& Elem : LayerNameToLBStrategy)
+	{
+		PartitionVersion += Elem.Value->GetPartitionVersion();
+	}
+	return PartitionVersion;
+}
+
+void ULayeredLBStrategy::SetClock(TFunction<double()> InClock)
+{
+	for (const auto& Elem : LayerNameToLBStrategy)
+	{
+		Elem.Value->SetClock(InClock);
+	}
+	Super::SetClock(MoveTemp(InClock));
+}
+
 // DEPRECATED
 // This is only included because Scavengers uses the function in SpatialStatics that calls this.
 // Once they are pick up this code, they should be able to switch to another method and we can remove this.
@@ -270,27 +361,30 @@ FName ULayeredLBStrategy::GetLayerNameForClass(const TSubclassOf<AActor> Class)
 		return NAME_None;
 	}
 
-	UClass* FoundClass = Class;
-	TSoftClassPtr<AActor> ClassPtr = TSoftClassPtr<AActor>(FoundClass);
-
-	while (FoundClass != nullptr && FoundClass->IsChildOf(AActor::StaticClass()))
+	if (ClassInfoManager != nullptr)
 	{
-		if (const FName* Layer = ClassPathToLayer.Find(ClassPtr))
+		const FClassInfo* Info = ClassInfoManager->FindClassInfoByClass(Class);
+		if (Info != nullptr && Info->LayerName != NAME_None)
 		{
-			FName LayerHolder = *Layer;
-			if (FoundClass != Class)
-			{
-				ClassPathToLayer.Add(TSoftClassPtr<AActor>(Class), LayerHolder);
-			}
-			return LayerHolder;
+			return Info->LayerName;
 		}
+	}
+
+	// A class without class info yet. Its Layer is stored once the class info is created.
+	return ResolveLayerNameForClass(Class);
+}
 
-		FoundClass = FoundClass->GetSuperClass();
-		ClassPtr = TSoftClassPtr<AActor>(FoundClass);
+FName ULayeredLBStrategy::ResolveLayerNameForClass(const UClass* Class) const
+{
+	for (const UClass* FoundClass = Class; FoundClass != nullptr && FoundClass->IsChildOf(AActor::StaticClass()); FoundClass = FoundClass->GetSuperClass())
+	{
+		if (const FName* Layer = ClassPathToLayer.Find(TSoftClassPtr<AActor>(FoundClass)))
+		{
+			return *Layer;
+		}
 	}
 
-	// No mapping found so set and return default actor group.
-	ClassPathToLayer.Add(TSoftClassPtr<AActor>(Class), SpatialConstants::DefaultLayer);
+	// No mapping found so return the default actor group.
 	return SpatialConstants::DefaultLayer;
 }
 
@@ -43,10 +43,8 @@ ActorLockToken UOwnershipLockingPolicy::AcquireLock(AActor* Actor, FString Debug
 			Actor->OnDestroyed.AddDynamic(this, &UOwnershipLockingPolicy::OnExplicitlyLockedActorDeleted);
 		}
 
-		AActor* OwnershipHierarchyRoot = SpatialGDK::GetHierarchyRoot(Actor);
-		AddOwnershipHierarchyRootInformation(OwnershipHierarchyRoot, Actor);
-		
-		ActorToLockingState.Add(Actor, MigrationLockElement{ 1, OwnershipHierarchyRoot });
+		ActorToLockingState.Add(Actor, MigrationLockElement{ 1, nullptr });
+		AddExplicitlyLockedActorToHierarchy(Actor);
 	}
 
 	UE_LOG(LogOwnershipLockingPolicy, Verbose, TEXT("Acquiring migration lock. "
@@ -78,8 +76,9 @@ bool UOwnershipLockingPolicy::ReleaseLock(const ActorLockToken Token)
 		{
 			UE_LOG(LogOwnershipLockingPolicy, Verbose, TEXT("Actor migration no longer locked. Actor: %s"), *Actor->GetName());
 			Actor->OnDestroyed.RemoveDynamic(this, &UOwnershipLockingPolicy::OnExplicitlyLockedActorDeleted);
-			RemoveOwnershipHierarchyRootInformation(ActorLockingState.HierarchyRoot, Actor);
+			AActor* HierarchyRoot = ActorLockingState.HierarchyRoot;
 			CountIt.RemoveCurrent();
+			RemoveExplicitlyLockedActorFromHierarchy(Actor, HierarchyRoot);
 		}
 		else
 		{
@@ -100,29 +99,8 @@ bool UOwnershipLockingPolicy::IsLocked(const AActor* Actor) const
 		return false;
 	}
 
-	// Is this Actor explicitly locked or on a locked hierarchy ownership path.
-	if (IsExplicitlyLocked(Actor) || IsLockedHierarchyRoot(Actor))
-	{
-		return true;
-	}
-
-	// Is the hierarchy root of this Actor explicitly locked or on a locked hierarchy ownership path.
-	if (AActor* HierarchyRoot = SpatialGDK::GetHierarchyRoot(Actor))
-	{
-		return IsExplicitlyLocked(HierarchyRoot) || IsLockedHierarchyRoot(HierarchyRoot);
-	}
-
-	return false;
-}
-
-bool UOwnershipLockingPolicy::IsExplicitlyLocked(const AActor* Actor) const
-{
-	return ActorToLockingState.Contains(Actor);
-}
-
-bool UOwnershipLockingPolicy::IsLockedHierarchyRoot(const AActor* Actor) const
-{
-	return LockedOwnershipRootActorToExplicitlyLockedActors.Contains(Actor);
+	// An Actor is locked if any Actor in its ownership hierarchy is explicitly locked.
+	return LockedActorToHierarchyRoot.Contains(Actor);
 }
 
 bool UOwnershipLockingPolicy::AcquireLockFromDelegate(AActor* ActorToLock, const FString& DelegateLockIdentifier)
@@ -155,29 +133,61 @@ void UOwnershipLockingPolicy::OnOwnerUpdated(const AActor* Actor, const AActor*
 {
 	check(Actor != nullptr);
 
-	// If an explicitly locked Actor is changing owner.
-	if (IsExplicitlyLocked(Actor))
+	// The Actor's subtree of the ownership hierarchy moves from its old hierarchy to its new one.
+	// Only the hierarchies which are locked need updating, and only the subtree which moved.
+	AActor* OldHierarchyRoot = LockedActorToHierarchyRoot.FindRef(Actor);
+	const AActor* NewHierarchyRoot = nullptr;
+	if (!Actor->IsPendingKillPending())
 	{
-		RecalculateLockedActorOwnershipHierarchyInformation(Actor);
+		const AActor* Root = SpatialGDK::GetHierarchyRoot(Actor);
+		NewHierarchyRoot = Root != nullptr ? Root : Actor;
 	}
 
-	// If a locked hierarchy root is changing owner.
-	if (IsLockedHierarchyRoot(Actor))
+	if (OldHierarchyRoot != nullptr)
 	{
-		RecalculateAllExplicitlyLockedActorsInThisHierarchy(Actor);
+		if (OldHierarchyRoot == NewHierarchyRoot)
+		{
+			// Moved within a locked hierarchy.
+			return;
+		}
+
+		RemoveLockedActors(Actor, OldHierarchyRoot);
+
+		// Explicitly locked Actors in the subtree are no longer locked Actors of the old hierarchy, so they moved with it.
+		TArray<AActor*>& ExplicitlyLockedActors = LockedHierarchyRootToExplicitlyLockedActors.FindChecked(OldHierarchyRoot);
+		TArray<AActor*> MovedExplicitlyLockedActors;
+		for (int32 i = ExplicitlyLockedActors.Num() - 1; i >= 0; i--)
+		{
+			if (!LockedActorToHierarchyRoot.Contains(ExplicitlyLockedActors[i]))
+			{
+				MovedExplicitlyLockedActors.Add(ExplicitlyLockedActors[i]);
+				ExplicitlyLockedActors.RemoveAtSwap(i);
+			}
+		}
+
+		if (ExplicitlyLockedActors.Num() == 0)
+		{
+			// Nothing left in the old hierarchy is explicitly locked, so the rest of it is no longer locked either.
+			LockedHierarchyRootToExplicitlyLockedActors.Remove(OldHierarchyRoot);
+			OldHierarchyRoot->OnDestroyed.RemoveDynamic(this, &UOwnershipLockingPolicy::OnHierarchyRootActorDeleted);
+			RemoveLockedActors(OldHierarchyRoot, OldHierarchyRoot);
+		}
+
+		for (AActor* ExplicitlyLockedActor : MovedExplicitlyLockedActors)
+		{
+			AddExplicitlyLockedActorToHierarchy(ExplicitlyLockedActor);
+		}
 	}
-	// If an Actor in a locked hierarchy is changing owner (i.e. either the old owner or
-	// the root hierarchy of the old owner is the root of a locked hierarchy), we need to
-	// recalculate ownership hierarchies of all explicitly locked Actors in that hierarchy.
-	else if (OldOwner != nullptr)
+
+	// If the subtree joined a locked hierarchy, it is now locked too. The root of a locked hierarchy is locked as its own root.
+	if (NewHierarchyRoot != nullptr && !LockedActorToHierarchyRoot.Contains(Actor))
 	{
-		const AActor* OldHierarchyRoot = OldOwner->GetOwner() != nullptr ? SpatialGDK::GetHierarchyRoot(OldOwner) : OldOwner;
-		if (IsLockedHierarchyRoot(OldHierarchyRoot))
+		if (AActor* LockedHierarchyRoot = LockedActorToHierarchyRoot.FindRef(NewHierarchyRoot))
 		{
-			RecalculateAllExplicitlyLockedActorsInThisHierarchy(OldHierarchyRoot);
+			AddLockedActors(Actor, LockedHierarchyRoot);
 		}
 	}
- }
+}
 
 void UOwnershipLockingPolicy::OnExplicitlyLockedActorDeleted(AActor* DestroyedActor)
 {
@@ -193,79 +203,134 @@ void UOwnershipLockingPolicy::OnExplicitlyLockedActorDeleted(AActor* DestroyedAc
 	// Delete Actor from local mapping.
 	MigrationLockElement ActorLockingState = ActorToLockingState.FindAndRemoveChecked(DestroyedActor);
 
-	// Update ownership path Actor mapping to remove this Actor.
-	RemoveOwnershipHierarchyRootInformation(ActorLockingState.HierarchyRoot, DestroyedActor);
+	// Update the locked hierarchy to remove this Actor.
+	RemoveExplicitlyLockedActorFromHierarchy(DestroyedActor, ActorLockingState.HierarchyRoot);
 }
 
 void UOwnershipLockingPolicy::OnHierarchyRootActorDeleted(AActor* DeletedHierarchyRoot)
 {
-	check(LockedOwnershipRootActorToExplicitlyLockedActors.Contains(DeletedHierarchyRoot));
-
-	// For all explicitly locked Actors where this Actor is on the ownership path, recalculate the
-	// ownership path information to account for this Actor's deletion.
-	RecalculateAllExplicitlyLockedActorsInThisHierarchy(DeletedHierarchyRoot);
-	LockedOwnershipRootActorToExplicitlyLockedActors.Remove(DeletedHierarchyRoot);
+	// The root may also be explicitly locked, in which case its hierarchy may already have been recalculated.
+	if (LockedHierarchyRootToExplicitlyLockedActors.Contains(DeletedHierarchyRoot))
+	{
+		// The hierarchy splits into the subtrees below the deleted root, so work out which of them are locked.
+		RecalculateLockedHierarchy(DeletedHierarchyRoot);
+	}
 }
 
-void UOwnershipLockingPolicy::RecalculateAllExplicitlyLockedActorsInThisHierarchy(const AActor* HierarchyRoot)
+void UOwnershipLockingPolicy::AddExplicitlyLockedActorToHierarchy(AActor* ExplicitlyLockedActor)
 {
-	TArray<const AActor*> ExplicitlyLockedActorsWithThisActorInOwnershipPath = LockedOwnershipRootActorToExplicitlyLockedActors.FindChecked(HierarchyRoot);
-	for (const AActor* ExplicitlyLockedActor : ExplicitlyLockedActorsWithThisActorInOwnershipPath)
+	AActor* HierarchyRoot = SpatialGDK::GetHierarchyRoot(ExplicitlyLockedActor);
+	if (HierarchyRoot == nullptr)
 	{
-		RecalculateLockedActorOwnershipHierarchyInformation(ExplicitlyLockedActor);
+		HierarchyRoot = ExplicitlyLockedActor;
 	}
-}
+	ActorToLockingState.FindChecked(ExplicitlyLockedActor).HierarchyRoot = HierarchyRoot;
 
-void UOwnershipLockingPolicy::RecalculateLockedActorOwnershipHierarchyInformation(const AActor* ExplicitlyLockedActor)
-{
-	// For the old ownership path, update ownership path Actor mapping to explicitly locked Actors to remove this Actor.
-	AActor* OldHierarchyRoot = ActorToLockingState.FindChecked(ExplicitlyLockedActor).HierarchyRoot;
-	RemoveOwnershipHierarchyRootInformation(OldHierarchyRoot, ExplicitlyLockedActor);
-
-	// For the new ownership path, update ownership path Actor mapping to explicitly locked Actors to include this Actor.
-	AActor* NewOwnershipHierarchyRoot = SpatialGDK::GetHierarchyRoot(ExplicitlyLockedActor);
-	ActorToLockingState.FindChecked(ExplicitlyLockedActor).HierarchyRoot = NewOwnershipHierarchyRoot;
-	AddOwnershipHierarchyRootInformation(NewOwnershipHierarchyRoot, ExplicitlyLockedActor);
+	// For the hierarchy root of an explicitly locked Actor, we store a reference from the hierarchy root Actor back to
+	// the explicitly locked Actor, as well as binding a deletion delegate to the hierarchy root Actor.
+	if (TArray<AActor*>* ExplicitlyLockedActors = LockedHierarchyRootToExplicitlyLockedActors.Find(HierarchyRoot))
+	{
+		ExplicitlyLockedActors->AddUnique(ExplicitlyLockedActor);
+		return;
+	}
+
+	LockedHierarchyRootToExplicitlyLockedActors.Add(HierarchyRoot, TArray<AActor*>{ ExplicitlyLockedActor });
+	if (!HierarchyRoot->OnDestroyed.IsAlreadyBound(this, &UOwnershipLockingPolicy::OnHierarchyRootActorDeleted))
+	{
+		HierarchyRoot->OnDestroyed.AddDynamic(this, &UOwnershipLockingPolicy::OnHierarchyRootActorDeleted);
+	}
+
+	// The hierarchy wasn't locked before, so lock all of it.
+	AddLockedActors(HierarchyRoot, HierarchyRoot);
 }
 
-void UOwnershipLockingPolicy::RemoveOwnershipHierarchyRootInformation(AActor* HierarchyRoot, const AActor* ExplicitlyLockedActor)
+void UOwnershipLockingPolicy::RemoveExplicitlyLockedActorFromHierarchy(AActor* ExplicitlyLockedActor, AActor* HierarchyRoot)
 {
-	if (HierarchyRoot == nullptr)
+	// The hierarchy may already have been recalculated if its root was deleted first.
+	TArray<AActor*>* ExplicitlyLockedActors = LockedHierarchyRootToExplicitlyLockedActors.Find(HierarchyRoot);
+	if (ExplicitlyLockedActors == nullptr || !ExplicitlyLockedActors->Contains(ExplicitlyLockedActor))
 	{
 		return;
 	}
 
-	// Find Actors in this root Actor's hierarchy which are explicitly locked.
-	TArray<const AActor*>& ExplicitlyLockedActorsWithThisActorOnPath = LockedOwnershipRootActorToExplicitlyLockedActors.FindChecked(HierarchyRoot);
-	check(ExplicitlyLockedActorsWithThisActorOnPath.Num() > 0);
-
 	// If there's only one explicitly locked Actor in the hierarchy, we're removing the only Actor with this root,
 	// so we can stop caring about the root itself. Otherwise, just remove the specific Actor entry in the root's list.
-	if (ExplicitlyLockedActorsWithThisActorOnPath.Num() == 1)
+	if (ExplicitlyLockedActors->Num() == 1)
 	{
-		LockedOwnershipRootActorToExplicitlyLockedActors.Remove(HierarchyRoot);
+		LockedHierarchyRootToExplicitlyLockedActors.Remove(HierarchyRoot);
 		HierarchyRoot->OnDestroyed.RemoveDynamic(this, &UOwnershipLockingPolicy::OnHierarchyRootActorDeleted);
+		RemoveLockedActors(HierarchyRoot, HierarchyRoot);
+		return;
 	}
-	else
+
+	ExplicitlyLockedActors->RemoveSwap(ExplicitlyLockedActor);
+
+	// A deleted root which was explicitly locked leaves the rest of its hierarchy in pieces.
+	if (ExplicitlyLockedActor == HierarchyRoot && ExplicitlyLockedActor->IsPendingKillPending())
 	{
-		ExplicitlyLockedActorsWithThisActorOnPath.Remove(ExplicitlyLockedActor);
+		RecalculateLockedHierarchy(HierarchyRoot);
 	}
 }
 
-void UOwnershipLockingPolicy::AddOwnershipHierarchyRootInformation(AActor* HierarchyRoot, const AActor* ExplicitlyLockedActor)
+void UOwnershipLockingPolicy::RecalculateLockedHierarchy(AActor* HierarchyRoot)
 {
-	if (HierarchyRoot == nullptr)
+	TArray<AActor*> ExplicitlyLockedActors = LockedHierarchyRootToExplicitlyLockedActors.FindAndRemoveChecked(HierarchyRoot);
+	HierarchyRoot->OnDestroyed.RemoveDynamic(this, &UOwnershipLockingPolicy::OnHierarchyRootActorDeleted);
+	RemoveLockedActors(HierarchyRoot, HierarchyRoot);
+
+	for (AActor* ExplicitlyLockedActor : ExplicitlyLockedActors)
 	{
-		return;
+		// Deleted Actors are removed by OnExplicitlyLockedActorDeleted.
+		if (!ExplicitlyLockedActor->IsPendingKillPending())
+		{
+			AddExplicitlyLockedActorToHierarchy(ExplicitlyLockedActor);
+		}
 	}
+}
 
-	// For the hierarchy root of an explicitly locked Actor, we store a reference from the hierarchy root Actor back to
-	// the explicitly locked Actor, as well as binding a deletion delegate to the hierarchy root Actor.
-	TArray<const AActor*>& ExplicitlyLockedActorsWithThisActorOnPath = LockedOwnershipRootActorToExplicitlyLockedActors.FindOrAdd(HierarchyRoot);
-	ExplicitlyLockedActorsWithThisActorOnPath.AddUnique(ExplicitlyLockedActor);
+void UOwnershipLockingPolicy::AddLockedActors(const AActor* Actor, AActor* HierarchyRoot)
+{
+	// Add the Actor and everything it owns. Actors owned by a deleted Actor are hierarchy roots, as in GetHierarchyRoot.
+	TArray<const AActor*> ActorsToAdd{ Actor };
+	while (ActorsToAdd.Num() > 0)
+	{
+		const AActor* ActorToAdd = ActorsToAdd.Pop(/* bAllowShrinking */ false);
+		LockedActorToHierarchyRoot.Add(ActorToAdd, HierarchyRoot);
 
-	if (!HierarchyRoot->OnDestroyed.IsAlreadyBound(this, &UOwnershipLockingPolicy::OnHierarchyRootActorDeleted))
+		if (!ActorToAdd->IsPendingKillPending())
+		{
+			for (const AActor* Child : ActorToAdd->Children)
+			{
+				if (Child != nullptr)
+				{
+					ActorsToAdd.Add(Child);
+				}
+			}
+		}
+	}
+}
+
+void UOwnershipLockingPolicy::RemoveLockedActors(const AActor* Actor, const AActor* HierarchyRoot)
+{
+	// Remove the Actor and everything it owns which is locked as part of the same hierarchy.
+	TArray<const AActor*> ActorsToRemove{ Actor };
+	while (ActorsToRemove.Num() > 0)
 	{
-		HierarchyRoot->OnDestroyed.AddDynamic(this, &UOwnershipLockingPolicy::OnHierarchyRootActorDeleted);
+		const AActor* ActorToRemove = ActorsToRemove.Pop(/* bAllowShrinking */ false);
+
+		AActor* const* LockedHierarchyRoot = LockedActorToHierarchyRoot.Find(ActorToRemove);
+		if (LockedHierarchyRoot == nullptr || *LockedHierarchyRoot != HierarchyRoot)
+		{
+			continue;
+		}
+		LockedActorToHierarchyRoot.Remove(ActorToRemove);
+
+		for (const AActor* Child : ActorToRemove->Children)
+		{
+			if (Child != nullptr)
+			{
+				ActorsToRemove.Add(Child);
+			}
+		}
 	}
 }
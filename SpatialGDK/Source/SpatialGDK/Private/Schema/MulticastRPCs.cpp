@@ -8,17 +8,29 @@ namespace SpatialGDK
 MulticastRPCs::MulticastRPCs(const Worker_ComponentData& Data)
 	: MulticastRPCBuffer(ERPCType::NetMulticast)
 {
-	ReadFromSchema(Schema_GetComponentDataFields(Data.schema_type));
+	Schema_Object* SchemaObject = Schema_GetComponentDataFields(Data.schema_type);
+
+	// RPCs already on the component when it's checked out are ignored (see SpatialRPCService::OnCheckoutMulticastRPCComponentOnEntity),
+	// so skip reading them. If the component was created with initial RPCs, last sent ID is 0 and they are all read.
+	uint64 LastSentRPCId = 0;
+	const Schema_FieldId LastSentRPCFieldId = RPCRingBufferUtils::GetRingBufferDescriptor(ERPCType::NetMulticast).LastSentRPCFieldId;
+	if (Schema_GetUint64Count(SchemaObject, LastSentRPCFieldId) > 0)
+	{
+		LastSentRPCId = Schema_GetUint64(SchemaObject, LastSentRPCFieldId);
+	}
+
+	ReadFromSchema(SchemaObject, LastSentRPCId);
 }
 
 void MulticastRPCs::ApplyComponentUpdate(const Worker_ComponentUpdate& Update)
 {
-	ReadFromSchema(Schema_GetComponentUpdateFields(Update.schema_type));
+	// Elements up to the previous last sent ID have been read already.
+	ReadFromSchema(Schema_GetComponentUpdateFields(Update.schema_type), MulticastRPCBuffer.LastSentRPCId);
 }
 
-void MulticastRPCs::ReadFromSchema(Schema_Object* SchemaObject)
+void MulticastRPCs::ReadFromSchema(Schema_Object* SchemaObject, uint64 SkipUpToRPCId)
 {
-	RPCRingBufferUtils::ReadBufferFromSchema(SchemaObject, MulticastRPCBuffer);
+	RPCRingBufferUtils::ReadBufferFromSchema(SchemaObject, MulticastRPCBuffer, SkipUpToRPCId);
 
 	// This is a special field that is set when creating a MulticastRPCs component with initial RPCs.
 	// The server that first gains authority over the component will set last sent RPC ID to be equal
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Interop/SpatialRPCService.h"
 #include "Interop/SpatialStaticComponentView.h"
+#include "Schema/MulticastRPCs.h"
 #include "Schema/RPCPayload.h"
 #include "SpatialConstants.h"
 #include "SpatialGDKSettings.h"
@@ -41,6 +42,11 @@ constexpr Worker_EntityId RPCTestEntityId_2 = 42;
 
 const SpatialGDK::RPCPayload SimplePayload = SpatialGDK::RPCPayload(1, 0, TArray<uint8>({ 1 }, 1));
 
+SpatialGDK::RPCPayload CreateIndexedPayload(uint32 Index)
+{
+	return SpatialGDK::RPCPayload(1, Index, TArray<uint8>({ 1 }, 1));
+}
+
 ExtractRPCDelegate DefaultRPCDelegate = ExtractRPCDelegate::CreateLambda([](Worker_EntityId EntityId, ERPCType RPCType, const SpatialGDK::RPCPayload& Payload) {
 	return true;
 });
@@ -109,14 +115,15 @@ USpatialStaticComponentView* CreateStaticComponentView(const TArray<Worker_Entit
 SpatialGDK::SpatialRPCService CreateRPCService(const TArray<Worker_EntityId>& EntityIdArray,
 	ERPCEndpointType RPCEndpointType,
 	ExtractRPCDelegate RPCDelegate = DefaultRPCDelegate,
-	USpatialStaticComponentView* StaticComponentView = nullptr)
+	USpatialStaticComponentView* StaticComponentView = nullptr,
+	bool bBundleMulticastRPCs = false)
 {
 	if (StaticComponentView == nullptr)
 	{
 		StaticComponentView = CreateStaticComponentView(EntityIdArray, RPCEndpointType);
 	}
 
-	SpatialGDK::SpatialRPCService RPCService = SpatialGDK::SpatialRPCService(RPCDelegate, StaticComponentView, nullptr);
+	SpatialGDK::SpatialRPCService RPCService = SpatialGDK::SpatialRPCService(RPCDelegate, StaticComponentView, nullptr, bBundleMulticastRPCs);
 
 	for (Worker_EntityId EntityId : EntityIdArray)
 	{
@@ -175,6 +182,15 @@ FWorkerComponentData GetComponentDataOnEntityCreationFromRPCService(SpatialGDK::
 	return *ComponentData;
 }
 
+void ApplyMulticastUpdateToStaticComponentView(USpatialStaticComponentView& StaticComponentView, Worker_EntityId EntityId, Schema_ComponentUpdate* ComponentUpdate)
+{
+	Worker_ComponentUpdateOp UpdateOp = {};
+	UpdateOp.entity_id = EntityId;
+	UpdateOp.update.component_id = SpatialConstants::MULTICAST_RPCS_COMPONENT_ID;
+	UpdateOp.update.schema_type = ComponentUpdate;
+	StaticComponentView.OnComponentUpdate(UpdateOp);
+}
+
 } // anonymous namespace
 
 RPC_SERVICE_TEST(GIVEN_authority_over_server_endpoint_WHEN_push_client_reliable_rpcs_to_the_service_THEN_rpc_push_result_success)
@@ -496,3 +512,226 @@ RPC_SERVICE_TEST(GIVEN_receiving_an_rpc_WHEN_return_false_from_extract_callback_
 	TestTrue("Returning false in extraction callback correctly stopped processing RPCs", bTestPassed);
 	return true;
 }
+
+RPC_SERVICE_TEST(GIVEN_bundling_multicast_rpcs_WHEN_push_burst_of_multicast_rpcs_THEN_single_ring_buffer_element_holds_all_payloads)
+{
+	SpatialGDK::SpatialRPCService RPCService = CreateRPCService({ RPCTestEntityId_1 }, SERVER_AUTH, DefaultRPCDelegate, nullptr, true);
+
+	// More RPCs than fit in the ring buffer, which would overwrite each other if they were sent as separate elements.
+	const uint32 RPCsToSend = 3 * GetDefault<USpatialGDKSettings>()->GetRPCRingBufferSize(ERPCType::NetMulticast);
+	for (uint32 i = 0; i < RPCsToSend; ++i)
+	{
+		SpatialGDK::EPushRPCResult Result = RPCService.PushRPC(RPCTestEntityId_1, ERPCType::NetMulticast, CreateIndexedPayload(i), false);
+		TestTrue("Push RPC returned expected results", (Result == SpatialGDK::EPushRPCResult::Success));
+	}
+
+	TArray<SpatialGDK::SpatialRPCService::UpdateToSend> UpdateToSendArray = RPCService.GetRPCsAndAcksToSend();
+	if (!TestEqual("One update is sent", UpdateToSendArray.Num(), 1))
+	{
+		return true;
+	}
+
+	const SpatialGDK::SpatialRPCService::UpdateToSend& Update = UpdateToSendArray[0];
+	TestTrue("Update is for the multicast component", Update.Update.component_id == SpatialConstants::MULTICAST_RPCS_COMPONENT_ID);
+
+	Schema_Object* SchemaObject = Schema_GetComponentUpdateFields(Update.Update.schema_type);
+	SpatialGDK::RPCRingBufferDescriptor Descriptor = SpatialGDK::RPCRingBufferUtils::GetRingBufferDescriptor(ERPCType::NetMulticast);
+	TestTrue("Last sent RPC ID covers a single element", Schema_GetUint64(SchemaObject, Descriptor.LastSentRPCFieldId) == 1);
+	TestTrue("Only one ring buffer element is written", Schema_GetObjectCount(SchemaObject, Descriptor.GetRingBufferElementFieldId(2)) == 0);
+
+	SpatialGDK::RPCRingBuffer Buffer(ERPCType::NetMulticast);
+	SpatialGDK::RPCRingBufferUtils::ReadBufferFromSchema(SchemaObject, Buffer);
+
+	const TOptional<SpatialGDK::RPCPayload>& Element = Buffer.GetRingBufferElement(1);
+	const TArray<SpatialGDK::RPCPayload>& BundledRPCs = Buffer.GetBundledRPCs(1);
+	bool bPayloadsMatch = Element.IsSet() && CompareRPCPayload(Element.GetValue(), CreateIndexedPayload(0)) && BundledRPCs.Num() == static_cast<int32>(RPCsToSend) - 1;
+	for (int32 i = 0; bPayloadsMatch && i < BundledRPCs.Num(); ++i)
+	{
+		bPayloadsMatch &= CompareRPCPayload(BundledRPCs[i], CreateIndexedPayload(i + 1));
+	}
+	TestTrue("Bundle holds all payloads in order", bPayloadsMatch);
+
+	Schema_DestroyComponentUpdate(Update.Update.schema_type);
+	return true;
+}
+
+RPC_SERVICE_TEST(GIVEN_bundling_multicast_rpcs_WHEN_push_multicast_rpcs_across_flushes_THEN_each_flush_sends_next_rpc_id)
+{
+	SpatialGDK::SpatialRPCService RPCService = CreateRPCService({ RPCTestEntityId_1, RPCTestEntityId_2 }, SERVER_AUTH, DefaultRPCDelegate, nullptr, true);
+	SpatialGDK::RPCRingBufferDescriptor Descriptor = SpatialGDK::RPCRingBufferUtils::GetRingBufferDescriptor(ERPCType::NetMulticast);
+
+	for (uint64 ExpectedRPCId = 1; ExpectedRPCId <= 3; ++ExpectedRPCId)
+	{
+		RPCService.PushRPC(RPCTestEntityId_1, ERPCType::NetMulticast, SimplePayload, false);
+		RPCService.PushRPC(RPCTestEntityId_1, ERPCType::NetMulticast, SimplePayload, false);
+		RPCService.PushRPC(RPCTestEntityId_2, ERPCType::NetMulticast, SimplePayload, false);
+
+		TArray<SpatialGDK::SpatialRPCService::UpdateToSend> UpdateToSendArray = RPCService.GetRPCsAndAcksToSend();
+		TestEqual("One update is sent per entity", UpdateToSendArray.Num(), 2);
+
+		for (const SpatialGDK::SpatialRPCService::UpdateToSend& Update : UpdateToSendArray)
+		{
+			Schema_Object* SchemaObject = Schema_GetComponentUpdateFields(Update.Update.schema_type);
+			TestTrue("Last sent RPC ID advances by one per flush", Schema_GetUint64(SchemaObject, Descriptor.LastSentRPCFieldId) == ExpectedRPCId);
+			Schema_DestroyComponentUpdate(Update.Update.schema_type);
+		}
+	}
+
+	return true;
+}
+
+RPC_SERVICE_TEST(GIVEN_multicast_rpc_bundles_received_WHEN_extract_rpcs_from_the_service_THEN_all_payloads_extracted_in_order)
+{
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*StaticComponentView,
+		RPCTestEntityId_1, SpatialConstants::MULTICAST_RPCS_COMPONENT_ID,
+		GetMulticastAuthorityFromRPCEndpointType(NO_AUTH));
+
+	TArray<uint32> ExtractedIndices;
+	ExtractRPCDelegate RPCDelegate = ExtractRPCDelegate::CreateLambda([&ExtractedIndices](Worker_EntityId EntityId, ERPCType RPCType, const SpatialGDK::RPCPayload& Payload) {
+		ExtractedIndices.Add(Payload.Index);
+		return true;
+	});
+
+	SpatialGDK::SpatialRPCService RPCService = CreateRPCService({ RPCTestEntityId_1 }, NO_AUTH, RPCDelegate, StaticComponentView);
+	RPCService.OnCheckoutMulticastRPCComponentOnEntity(RPCTestEntityId_1);
+
+	// Two bundles followed by a single RPC, as sent by a server over three ticks.
+	Schema_ComponentUpdate* ComponentUpdate = Schema_CreateComponentUpdate();
+	Schema_Object* SchemaObject = Schema_GetComponentUpdateFields(ComponentUpdate);
+	SpatialGDK::RPCRingBufferUtils::WriteRPCBundleToSchema(SchemaObject, ERPCType::NetMulticast, 1, { CreateIndexedPayload(0), CreateIndexedPayload(1), CreateIndexedPayload(2) });
+	SpatialGDK::RPCRingBufferUtils::WriteRPCBundleToSchema(SchemaObject, ERPCType::NetMulticast, 2, { CreateIndexedPayload(3), CreateIndexedPayload(4) });
+	SpatialGDK::RPCRingBufferUtils::WriteRPCToSchema(SchemaObject, ERPCType::NetMulticast, 3, CreateIndexedPayload(5));
+	ApplyMulticastUpdateToStaticComponentView(*StaticComponentView, RPCTestEntityId_1, ComponentUpdate);
+	Schema_DestroyComponentUpdate(ComponentUpdate);
+
+	RPCService.ExtractRPCsForEntity(RPCTestEntityId_1, SpatialConstants::MULTICAST_RPCS_COMPONENT_ID);
+
+	TestTrue("All payloads were extracted in order", ExtractedIndices == TArray<uint32>({ 0, 1, 2, 3, 4, 5 }));
+	return true;
+}
+
+RPC_SERVICE_TEST(GIVEN_multicast_rpc_bundle_received_WHEN_return_false_from_extract_callback_midway_THEN_next_extraction_resumes_within_bundle)
+{
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*StaticComponentView,
+		RPCTestEntityId_1, SpatialConstants::MULTICAST_RPCS_COMPONENT_ID,
+		GetMulticastAuthorityFromRPCEndpointType(NO_AUTH));
+
+	TArray<uint32> ExtractedIndices;
+	bool bStopAtSecondPayload = true;
+	ExtractRPCDelegate RPCDelegate = ExtractRPCDelegate::CreateLambda([&ExtractedIndices, &bStopAtSecondPayload](Worker_EntityId EntityId, ERPCType RPCType, const SpatialGDK::RPCPayload& Payload) {
+		if (bStopAtSecondPayload && Payload.Index == 1)
+		{
+			return false;
+		}
+		ExtractedIndices.Add(Payload.Index);
+		return true;
+	});
+
+	SpatialGDK::SpatialRPCService RPCService = CreateRPCService({ RPCTestEntityId_1 }, NO_AUTH, RPCDelegate, StaticComponentView);
+	RPCService.OnCheckoutMulticastRPCComponentOnEntity(RPCTestEntityId_1);
+
+	Schema_ComponentUpdate* ComponentUpdate = Schema_CreateComponentUpdate();
+	SpatialGDK::RPCRingBufferUtils::WriteRPCBundleToSchema(Schema_GetComponentUpdateFields(ComponentUpdate), ERPCType::NetMulticast, 1, { CreateIndexedPayload(0), CreateIndexedPayload(1), CreateIndexedPayload(2) });
+	ApplyMulticastUpdateToStaticComponentView(*StaticComponentView, RPCTestEntityId_1, ComponentUpdate);
+	Schema_DestroyComponentUpdate(ComponentUpdate);
+
+	RPCService.ExtractRPCsForEntity(RPCTestEntityId_1, SpatialConstants::MULTICAST_RPCS_COMPONENT_ID);
+	TestTrue("Extraction stopped within the bundle", ExtractedIndices == TArray<uint32>({ 0 }));
+
+	bStopAtSecondPayload = false;
+	RPCService.ExtractRPCsForEntity(RPCTestEntityId_1, SpatialConstants::MULTICAST_RPCS_COMPONENT_ID);
+	TestTrue("Extraction resumed without repeating payloads", ExtractedIndices == TArray<uint32>({ 0, 1, 2 }));
+
+	RPCService.ExtractRPCsForEntity(RPCTestEntityId_1, SpatialConstants::MULTICAST_RPCS_COMPONENT_ID);
+	TestTrue("Fully extracted bundle is not extracted again", ExtractedIndices == TArray<uint32>({ 0, 1, 2 }));
+	return true;
+}
+
+RPC_SERVICE_TEST(GIVEN_multicast_component_with_sent_rpcs_WHEN_checked_out_THEN_ring_buffer_elements_are_not_read)
+{
+	const uint32 RingBufferSize = GetDefault<USpatialGDKSettings>()->GetRPCRingBufferSize(ERPCType::NetMulticast);
+
+	Worker_ComponentData Data = {};
+	Data.component_id = SpatialConstants::MULTICAST_RPCS_COMPONENT_ID;
+	Data.schema_type = Schema_CreateComponentData();
+	Schema_Object* SchemaObject = Schema_GetComponentDataFields(Data.schema_type);
+
+	// A burst that wrapped around the ring buffer, so every element holds an RPC.
+	const uint64 LastSentRPCId = RingBufferSize + 5;
+	for (uint64 RPCId = 6; RPCId <= LastSentRPCId; ++RPCId)
+	{
+		SpatialGDK::RPCRingBufferUtils::WriteRPCBundleToSchema(SchemaObject, ERPCType::NetMulticast, RPCId, { SimplePayload, SimplePayload });
+	}
+
+	SpatialGDK::MulticastRPCs Component(Data);
+	TestTrue("Last sent RPC ID is read", Component.MulticastRPCBuffer.LastSentRPCId == LastSentRPCId);
+
+	bool bAnyElementRead = false;
+	for (uint64 RPCId = 6; RPCId <= LastSentRPCId; ++RPCId)
+	{
+		bAnyElementRead |= Component.MulticastRPCBuffer.GetRingBufferElement(RPCId).IsSet();
+		bAnyElementRead |= Component.MulticastRPCBuffer.GetBundledRPCs(RPCId).Num() > 0;
+	}
+	TestFalse("RPCs ignored on checkout are not read", bAnyElementRead);
+
+	Schema_DestroyComponentData(Data.schema_type);
+	return true;
+}
+
+RPC_SERVICE_TEST(GIVEN_multicast_component_with_initially_present_rpcs_WHEN_checked_out_THEN_ring_buffer_elements_are_read)
+{
+	Worker_ComponentData Data = {};
+	Data.component_id = SpatialConstants::MULTICAST_RPCS_COMPONENT_ID;
+	Data.schema_type = Schema_CreateComponentData();
+	Schema_Object* SchemaObject = Schema_GetComponentDataFields(Data.schema_type);
+
+	SpatialGDK::RPCRingBufferUtils::WriteRPCToSchema(SchemaObject, ERPCType::NetMulticast, 1, CreateIndexedPayload(0));
+	SpatialGDK::RPCRingBufferUtils::WriteRPCToSchema(SchemaObject, ERPCType::NetMulticast, 2, CreateIndexedPayload(1));
+	SpatialGDK::RPCRingBufferUtils::MoveLastSentIdToInitiallyPresentCount(SchemaObject, 2);
+
+	SpatialGDK::MulticastRPCs Component(Data);
+	TestTrue("Initially present count is read", Component.InitiallyPresentMulticastRPCsCount == 2);
+	TestTrue("First initial RPC is read", Component.MulticastRPCBuffer.GetRingBufferElement(1).IsSet());
+	TestTrue("Second initial RPC is read", Component.MulticastRPCBuffer.GetRingBufferElement(2).IsSet());
+
+	Schema_DestroyComponentData(Data.schema_type);
+	return true;
+}
+
+RPC_SERVICE_TEST(GIVEN_multicast_rpcs_checked_out_WHEN_update_rewrites_seen_elements_THEN_only_new_elements_are_read)
+{
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+
+	Schema_ComponentData* ComponentData = Schema_CreateComponentData();
+	SpatialGDK::RPCRingBufferUtils::WriteRPCToSchema(Schema_GetComponentDataFields(ComponentData), ERPCType::NetMulticast, 1, CreateIndexedPayload(0));
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*StaticComponentView,
+		RPCTestEntityId_1, SpatialConstants::MULTICAST_RPCS_COMPONENT_ID,
+		ComponentData,
+		GetMulticastAuthorityFromRPCEndpointType(NO_AUTH));
+
+	TArray<uint32> ExtractedIndices;
+	ExtractRPCDelegate RPCDelegate = ExtractRPCDelegate::CreateLambda([&ExtractedIndices](Worker_EntityId EntityId, ERPCType RPCType, const SpatialGDK::RPCPayload& Payload) {
+		ExtractedIndices.Add(Payload.Index);
+		return true;
+	});
+
+	SpatialGDK::SpatialRPCService RPCService = CreateRPCService({ RPCTestEntityId_1 }, NO_AUTH, RPCDelegate, StaticComponentView);
+	RPCService.OnCheckoutMulticastRPCComponentOnEntity(RPCTestEntityId_1);
+
+	// The update carries the already seen element again alongside a new one.
+	Schema_ComponentUpdate* ComponentUpdate = Schema_CreateComponentUpdate();
+	Schema_Object* SchemaObject = Schema_GetComponentUpdateFields(ComponentUpdate);
+	SpatialGDK::RPCRingBufferUtils::WriteRPCToSchema(SchemaObject, ERPCType::NetMulticast, 1, CreateIndexedPayload(0));
+	SpatialGDK::RPCRingBufferUtils::WriteRPCToSchema(SchemaObject, ERPCType::NetMulticast, 2, CreateIndexedPayload(1));
+	ApplyMulticastUpdateToStaticComponentView(*StaticComponentView, RPCTestEntityId_1, ComponentUpdate);
+	Schema_DestroyComponentUpdate(ComponentUpdate);
+
+	const SpatialGDK::MulticastRPCs* Component = StaticComponentView->GetComponentData<SpatialGDK::MulticastRPCs>(RPCTestEntityId_1);
+	TestFalse("Already seen element is not read", Component->MulticastRPCBuffer.GetRingBufferElement(1).IsSet());
+
+	RPCService.ExtractRPCsForEntity(RPCTestEntityId_1, SpatialConstants::MULTICAST_RPCS_COMPONENT_ID);
+	TestTrue("Only the new RPC is extracted", ExtractedIndices == TArray<uint32>({ 1 }));
+	return true;
+}
@@ -22,3 +22,22 @@ void TestingSchemaHelpers::AddTranslationComponentDataMapping(Schema_Object* Com
 	Schema_AddUint32(SchemaObject, SpatialConstants::MAPPING_VIRTUAL_WORKER_ID, VWId);
 	SpatialGDK::AddStringToSchema(SchemaObject, SpatialConstants::MAPPING_PHYSICAL_WORKER_NAME, WorkerName);
 }
+
+void TestingSchemaHelpers::SetTranslationComponentDataMappingVersion(Schema_Object* ComponentDataFields, uint32 MappingVersion)
+{
+	Schema_AddUint32(ComponentDataFields, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_VERSION_ID, MappingVersion);
+}
+
+void TestingSchemaHelpers::SetTranslationComponentDataSnapshotVersion(Schema_Object* ComponentDataFields, uint32 SnapshotVersion)
+{
+	Schema_AddUint32(ComponentDataFields, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_SNAPSHOT_VERSION_ID, SnapshotVersion);
+}
+
+void TestingSchemaHelpers::AddTranslationComponentDataMappingChange(Schema_Object* ComponentDataFields, VirtualWorkerId VWId, const PhysicalWorkerName& WorkerName, uint32 Version, Worker_EntityId ServerWorkerEntityId)
+{
+	Schema_Object* SchemaObject = Schema_AddObject(ComponentDataFields, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_CHANGES_ID);
+	Schema_AddUint32(SchemaObject, SpatialConstants::MAPPING_VIRTUAL_WORKER_ID, VWId);
+	SpatialGDK::AddStringToSchema(SchemaObject, SpatialConstants::MAPPING_PHYSICAL_WORKER_NAME, WorkerName);
+	Schema_AddEntityId(SchemaObject, SpatialConstants::MAPPING_SERVER_WORKER_ENTITY_ID, ServerWorkerEntityId);
+	Schema_AddUint32(SchemaObject, SpatialConstants::MAPPING_VERSION_ID, Version);
+}
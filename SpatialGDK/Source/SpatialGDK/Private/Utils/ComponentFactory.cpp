@@ -14,14 +14,18 @@
 #include "Net/NetworkProfiler.h"
 #include "Schema/Interest.h"
 #include "SpatialConstants.h"
+#include "Utils/FastArrayItemDelta.h"
 #include "Utils/InterestFactory.h"
 #include "Utils/RepLayoutUtils.h"
+#include "Utils/SpatialBandwidthProfiler.h"
 #include "Utils/SpatialLatencyTracer.h"
+#include "Utils/SpatialMetrics.h"
 
 DEFINE_LOG_CATEGORY(LogComponentFactory);
 
 DECLARE_CYCLE_STAT(TEXT("Factory ProcessPropertyUpdates"), STAT_FactoryProcessPropertyUpdates, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("Factory ProcessFastArrayUpdate"), STAT_FactoryProcessFastArrayUpdate, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("Factory AddPrimitiveArray"), STAT_FactoryAddPrimitiveArray, STATGROUP_SpatialNet);
 
 namespace
 {
@@ -44,8 +48,23 @@ ComponentFactory::ComponentFactory(bool bInterestDirty, USpatialNetDriver* InNet
 	, ClassInfoManager(InNetDriver->ClassInfoManager)
 	, bInterestHasChanged(bInterestDirty)
 	, LatencyTracer(InLatencyTracer)
+	, UpdateChannel(nullptr)
+	, bFastArrayItemDeltas(FFastArrayItemDelta::IsEnabled())
+	, bWritingWholeState(false)
+	, Profiler(InNetDriver->SpatialMetrics != nullptr ? InNetDriver->SpatialMetrics->GetActiveBandwidthProfiler() : nullptr)
+	, Allocations{}
 { }
 
+void ComponentFactory::Reset(bool bInterestDirty, USpatialLatencyTracer* InLatencyTracer)
+{
+	bInterestHasChanged = bInterestDirty;
+	LatencyTracer = InLatencyTracer;
+	UpdateChannel = nullptr;
+
+	// Profiling can be started and stopped while the factory is alive.
+	Profiler = NetDriver->SpatialMetrics != nullptr ? NetDriver->SpatialMetrics->GetActiveBandwidthProfiler() : nullptr;
+}
+
 uint32 ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObject* Object, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, bool bIsInitialData, TraceKey* OutLatencyTraceId, TArray<Schema_FieldId>* ClearedIds /*= nullptr*/)
 {
 	SCOPE_CYCLE_COUNTER(STAT_FactoryProcessPropertyUpdates);
@@ -90,9 +109,9 @@ uint32 ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObjec
 
 				bool bProcessedFastArrayProperty = false;
 
-#if USE_NETWORK_PROFILER
-				const uint32 ProfilerBytesStart = Schema_GetWriteBufferLength(ComponentObject);
-#endif
+				// Measuring the buffer isn't free, so only do it when a profiler is listening.
+				const bool bProfileProperty = USE_NETWORK_PROFILER || Profiler != nullptr;
+				const uint32 ProfilerBytesStart = bProfileProperty ? Schema_GetWriteBufferLength(ComponentObject) : 0;
 
 				if (Cmd.Type == ERepLayoutCmdType::DynamicArray)
 				{
@@ -103,11 +122,23 @@ uint32 ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObjec
 					{
 						SCOPE_CYCLE_COUNTER(STAT_FactoryProcessFastArrayUpdate);
 
-						FSpatialNetBitWriter ValueDataWriter(PackageMap);
-
-						if (FSpatialNetDeltaSerializeInfo::DeltaSerializeWrite(NetDriver, ValueDataWriter, Object, Parent.ArrayIndex, Parent.Property, NetDeltaStruct) || bIsInitialData)
+						if (bFastArrayItemDeltas && UpdateChannel != nullptr && !bIsInitialData)
+						{
+							AddFastArrayItemDeltaOrKeyframe(ComponentObject, HandleIterator.Handle, Object, Parent, ArrayProperty, NetDeltaStruct);
+						}
+						else
 						{
-							AddBytesToSchema(ComponentObject, HandleIterator.Handle, ValueDataWriter);
+							if (bFastArrayItemDeltas)
+							{
+								FFastArrayItemDelta::AssignItemIds(Parent.Property->ContainerPtrToValuePtr<void>(Object, Parent.ArrayIndex), ArrayProperty);
+							}
+
+							FSpatialNetBitWriter ValueDataWriter(PackageMap);
+
+							if (FSpatialNetDeltaSerializeInfo::DeltaSerializeWrite(NetDriver, ValueDataWriter, Object, Parent.ArrayIndex, Parent.Property, NetDeltaStruct) || bIsInitialData || bWritingWholeState)
+							{
+								AddBytesToSchema(ComponentObject, HandleIterator.Handle, ValueDataWriter);
+							}
 						}
 
 						bProcessedFastArrayProperty = true;
@@ -119,17 +150,26 @@ uint32 ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObjec
 					AddProperty(ComponentObject, HandleIterator.Handle, Cmd.Property, Data, ClearedIds);
 				}
 
+				if (bProfileProperty)
+				{
+					const uint32 ProfilerBytesEnd = Schema_GetWriteBufferLength(ComponentObject);
 #if USE_NETWORK_PROFILER
-				/**
-				 *  a good proxy for how many bits are being sent for a property. Reasons for why it might not be fully accurate:
+					/**
+					 *  a good proxy for how many bits are being sent for a property. Reasons for why it might not be fully accurate:
 						- the serialized size of a message is just the body contents. Typically something will send the message with the length prefixed, which might be varint encoded, and you pushing the size over some size can cause the encoding of the length be bigger
 						- similarly, if you push the message over some size it can cause fragmentation which means you now have to pay for the headers again
 						- if there is any compression or anything else going on, the number of bytes actually transferred because of this data can differ
 						- lastly somewhat philosophical question of who pays for the overhead of a packet and whether you attribute a part of it to each field or attribute it to the update itself, but I assume you care a bit less about this
-				 */
-				const uint32 ProfilerBytesEnd = Schema_GetWriteBufferLength(ComponentObject);
-				NETWORK_PROFILER(GNetworkProfiler.TrackReplicateProperty(Cmd.Property, (ProfilerBytesEnd - ProfilerBytesStart) * CHAR_BIT, nullptr));
+					 */
+					NETWORK_PROFILER(GNetworkProfiler.TrackReplicateProperty(Cmd.Property, (ProfilerBytesEnd - ProfilerBytesStart) * CHAR_BIT, nullptr));
 #endif
+					if (Profiler != nullptr)
+					{
+						// Attribute nested struct members to the top level replicated property.
+						const EBandwidthCategory Category = PropertyGroup == SCHEMA_OwnerOnly ? EBandwidthCategory::OwnerOnly : EBandwidthCategory::Data;
+						Profiler->Track(Object->GetClass()->GetFName(), Parent.Property->GetFName(), Category, ProfilerBytesEnd - ProfilerBytesStart);
+					}
+				}
 			}
 
 			if (Cmd.Type == ERepLayoutCmdType::DynamicArray)
@@ -147,6 +187,29 @@ uint32 ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObjec
 	return BytesEnd - BytesStart;
 }
 
+void ComponentFactory::AddFastArrayItemDeltaOrKeyframe(Schema_Object* ComponentObject, Schema_FieldId FieldId, UObject* Object, const FRepParentCmd& Parent, UArrayProperty* ItemsProperty, UScriptStruct* NetDeltaStruct)
+{
+	void* FastArray = Parent.Property->ContainerPtrToValuePtr<void>(Object, Parent.ArrayIndex);
+	FFastArrayItemDeltaSenderState& State = UpdateChannel->GetFastArrayItemDeltaSenderState(Object, FieldId);
+
+	// The whole state is written against no earlier update, so it always holds a keyframe.
+	if (!bWritingWholeState)
+	{
+		if (!FFastArrayItemDelta::HasChangedSinceLastWrite(FastArray, State))
+		{
+			return;
+		}
+
+		if (FFastArrayItemDelta::WriteDelta(NetDriver, ComponentObject, FieldId, FastArray, ItemsProperty, State))
+		{
+			return;
+		}
+	}
+
+	// No keyframe yet, or the item deltas have outgrown it, so write the whole array and start a new item delta.
+	FFastArrayItemDelta::WriteKeyframe(NetDriver, ComponentObject, FieldId, Object, Parent.ArrayIndex, Parent.Property, ItemsProperty, NetDeltaStruct, State);
+}
+
 uint32 ComponentFactory::FillHandoverSchemaObject(Schema_Object* ComponentObject, UObject* Object, const FClassInfo& Info, const FHandoverChangeState& Changes, bool bIsInitialData, TraceKey* OutLatencyTraceId, TArray<Schema_FieldId>* ClearedIds /* = nullptr */)
 {
 	const uint32 BytesStart = Schema_GetWriteBufferLength(ComponentObject);
@@ -170,7 +233,14 @@ uint32 ComponentFactory::FillHandoverSchemaObject(Schema_Object* ComponentObject
 			*OutLatencyTraceId = LatencyTracer->RetrievePendingTrace(Object, PropertyInfo.Property);
 		}
 #endif
+		const uint32 ProfilerBytesStart = Profiler != nullptr ? Schema_GetWriteBufferLength(ComponentObject) : 0;
+
 		AddProperty(ComponentObject, ChangedHandle, PropertyInfo.Property, Data, ClearedIds);
+
+		if (Profiler != nullptr)
+		{
+			Profiler->Track(Object->GetClass()->GetFName(), PropertyInfo.Property->GetFName(), EBandwidthCategory::Handover, Schema_GetWriteBufferLength(ComponentObject) - ProfilerBytesStart);
+		}
 	}
 
 	const uint32 BytesEnd = Schema_GetWriteBufferLength(ComponentObject);
@@ -277,7 +347,8 @@ void ComponentFactory::AddProperty(Schema_Object* Object, Schema_FieldId FieldId
 	}
 	else if (UNameProperty* NameProperty = Cast<UNameProperty>(Property))
 	{
-		AddStringToSchema(Object, FieldId, NameProperty->GetPropertyValue(Data).ToString());
+		NameProperty->GetPropertyValue(Data).ToString(NameStringScratch);
+		AddStringToSchema(Object, FieldId, NameStringScratch);
 	}
 	else if (UStrProperty* StrProperty = Cast<UStrProperty>(Property))
 	{
@@ -290,9 +361,12 @@ void ComponentFactory::AddProperty(Schema_Object* Object, Schema_FieldId FieldId
 	else if (UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property))
 	{
 		FScriptArrayHelper ArrayHelper(ArrayProperty, Data);
-		for (int i = 0; i < ArrayHelper.Num(); i++)
+		if (!AddPrimitiveArray(Object, FieldId, ArrayProperty->Inner, ArrayHelper))
 		{
-			AddProperty(Object, FieldId, ArrayProperty->Inner, ArrayHelper.GetRawPtr(i), ClearedIds);
+			for (int i = 0; i < ArrayHelper.Num(); i++)
+			{
+				AddProperty(Object, FieldId, ArrayProperty->Inner, ArrayHelper.GetRawPtr(i), ClearedIds);
+			}
 		}
 
 		if (ArrayHelper.Num() == 0 && ClearedIds)
@@ -329,6 +403,82 @@ void ComponentFactory::AddProperty(Schema_Object* Object, Schema_FieldId FieldId
 	}
 }
 
+bool ComponentFactory::AddPrimitiveArray(Schema_Object* Object, Schema_FieldId FieldId, UProperty* InnerProperty, FScriptArrayHelper& ArrayHelper)
+{
+	SCOPE_CYCLE_COUNTER(STAT_FactoryAddPrimitiveArray);
+
+	if (!InnerProperty->IsA<UNumericProperty>())
+	{
+		return false;
+	}
+
+	// Schema lists are encoded identically to repeated single-value adds, so readers can consume
+	// these fields either element by element or as a list.
+	const int32 Count = ArrayHelper.Num();
+	if (Count == 0)
+	{
+		return true;
+	}
+
+	const uint8* Elements = ArrayHelper.GetRawPtr(0);
+
+	if (InnerProperty->IsA<UFloatProperty>())
+	{
+		Schema_AddFloatList(Object, FieldId, reinterpret_cast<const float*>(Elements), Count);
+	}
+	else if (InnerProperty->IsA<UDoubleProperty>())
+	{
+		Schema_AddDoubleList(Object, FieldId, reinterpret_cast<const double*>(Elements), Count);
+	}
+	else if (InnerProperty->IsA<UInt8Property>())
+	{
+		Int32ListScratch.SetNumUninitialized(Count, /* bAllowShrinking */ false);
+		ConvertIntegerBuffer(Int32ListScratch.GetData(), reinterpret_cast<const int8*>(Elements), Count);
+		Schema_AddInt32List(Object, FieldId, Int32ListScratch.GetData(), Count);
+	}
+	else if (InnerProperty->IsA<UInt16Property>())
+	{
+		Int32ListScratch.SetNumUninitialized(Count, /* bAllowShrinking */ false);
+		ConvertIntegerBuffer(Int32ListScratch.GetData(), reinterpret_cast<const int16*>(Elements), Count);
+		Schema_AddInt32List(Object, FieldId, Int32ListScratch.GetData(), Count);
+	}
+	else if (InnerProperty->IsA<UIntProperty>())
+	{
+		Schema_AddInt32List(Object, FieldId, reinterpret_cast<const int32*>(Elements), Count);
+	}
+	else if (InnerProperty->IsA<UInt64Property>())
+	{
+		Schema_AddInt64List(Object, FieldId, reinterpret_cast<const int64*>(Elements), Count);
+	}
+	else if (InnerProperty->IsA<UByteProperty>())
+	{
+		Uint32ListScratch.SetNumUninitialized(Count, /* bAllowShrinking */ false);
+		ConvertIntegerBuffer(Uint32ListScratch.GetData(), reinterpret_cast<const uint8*>(Elements), Count);
+		Schema_AddUint32List(Object, FieldId, Uint32ListScratch.GetData(), Count);
+	}
+	else if (InnerProperty->IsA<UUInt16Property>())
+	{
+		Uint32ListScratch.SetNumUninitialized(Count, /* bAllowShrinking */ false);
+		ConvertIntegerBuffer(Uint32ListScratch.GetData(), reinterpret_cast<const uint16*>(Elements), Count);
+		Schema_AddUint32List(Object, FieldId, Uint32ListScratch.GetData(), Count);
+	}
+	else if (InnerProperty->IsA<UUInt32Property>())
+	{
+		Schema_AddUint32List(Object, FieldId, reinterpret_cast<const uint32*>(Elements), Count);
+	}
+	else if (InnerProperty->IsA<UUInt64Property>())
+	{
+		Schema_AddUint64List(Object, FieldId, reinterpret_cast<const uint64*>(Elements), Count);
+	}
+	else
+	{
+		checkf(false, TEXT("Tried to add unknown numeric array in field %d"), FieldId);
+		return false;
+	}
+
+	return true;
+}
+
 TArray<FWorkerComponentData> ComponentFactory::CreateComponentDatas(UObject* Object, const FClassInfo& Info, const FRepChangeState& RepChangeState, const FHandoverChangeState& HandoverChangeState, uint32& OutBytesWritten)
 {
 	TArray<FWorkerComponentData> ComponentDatas;
@@ -387,6 +537,13 @@ FWorkerComponentData ComponentFactory::CreateHandoverComponentData(Worker_Compon
 TArray<FWorkerComponentUpdate> ComponentFactory::CreateComponentUpdates(UObject* Object, const FClassInfo& Info, Worker_EntityId EntityId, const FRepChangeState* RepChangeState, const FHandoverChangeState* HandoverChangeState, uint32& OutBytesWritten)
 {
 	TArray<FWorkerComponentUpdate> ComponentUpdates;
+	CreateComponentUpdates(Object, Info, EntityId, RepChangeState, HandoverChangeState, ComponentUpdates, OutBytesWritten);
+	return ComponentUpdates;
+}
+
+void ComponentFactory::CreateComponentUpdates(UObject* Object, const FClassInfo& Info, Worker_EntityId EntityId, const FRepChangeState* RepChangeState, const FHandoverChangeState* HandoverChangeState, TArray<FWorkerComponentUpdate>& OutUpdates, uint32& OutBytesWritten)
+{
+	UpdateChannel = NetDriver->GetActorChannelByEntityId(EntityId);
 
 	if (RepChangeState)
 	{
@@ -396,7 +553,7 @@ TArray<FWorkerComponentUpdate> ComponentFactory::CreateComponentUpdates(UObject*
 			FWorkerComponentUpdate MultiClientUpdate = CreateComponentUpdate(Info.SchemaComponents[SCHEMA_Data], Object, *RepChangeState, SCHEMA_Data, BytesWritten);
 			if (BytesWritten > 0)
 			{
-				ComponentUpdates.Add(MultiClientUpdate);
+				OutUpdates.Add(MultiClientUpdate);
 				OutBytesWritten += BytesWritten;
 			}
 		}
@@ -407,7 +564,7 @@ TArray<FWorkerComponentUpdate> ComponentFactory::CreateComponentUpdates(UObject*
 			FWorkerComponentUpdate SingleClientUpdate = CreateComponentUpdate(Info.SchemaComponents[SCHEMA_OwnerOnly], Object, *RepChangeState, SCHEMA_OwnerOnly, BytesWritten);
 			if (BytesWritten > 0)
 			{
-				ComponentUpdates.Add(SingleClientUpdate);
+				OutUpdates.Add(SingleClientUpdate);
 				OutBytesWritten += BytesWritten;
 			}
 		}
@@ -421,7 +578,7 @@ TArray<FWorkerComponentUpdate> ComponentFactory::CreateComponentUpdates(UObject*
 			FWorkerComponentUpdate HandoverUpdate = CreateHandoverComponentUpdate(Info.SchemaComponents[SCHEMA_Handover], Object, Info, *HandoverChangeState, BytesWritten);
 			if (BytesWritten > 0)
 			{
-				ComponentUpdates.Add(HandoverUpdate);
+				OutUpdates.Add(HandoverUpdate);
 				OutBytesWritten += BytesWritten;
 			}
 		}
@@ -430,10 +587,30 @@ TArray<FWorkerComponentUpdate> ComponentFactory::CreateComponentUpdates(UObject*
 	// Only support Interest for Actors for now.
 	if (Object->IsA<AActor>() && bInterestHasChanged)
 	{
-		ComponentUpdates.Add(NetDriver->InterestFactory->CreateInterestUpdate((AActor*)Object, Info, EntityId));
+		FWorkerComponentUpdate InterestUpdate = NetDriver->InterestFactory->CreateInterestUpdate((AActor*)Object, Info, EntityId);
+
+		if (Profiler != nullptr)
+		{
+			Profiler->Track(Object->GetClass()->GetFName(), NAME_None, EBandwidthCategory::Interest, Schema_GetWriteBufferLength(Schema_GetComponentUpdateFields(InterestUpdate.schema_type)));
+		}
+
+		OutUpdates.Add(InterestUpdate);
 	}
+}
 
-	return ComponentUpdates;
+FWorkerComponentUpdate ComponentFactory::CreateWholeComponentUpdate(Worker_ComponentId ComponentId, UObject* Object, const FClassInfo& Info, Worker_EntityId EntityId, const FRepChangeState& RepChangeState, const FHandoverChangeState& HandoverChangeState, uint32& OutBytesWritten)
+{
+	UpdateChannel = NetDriver->GetActorChannelByEntityId(EntityId);
+	bWritingWholeState = true;
+
+	const ESchemaComponentType PropertyGroup = ClassInfoManager->GetCategoryByComponentId(ComponentId);
+	FWorkerComponentUpdate ComponentUpdate = PropertyGroup == SCHEMA_Handover
+		? CreateHandoverComponentUpdate(ComponentId, Object, Info, HandoverChangeState, OutBytesWritten)
+		: CreateComponentUpdate(ComponentId, Object, RepChangeState, PropertyGroup, OutBytesWritten);
+
+	bWritingWholeState = false;
+
+	return ComponentUpdate;
 }
 
 FWorkerComponentUpdate ComponentFactory::CreateComponentUpdate(Worker_ComponentId ComponentId, UObject* Object, const FRepChangeState& Changes, ESchemaComponentType PropertyGroup, uint32& OutBytesWritten)
@@ -441,10 +618,20 @@ FWorkerComponentUpdate ComponentFactory::CreateComponentUpdate(Worker_ComponentI
 	FWorkerComponentUpdate ComponentUpdate = {};
 
 	ComponentUpdate.component_id = ComponentId;
+
+	// Nothing would be written, so don't allocate an update just to destroy it.
+	if (Changes.RepChanged.Num() == 0)
+	{
+		Allocations.NumSchemaUpdatesSkipped++;
+		return ComponentUpdate;
+	}
+
 	ComponentUpdate.schema_type = Schema_CreateComponentUpdate();
+	Allocations.NumSchemaUpdatesCreated++;
 	Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(ComponentUpdate.schema_type);
 
-	TArray<Schema_FieldId> ClearedIds;
+	TArray<Schema_FieldId>& ClearedIds = ClearedIdsScratch;
+	ClearedIds.Reset();
 
 	uint32 BytesWritten = FillSchemaObject(ComponentObject, Object, Changes, PropertyGroup, false, GetTraceKeyFromComponentObject(ComponentUpdate), &ClearedIds);
 
@@ -457,6 +644,8 @@ FWorkerComponentUpdate ComponentFactory::CreateComponentUpdate(Worker_ComponentI
 	if (BytesWritten == 0)
 	{
 		Schema_DestroyComponentUpdate(ComponentUpdate.schema_type);
+		ComponentUpdate.schema_type = nullptr;
+		Allocations.NumSchemaUpdatesDiscarded++;
 	}
 
 	OutBytesWritten += BytesWritten;
@@ -469,10 +658,20 @@ FWorkerComponentUpdate ComponentFactory::CreateHandoverComponentUpdate(Worker_Co
 	FWorkerComponentUpdate ComponentUpdate = {};
 
 	ComponentUpdate.component_id = ComponentId;
+
+	// Nothing would be written, so don't allocate an update just to destroy it.
+	if (Changes.Num() == 0)
+	{
+		Allocations.NumSchemaUpdatesSkipped++;
+		return ComponentUpdate;
+	}
+
 	ComponentUpdate.schema_type = Schema_CreateComponentUpdate();
+	Allocations.NumSchemaUpdatesCreated++;
 	Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(ComponentUpdate.schema_type);
 
-	TArray<Schema_FieldId> ClearedIds;
+	TArray<Schema_FieldId>& ClearedIds = ClearedIdsScratch;
+	ClearedIds.Reset();
 
 	uint32 BytesWritten = FillHandoverSchemaObject(ComponentObject, Object, Info, Changes, false, GetTraceKeyFromComponentObject(ComponentUpdate), &ClearedIds);
 
@@ -485,6 +684,8 @@ FWorkerComponentUpdate ComponentFactory::CreateHandoverComponentUpdate(Worker_Co
 	if (BytesWritten == 0)
 	{
 		Schema_DestroyComponentUpdate(ComponentUpdate.schema_type);
+		ComponentUpdate.schema_type = nullptr;
+		Allocations.NumSchemaUpdatesDiscarded++;
 	}
 
 	OutBytesWritten += BytesWritten;
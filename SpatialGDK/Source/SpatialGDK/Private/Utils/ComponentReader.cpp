@@ -11,6 +11,7 @@
 #include "EngineClasses/SpatialNetBitReader.h"
 #include "Interop/SpatialConditionMapFilter.h"
 #include "SpatialConstants.h"
+#include "Utils/FastArrayItemDelta.h"
 #include "Utils/SchemaUtils.h"
 #include "Utils/RepLayoutUtils.h"
 
@@ -79,6 +80,20 @@ namespace
 		}
 		return false;
 	}
+
+	// Whether applying the property can change the role or physics replication the channel's condition map filter was built from.
+	bool AffectsConditionMapFilter(const UObject& Object, const USpatialActorChannel& Channel, const FRepLayoutCmd& Cmd, const FRepParentCmd& Parent)
+	{
+		static const FName NAME_ReplicatedMovement(TEXT("ReplicatedMovement"));
+
+		if (&Object != Channel.Actor)
+		{
+			return false;
+		}
+
+		// Role and RemoteRole are swapped as they are written, so both can change the local role.
+		return Cmd.Property->GetFName() == NAME_Role || Cmd.Property->GetFName() == NAME_RemoteRole || Parent.Property->GetFName() == NAME_ReplicatedMovement;
+	}
 }
 
 namespace SpatialGDK
@@ -105,6 +120,12 @@ void ComponentReader::ApplyComponentData(const Worker_ComponentData& ComponentDa
 	UpdatedIds.SetNumUninitialized(Schema_GetUniqueFieldIdCount(ComponentObject));
 	Schema_GetUniqueFieldIds(ComponentObject, UpdatedIds.GetData());
 
+	if (FFastArrayItemDelta::IsEnabled())
+	{
+		// FastArray item deltas are applied on top of their keyframe, which has the lower field id.
+		UpdatedIds.Sort();
+	}
+
 	if (bIsHandover)
 	{
 		ApplyHandoverSchemaObject(ComponentObject, Object, Channel, true, UpdatedIds, ComponentData.component_id, bOutReferencesChanged);
@@ -137,6 +158,12 @@ void ComponentReader::ApplyComponentUpdate(const Worker_ComponentUpdate& Compone
 	// Merge cleared fields into updated fields to ensure they will be processed (Schema_FieldId == uint32)
 	UpdatedIds.Append(ClearedIds);
 
+	if (FFastArrayItemDelta::IsEnabled())
+	{
+		// FastArray item deltas are applied on top of their keyframe, which has the lower field id.
+		UpdatedIds.Sort();
+	}
+
 	if (UpdatedIds.Num() > 0)
 	{
 		if (bIsHandover)
@@ -168,16 +195,24 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject&
 	bool bAutonomousProxy = Channel.IsClientAutonomousProxy();
 	bool bIsClient = NetDriver->GetNetMode() == NM_Client;
 
-	FSpatialConditionMapFilter ConditionMap(&Channel, bIsClient);
+	const FSpatialConditionMapFilter& ConditionMap = Channel.GetConditionMapFilter(bIsClient);
+
+	// The channel's buffer is only used until PostReceiveSpatialUpdate hands the RepNotifies over to the RepState.
+	TArray<UProperty*>& RepNotifies = Channel.GetRepNotifiesBuffer();
 
-	TArray<UProperty*> RepNotifies;
+	// ConditionMap is used for the whole update, so the filter is only invalidated once every property has been applied.
+	bool bInvalidateConditionMapFilter = false;
 
 	{
 		// Scoped to exclude OnRep callbacks which are already tracked per OnRep function
 		SCOPE_CYCLE_COUNTER(STAT_ReaderApplyPropertyUpdates);
 
-		for (uint32 FieldId : UpdatedIds)
+		for (uint32 UpdatedId : UpdatedIds)
 		{
+			// The item delta of a FastArray is written at an offset from the FastArray's own field.
+			const bool bIsFastArrayItemDelta = FFastArrayItemDelta::IsDeltaFieldId(UpdatedId);
+			const uint32 FieldId = bIsFastArrayItemDelta ? FFastArrayItemDelta::GetKeyframeFieldId(UpdatedId) : UpdatedId;
+
 			// FieldId is the same as rep handle
 			if (FieldId == 0 || (int)FieldId - 1 >= BaseHandleToCmdIndex.Num())
 			{
@@ -190,8 +225,16 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject&
 			const FRepParentCmd& Parent = Parents[Cmd.ParentIndex];
 			int32 ShadowOffset = Cmd.ShadowOffset;
 
+			if (bIsFastArrayItemDelta && Cmd.Type != ERepLayoutCmdType::DynamicArray)
+			{
+				UE_LOG(LogSpatialComponentReader, Error, TEXT("ApplySchemaObject: Received a FastArray item delta for a property that isn't a FastArray. Object: %s, Field: %d, Entity: %lld, Component: %d"), *Object.GetPathName(), UpdatedId, Channel.GetEntityId(), ComponentId);
+				continue;
+			}
+
 			if (NetDriver->IsServer() || ConditionMap.IsRelevant(Parent.Condition))
 			{
+				bInvalidateConditionMapFilter |= AffectsConditionMapFilter(Object, Channel, Cmd, Parent);
+
 				// This swaps Role/RemoteRole as we write it
 				const FRepLayoutCmd& SwappedCmd = (!bIsAuthServer && Parent.RoleSwapIndex != -1) ? Cmds[Parents[Parent.RoleSwapIndex].CmdStart] : Cmd;
 
@@ -225,33 +268,55 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject&
 					{
 						SCOPE_CYCLE_COUNTER(STAT_ReaderApplyFastArrayUpdate);
 
-						TArray<uint8> ValueData = GetBytesFromSchema(ComponentObject, FieldId);
-						int64 CountBits = ValueData.Num() * 8;
-						TSet<FUnrealObjectRef> NewMappedRefs;
-						TSet<FUnrealObjectRef> NewUnresolvedRefs;
-						FSpatialNetBitReader ValueDataReader(PackageMap, ValueData.GetData(), CountBits, NewMappedRefs, NewUnresolvedRefs);
-
-						if (ValueData.Num() > 0)
+						if (bIsFastArrayItemDelta)
 						{
-							FSpatialNetDeltaSerializeInfo::DeltaSerializeRead(NetDriver, ValueDataReader, &Object, Parent.ArrayIndex, Parent.Property, NetDeltaStruct);
+							ApplyFastArrayItemDelta(Schema_GetObject(ComponentObject, UpdatedId), Object, Channel, FieldId, Parent, ArrayProperty, NetDeltaStruct, SwappedCmd.Offset, ShadowOffset, Cmd.ParentIndex, bOutReferencesChanged);
 						}
+						else
+						{
+							TArrayView<const uint8> ValueData = GetBytesViewFromSchema(ComponentObject, FieldId);
 
-						FObjectReferences* CurEntry = RootObjectReferencesMap.Find(SwappedCmd.Offset);
-						const bool bHasReferences = NewUnresolvedRefs.Num() > 0 || NewMappedRefs.Num() > 0;
+							int64 CountBits = ValueData.Num() * 8;
+							TSet<FUnrealObjectRef> NewMappedRefs;
+							TSet<FUnrealObjectRef> NewUnresolvedRefs;
+							FSpatialNetBitReader ValueDataReader(PackageMap, ValueData.GetData(), CountBits, NewMappedRefs, NewUnresolvedRefs);
 
-						if (ReferencesChanged(RootObjectReferencesMap, SwappedCmd.Offset, bHasReferences, NewMappedRefs, NewUnresolvedRefs))
-						{
-							if (bHasReferences)
+							if (ValueData.Num() > 0)
+							{
+								FSpatialNetDeltaSerializeInfo::DeltaSerializeRead(NetDriver, ValueDataReader, &Object, Parent.ArrayIndex, Parent.Property, NetDeltaStruct);
+							}
+
+							if (FFastArrayItemDelta::IsEnabled())
 							{
-								RootObjectReferencesMap.Add(SwappedCmd.Offset, FObjectReferences(ValueData, CountBits, MoveTemp(NewMappedRefs), MoveTemp(NewUnresolvedRefs), ShadowOffset, Cmd.ParentIndex, ArrayProperty, /* bFastArrayProp */ true));
+								FFastArrayItemDelta::OnKeyframeApplied(Parent.Property->ContainerPtrToValuePtr<void>(&Object, Parent.ArrayIndex), ArrayProperty, Channel.GetFastArrayItemDeltaReceiverState(&Object, FieldId));
 							}
-							else
+
+							const bool bHasReferences = NewUnresolvedRefs.Num() > 0 || NewMappedRefs.Num() > 0;
+
+							if (ReferencesChanged(RootObjectReferencesMap, SwappedCmd.Offset, bHasReferences, NewMappedRefs, NewUnresolvedRefs))
 							{
-								RootObjectReferencesMap.Remove(SwappedCmd.Offset);
+								if (bHasReferences)
+								{
+									RootObjectReferencesMap.Add(SwappedCmd.Offset, FObjectReferences(ValueData, CountBits, MoveTemp(NewMappedRefs), MoveTemp(NewUnresolvedRefs), ShadowOffset, Cmd.ParentIndex, ArrayProperty, /* bFastArrayProp */ true));
+								}
+								else
+								{
+									RootObjectReferencesMap.Remove(SwappedCmd.Offset);
+								}
+								bOutReferencesChanged = true;
+							}
+							else if (FObjectReferences* CurEntry = RootObjectReferencesMap.Find(SwappedCmd.Offset))
+							{
+								// The keyframe replaces the array, and any item delta received before it.
+								CurEntry->ItemDeltaBuffer.Reset();
 							}
-							bOutReferencesChanged = true;
 						}
 					}
+					else if (bIsFastArrayItemDelta)
+					{
+						UE_LOG(LogSpatialComponentReader, Error, TEXT("ApplySchemaObject: Received a FastArray item delta for a property that isn't a FastArray. Object: %s, Field: %d, Entity: %lld, Component: %d"), *Object.GetPathName(), UpdatedId, Channel.GetEntityId(), ComponentId);
+						continue;
+					}
 					else
 					{
 						ApplyArray(ComponentObject, FieldId, RootObjectReferencesMap, ArrayProperty, Data, SwappedCmd.Offset, ShadowOffset, Cmd.ParentIndex, bOutReferencesChanged);
@@ -298,11 +363,46 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject&
 		}
 	}
 
+	if (bInvalidateConditionMapFilter)
+	{
+		Channel.InvalidateConditionMapFilter();
+	}
+
 	Channel.RemoveRepNotifiesWithUnresolvedObjs(RepNotifies, *Replicator->RepLayout, RootObjectReferencesMap, &Object);
 
 	Channel.PostReceiveSpatialUpdate(&Object, RepNotifies);
 }
 
+void ComponentReader::ApplyFastArrayItemDelta(Schema_Object* DeltaObject, UObject& Object, USpatialActorChannel& Channel, Schema_FieldId FieldId, const FRepParentCmd& Parent, UArrayProperty* ArrayProperty, UScriptStruct* NetDeltaStruct, int32 Offset, int32 ShadowOffset, int32 ParentIndex, bool& bOutReferencesChanged)
+{
+	void* FastArray = Parent.Property->ContainerPtrToValuePtr<void>(&Object, Parent.ArrayIndex);
+
+	TSet<FUnrealObjectRef> NewMappedRefs;
+	TSet<FUnrealObjectRef> NewUnresolvedRefs;
+	FFastArrayItemDelta::ApplyDelta(NetDriver, DeltaObject, FastArray, ArrayProperty, NetDeltaStruct, &Channel.GetFastArrayItemDeltaReceiverState(&Object, FieldId), NewMappedRefs, NewUnresolvedRefs);
+
+	if (NewMappedRefs.Num() == 0 && NewUnresolvedRefs.Num() == 0)
+	{
+		return;
+	}
+
+	// Only the items that changed since the last update were read, so keep the references of the keyframe and earlier items too.
+	// The item delta is cumulative, so it replaces any item delta kept for the property before it.
+	if (FObjectReferences* CurEntry = RootObjectReferencesMap.Find(Offset))
+	{
+		CurEntry->MappedRefs.Append(NewMappedRefs);
+		CurEntry->UnresolvedRefs.Append(NewUnresolvedRefs);
+		CurEntry->ItemDeltaBuffer = FFastArrayItemDelta::SerializeDelta(DeltaObject);
+	}
+	else
+	{
+		FObjectReferences& NewEntry = RootObjectReferencesMap.Add(Offset, FObjectReferences(TArrayView<const uint8>(), 0, MoveTemp(NewMappedRefs), MoveTemp(NewUnresolvedRefs), ShadowOffset, ParentIndex, ArrayProperty, /* bFastArrayProp */ true));
+		NewEntry.ItemDeltaBuffer = FFastArrayItemDelta::SerializeDelta(DeltaObject);
+	}
+
+	bOutReferencesChanged = true;
+}
+
 void ComponentReader::ApplyHandoverSchemaObject(Schema_Object* ComponentObject, UObject& Object, USpatialActorChannel& Channel, bool bIsInitialData, const TArray<Schema_FieldId>& UpdatedIds, Worker_ComponentId ComponentId, bool& bOutReferencesChanged)
 {
 	SCOPE_CYCLE_COUNTER(STAT_ReaderApplyHandoverPropertyUpdates);
@@ -347,7 +447,7 @@ void ComponentReader::ApplyProperty(Schema_Object* Object, Schema_FieldId FieldI
 
 	if (UStructProperty* StructProperty = Cast<UStructProperty>(Property))
 	{
-		TArray<uint8> ValueData = IndexBytesFromSchema(Object, FieldId, Index);
+		TArrayView<const uint8> ValueData = IndexBytesViewFromSchema(Object, FieldId, Index);
 		// A bit hacky, we should probably include the number of bits with the data instead.
 		int64 CountBits = ValueData.Num() * 8;
 		TSet<FUnrealObjectRef> NewDynamicRefs;
@@ -457,11 +557,12 @@ void ComponentReader::ApplyProperty(Schema_Object* Object, Schema_FieldId FieldI
 	}
 	else if (UNameProperty* NameProperty = Cast<UNameProperty>(Property))
 	{
-		NameProperty->SetPropertyValue(Data, FName(*IndexStringFromSchema(Object, FieldId, Index)));
+		NameProperty->SetPropertyValue(Data, IndexNameFromSchema(Object, FieldId, Index));
 	}
 	else if (UStrProperty* StrProperty = Cast<UStrProperty>(Property))
 	{
-		StrProperty->SetPropertyValue(Data, IndexStringFromSchema(Object, FieldId, Index));
+		// Read directly into the existing string so its allocation is reused.
+		IndexStringFromSchema(Object, FieldId, Index, *StrProperty->GetPropertyValuePtr(Data));
 	}
 	else if (UTextProperty* TextProperty = Cast<UTextProperty>(Property))
 	{
@@ -488,6 +589,13 @@ void ComponentReader::ApplyArray(Schema_Object* Object, Schema_FieldId FieldId,
 {
 	SCOPE_CYCLE_COUNTER(STAT_ReaderApplyArray);
 
+	FScriptArrayHelper ArrayHelper(Property, Data);
+
+	if (ApplyPrimitiveArray(Object, FieldId, Property->Inner, ArrayHelper))
+	{
+		return;
+	}
+
 	FObjectReferencesMap* ArrayObjectReferences;
 	bool bNewArrayMap = false;
 	if (FObjectReferences* ExistingEntry = InObjectReferencesMap.Find(Offset))
@@ -502,8 +610,6 @@ void ComponentReader::ApplyArray(Schema_Object* Object, Schema_FieldId FieldId,
 		ArrayObjectReferences = new FObjectReferencesMap();
 	}
 
-	FScriptArrayHelper ArrayHelper(Property, Data);
-
 	int Count = GetPropertyCount(Object, FieldId, Property->Inner);
 	ArrayHelper.Resize(Count);
 
@@ -534,6 +640,80 @@ void ComponentReader::ApplyArray(Schema_Object* Object, Schema_FieldId FieldId,
 	}
 }
 
+bool ComponentReader::ApplyPrimitiveArray(Schema_Object* Object, Schema_FieldId FieldId, UProperty* InnerProperty, FScriptArrayHelper& ArrayHelper)
+{
+	if (!InnerProperty->IsA<UNumericProperty>())
+	{
+		return false;
+	}
+
+	const int32 Count = (int32)GetPropertyCount(Object, FieldId, InnerProperty);
+	ArrayHelper.Resize(Count);
+
+	if (Count == 0)
+	{
+		return true;
+	}
+
+	uint8* Elements = ArrayHelper.GetRawPtr(0);
+
+	if (InnerProperty->IsA<UFloatProperty>())
+	{
+		Schema_GetFloatList(Object, FieldId, reinterpret_cast<float*>(Elements));
+	}
+	else if (InnerProperty->IsA<UDoubleProperty>())
+	{
+		Schema_GetDoubleList(Object, FieldId, reinterpret_cast<double*>(Elements));
+	}
+	else if (InnerProperty->IsA<UInt8Property>())
+	{
+		Int32ListScratch.SetNumUninitialized(Count, /* bAllowShrinking */ false);
+		Schema_GetInt32List(Object, FieldId, Int32ListScratch.GetData());
+		ConvertIntegerBuffer(reinterpret_cast<int8*>(Elements), Int32ListScratch.GetData(), Count);
+	}
+	else if (InnerProperty->IsA<UInt16Property>())
+	{
+		Int32ListScratch.SetNumUninitialized(Count, /* bAllowShrinking */ false);
+		Schema_GetInt32List(Object, FieldId, Int32ListScratch.GetData());
+		ConvertIntegerBuffer(reinterpret_cast<int16*>(Elements), Int32ListScratch.GetData(), Count);
+	}
+	else if (InnerProperty->IsA<UIntProperty>())
+	{
+		Schema_GetInt32List(Object, FieldId, reinterpret_cast<int32*>(Elements));
+	}
+	else if (InnerProperty->IsA<UInt64Property>())
+	{
+		Schema_GetInt64List(Object, FieldId, reinterpret_cast<int64*>(Elements));
+	}
+	else if (InnerProperty->IsA<UByteProperty>())
+	{
+		Uint32ListScratch.SetNumUninitialized(Count, /* bAllowShrinking */ false);
+		Schema_GetUint32List(Object, FieldId, Uint32ListScratch.GetData());
+		ConvertIntegerBuffer(Elements, Uint32ListScratch.GetData(), Count);
+	}
+	else if (InnerProperty->IsA<UUInt16Property>())
+	{
+		Uint32ListScratch.SetNumUninitialized(Count, /* bAllowShrinking */ false);
+		Schema_GetUint32List(Object, FieldId, Uint32ListScratch.GetData());
+		ConvertIntegerBuffer(reinterpret_cast<uint16*>(Elements), Uint32ListScratch.GetData(), Count);
+	}
+	else if (InnerProperty->IsA<UUInt32Property>())
+	{
+		Schema_GetUint32List(Object, FieldId, reinterpret_cast<uint32*>(Elements));
+	}
+	else if (InnerProperty->IsA<UUInt64Property>())
+	{
+		Schema_GetUint64List(Object, FieldId, reinterpret_cast<uint64*>(Elements));
+	}
+	else
+	{
+		checkf(false, TEXT("Tried to read unknown numeric array in field %d"), FieldId);
+		return false;
+	}
+
+	return true;
+}
+
 uint32 ComponentReader::GetPropertyCount(const Schema_Object* Object, Schema_FieldId FieldId, UProperty* Property)
 {
 	if (UStructProperty* StructProperty = Cast<UStructProperty>(Property))
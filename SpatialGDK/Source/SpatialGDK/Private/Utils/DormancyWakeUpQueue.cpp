@@ -0,0 +1,122 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/DormancyWakeUpQueue.h"
+
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+
+DECLARE_CYCLE_STAT(TEXT("DormancyWakeUpQueue Process"), STAT_SpatialDormancyWakeUpQueueProcess, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Dormancy Wake Ups Replicated"), STAT_SpatialDormancyWakeUpsReplicated, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Dormancy Wake Ups Staged"), STAT_SpatialDormancyWakeUpsStaged, STATGROUP_SpatialNet);
+
+FDormancyWakeUpQueue::FDormancyWakeUpQueue(float InTimeBudgetSeconds)
+	: TimeBudgetSeconds(InTimeBudgetSeconds)
+	, NextSequence(0)
+	, Stats{}
+{
+}
+
+void FDormancyWakeUpQueue::Stage(AActor* Actor, bool bRelevantToClients, float DistanceSqToNearestViewer)
+{
+	if (FStagedActor* Existing = Staged.Find(Actor))
+	{
+		// Keep the original sequence, so re-staging doesn't move an actor behind ones staged after it.
+		Existing->bRelevantToClients = bRelevantToClients;
+		Existing->DistanceSqToNearestViewer = DistanceSqToNearestViewer;
+		return;
+	}
+
+	Staged.Add(Actor, FStagedActor{ bRelevantToClients, DistanceSqToNearestViewer, NextSequence++ });
+
+	Stats.NumStaged++;
+	Stats.PeakStaged = FMath::Max(Stats.PeakStaged, Staged.Num());
+	SET_DWORD_STAT(STAT_SpatialDormancyWakeUpsStaged, Staged.Num());
+}
+
+int32 FDormancyWakeUpQueue::Process(int32 MaxActors, TFunctionRef<bool(AActor*)> Replicate)
+{
+	if (Staged.Num() == 0 || MaxActors <= 0)
+	{
+		if (Staged.Num() > 0)
+		{
+			Stats.NumTicksRateLimited++;
+		}
+
+		Stats.LastProcessSeconds = 0.0;
+		return 0;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_SpatialDormancyWakeUpQueueProcess);
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	OrderScratch.Reset();
+	OrderScratch.Reserve(Staged.Num());
+	for (const TPair<TWeakObjectPtr<AActor>, FStagedActor>& Pair : Staged)
+	{
+		OrderScratch.Add(Pair);
+	}
+
+	OrderScratch.Sort([](const TPair<TWeakObjectPtr<AActor>, FStagedActor>& Lhs, const TPair<TWeakObjectPtr<AActor>, FStagedActor>& Rhs)
+	{
+		if (Lhs.Value.bRelevantToClients != Rhs.Value.bRelevantToClients)
+		{
+			return Lhs.Value.bRelevantToClients;
+		}
+		if (Lhs.Value.DistanceSqToNearestViewer != Rhs.Value.DistanceSqToNearestViewer)
+		{
+			return Lhs.Value.DistanceSqToNearestViewer < Rhs.Value.DistanceSqToNearestViewer;
+		}
+		return Lhs.Value.Sequence < Rhs.Value.Sequence;
+	});
+
+	int32 NumProcessed = 0;
+	int32 NumReplicated = 0;
+	bool bRateLimited = false;
+	for (const TPair<TWeakObjectPtr<AActor>, FStagedActor>& Pair : OrderScratch)
+	{
+		if (NumProcessed >= MaxActors)
+		{
+			bRateLimited = true;
+			break;
+		}
+
+		if (NumProcessed > 0 && FPlatformTime::Seconds() - StartTime >= TimeBudgetSeconds)
+		{
+			break;
+		}
+
+		Staged.Remove(Pair.Key);
+
+		// Actors destroyed while staged don't use up the budget.
+		AActor* Actor = Pair.Key.Get();
+		if (Actor == nullptr)
+		{
+			continue;
+		}
+
+		NumProcessed++;
+		if (Replicate(Actor))
+		{
+			NumReplicated++;
+		}
+	}
+
+	if (bRateLimited)
+	{
+		Stats.NumTicksRateLimited++;
+	}
+	else if (Staged.Num() > 0)
+	{
+		Stats.NumTicksOverBudget++;
+	}
+
+	Stats.NumReplicated += NumReplicated;
+	Stats.LastProcessSeconds = FPlatformTime::Seconds() - StartTime;
+	Stats.LongestProcessSeconds = FMath::Max(Stats.LongestProcessSeconds, Stats.LastProcessSeconds);
+
+	INC_DWORD_STAT_BY(STAT_SpatialDormancyWakeUpsReplicated, NumReplicated);
+	SET_DWORD_STAT(STAT_SpatialDormancyWakeUpsStaged, Staged.Num());
+
+	return NumReplicated;
+}
@@ -0,0 +1,111 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/EntityCreationBatch.h"
+
+#include "Interop/Connection/SpatialOSWorkerInterface.h"
+#include "SpatialConstants.h"
+
+#include "HAL/PlatformTime.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+DEFINE_LOG_CATEGORY(LogSpatialEntityCreationBatch);
+
+DECLARE_CYCLE_STAT(TEXT("EntityCreationBatch Flush"), STAT_SpatialEntityCreationBatchFlush, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Entity Creations Batched"), STAT_SpatialEntityCreationsBatched, STATGROUP_SpatialNet);
+
+FEntityCreationBatch::FEntityCreationBatch()
+	: NextBatchId(0)
+	, Stats{}
+{
+}
+
+FEntityCreationBatch::~FEntityCreationBatch()
+{
+	for (FQueuedCreation& Creation : Queued)
+	{
+		for (FWorkerComponentData& Component : Creation.Components)
+		{
+			Schema_DestroyComponentData(Component.schema_type);
+		}
+	}
+}
+
+void FEntityCreationBatch::Add(Worker_EntityId EntityId, TArray<FWorkerComponentData>&& Components, USpatialActorChannel* Channel)
+{
+	Queued.Add(FQueuedCreation{ EntityId, MoveTemp(Components), Channel });
+}
+
+int32 FEntityCreationBatch::Flush(SpatialOSWorkerInterface& Connection, FOnRequestSent OnRequestSent)
+{
+	if (Queued.Num() == 0)
+	{
+		return 0;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_SpatialEntityCreationBatchFlush);
+
+	const uint32 BatchId = NextBatchId++;
+	const int32 NumRequests = Queued.Num();
+
+	InFlightRequests.Reserve(InFlightRequests.Num() + NumRequests);
+
+	for (FQueuedCreation& Creation : Queued)
+	{
+		// The request is sent even if the channel has closed in the meantime, as the channel will already have
+		// asked for the entity to be retired once this worker gains authority over it.
+		const Worker_RequestId RequestId = Connection.SendCreateEntityRequest(MoveTemp(Creation.Components), &Creation.EntityId);
+		InFlightRequests.Add(RequestId, BatchId);
+
+		OnRequestSent(RequestId, Creation.EntityId, Creation.Channel);
+	}
+
+	// Keep the allocation around for the next tick.
+	Queued.Reset();
+
+	InFlightBatches.Add(BatchId, FInFlightBatch{ FPlatformTime::Seconds(), NumRequests, NumRequests, 0 });
+
+	Stats.NumBatches++;
+	Stats.NumRequests += NumRequests;
+	INC_DWORD_STAT_BY(STAT_SpatialEntityCreationsBatched, NumRequests);
+
+	UE_LOG(LogSpatialEntityCreationBatch, Verbose, TEXT("Sent batch %u of %d create entity requests"), BatchId, NumRequests);
+
+	return NumRequests;
+}
+
+bool FEntityCreationBatch::OnCreateEntityResponse(const Worker_CreateEntityResponseOp& Op)
+{
+	uint32 BatchId;
+	if (!InFlightRequests.RemoveAndCopyValue(Op.request_id, BatchId))
+	{
+		return false;
+	}
+
+	FInFlightBatch* Batch = InFlightBatches.Find(BatchId);
+	check(Batch != nullptr);
+
+	// Timed out requests are retried by the owning channel as a new request, so they are counted as failed here.
+	if (Op.status_code == WORKER_STATUS_CODE_SUCCESS)
+	{
+		Stats.NumSucceeded++;
+	}
+	else
+	{
+		Stats.NumFailed++;
+		Batch->NumFailed++;
+	}
+
+	if (--Batch->NumOutstanding == 0)
+	{
+		Stats.LastBatchSeconds = FPlatformTime::Seconds() - Batch->FlushTime;
+		Stats.LastBatchSize = Batch->NumRequests;
+
+		UE_LOG(LogSpatialEntityCreationBatch, Verbose, TEXT("Batch %u of %d create entity requests completed in %.2f ms with %d failures"),
+			BatchId, Batch->NumRequests, Stats.LastBatchSeconds * 1000.0, Batch->NumFailed);
+
+		InFlightBatches.Remove(BatchId);
+	}
+
+	return true;
+}
@@ -21,6 +21,7 @@
 #include "SpatialCommonTypes.h"
 #include "SpatialConstants.h"
 #include "Utils/ComponentFactory.h"
+#include "Utils/EntityPrototypeCache.h"
 #include "Utils/InspectionColors.h"
 #include "Utils/InterestFactory.h"
 #include "Utils/SpatialActorUtils.h"
@@ -36,11 +37,12 @@ DEFINE_LOG_CATEGORY(LogEntityFactory);
 namespace SpatialGDK
 {
 
-EntityFactory::EntityFactory(USpatialNetDriver* InNetDriver, USpatialPackageMapClient* InPackageMap, USpatialClassInfoManager* InClassInfoManager, SpatialRPCService* InRPCService)
+EntityFactory::EntityFactory(USpatialNetDriver* InNetDriver, USpatialPackageMapClient* InPackageMap, USpatialClassInfoManager* InClassInfoManager, SpatialRPCService* InRPCService, EntityPrototypeCache* InPrototypeCache)
 	: NetDriver(InNetDriver)
 	, PackageMap(InPackageMap)
 	, ClassInfoManager(InClassInfoManager)
 	, RPCService(InRPCService)
+	, PrototypeCache(InPrototypeCache)
 { }
 
 TArray<FWorkerComponentData> EntityFactory::CreateEntityComponents(USpatialActorChannel* Channel, FRPCsOnEntityCreationMap& OutgoingOnCreateEntityRPCs, uint32& OutBytesWritten)
@@ -76,12 +78,28 @@ TArray<FWorkerComponentData> EntityFactory::CreateEntityComponents(USpatialActor
 
 	const WorkerRequirementSet AuthoritativeWorkerRequirementSet = { WorkerAttributeOrSpecificWorker };
 
+	const USpatialGDKSettings* SpatialSettings = GetDefault<USpatialGDKSettings>();
+	const bool bUseRingBufferRPCs = SpatialSettings->UseRPCRingBuffer() && RPCService != nullptr;
+
+	// The class-wide parts of the entity, including most of the write ACL, are built once per class and copied here.
+	EntityPrototype UncachedPrototype;
+	const EntityPrototype* Prototype = nullptr;
+	if (PrototypeCache != nullptr)
+	{
+		Prototype = &PrototypeCache->GetOrCreatePrototype(Class, Info, ClassInfoManager->SchemaDatabase->NetCullDistanceComponentIds, WorkerAttributeOrSpecificWorker, bUseRingBufferRPCs);
+	}
+	else
+	{
+		UncachedPrototype = EntityPrototypeCache::CreatePrototype(Class, Info, ClassInfoManager->SchemaDatabase->NetCullDistanceComponentIds, WorkerAttributeOrSpecificWorker, bUseRingBufferRPCs);
+		Prototype = &UncachedPrototype;
+	}
+
 	WorkerRequirementSet ReadAcl;
-	if (Class->HasAnySpatialClassFlags(SPATIALCLASS_ServerOnly))
+	if (Prototype->bIsServerOnly)
 	{
 		ReadAcl = AnyServerRequirementSet;
 	}
-	else if (Actor->IsA<APlayerController>())
+	else if (Prototype->bIsPlayerController)
 	{
 		ReadAcl = AnyServerOrOwningClientRequirementSet;
 	}
@@ -90,35 +108,16 @@ TArray<FWorkerComponentData> EntityFactory::CreateEntityComponents(USpatialActor
 		ReadAcl = AnyServerOrClientRequirementSet;
 	}
 
-	WriteAclMap ComponentWriteAcl;
-	ComponentWriteAcl.Add(SpatialConstants::POSITION_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-	ComponentWriteAcl.Add(SpatialConstants::INTEREST_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-	ComponentWriteAcl.Add(SpatialConstants::SPAWN_DATA_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-	ComponentWriteAcl.Add(SpatialConstants::DORMANT_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-	ComponentWriteAcl.Add(SpatialConstants::SERVER_TO_SERVER_COMMAND_ENDPOINT_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-	ComponentWriteAcl.Add(SpatialConstants::COMPONENT_PRESENCE_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-	ComponentWriteAcl.Add(SpatialConstants::NET_OWNING_CLIENT_WORKER_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-	ComponentWriteAcl.Add(SpatialConstants::ENTITY_ACL_COMPONENT_ID, AnyServerRequirementSet);
-	ComponentWriteAcl.Add(SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-
-	const USpatialGDKSettings* SpatialSettings = GetDefault<USpatialGDKSettings>();
-	if (SpatialSettings->UseRPCRingBuffer() && RPCService != nullptr)
+	WriteAclMap ComponentWriteAcl = Prototype->AuthoritativeWriteAcl;
+	for (const Worker_ComponentId ComponentId : Prototype->OwningClientComponentIds)
 	{
-		ComponentWriteAcl.Add(SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID, OwningClientOnlyRequirementSet);
-		ComponentWriteAcl.Add(SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-		ComponentWriteAcl.Add(SpatialConstants::MULTICAST_RPCS_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+		ComponentWriteAcl.Add(ComponentId, OwningClientOnlyRequirementSet);
 	}
-	else
-	{
-		ComponentWriteAcl.Add(SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID_LEGACY, AuthoritativeWorkerRequirementSet);
-		ComponentWriteAcl.Add(SpatialConstants::NETMULTICAST_RPCS_COMPONENT_ID_LEGACY, AuthoritativeWorkerRequirementSet);
-		ComponentWriteAcl.Add(SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID_LEGACY, OwningClientOnlyRequirementSet);
 
-		// If there are pending RPCs, add this component.
-		if (OutgoingOnCreateEntityRPCs.Contains(Actor))
-		{
-			ComponentWriteAcl.Add(SpatialConstants::RPCS_ON_ENTITY_CREATION_ID, AuthoritativeWorkerRequirementSet);
-		}
+	// If there are pending RPCs, add this component.
+	if (!bUseRingBufferRPCs && OutgoingOnCreateEntityRPCs.Contains(Actor))
+	{
+		ComponentWriteAcl.Add(SpatialConstants::RPCS_ON_ENTITY_CREATION_ID, AuthoritativeWorkerRequirementSet);
 	}
 
 	if (Actor->IsNetStartupActor())
@@ -126,35 +125,8 @@ TArray<FWorkerComponentData> EntityFactory::CreateEntityComponents(USpatialActor
 		ComponentWriteAcl.Add(SpatialConstants::TOMBSTONE_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
 	}
 
-	// If Actor is a PlayerController, add the heartbeat component.
-	if (Actor->IsA<APlayerController>())
-	{
-#if !UE_BUILD_SHIPPING
-		ComponentWriteAcl.Add(SpatialConstants::DEBUG_METRICS_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-#endif // !UE_BUILD_SHIPPING
-		ComponentWriteAcl.Add(SpatialConstants::HEARTBEAT_COMPONENT_ID, OwningClientOnlyRequirementSet);
-	}
-
-	// Add all Interest component IDs to allow us to change it if needed.
-	ComponentWriteAcl.Add(SpatialConstants::ALWAYS_RELEVANT_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
-	for (const auto ComponentId : ClassInfoManager->SchemaDatabase->NetCullDistanceComponentIds)
-	{
-		ComponentWriteAcl.Add(ComponentId, AuthoritativeWorkerRequirementSet);
-	}
-
 	Worker_ComponentId ActorInterestComponentId = ClassInfoManager->ComputeActorInterestComponentId(Actor);
 
-	ForAllSchemaComponentTypes([&](ESchemaComponentType Type)
-	{
-		Worker_ComponentId ComponentId = Info.SchemaComponents[Type];
-		if (ComponentId == SpatialConstants::INVALID_COMPONENT_ID)
-		{
-			return;
-		}
-
-		ComponentWriteAcl.Add(ComponentId, AuthoritativeWorkerRequirementSet);
-	});
-
 	for (auto& SubobjectInfoPair : Info.SubobjectInfo)
 	{
 		const FClassInfo& SubobjectInfo = SubobjectInfoPair.Value.Get();
@@ -205,13 +177,13 @@ TArray<FWorkerComponentData> EntityFactory::CreateEntityComponents(USpatialActor
 
 	TArray<FWorkerComponentData> ComponentDatas;
 	ComponentDatas.Add(Position(Coordinates::FromFVector(GetActorSpatialPosition(Actor))).CreatePositionData());
-	ComponentDatas.Add(Metadata(Class->GetName()).CreateMetadataData());
+	ComponentDatas.Add(Metadata(Prototype->ClassName).CreateMetadataData());
 	ComponentDatas.Add(SpawnData(Actor).CreateSpawnDataData());
-	ComponentDatas.Add(UnrealMetadata(StablyNamedObjectRef, Class->GetPathName(), bNetStartup).CreateUnrealMetadataData());
-	ComponentDatas.Add(NetOwningClientWorker(GetConnectionOwningWorkerId(Channel->Actor)).CreateNetOwningClientWorkerData());
+	ComponentDatas.Add(UnrealMetadata(StablyNamedObjectRef, Prototype->ClassPath, bNetStartup).CreateUnrealMetadataData());
+	ComponentDatas.Add(NetOwningClientWorker(ClientWorkerAttribute).CreateNetOwningClientWorkerData());
 	ComponentDatas.Add(AuthorityIntent::CreateAuthorityIntentData(IntendedVirtualWorkerId));
 
-	if (!Class->HasAnySpatialClassFlags(SPATIALCLASS_NotPersistent))
+	if (Prototype->bIsPersistent)
 	{
 		ComponentDatas.Add(Persistence().CreatePersistenceData());
 	}
@@ -243,7 +215,7 @@ TArray<FWorkerComponentData> EntityFactory::CreateEntityComponents(USpatialActor
 		ComponentDatas.Add(ComponentFactory::CreateEmptyComponentData(SpatialConstants::DORMANT_COMPONENT_ID));
 	}
 
-	if (Actor->IsA<APlayerController>())
+	if (Prototype->bIsPlayerController)
 	{
 #if !UE_BUILD_SHIPPING
 		ComponentDatas.Add(ComponentFactory::CreateEmptyComponentData(SpatialConstants::DEBUG_METRICS_COMPONENT_ID));
@@ -266,7 +238,7 @@ TArray<FWorkerComponentData> EntityFactory::CreateEntityComponents(USpatialActor
 
 	ComponentDatas.Add(ComponentFactory::CreateEmptyComponentData(SpatialConstants::SERVER_TO_SERVER_COMMAND_ENDPOINT_COMPONENT_ID));
 
-	if (SpatialSettings->UseRPCRingBuffer() && RPCService != nullptr)
+	if (bUseRingBufferRPCs)
 	{
 		ComponentDatas.Append(RPCService->GetRPCComponentsOnEntityCreation(EntityId));
 	}
@@ -0,0 +1,117 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/EntityPrototypeCache.h"
+
+#include "Interop/SpatialClassInfoManager.h"
+#include "SpatialConstants.h"
+
+#include "GameFramework/PlayerController.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Entity Prototype Cache Hits"), STAT_SpatialEntityPrototypeCacheHits, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Entity Prototype Cache Misses"), STAT_SpatialEntityPrototypeCacheMisses, STATGROUP_SpatialNet);
+
+namespace SpatialGDK
+{
+
+EntityPrototypeCache::EntityPrototypeCache()
+	: bCachedUseRingBufferRPCs(false)
+	, NumHits(0)
+	, NumMisses(0)
+{
+}
+
+const EntityPrototype& EntityPrototypeCache::GetOrCreatePrototype(UClass* Class, const FClassInfo& Info, const TSet<uint32>& NetCullDistanceComponentIds,
+	const WorkerAttributeSet& AuthoritativeWorkerAttributeSet, bool bUseRingBufferRPCs)
+{
+	if (bCachedUseRingBufferRPCs != bUseRingBufferRPCs || CachedAuthoritativeWorkerAttributeSet != AuthoritativeWorkerAttributeSet)
+	{
+		Reset();
+		CachedAuthoritativeWorkerAttributeSet = AuthoritativeWorkerAttributeSet;
+		bCachedUseRingBufferRPCs = bUseRingBufferRPCs;
+	}
+
+	if (const EntityPrototype* Prototype = Prototypes.Find(Class))
+	{
+		NumHits++;
+		INC_DWORD_STAT(STAT_SpatialEntityPrototypeCacheHits);
+		return *Prototype;
+	}
+
+	NumMisses++;
+	INC_DWORD_STAT(STAT_SpatialEntityPrototypeCacheMisses);
+	return Prototypes.Add(Class, CreatePrototype(Class, Info, NetCullDistanceComponentIds, AuthoritativeWorkerAttributeSet, bUseRingBufferRPCs));
+}
+
+EntityPrototype EntityPrototypeCache::CreatePrototype(UClass* Class, const FClassInfo& Info, const TSet<uint32>& NetCullDistanceComponentIds,
+	const WorkerAttributeSet& AuthoritativeWorkerAttributeSet, bool bUseRingBufferRPCs)
+{
+	const WorkerRequirementSet AuthoritativeWorkerRequirementSet = { AuthoritativeWorkerAttributeSet };
+	const WorkerRequirementSet AnyServerRequirementSet = { SpatialConstants::UnrealServerAttributeSet };
+
+	EntityPrototype Prototype;
+	Prototype.ClassName = Class->GetName();
+	Prototype.ClassPath = Class->GetPathName();
+	Prototype.bIsServerOnly = Class->HasAnySpatialClassFlags(SPATIALCLASS_ServerOnly);
+	Prototype.bIsPlayerController = Class->IsChildOf<APlayerController>();
+	Prototype.bIsPersistent = !Class->HasAnySpatialClassFlags(SPATIALCLASS_NotPersistent);
+
+	WriteAclMap& ComponentWriteAcl = Prototype.AuthoritativeWriteAcl;
+	ComponentWriteAcl.Add(SpatialConstants::POSITION_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+	ComponentWriteAcl.Add(SpatialConstants::INTEREST_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+	ComponentWriteAcl.Add(SpatialConstants::SPAWN_DATA_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+	ComponentWriteAcl.Add(SpatialConstants::DORMANT_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+	ComponentWriteAcl.Add(SpatialConstants::SERVER_TO_SERVER_COMMAND_ENDPOINT_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+	ComponentWriteAcl.Add(SpatialConstants::COMPONENT_PRESENCE_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+	ComponentWriteAcl.Add(SpatialConstants::NET_OWNING_CLIENT_WORKER_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+	ComponentWriteAcl.Add(SpatialConstants::ENTITY_ACL_COMPONENT_ID, AnyServerRequirementSet);
+	ComponentWriteAcl.Add(SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+
+	if (bUseRingBufferRPCs)
+	{
+		ComponentWriteAcl.Add(SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+		ComponentWriteAcl.Add(SpatialConstants::MULTICAST_RPCS_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+		Prototype.OwningClientComponentIds.Add(SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID);
+	}
+	else
+	{
+		ComponentWriteAcl.Add(SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID_LEGACY, AuthoritativeWorkerRequirementSet);
+		ComponentWriteAcl.Add(SpatialConstants::NETMULTICAST_RPCS_COMPONENT_ID_LEGACY, AuthoritativeWorkerRequirementSet);
+		Prototype.OwningClientComponentIds.Add(SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID_LEGACY);
+	}
+
+	// If Actor is a PlayerController, add the heartbeat component.
+	if (Prototype.bIsPlayerController)
+	{
+#if !UE_BUILD_SHIPPING
+		ComponentWriteAcl.Add(SpatialConstants::DEBUG_METRICS_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+#endif // !UE_BUILD_SHIPPING
+		Prototype.OwningClientComponentIds.Add(SpatialConstants::HEARTBEAT_COMPONENT_ID);
+	}
+
+	// Add all Interest component IDs to allow us to change it if needed.
+	ComponentWriteAcl.Add(SpatialConstants::ALWAYS_RELEVANT_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+	for (const Worker_ComponentId ComponentId : NetCullDistanceComponentIds)
+	{
+		ComponentWriteAcl.Add(ComponentId, AuthoritativeWorkerRequirementSet);
+	}
+
+	ForAllSchemaComponentTypes([&](ESchemaComponentType Type)
+	{
+		Worker_ComponentId ComponentId = Info.SchemaComponents[Type];
+		if (ComponentId == SpatialConstants::INVALID_COMPONENT_ID)
+		{
+			return;
+		}
+
+		ComponentWriteAcl.Add(ComponentId, AuthoritativeWorkerRequirementSet);
+	});
+
+	return Prototype;
+}
+
+void EntityPrototypeCache::Reset()
+{
+	Prototypes.Reset();
+}
+
+} // namespace SpatialGDK
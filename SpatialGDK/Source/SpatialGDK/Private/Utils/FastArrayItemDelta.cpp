@@ -0,0 +1,355 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/FastArrayItemDelta.h"
+
+#include "Engine/NetSerialization.h"
+
+#include "EngineClasses/SpatialFastArrayNetSerialize.h"
+#include "EngineClasses/SpatialNetBitReader.h"
+#include "EngineClasses/SpatialNetBitWriter.h"
+#include "EngineClasses/SpatialNetDriver.h"
+#include "EngineClasses/SpatialPackageMapClient.h"
+#include "SpatialGDKSettings.h"
+#include "Utils/SchemaUtils.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("FastArray Keyframes Written"), STAT_SpatialFastArrayKeyframesWritten, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("FastArray Item Deltas Written"), STAT_SpatialFastArrayItemDeltasWritten, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("FastArray Items Written In Deltas"), STAT_SpatialFastArrayItemsWrittenInDeltas, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("FastArray Items Applied From Deltas"), STAT_SpatialFastArrayItemsAppliedFromDeltas, STATGROUP_SpatialNet);
+
+namespace SpatialGDK
+{
+
+namespace
+{
+
+// Every FastArray derives from FFastArraySerializer and every item from FFastArraySerializerItem. Neither is polymorphic,
+// so the base is at the start of the derived struct, which is how the engine's RepLayout treats them too.
+FFastArraySerializer& GetSerializer(void* FastArray)
+{
+	return *static_cast<FFastArraySerializer*>(FastArray);
+}
+
+const FFastArraySerializer& GetSerializer(const void* FastArray)
+{
+	return *static_cast<const FFastArraySerializer*>(FastArray);
+}
+
+FFastArraySerializerItem& GetItem(FScriptArrayHelper& Items, int32 Index)
+{
+	return *reinterpret_cast<FFastArraySerializerItem*>(Items.GetRawPtr(Index));
+}
+
+UScriptStruct* GetItemStruct(UArrayProperty* ItemsProperty)
+{
+	return CastChecked<UStructProperty>(ItemsProperty->Inner)->Struct;
+}
+
+USpatialPackageMapClient* GetPackageMap(USpatialNetDriver* NetDriver)
+{
+	return NetDriver != nullptr ? NetDriver->PackageMap : nullptr;
+}
+
+// Keeps the next ReplicationID this worker assigns above the ones it has received, so items it adds after gaining
+// authority don't reuse the ID of an existing item.
+void RaiseIdCounterAboveItems(void* FastArray, UArrayProperty* ItemsProperty)
+{
+	FFastArraySerializer& Serializer = GetSerializer(FastArray);
+	FScriptArrayHelper Items(ItemsProperty, ItemsProperty->ContainerPtrToValuePtr<void>(FastArray));
+
+	for (int32 Index = 0; Index < Items.Num(); Index++)
+	{
+		Serializer.IDCounter = FMath::Max(Serializer.IDCounter, GetItem(Items, Index).ReplicationID);
+	}
+}
+
+} // anonymous namespace
+
+bool FFastArrayItemDelta::IsEnabled()
+{
+	return GetDefault<USpatialGDKSettings>()->bEnableFastArrayItemDeltas;
+}
+
+bool FFastArrayItemDelta::HasChangedSinceLastWrite(const void* FastArray, const FFastArrayItemDeltaSenderState& State)
+{
+	return !State.bHasKeyframe || GetSerializer(FastArray).ArrayReplicationKey != State.LastWrittenArrayReplicationKey;
+}
+
+void FFastArrayItemDelta::AssignItemIds(void* FastArray, UArrayProperty* ItemsProperty)
+{
+	FFastArraySerializer& Serializer = GetSerializer(FastArray);
+	FScriptArrayHelper Items(ItemsProperty, ItemsProperty->ContainerPtrToValuePtr<void>(FastArray));
+
+	for (int32 Index = 0; Index < Items.Num(); Index++)
+	{
+		FFastArraySerializerItem& Item = GetItem(Items, Index);
+		if (Item.ReplicationID == INDEX_NONE)
+		{
+			Serializer.MarkItemDirty(Item);
+		}
+	}
+}
+
+void FFastArrayItemDelta::RecordKeyframe(void* FastArray, UArrayProperty* ItemsProperty, int32 KeyframeBytes, FFastArrayItemDeltaSenderState& State)
+{
+	FScriptArrayHelper Items(ItemsProperty, ItemsProperty->ContainerPtrToValuePtr<void>(FastArray));
+
+	State.KeyframeItemKeys.Reset();
+	State.ItemsAddedSinceKeyframe.Reset();
+	for (int32 Index = 0; Index < Items.Num(); Index++)
+	{
+		const FFastArraySerializerItem& Item = GetItem(Items, Index);
+		State.KeyframeItemKeys.Add(Item.ReplicationID, Item.ReplicationKey);
+	}
+
+	State.KeyframeBytes = KeyframeBytes;
+	State.DeltaBytesSinceKeyframe = 0;
+	State.LastWrittenArrayReplicationKey = GetSerializer(FastArray).ArrayReplicationKey;
+	State.bHasKeyframe = true;
+
+	INC_DWORD_STAT(STAT_SpatialFastArrayKeyframesWritten);
+}
+
+bool FFastArrayItemDelta::WriteDelta(USpatialNetDriver* NetDriver, Schema_Object* ComponentObject, Schema_FieldId KeyframeFieldId, void* FastArray, UArrayProperty* ItemsProperty, FFastArrayItemDeltaSenderState& State)
+{
+	if (!State.bHasKeyframe)
+	{
+		return false;
+	}
+
+	AssignItemIds(FastArray, ItemsProperty);
+
+	FScriptArrayHelper Items(ItemsProperty, ItemsProperty->ContainerPtrToValuePtr<void>(FastArray));
+
+	TSet<int32> CurrentIds;
+	CurrentIds.Reserve(Items.Num());
+	TArray<int32> ChangedIndices;
+	for (int32 Index = 0; Index < Items.Num(); Index++)
+	{
+		const FFastArraySerializerItem& Item = GetItem(Items, Index);
+		CurrentIds.Add(Item.ReplicationID);
+
+		const int32* KeyframeKey = State.KeyframeItemKeys.Find(Item.ReplicationID);
+		if (KeyframeKey == nullptr || *KeyframeKey != Item.ReplicationKey)
+		{
+			ChangedIndices.Add(Index);
+		}
+	}
+
+	TArray<int32> RemovedIds;
+	for (const TPair<int32, int32>& KeyframeItem : State.KeyframeItemKeys)
+	{
+		if (!CurrentIds.Contains(KeyframeItem.Key))
+		{
+			RemovedIds.Add(KeyframeItem.Key);
+		}
+	}
+	for (int32 AddedId : State.ItemsAddedSinceKeyframe)
+	{
+		if (!CurrentIds.Contains(AddedId))
+		{
+			RemovedIds.Add(AddedId);
+		}
+	}
+
+	// Serialize the items up front, to find out whether a keyframe would be cheaper before writing anything.
+	USpatialPackageMapClient* PackageMap = GetPackageMap(NetDriver);
+	SpatialFastArrayNetSerializeCB SerializeCB(NetDriver);
+	UScriptStruct* ItemStruct = GetItemStruct(ItemsProperty);
+
+	TArray<FSpatialNetBitWriter> ItemWriters;
+	ItemWriters.Reserve(ChangedIndices.Num());
+	int32 DeltaBytes = RemovedIds.Num() * sizeof(int32);
+	for (int32 Index : ChangedIndices)
+	{
+		FSpatialNetBitWriter& ItemWriter = ItemWriters.Emplace_GetRef(PackageMap);
+		bool bHasUnmapped = false;
+		SerializeCB.NetSerializeStruct(ItemStruct, ItemWriter, PackageMap, Items.GetRawPtr(Index), bHasUnmapped);
+		DeltaBytes += ItemWriter.GetNumBytes() + 2 * sizeof(int32);
+	}
+
+	if (State.DeltaBytesSinceKeyframe + DeltaBytes > State.KeyframeBytes)
+	{
+		return false;
+	}
+
+	Schema_Object* DeltaObject = Schema_AddObject(ComponentObject, GetDeltaFieldId(KeyframeFieldId));
+	for (int32 i = 0; i < ChangedIndices.Num(); i++)
+	{
+		const FFastArraySerializerItem& Item = GetItem(Items, ChangedIndices[i]);
+
+		Schema_Object* ItemObject = Schema_AddObject(DeltaObject, SpatialConstants::FAST_ARRAY_ITEM_DELTA_CHANGED_ITEMS_ID);
+		Schema_AddInt32(ItemObject, SpatialConstants::FAST_ARRAY_ITEM_REPLICATION_ID_ID, Item.ReplicationID);
+		Schema_AddInt32(ItemObject, SpatialConstants::FAST_ARRAY_ITEM_REPLICATION_KEY_ID, Item.ReplicationKey);
+		AddBytesToSchema(ItemObject, SpatialConstants::FAST_ARRAY_ITEM_DATA_ID, ItemWriters[i]);
+
+		if (!State.KeyframeItemKeys.Contains(Item.ReplicationID))
+		{
+			State.ItemsAddedSinceKeyframe.Add(Item.ReplicationID);
+		}
+	}
+	Schema_AddInt32List(DeltaObject, SpatialConstants::FAST_ARRAY_ITEM_DELTA_REMOVED_IDS_ID, RemovedIds.GetData(), RemovedIds.Num());
+
+	State.DeltaBytesSinceKeyframe += DeltaBytes;
+	State.LastWrittenArrayReplicationKey = GetSerializer(FastArray).ArrayReplicationKey;
+
+	INC_DWORD_STAT(STAT_SpatialFastArrayItemDeltasWritten);
+	INC_DWORD_STAT_BY(STAT_SpatialFastArrayItemsWrittenInDeltas, ChangedIndices.Num());
+
+	return true;
+}
+
+void FFastArrayItemDelta::ClearDelta(Schema_Object* ComponentObject, Schema_FieldId KeyframeFieldId)
+{
+	Schema_AddObject(ComponentObject, GetDeltaFieldId(KeyframeFieldId));
+}
+
+int32 FFastArrayItemDelta::WriteKeyframe(USpatialNetDriver* NetDriver, Schema_Object* ComponentObject, Schema_FieldId KeyframeFieldId, UObject* Object, int32 ArrayIndex, UProperty* ParentProperty,
+	UArrayProperty* ItemsProperty, UScriptStruct* NetDeltaStruct, FFastArrayItemDeltaSenderState& State)
+{
+	void* FastArray = ParentProperty->ContainerPtrToValuePtr<void>(Object, ArrayIndex);
+	AssignItemIds(FastArray, ItemsProperty);
+
+	FSpatialNetBitWriter ValueDataWriter(NetDriver->PackageMap);
+	FSpatialNetDeltaSerializeInfo::DeltaSerializeWrite(NetDriver, ValueDataWriter, Object, ArrayIndex, ParentProperty, NetDeltaStruct);
+	AddBytesToSchema(ComponentObject, KeyframeFieldId, ValueDataWriter);
+	ClearDelta(ComponentObject, KeyframeFieldId);
+
+	RecordKeyframe(FastArray, ItemsProperty, ValueDataWriter.GetNumBytes(), State);
+
+	return ValueDataWriter.GetNumBytes();
+}
+
+void FFastArrayItemDelta::OnKeyframeApplied(void* FastArray, UArrayProperty* ItemsProperty, FFastArrayItemDeltaReceiverState& State)
+{
+	State.AppliedItemKeys.Reset();
+	RaiseIdCounterAboveItems(FastArray, ItemsProperty);
+}
+
+bool FFastArrayItemDelta::ApplyDelta(USpatialNetDriver* NetDriver, Schema_Object* DeltaObject, void* FastArray, UArrayProperty* ItemsProperty, UScriptStruct* NetDeltaStruct,
+	FFastArrayItemDeltaReceiverState* State, TSet<FUnrealObjectRef>& OutMappedRefs, TSet<FUnrealObjectRef>& OutUnresolvedRefs)
+{
+	TArray<Schema_Object*> ItemsToApply;
+	const uint32 ChangedCount = Schema_GetObjectCount(DeltaObject, SpatialConstants::FAST_ARRAY_ITEM_DELTA_CHANGED_ITEMS_ID);
+	for (uint32 i = 0; i < ChangedCount; i++)
+	{
+		Schema_Object* ItemObject = Schema_IndexObject(DeltaObject, SpatialConstants::FAST_ARRAY_ITEM_DELTA_CHANGED_ITEMS_ID, i);
+		const int32 ReplicationId = Schema_GetInt32(ItemObject, SpatialConstants::FAST_ARRAY_ITEM_REPLICATION_ID_ID);
+		const int32 ReplicationKey = Schema_GetInt32(ItemObject, SpatialConstants::FAST_ARRAY_ITEM_REPLICATION_KEY_ID);
+
+		// The item delta is cumulative, so most of its items have already been applied by an earlier update.
+		const int32* AppliedKey = State != nullptr ? State->AppliedItemKeys.Find(ReplicationId) : nullptr;
+		if (AppliedKey == nullptr || *AppliedKey != ReplicationKey)
+		{
+			ItemsToApply.Add(ItemObject);
+		}
+	}
+
+	TArray<int32> RemovedIds;
+	RemovedIds.SetNumUninitialized(Schema_GetInt32Count(DeltaObject, SpatialConstants::FAST_ARRAY_ITEM_DELTA_REMOVED_IDS_ID));
+	Schema_GetInt32List(DeltaObject, SpatialConstants::FAST_ARRAY_ITEM_DELTA_REMOVED_IDS_ID, RemovedIds.GetData());
+
+	FScriptArrayHelper Items(ItemsProperty, ItemsProperty->ContainerPtrToValuePtr<void>(FastArray));
+	if (RemovedIds.Num() > 0)
+	{
+		// Removals also stay in the item delta until the next keyframe, so only remove the items that are still here.
+		TSet<int32> CurrentIds;
+		CurrentIds.Reserve(Items.Num());
+		for (int32 Index = 0; Index < Items.Num(); Index++)
+		{
+			CurrentIds.Add(GetItem(Items, Index).ReplicationID);
+		}
+		RemovedIds.RemoveAllSwap([&CurrentIds](int32 Id) { return !CurrentIds.Contains(Id); });
+	}
+
+	if (ItemsToApply.Num() == 0 && RemovedIds.Num() == 0)
+	{
+		return false;
+	}
+
+	// Read the items into a scratch FastArray holding only them, then let the engine's native FastArray serialization
+	// apply them to FastArray. Old state lists the removed items, so it writes those as removals and the rest as changes.
+	USpatialPackageMapClient* PackageMap = GetPackageMap(NetDriver);
+	SpatialFastArrayNetSerializeCB SerializeCB(NetDriver);
+	UScriptStruct* ItemStruct = GetItemStruct(ItemsProperty);
+
+	uint8* ScratchArray = static_cast<uint8*>(FMemory::Malloc(NetDeltaStruct->GetStructureSize(), NetDeltaStruct->GetMinAlignment()));
+	NetDeltaStruct->InitializeStruct(ScratchArray);
+
+	FScriptArrayHelper ScratchItems(ItemsProperty, ItemsProperty->ContainerPtrToValuePtr<void>(ScratchArray));
+	for (Schema_Object* ItemObject : ItemsToApply)
+	{
+		const int32 Index = ScratchItems.AddValue();
+		FFastArraySerializerItem& Item = GetItem(ScratchItems, Index);
+		Item.ReplicationID = Schema_GetInt32(ItemObject, SpatialConstants::FAST_ARRAY_ITEM_REPLICATION_ID_ID);
+		Item.ReplicationKey = Schema_GetInt32(ItemObject, SpatialConstants::FAST_ARRAY_ITEM_REPLICATION_KEY_ID);
+
+		const TArrayView<const uint8> ItemData = GetBytesViewFromSchema(ItemObject, SpatialConstants::FAST_ARRAY_ITEM_DATA_ID);
+		FSpatialNetBitReader ItemReader(PackageMap, ItemData.GetData(), ItemData.Num() * 8, OutMappedRefs, OutUnresolvedRefs);
+		bool bHasUnmapped = false;
+		SerializeCB.NetSerializeStruct(ItemStruct, ItemReader, PackageMap, &Item, bHasUnmapped);
+	}
+
+	FNetFastTArrayBaseState OldState;
+	for (int32 RemovedId : RemovedIds)
+	{
+		OldState.IDToCLMap.Add(RemovedId, INDEX_NONE);
+	}
+
+	FSpatialNetBitWriter NativeWriter(PackageMap);
+	TSharedPtr<INetDeltaBaseState> NewState;
+	FSpatialNetDeltaSerializeInfo::NativeDeltaSerializeWrite(NetDriver, NativeWriter, ScratchArray, NetDeltaStruct, &OldState, NewState);
+
+	// References were collected when reading the items above. Unresolved ones are null in the scratch array, and the
+	// whole item delta is applied again once they resolve.
+	TSet<FUnrealObjectRef> NativeMappedRefs;
+	TSet<FUnrealObjectRef> NativeUnresolvedRefs;
+	FSpatialNetBitReader NativeReader(PackageMap, NativeWriter.GetData(), NativeWriter.GetNumBits(), NativeMappedRefs, NativeUnresolvedRefs);
+	FSpatialNetDeltaSerializeInfo::NativeDeltaSerializeRead(NetDriver, NativeReader, FastArray, NetDeltaStruct);
+
+	if (State != nullptr)
+	{
+		for (int32 Index = 0; Index < ScratchItems.Num(); Index++)
+		{
+			const FFastArraySerializerItem& Item = GetItem(ScratchItems, Index);
+			State->AppliedItemKeys.Add(Item.ReplicationID, Item.ReplicationKey);
+		}
+		for (int32 RemovedId : RemovedIds)
+		{
+			State->AppliedItemKeys.Remove(RemovedId);
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_SpatialFastArrayItemsAppliedFromDeltas, ItemsToApply.Num() + RemovedIds.Num());
+
+	NetDeltaStruct->DestroyStruct(ScratchArray);
+	FMemory::Free(ScratchArray);
+
+	RaiseIdCounterAboveItems(FastArray, ItemsProperty);
+
+	return true;
+}
+
+TArray<uint8> FFastArrayItemDelta::SerializeDelta(Schema_Object* DeltaObject)
+{
+	TArray<uint8> SerializedDelta;
+	SerializedDelta.SetNumUninitialized(Schema_GetWriteBufferLength(DeltaObject));
+	Schema_SerializeToBuffer(DeltaObject, SerializedDelta.GetData(), SerializedDelta.Num());
+	return SerializedDelta;
+}
+
+bool FFastArrayItemDelta::ApplySerializedDelta(USpatialNetDriver* NetDriver, const TArray<uint8>& SerializedDelta, void* FastArray, UArrayProperty* ItemsProperty, UScriptStruct* NetDeltaStruct,
+	TSet<FUnrealObjectRef>& OutMappedRefs, TSet<FUnrealObjectRef>& OutUnresolvedRefs)
+{
+	Schema_ComponentData* DeltaData = Schema_CreateComponentData();
+	Schema_Object* DeltaObject = Schema_GetComponentDataFields(DeltaData);
+	Schema_MergeFromBuffer(DeltaObject, SerializedDelta.GetData(), SerializedDelta.Num());
+
+	const bool bApplied = ApplyDelta(NetDriver, DeltaObject, FastArray, ItemsProperty, NetDeltaStruct, nullptr, OutMappedRefs, OutUnresolvedRefs);
+
+	Schema_DestroyComponentData(DeltaData);
+
+	return bApplied;
+}
+
+} // namespace SpatialGDK
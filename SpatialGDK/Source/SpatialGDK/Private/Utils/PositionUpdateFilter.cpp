@@ -0,0 +1,69 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/PositionUpdateFilter.h"
+
+#include "SpatialConstants.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Position Updates Sent"), STAT_SpatialPositionUpdatesSent, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Position Updates Suppressed"), STAT_SpatialPositionUpdatesSuppressed, STATGROUP_SpatialNet);
+
+FPositionUpdateFilter::FPositionUpdateFilter(float InPrecision)
+	: Precision(InPrecision)
+	, Stats{}
+{
+}
+
+void FPositionUpdateFilter::SetPrecision(float InPrecision)
+{
+	if (Precision != InPrecision)
+	{
+		Precision = InPrecision;
+		// Positions recorded with a different precision can't be compared with new ones.
+		LastSentPositions.Reset();
+	}
+}
+
+bool FPositionUpdateFilter::ShouldSend(Worker_EntityId EntityId, const FVector& Position, FVector& OutPosition)
+{
+	const FVector QuantizedPosition = Quantize(Position, Precision);
+
+	if (FVector* LastSentPosition = LastSentPositions.Find(EntityId))
+	{
+		if (*LastSentPosition == QuantizedPosition)
+		{
+			Stats.NumSuppressed++;
+			INC_DWORD_STAT(STAT_SpatialPositionUpdatesSuppressed);
+			return false;
+		}
+
+		*LastSentPosition = QuantizedPosition;
+	}
+	else
+	{
+		LastSentPositions.Add(EntityId, QuantizedPosition);
+	}
+
+	OutPosition = QuantizedPosition;
+
+	Stats.NumSent++;
+	INC_DWORD_STAT(STAT_SpatialPositionUpdatesSent);
+	return true;
+}
+
+void FPositionUpdateFilter::RemoveEntity(Worker_EntityId EntityId)
+{
+	LastSentPositions.Remove(EntityId);
+}
+
+FVector FPositionUpdateFilter::Quantize(const FVector& Position, float Precision)
+{
+	if (Precision <= 0.0f)
+	{
+		return Position;
+	}
+
+	return FVector(
+		FMath::RoundToDouble(Position.X / Precision) * Precision,
+		FMath::RoundToDouble(Position.Y / Precision) * Precision,
+		FMath::RoundToDouble(Position.Z / Precision) * Precision);
+}
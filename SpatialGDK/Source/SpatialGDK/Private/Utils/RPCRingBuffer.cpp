@@ -4,6 +4,8 @@
 
 #include "SpatialGDKSettings.h"
 
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Ring Buffer RPCs Skipped On Read"), STAT_SpatialRingBufferRPCsSkippedOnRead, STATGROUP_SpatialNet);
+
 namespace SpatialGDK
 {
 
@@ -11,6 +13,23 @@ RPCRingBuffer::RPCRingBuffer(ERPCType InType)
 	: Type(InType)
 {
 	RingBuffer.SetNum(RPCRingBufferUtils::GetRingBufferSize(Type));
+
+	// Only multicast RPCs are bundled.
+	if (Type == ERPCType::NetMulticast)
+	{
+		BundledRPCs.SetNum(RingBuffer.Num());
+	}
+}
+
+const TArray<RPCPayload>& RPCRingBuffer::GetBundledRPCs(uint64 RPCId) const
+{
+	if (BundledRPCs.Num() == 0)
+	{
+		static const TArray<RPCPayload> NoBundledRPCs;
+		return NoBundledRPCs;
+	}
+
+	return BundledRPCs[(RPCId - 1) % BundledRPCs.Num()];
 }
 
 namespace RPCRingBufferUtils
@@ -133,23 +152,58 @@ bool ShouldQueueOverflowed(ERPCType Type)
 	}
 }
 
-void ReadBufferFromSchema(Schema_Object* SchemaObject, RPCRingBuffer& OutBuffer)
+void ReadBufferFromSchema(Schema_Object* SchemaObject, RPCRingBuffer& OutBuffer, uint64 SkipUpToRPCId)
 {
 	RPCRingBufferDescriptor Descriptor = GetRingBufferDescriptor(OutBuffer.Type);
 
+	// Read the last sent ID first, so we know which RPC each element holds.
+	if (Schema_GetUint64Count(SchemaObject, Descriptor.LastSentRPCFieldId) > 0)
+	{
+		OutBuffer.LastSentRPCId = Schema_GetUint64(SchemaObject, Descriptor.LastSentRPCFieldId);
+	}
+
 	for (uint32 RingBufferIndex = 0; RingBufferIndex < Descriptor.RingBufferSize; RingBufferIndex++)
 	{
 		Schema_FieldId FieldId = Descriptor.SchemaFieldStart + RingBufferIndex;
-		if (Schema_GetObjectCount(SchemaObject, FieldId) > 0)
+		if (Schema_GetObjectCount(SchemaObject, FieldId) == 0)
+		{
+			continue;
+		}
+
+		if (SkipUpToRPCId > 0 && GetRPCIdAtElementIndex(RingBufferIndex, Descriptor.RingBufferSize, OutBuffer.LastSentRPCId) <= SkipUpToRPCId)
+		{
+			INC_DWORD_STAT(STAT_SpatialRingBufferRPCsSkippedOnRead);
+			continue;
+		}
+
+		Schema_Object* RPCObject = Schema_GetObject(SchemaObject, FieldId);
+		OutBuffer.RingBuffer[RingBufferIndex].Emplace(RPCObject);
+
+		if (OutBuffer.BundledRPCs.Num() > 0)
 		{
-			OutBuffer.RingBuffer[RingBufferIndex].Emplace(Schema_GetObject(SchemaObject, FieldId));
+			TArray<RPCPayload>& Bundle = OutBuffer.BundledRPCs[RingBufferIndex];
+			Bundle.Reset();
+
+			const uint32 BundledCount = Schema_GetObjectCount(RPCObject, SpatialConstants::UNREAL_RPC_PAYLOAD_BUNDLED_RPCS_ID);
+			for (uint32 BundledIndex = 0; BundledIndex < BundledCount; BundledIndex++)
+			{
+				Bundle.Emplace(Schema_IndexObject(RPCObject, SpatialConstants::UNREAL_RPC_PAYLOAD_BUNDLED_RPCS_ID, BundledIndex));
+			}
 		}
 	}
+}
 
-	if (Schema_GetUint64Count(SchemaObject, Descriptor.LastSentRPCFieldId) > 0)
+uint64 GetRPCIdAtElementIndex(uint32 RingBufferIndex, uint32 RingBufferSize, uint64 LastSentRPCId)
+{
+	if (LastSentRPCId == 0)
 	{
-		OutBuffer.LastSentRPCId = Schema_GetUint64(SchemaObject, Descriptor.LastSentRPCFieldId);
+		return 0;
 	}
+
+	// Walk back from the element holding the last sent RPC. Elements that would hold an RPC ID below 1 haven't been written to yet.
+	const uint32 LastSentIndex = static_cast<uint32>((LastSentRPCId - 1) % RingBufferSize);
+	const uint32 Distance = (LastSentIndex + RingBufferSize - RingBufferIndex) % RingBufferSize;
+	return LastSentRPCId > Distance ? LastSentRPCId - Distance : 0;
 }
 
 void ReadAckFromSchema(const Schema_Object* SchemaObject, ERPCType Type, uint64& OutAck)
@@ -173,6 +227,26 @@ void WriteRPCToSchema(Schema_Object* SchemaObject, ERPCType Type, uint64 RPCId,
 	Schema_AddUint64(SchemaObject, Descriptor.LastSentRPCFieldId, RPCId);
 }
 
+void WriteRPCBundleToSchema(Schema_Object* SchemaObject, ERPCType Type, uint64 RPCId, const TArray<RPCPayload>& Payloads)
+{
+	check(Payloads.Num() > 0);
+
+	RPCRingBufferDescriptor Descriptor = GetRingBufferDescriptor(Type);
+
+	Schema_Object* RPCObject = Schema_AddObject(SchemaObject, Descriptor.GetRingBufferElementFieldId(RPCId));
+	Payloads[0].WriteToSchemaObject(RPCObject);
+
+	for (int32 i = 1; i < Payloads.Num(); i++)
+	{
+		const RPCPayload& Payload = Payloads[i];
+		Schema_Object* BundledObject = Schema_AddObject(RPCObject, SpatialConstants::UNREAL_RPC_PAYLOAD_BUNDLED_RPCS_ID);
+		RPCPayload::WriteToSchemaObject(BundledObject, Payload.Offset, Payload.Index, Payload.PayloadData.GetData(), Payload.PayloadData.Num());
+	}
+
+	Schema_ClearField(SchemaObject, Descriptor.LastSentRPCFieldId);
+	Schema_AddUint64(SchemaObject, Descriptor.LastSentRPCFieldId, RPCId);
+}
+
 void WriteAckToSchema(Schema_Object* SchemaObject, ERPCType Type, uint64 Ack)
 {
 	Schema_FieldId AckFieldId = GetAckFieldId(Type);
@@ -0,0 +1,161 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/SpatialBandwidthProfiler.h"
+
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+
+FString EscapeJsonString(const FString& In)
+{
+	return In.Replace(TEXT("\\"), TEXT("\\\\")).Replace(TEXT("\""), TEXT("\\\""));
+}
+
+} // anonymous namespace
+
+namespace SpatialGDK
+{
+
+BandwidthProfiler::BandwidthProfiler()
+	: bEnabled(false)
+	, SessionStartTime(0.0)
+	, AccumulatedSeconds(0.0)
+{ }
+
+void BandwidthProfiler::Start()
+{
+	if (bEnabled)
+	{
+		return;
+	}
+
+	bEnabled = true;
+	SessionStartTime = FPlatformTime::Seconds();
+}
+
+void BandwidthProfiler::Stop()
+{
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	bEnabled = false;
+	AccumulatedSeconds += FPlatformTime::Seconds() - SessionStartTime;
+}
+
+void BandwidthProfiler::Reset()
+{
+	Stats.Reset();
+	AccumulatedSeconds = 0.0;
+	SessionStartTime = FPlatformTime::Seconds();
+}
+
+void BandwidthProfiler::Track(FName ClassName, FName PropertyName, EBandwidthCategory Category, uint32 Bytes)
+{
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	const FKey Key{ ClassName, PropertyName, Category };
+	if (FStat* Stat = Stats.Find(Key))
+	{
+		Stat->Bytes += Bytes;
+		Stat->Count++;
+	}
+	else
+	{
+		Stats.Add(Key, FStat{ Bytes, 1 });
+	}
+}
+
+TArray<BandwidthProfiler::FEntry> BandwidthProfiler::GetEntries() const
+{
+	TArray<FEntry> Entries;
+	Entries.Reserve(Stats.Num());
+
+	for (const TPair<FKey, FStat>& Pair : Stats)
+	{
+		Entries.Add(FEntry{ Pair.Key.ClassName, Pair.Key.PropertyName, Pair.Key.Category, Pair.Value.Bytes, Pair.Value.Count });
+	}
+
+	Entries.Sort([](const FEntry& A, const FEntry& B)
+	{
+		if (A.Bytes != B.Bytes)
+		{
+			return A.Bytes > B.Bytes;
+		}
+		return A.Count > B.Count;
+	});
+
+	return Entries;
+}
+
+double BandwidthProfiler::GetRecordedSeconds() const
+{
+	return bEnabled ? AccumulatedSeconds + (FPlatformTime::Seconds() - SessionStartTime) : AccumulatedSeconds;
+}
+
+FString BandwidthProfiler::ToCSV() const
+{
+	FString Result = TEXT("Class,Property,Category,Bytes,Count,AvgBytes\n");
+
+	for (const FEntry& Entry : GetEntries())
+	{
+		Result += FString::Printf(TEXT("%s,%s,%s,%llu,%llu,%.2f\n"),
+			*Entry.ClassName.ToString(),
+			*Entry.PropertyName.ToString(),
+			GetCategoryName(Entry.Category),
+			Entry.Bytes,
+			Entry.Count,
+			Entry.Count > 0 ? static_cast<double>(Entry.Bytes) / Entry.Count : 0.0);
+	}
+
+	return Result;
+}
+
+FString BandwidthProfiler::ToJson() const
+{
+	FString Result = FString::Printf(TEXT("{\"seconds\":%.3f,\"entries\":["), GetRecordedSeconds());
+
+	bool bFirst = true;
+	for (const FEntry& Entry : GetEntries())
+	{
+		Result += FString::Printf(TEXT("%s{\"class\":\"%s\",\"property\":\"%s\",\"category\":\"%s\",\"bytes\":%llu,\"count\":%llu}"),
+			bFirst ? TEXT("") : TEXT(","),
+			*EscapeJsonString(Entry.ClassName.ToString()),
+			*EscapeJsonString(Entry.PropertyName.ToString()),
+			GetCategoryName(Entry.Category),
+			Entry.Bytes,
+			Entry.Count);
+		bFirst = false;
+	}
+
+	Result += TEXT("]}");
+
+	return Result;
+}
+
+const TCHAR* BandwidthProfiler::GetCategoryName(EBandwidthCategory Category)
+{
+	switch (Category)
+	{
+	case EBandwidthCategory::Data:
+		return TEXT("Data");
+	case EBandwidthCategory::OwnerOnly:
+		return TEXT("OwnerOnly");
+	case EBandwidthCategory::Handover:
+		return TEXT("Handover");
+	case EBandwidthCategory::RPC:
+		return TEXT("RPC");
+	case EBandwidthCategory::Interest:
+		return TEXT("Interest");
+	default:
+		checkNoEntry();
+		return TEXT("Unknown");
+	}
+}
+
+} // namespace SpatialGDK
@@ -4,6 +4,10 @@
 
 #include "Engine/Engine.h"
 #include "EngineGlobals.h"
+#include "HAL/FileManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 
 #include "Interop/Connection/SpatialWorkerConnection.h"
 #include "SpatialGDKSettings.h"
@@ -299,8 +303,71 @@ void USpatialMetrics::OnModifySettingCommand(Schema_Object* CommandPayload)
 	SpatialModifySetting(Name, Value);
 }
 
+void USpatialMetrics::SpatialStartBandwidthProfiler()
+{
+	if (BandwidthProfiler.IsEnabled())
+	{
+		UE_LOG(LogSpatialMetrics, Log, TEXT("Already recording bandwidth profile"));
+		return;
+	}
+
+	UE_LOG(LogSpatialMetrics, Log, TEXT("Recording bandwidth profile"));
+
+	BandwidthProfiler.Start();
+}
+
+void USpatialMetrics::SpatialStopBandwidthProfiler()
+{
+	if (!BandwidthProfiler.IsEnabled())
+	{
+		UE_LOG(LogSpatialMetrics, Log, TEXT("Could not stop recording bandwidth profile. Bandwidth profiler not yet started."));
+		return;
+	}
+
+	BandwidthProfiler.Stop();
+
+	// Log the entries which dominate egress, the full profile is available through SpatialDumpBandwidthProfile.
+	const int32 MaxEntriesToLog = 20;
+	const TArray<SpatialGDK::BandwidthProfiler::FEntry> Entries = BandwidthProfiler.GetEntries();
+
+	UE_LOG(LogSpatialMetrics, Log, TEXT("Recorded %d bandwidth profile entries over %.3f seconds - %s:"), Entries.Num(), BandwidthProfiler.GetRecordedSeconds(), bIsServer ? TEXT("Server") : TEXT("Client"));
+	for (int32 i = 0; i < Entries.Num() && i < MaxEntriesToLog; i++)
+	{
+		const SpatialGDK::BandwidthProfiler::FEntry& Entry = Entries[i];
+		UE_LOG(LogSpatialMetrics, Log, TEXT("%-10s | %s::%s | %llu bytes | %llu writes"),
+			SpatialGDK::BandwidthProfiler::GetCategoryName(Entry.Category), *Entry.ClassName.ToString(), *Entry.PropertyName.ToString(), Entry.Bytes, Entry.Count);
+	}
+}
+
+void USpatialMetrics::SpatialDumpBandwidthProfile(const FString& Format)
+{
+	const bool bJson = Format.Equals(TEXT("json"), ESearchCase::IgnoreCase);
+	if (!bJson && !Format.IsEmpty() && !Format.Equals(TEXT("csv"), ESearchCase::IgnoreCase))
+	{
+		UE_LOG(LogSpatialMetrics, Warning, TEXT("SpatialDumpBandwidthProfile: Unknown format %s, expected csv or json"), *Format);
+		return;
+	}
+
+	const FString Directory = FPaths::Combine(FPaths::ProfilingDir(), TEXT("SpatialBandwidth"));
+	IFileManager::Get().MakeDirectory(*Directory, true);
+
+	const FString FileName = FString::Printf(TEXT("BandwidthProfile-%s-%s.%s"), bIsServer ? TEXT("Server") : TEXT("Client"), *FDateTime::Now().ToString(), bJson ? TEXT("json") : TEXT("csv"));
+	const FString FilePath = FPaths::Combine(Directory, FileName);
+
+	if (FFileHelper::SaveStringToFile(bJson ? BandwidthProfiler.ToJson() : BandwidthProfiler.ToCSV(), *FilePath))
+	{
+		UE_LOG(LogSpatialMetrics, Log, TEXT("SpatialDumpBandwidthProfile: Wrote bandwidth profile to %s"), *FilePath);
+	}
+	else
+	{
+		UE_LOG(LogSpatialMetrics, Error, TEXT("SpatialDumpBandwidthProfile: Failed to write bandwidth profile to %s"), *FilePath);
+	}
+}
+
 void USpatialMetrics::TrackSentRPC(UFunction* Function, ERPCType RPCType, int PayloadSize)
 {
+	BandwidthProfiler.Track(Function->GetOuter()->GetFName(), Function->GetFName(), SpatialGDK::EBandwidthCategory::RPC, PayloadSize);
+
 	if (!bRPCTrackingEnabled)
 	{
 		return;
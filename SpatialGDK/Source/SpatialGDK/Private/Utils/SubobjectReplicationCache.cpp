@@ -0,0 +1,115 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/SubobjectReplicationCache.h"
+
+#include "LoadBalancing/AbstractLBStrategy.h"
+#include "SpatialConstants.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Subobject Replication Cache Hits"), STAT_SpatialSubobjectReplicationCacheHits, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Subobject Replication Cache Misses"), STAT_SpatialSubobjectReplicationCacheMisses, STATGROUP_SpatialNet);
+
+FSubobjectReplicationCache::FSubobjectReplicationCache()
+	: bHandoverSubobjectsValid(false)
+	, EligibilityLocalVirtualWorkerId(SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
+	, bLoadBalancingEligible(false)
+	, bLoadBalancingEligibilityValid(false)
+	, NumHits(0)
+	, NumMisses(0)
+{
+}
+
+const FClassInfo* FSubobjectReplicationCache::FindSubobjectInfo(const UObject* Subobject)
+{
+	if (const FClassInfo* const* Info = SubobjectInfos.Find(Subobject))
+	{
+		RecordHit();
+		return *Info;
+	}
+
+	RecordMiss();
+	return nullptr;
+}
+
+void FSubobjectReplicationCache::AddSubobjectInfo(const UObject* Subobject, const FClassInfo* Info)
+{
+	SubobjectInfos.Add(Subobject, Info);
+}
+
+const FSubobjectReplicationCache::FHandoverSubobjects* FSubobjectReplicationCache::FindHandoverSubobjects()
+{
+	if (!bHandoverSubobjectsValid)
+	{
+		RecordMiss();
+		return nullptr;
+	}
+
+	// A subobject may have been destroyed without going through OnSubobjectDeleted yet, in which case the
+	// set has to be rebuilt rather than handing out a stale entry.
+	for (const TPair<TWeakObjectPtr<UObject>, const FClassInfo*>& Pair : HandoverSubobjects)
+	{
+		if (!Pair.Key.IsValid())
+		{
+			bHandoverSubobjectsValid = false;
+			RecordMiss();
+			return nullptr;
+		}
+	}
+
+	RecordHit();
+	return &HandoverSubobjects;
+}
+
+void FSubobjectReplicationCache::SetHandoverSubobjects(FHandoverSubobjects&& InHandoverSubobjects)
+{
+	HandoverSubobjects = MoveTemp(InHandoverSubobjects);
+	bHandoverSubobjectsValid = true;
+}
+
+bool FSubobjectReplicationCache::FindLoadBalancingEligibility(const UAbstractLBStrategy* Strategy, bool& bOutEligible)
+{
+	const VirtualWorkerId LocalVirtualWorkerId = Strategy != nullptr ? Strategy->GetLocalVirtualWorkerId() : SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+
+	if (!bLoadBalancingEligibilityValid || EligibilityStrategy.Get() != Strategy || EligibilityLocalVirtualWorkerId != LocalVirtualWorkerId)
+	{
+		RecordMiss();
+		return false;
+	}
+
+	RecordHit();
+	bOutEligible = bLoadBalancingEligible;
+	return true;
+}
+
+void FSubobjectReplicationCache::SetLoadBalancingEligibility(const UAbstractLBStrategy* Strategy, bool bEligible)
+{
+	EligibilityStrategy = Strategy;
+	EligibilityLocalVirtualWorkerId = Strategy != nullptr ? Strategy->GetLocalVirtualWorkerId() : SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	bLoadBalancingEligible = bEligible;
+	bLoadBalancingEligibilityValid = true;
+}
+
+void FSubobjectReplicationCache::InvalidateSubobject(const UObject* Subobject)
+{
+	SubobjectInfos.Remove(Subobject);
+	bHandoverSubobjectsValid = false;
+}
+
+void FSubobjectReplicationCache::Invalidate()
+{
+	SubobjectInfos.Reset();
+	HandoverSubobjects.Reset();
+	bHandoverSubobjectsValid = false;
+	bLoadBalancingEligibilityValid = false;
+}
+
+void FSubobjectReplicationCache::RecordHit()
+{
+	NumHits++;
+	INC_DWORD_STAT(STAT_SpatialSubobjectReplicationCacheHits);
+}
+
+void FSubobjectReplicationCache::RecordMiss()
+{
+	NumMisses++;
+	INC_DWORD_STAT(STAT_SpatialSubobjectReplicationCacheMisses);
+}
@@ -0,0 +1,264 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/UpdatesQueuedUntilAuthority.h"
+
+#include "Interop/Connection/SpatialOSWorkerInterface.h"
+#include "SpatialConstants.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+DEFINE_LOG_CATEGORY(LogSpatialUpdatesQueuedUntilAuthority);
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Updates Queued Until Authority Merged"), STAT_SpatialUpdatesQueuedUntilAuthorityMerged, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Updates Queued Until Authority Evicted"), STAT_SpatialUpdatesQueuedUntilAuthorityEvicted, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Updates Queued Until Authority Whole Components Resent"), STAT_SpatialUpdatesQueuedUntilAuthorityWholeComponentsResent, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Updates Queued Until Authority Bytes"), STAT_SpatialUpdatesQueuedUntilAuthorityBytes, STATGROUP_SpatialNet);
+
+FUpdatesQueuedUntilAuthority::FUpdatesQueuedUntilAuthority(uint32 InMaxBytes)
+	: NumEntries(0)
+	, EvictionHead(0)
+	, NextSequence(0)
+	, MaxBytes(InMaxBytes)
+	, QueuedBytes(0)
+	, Stats{}
+{
+}
+
+FUpdatesQueuedUntilAuthority::~FUpdatesQueuedUntilAuthority()
+{
+	for (TPair<Worker_EntityId_Key, TMap<Worker_ComponentId, FEntry>>& EntityEntries : Entries)
+	{
+		for (TPair<Worker_ComponentId, FEntry>& Pair : EntityEntries.Value)
+		{
+			Schema_DestroyComponentUpdate(Pair.Value.Update.schema_type);
+		}
+	}
+}
+
+void FUpdatesQueuedUntilAuthority::SetMaxBytes(uint32 InMaxBytes)
+{
+	MaxBytes = InMaxBytes;
+	EvictUntilUnderBudget();
+}
+
+void FUpdatesQueuedUntilAuthority::Add(Worker_EntityId EntityId, const FWorkerComponentUpdate& Update)
+{
+	TMap<Worker_ComponentId, FEntry>& EntityEntries = Entries.FindOrAdd(EntityId);
+	FEntry* Entry = EntityEntries.Find(Update.component_id);
+
+	Stats.NumQueued++;
+
+	if (Entry == nullptr)
+	{
+		const uint32 Bytes = GetUpdateSize(Update);
+		EntityEntries.Add(Update.component_id, FEntry{ Update, Bytes, NextSequence });
+		NumEntries++;
+		QueuedBytes += Bytes;
+	}
+	else
+	{
+		// Schema_MergeComponentUpdateIntoUpdate copies the newer update's fields over the queued ones and appends its events,
+		// but leaves the newer update for us to destroy.
+		Schema_MergeComponentUpdateIntoUpdate(Update.schema_type, Entry->Update.schema_type);
+		Schema_DestroyComponentUpdate(Update.schema_type);
+
+#if TRACE_LIB_ACTIVE
+		if (Entry->Update.Trace == InvalidTraceKey)
+		{
+			Entry->Update.Trace = Update.Trace;
+		}
+#endif
+
+		QueuedBytes -= Entry->Bytes;
+		Entry->Bytes = GetUpdateSize(Entry->Update);
+		QueuedBytes += Entry->Bytes;
+		Entry->Sequence = NextSequence;
+
+		Stats.NumMerged++;
+		INC_DWORD_STAT(STAT_SpatialUpdatesQueuedUntilAuthorityMerged);
+	}
+
+	EvictionOrder.Add(FEvictionCandidate{ EntityId, Update.component_id, NextSequence });
+	NextSequence++;
+
+	Stats.PeakBytes = FMath::Max(Stats.PeakBytes, QueuedBytes);
+
+	EvictUntilUnderBudget();
+	CompactEvictionOrder();
+	UpdateQueuedBytesStat();
+}
+
+bool FUpdatesQueuedUntilAuthority::Pop(Worker_EntityId EntityId, Worker_ComponentId ComponentId, FWorkerComponentUpdate& OutUpdate)
+{
+	TMap<Worker_ComponentId, FEntry>* EntityEntries = Entries.Find(EntityId);
+	if (EntityEntries == nullptr)
+	{
+		return false;
+	}
+
+	FEntry* Entry = EntityEntries->Find(ComponentId);
+	if (Entry == nullptr)
+	{
+		return false;
+	}
+
+	OutUpdate = Entry->Update;
+	RemoveEntry(EntityId, ComponentId, false);
+	CompactEvictionOrder();
+	UpdateQueuedBytesStat();
+
+	return true;
+}
+
+void FUpdatesQueuedUntilAuthority::Send(Worker_EntityId EntityId, Worker_ComponentId ComponentId, SpatialOSWorkerInterface& Connection, TFunctionRef<bool(FWorkerComponentUpdate& OutUpdate)> CreateWholeComponentUpdate)
+{
+	// Updates queued for the same component have already been merged, so this sends at most one queued update.
+	FWorkerComponentUpdate Update;
+	if (Pop(EntityId, ComponentId, Update))
+	{
+		Connection.SendComponentUpdate(EntityId, &Update);
+	}
+
+	TSet<Worker_ComponentId>* EntityEvictedComponents = EvictedComponents.Find(EntityId);
+	if (EntityEvictedComponents == nullptr || EntityEvictedComponents->Remove(ComponentId) == 0)
+	{
+		return;
+	}
+
+	if (EntityEvictedComponents->Num() == 0)
+	{
+		EvictedComponents.Remove(EntityId);
+	}
+
+	// Sent after the queued update, so the component ends up with its current state.
+	FWorkerComponentUpdate WholeComponentUpdate = {};
+	if (CreateWholeComponentUpdate(WholeComponentUpdate))
+	{
+		Connection.SendComponentUpdate(EntityId, &WholeComponentUpdate);
+
+		Stats.NumWholeComponentsResent++;
+		INC_DWORD_STAT(STAT_SpatialUpdatesQueuedUntilAuthorityWholeComponentsResent);
+	}
+	else
+	{
+		UE_LOG(LogSpatialUpdatesQueuedUntilAuthority, Warning, TEXT("Could not resend the state of a component whose update queued until authority was dropped. Entity: %lld, component: %d"),
+			EntityId, ComponentId);
+	}
+}
+
+bool FUpdatesQueuedUntilAuthority::WasEvicted(Worker_EntityId EntityId, Worker_ComponentId ComponentId) const
+{
+	const TSet<Worker_ComponentId>* EntityEvictedComponents = EvictedComponents.Find(EntityId);
+	return EntityEvictedComponents != nullptr && EntityEvictedComponents->Contains(ComponentId);
+}
+
+void FUpdatesQueuedUntilAuthority::RemoveEntity(Worker_EntityId EntityId)
+{
+	EvictedComponents.Remove(EntityId);
+
+	TMap<Worker_ComponentId, FEntry>* EntityEntries = Entries.Find(EntityId);
+	if (EntityEntries == nullptr)
+	{
+		return;
+	}
+
+	for (TPair<Worker_ComponentId, FEntry>& Pair : *EntityEntries)
+	{
+		Schema_DestroyComponentUpdate(Pair.Value.Update.schema_type);
+		QueuedBytes -= Pair.Value.Bytes;
+		NumEntries--;
+	}
+
+	Entries.Remove(EntityId);
+	CompactEvictionOrder();
+	UpdateQueuedBytesStat();
+}
+
+uint32 FUpdatesQueuedUntilAuthority::GetUpdateSize(const Worker_ComponentUpdate& Update)
+{
+	return Schema_GetWriteBufferLength(Schema_GetComponentUpdateFields(Update.schema_type))
+		+ Schema_GetWriteBufferLength(Schema_GetComponentUpdateEvents(Update.schema_type));
+}
+
+void FUpdatesQueuedUntilAuthority::RemoveEntry(Worker_EntityId EntityId, Worker_ComponentId ComponentId, bool bDestroyUpdate)
+{
+	TMap<Worker_ComponentId, FEntry>& EntityEntries = Entries.FindChecked(EntityId);
+	FEntry& Entry = EntityEntries.FindChecked(ComponentId);
+
+	if (bDestroyUpdate)
+	{
+		Schema_DestroyComponentUpdate(Entry.Update.schema_type);
+	}
+
+	QueuedBytes -= Entry.Bytes;
+	NumEntries--;
+
+	EntityEntries.Remove(ComponentId);
+	if (EntityEntries.Num() == 0)
+	{
+		Entries.Remove(EntityId);
+	}
+}
+
+void FUpdatesQueuedUntilAuthority::EvictUntilUnderBudget()
+{
+	while (MaxBytes != 0 && QueuedBytes > MaxBytes && EvictionHead < EvictionOrder.Num())
+	{
+		const FEvictionCandidate Candidate = EvictionOrder[EvictionHead++];
+
+		const TMap<Worker_ComponentId, FEntry>* EntityEntries = Entries.Find(Candidate.EntityId);
+		const FEntry* Entry = EntityEntries != nullptr ? EntityEntries->Find(Candidate.ComponentId) : nullptr;
+		if (Entry == nullptr || Entry->Sequence != Candidate.Sequence)
+		{
+			// The entry was sent, removed or updated since this candidate was recorded.
+			continue;
+		}
+
+		UE_LOG(LogSpatialUpdatesQueuedUntilAuthority, Warning, TEXT("Dropping update queued until authority to stay within %u bytes, the component's whole state will be sent on authority gain instead. Entity: %lld, component: %d, bytes: %u"),
+			MaxBytes, Candidate.EntityId, Candidate.ComponentId, Entry->Bytes);
+
+		Stats.NumEvicted++;
+		Stats.BytesEvicted += Entry->Bytes;
+		INC_DWORD_STAT(STAT_SpatialUpdatesQueuedUntilAuthorityEvicted);
+
+		RemoveEntry(Candidate.EntityId, Candidate.ComponentId, true);
+		EvictedComponents.FindOrAdd(Candidate.EntityId).Add(Candidate.ComponentId);
+	}
+}
+
+void FUpdatesQueuedUntilAuthority::CompactEvictionOrder()
+{
+	if (NumEntries == 0)
+	{
+		EvictionOrder.Reset();
+		EvictionHead = 0;
+		return;
+	}
+
+	// Merged, sent and removed entries leave stale candidates behind, so drop them once they outnumber the live ones.
+	if (EvictionOrder.Num() - EvictionHead <= 2 * NumEntries + 64)
+	{
+		return;
+	}
+
+	TArray<FEvictionCandidate> LiveCandidates;
+	LiveCandidates.Reserve(NumEntries);
+	for (int32 i = EvictionHead; i < EvictionOrder.Num(); i++)
+	{
+		const FEvictionCandidate& Candidate = EvictionOrder[i];
+		const TMap<Worker_ComponentId, FEntry>* EntityEntries = Entries.Find(Candidate.EntityId);
+		const FEntry* Entry = EntityEntries != nullptr ? EntityEntries->Find(Candidate.ComponentId) : nullptr;
+		if (Entry != nullptr && Entry->Sequence == Candidate.Sequence)
+		{
+			LiveCandidates.Add(Candidate);
+		}
+	}
+
+	EvictionOrder = MoveTemp(LiveCandidates);
+	EvictionHead = 0;
+}
+
+void FUpdatesQueuedUntilAuthority::UpdateQueuedBytesStat()
+{
+	SET_DWORD_STAT(STAT_SpatialUpdatesQueuedUntilAuthorityBytes, QueuedBytes);
+}
@@ -7,14 +7,17 @@
 #include "EngineClasses/SpatialNetDriver.h"
 #include "Interop/Connection/SpatialWorkerConnection.h"
 #include "Interop/SpatialClassInfoManager.h"
+#include "Interop/SpatialConditionMapFilter.h"
 #include "Interop/SpatialStaticComponentView.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "Schema/StandardLibrary.h"
 #include "Schema/RPCPayload.h"
 #include "SpatialCommonTypes.h"
 #include "SpatialGDKSettings.h"
+#include "Utils/FastArrayItemDelta.h"
 #include "Utils/RepDataUtils.h"
 #include "Utils/SpatialStatics.h"
+#include "Utils/SubobjectReplicationCache.h"
 
 #include <WorkerSDK/improbable/c_worker.h>
 
@@ -32,6 +35,7 @@ struct FObjectReferences
 		, bFastArrayProp(Other.bFastArrayProp)
 		, Buffer(MoveTemp(Other.Buffer))
 		, NumBufferBits(Other.NumBufferBits)
+		, ItemDeltaBuffer(MoveTemp(Other.ItemDeltaBuffer))
 		, Array(MoveTemp(Other.Array))
 		, ShadowOffset(Other.ShadowOffset)
 		, ParentIndex(Other.ParentIndex)
@@ -52,8 +56,8 @@ struct FObjectReferences
 	}
 
 	// Struct (memory stream) constructor
-	FObjectReferences(const TArray<uint8>& InBuffer, int32 InNumBufferBits, TSet<FUnrealObjectRef>&& InDynamicRefs, TSet<FUnrealObjectRef>&& InUnresolvedRefs, int32 InCmdIndex, int32 InParentIndex, UProperty* InProperty, bool InFastArrayProp = false)
-		: MappedRefs(MoveTemp(InDynamicRefs)), UnresolvedRefs(MoveTemp(InUnresolvedRefs)), bSingleProp(false), bFastArrayProp(InFastArrayProp), Buffer(InBuffer), NumBufferBits(InNumBufferBits), ShadowOffset(InCmdIndex), ParentIndex(InParentIndex), Property(InProperty) {}
+	FObjectReferences(TArrayView<const uint8> InBuffer, int32 InNumBufferBits, TSet<FUnrealObjectRef>&& InDynamicRefs, TSet<FUnrealObjectRef>&& InUnresolvedRefs, int32 InCmdIndex, int32 InParentIndex, UProperty* InProperty, bool InFastArrayProp = false)
+		: MappedRefs(MoveTemp(InDynamicRefs)), UnresolvedRefs(MoveTemp(InUnresolvedRefs)), bSingleProp(false), bFastArrayProp(InFastArrayProp), Buffer(InBuffer.GetData(), InBuffer.Num()), NumBufferBits(InNumBufferBits), ShadowOffset(InCmdIndex), ParentIndex(InParentIndex), Property(InProperty) {}
 
 	// Array constructor
 	FObjectReferences(FObjectReferencesMap* InArray, int32 InCmdIndex, int32 InParentIndex, UProperty* InProperty)
@@ -66,6 +70,7 @@ struct FObjectReferences
 	bool								bFastArrayProp;
 	TArray<uint8>						Buffer;
 	int32								NumBufferBits;
+	TArray<uint8>						ItemDeltaBuffer; // FastArray item delta received since the keyframe in Buffer, serialized from schema.
 
 	TUniquePtr<FObjectReferencesMap>	Array;
 	int32								ShadowOffset;
@@ -163,6 +168,10 @@ public:
 
 	inline void SetClientAuthority(const bool IsAuth)
 	{
+		if (IsAuth != bIsAuthClient)
+		{
+			InvalidateConditionMapFilter();
+		}
 		bIsAuthClient = IsAuth;
 	}
 
@@ -186,14 +195,9 @@ public:
 		}
 	}
 
-	void SetServerAuthority(const bool IsAuth)
-	{
-		if (IsAuth && !bIsAuthServer)
-		{
-			AuthorityReceivedTimestamp = FPlatformTime::Cycles64();
-		}
-		bIsAuthServer = IsAuth;
-	}
+	// A channel prewarmed for authority forces a net update when authority arrives, so the Actor is replicated on this tick
+	// rather than waiting for its next update.
+	void SetServerAuthority(const bool IsAuth);
 
 	inline bool IsAuthoritativeServer() const
 	{
@@ -239,6 +243,18 @@ public:
 	FObjectReplicator* PreReceiveSpatialUpdate(UObject* TargetObject);
 	void PostReceiveSpatialUpdate(UObject* TargetObject, const TArray<UProperty*>& RepNotifies);
 
+	// Returns the condition filter for received properties, cached until InvalidateConditionMapFilter is called.
+	const FSpatialConditionMapFilter& GetConditionMapFilter(bool bIsClient);
+
+	// Called when a client receives a new role, client authority or physics replication state for the actor, as the cached filter
+	// depends on them. Servers apply every received property, so they don't need to invalidate it.
+	void InvalidateConditionMapFilter() { ConditionMapFilter.Reset(); }
+
+	uint32 GetNumConditionMapFiltersBuilt() const { return NumConditionMapFiltersBuilt; }
+
+	// Returns an empty array to collect the RepNotifies of a received update in, reused across updates to avoid allocating per update.
+	TArray<UProperty*>& GetRepNotifiesBuffer();
+
 	void OnCreateEntityResponse(const Worker_CreateEntityResponseOp& Op);
 
 	void RemoveRepNotifiesWithUnresolvedObjs(TArray<UProperty*>& RepNotifies, const FRepLayout& RepLayout, const FObjectReferencesMap& RefMap, UObject* Object);
@@ -258,8 +274,31 @@ public:
 	// Call when a subobject is deleted to unmap its references and cleanup its cached informations.
 	void OnSubobjectDeleted(const FUnrealObjectRef& ObjectRef, UObject* Object);
 
+	// Call when authority over any component of this channel's entity changes.
+	FORCEINLINE void InvalidateReplicationCache() { ReplicationCache.Invalidate(); }
+
+	// Call on a server worker which isn't authoritative over the Actor when the load balancing strategy predicts it will be soon,
+	// so the replicators and shadow data are ready and the Actor can be replicated as soon as authority arrives.
+	void PrewarmForAuthority();
+	// Call when the strategy no longer predicts this worker will gain authority, so the Actor isn't forced to replicate if it does anyway.
+	FORCEINLINE void CancelPrewarmForAuthority() { bPrewarmedForAuthority = false; }
+	FORCEINLINE bool IsPrewarmedForAuthority() const { return bPrewarmedForAuthority; }
+	FORCEINLINE bool IsAwaitingFirstReplicationSinceAuthority() const { return bAwaitingFirstReplicationSinceAuthority; }
+
+	// Item delta state of a FastArray property of an object replicated by this channel. Getting the state for one
+	// direction discards the other, as a worker that sends a FastArray's updates doesn't also receive them.
+	SpatialGDK::FFastArrayItemDeltaSenderState& GetFastArrayItemDeltaSenderState(UObject* Object, uint16 Handle);
+	SpatialGDK::FFastArrayItemDeltaReceiverState& GetFastArrayItemDeltaReceiverState(UObject* Object, uint16 Handle);
+
 	static void ResetShadowData(FRepLayout& RepLayout, FRepStateStaticBuffer& StaticBuffer, UObject* TargetObject);
 
+	// Allocates and initializes handover shadow data using the layout in ClassInfo.
+	static void InitializeHandoverShadowData(const FClassInfo& ClassInfo, TArray<uint8>& ShadowData);
+
+	// Returns the handles of handover properties which differ from the shadow data, and updates the shadow data.
+	// POD properties are diffed and copied bitwise, a range at a time.
+	static FHandoverChangeState GetHandoverChangeList(const FClassInfo& ClassInfo, TArray<uint8>& ShadowData, const UObject* Object, bool bForceAllChanged);
+
 protected:
 	// Begin UChannel interface
 	virtual bool CleanUp(const bool bForDestroy, EChannelCloseReason CloseReason) override;
@@ -277,6 +316,11 @@ private:
 
 	void GetLatestAuthorityChangeFromHierarchy(const AActor* HierarchyActor, uint64& OutTimestamp);
 
+	// Whether this worker should evaluate the load balancing strategy for this channel's actor.
+	bool IsLoadBalancingEligible();
+
+	using FFastArrayPropertyKey = TPair<TWeakObjectPtr<UObject>, uint16>;
+
 public:
 	// If this actor channel is responsible for creating a new entity, this will be set to true once the entity creation request is issued.
 	bool bCreatedEntity;
@@ -332,6 +376,21 @@ private:
 	TArray<uint8>* ActorHandoverShadowData;
 	TMap<TWeakObjectPtr<UObject>, TSharedRef<TArray<uint8>>> HandoverShadowDataMap;
 
+	// Item delta state of the FastArray properties sent and received through this channel, per object and rep handle.
+	TMap<FFastArrayPropertyKey, SpatialGDK::FFastArrayItemDeltaSenderState> FastArrayItemDeltaSenderStates;
+	TMap<FFastArrayPropertyKey, SpatialGDK::FFastArrayItemDeltaReceiverState> FastArrayItemDeltaReceiverStates;
+
+	// Subobject class infos, handover subobjects and load balancing eligibility, reused across replication passes.
+	FSubobjectReplicationCache ReplicationCache;
+
+	// Filter for received properties, cached as it only changes with the actor's role, ownership and physics state.
+	TOptional<FSpatialConditionMapFilter> ConditionMapFilter;
+	bool bConditionMapFilterIsClient;
+	uint32 NumConditionMapFiltersBuilt;
+
+	// Reused to collect the RepNotifies of each received update.
+	TArray<UProperty*> RepNotifiesBuffer;
+
 	// Band-aid until we get Actor Sets.
 	// Used on server-side workers only.
 	// Record when this worker receives SpatialOS Position component authority over the Actor.
@@ -342,4 +401,13 @@ private:
 	// before the actor holding the position for all the hierarchy, it can immediately attempt to migrate back.
 	// Using this timestamp, we can back off attempting migrations for a while.
 	uint64 AuthorityReceivedTimestamp;
+
+	// Used on server-side workers only.
+	// Set by PrewarmForAuthority until it is cancelled or authority is lost, and from gaining authority until the Actor is first
+	// replicated or authority is lost.
+	bool bPrewarmedForAuthority;
+	bool bAwaitingFirstReplicationSinceAuthority;
+
+	// Replicates the Actor every tick while the load balancing strategy predicts it is about to be handed over to another worker.
+	void PrefetchHandover();
 };
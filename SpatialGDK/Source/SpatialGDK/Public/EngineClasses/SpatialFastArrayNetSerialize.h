@@ -21,8 +21,9 @@ public:
 		: NetDriver(InNetDriver)
 	{ }
 	virtual void NetSerializeStruct(UScriptStruct* Struct, FBitArchive& Ar, UPackageMap* PackageMap, void* Data, bool& bHasUnmapped) override;
-	//TODO: UNR-2371 - Look at whether we need to implement these and implement 'NetSerializeStruct(FNetDeltaSerializeInfo& Params)'.
-	virtual void NetSerializeStruct(FNetDeltaSerializeInfo& Params) override { checkf(false, TEXT("The GDK does not support the new version of NetSerializeStruct yet.")); };
+	// Used by the engine's native FastArray serialization, which FastArray item deltas are applied through.
+	virtual void NetSerializeStruct(FNetDeltaSerializeInfo& Params) override;
+	//TODO: UNR-2371 - Look at whether we need to implement these.
 
 	virtual void GatherGuidReferencesForFastArray(struct FFastArrayDeltaSerializeParams& Params) override { checkf(false, TEXT("GatherGuidReferencesForFastArray called - the GDK currently does not support delta serialization of structs within fast arrays.")); };
 	virtual bool MoveGuidToUnmappedForFastArray(struct FFastArrayDeltaSerializeParams& Params) override { checkf(false, TEXT("MoveGuidToUnmappedForFastArray called - the GDK currently does not support delta serialization of structs within fast arrays.")); return false; };
@@ -42,6 +43,11 @@ struct FSpatialNetDeltaSerializeInfo : FNetDeltaSerializeInfo
 
 	static bool DeltaSerializeRead(USpatialNetDriver* NetDriver, FSpatialNetBitReader& Reader, UObject* Object, int32 ArrayIndex, UProperty* ParentProperty, UScriptStruct* NetDeltaStruct);
 	static bool DeltaSerializeWrite(USpatialNetDriver* NetDriver, FSpatialNetBitWriter& Writer, UObject* Object, int32 ArrayIndex, UProperty* ParentProperty, UScriptStruct* NetDeltaStruct);
+
+	// Serialize FastArray in the engine's native format, which only contains the items that differ from OldState
+	// and fires the item callbacks for each of them when read.
+	static bool NativeDeltaSerializeRead(USpatialNetDriver* NetDriver, FSpatialNetBitReader& Reader, void* FastArray, UScriptStruct* NetDeltaStruct);
+	static bool NativeDeltaSerializeWrite(USpatialNetDriver* NetDriver, FSpatialNetBitWriter& Writer, void* FastArray, UScriptStruct* NetDeltaStruct, INetDeltaBaseState* OldState, TSharedPtr<INetDeltaBaseState>& OutNewState);
 };
 
 PRAGMA_ENABLE_DEPRECATION_WARNINGS // TODO: UNR-2371 - Remove when we update our usage of FNetDeltaSerializeInfo
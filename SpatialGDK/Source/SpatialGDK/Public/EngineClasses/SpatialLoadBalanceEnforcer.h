@@ -16,6 +16,15 @@ class SpatialVirtualWorkerTranslator;
 class SPATIALGDK_API SpatialLoadBalanceEnforcer
 {
 public:
+	// The write ACL of every entity with the same owning worker and components, built once per tick and shared by their requests.
+	struct WriteAclTemplate
+	{
+		// Entries which don't depend on the entity.
+		WriteAclMap ServerWriteAcl;
+		// Components written by the entity's owning client, which are given the request's ClientRequirementSet.
+		TArray<Worker_ComponentId> OwningClientComponentIds;
+	};
+
 	struct AclWriteAuthorityRequest
 	{
 		Worker_EntityId EntityId = 0;
@@ -23,6 +32,7 @@ public:
 		WorkerRequirementSet ReadAcl;
 		WorkerRequirementSet ClientRequirementSet;
 		TArray<Worker_ComponentId> ComponentIds;
+		TSharedPtr<const WriteAclTemplate> WriteAcl;
 	};
 
 	SpatialLoadBalanceEnforcer(const PhysicalWorkerName& InWorkerId, const USpatialStaticComponentView* InStaticComponentView, const SpatialVirtualWorkerTranslator* InVirtualWorkerTranslator);
@@ -39,15 +49,30 @@ public:
 	// Visible for testing
 	bool AclAssignmentRequestIsQueued(const Worker_EntityId EntityId) const;
 
-	TArray<AclWriteAuthorityRequest> ProcessQueuedAclAssignmentRequests();
+	int32 GetNumQueuedAclAssignmentRequests() const;
+
+	// Processes queued requests in the order they were queued. If MaxRequests is above 0, at most that many requests are returned,
+	// and the rest stay queued for the next call.
+	TArray<AclWriteAuthorityRequest> ProcessQueuedAclAssignmentRequests(int32 MaxRequests = 0);
+
+	// Visible for testing
+	int32 GetNumWriteAclTemplatesBuiltLastProcess() const { return NumWriteAclTemplatesBuiltLastProcess; }
 
 private:
 	void QueueAclAssignmentRequest(const Worker_EntityId EntityId);
+	void DequeueAclAssignmentRequest(const Worker_EntityId EntityId);
 	bool CanEnforce(Worker_EntityId EntityId) const;
 
+	static TSharedRef<const WriteAclTemplate> CreateWriteAclTemplate(const PhysicalWorkerName& OwningWorkerId, const TArray<Worker_ComponentId>& ComponentIds);
+
 	const PhysicalWorkerName WorkerId;
 	TWeakObjectPtr<const USpatialStaticComponentView> StaticComponentView;
 	const SpatialVirtualWorkerTranslator* VirtualWorkerTranslator;
 
+	// Entities in the order they were queued. Dequeued entities are only removed from QueuedAclAssignmentRequests,
+	// and skipped when they are reached here.
 	TArray<Worker_EntityId> AclWriteAuthAssignmentRequests;
+	TSet<Worker_EntityId> QueuedAclAssignmentRequests;
+
+	int32 NumWriteAclTemplatesBuiltLastProcess = 0;
 };
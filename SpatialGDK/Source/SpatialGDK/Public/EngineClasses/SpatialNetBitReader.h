@@ -14,7 +14,7 @@ class USpatialPackageMapClient;
 class SPATIALGDK_API FSpatialNetBitReader : public FNetBitReader
 {
 public:
-	FSpatialNetBitReader(USpatialPackageMapClient* InPackageMap, uint8* Source, int64 CountBits, TSet<FUnrealObjectRef>& InDynamicRefs, TSet<FUnrealObjectRef>& InUnresolvedRefs);
+	FSpatialNetBitReader(USpatialPackageMapClient* InPackageMap, const uint8* Source, int64 CountBits, TSet<FUnrealObjectRef>& InDynamicRefs, TSet<FUnrealObjectRef>& InUnresolvedRefs);
 
 	using FArchive::operator<<; // For visibility of the overloads we don't override
 
@@ -27,6 +27,12 @@ public:
 protected:
 	void DeserializeObjectRef(FUnrealObjectRef& ObjectRef);
 
+	// Reads a value written by FSpatialNetBitWriter::SerializeVarint.
+	uint64 DeserializeVarint();
+
 	TSet<FUnrealObjectRef>& DynamicRefs;
 	TSet<FUnrealObjectRef>& UnresolvedRefs;
+
+	// Paths read so far from this buffer, in the order the writer assigned their indices.
+	TArray<FString> Paths;
 };
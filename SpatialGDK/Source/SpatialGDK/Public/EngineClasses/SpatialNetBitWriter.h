@@ -23,4 +23,13 @@ public:
 
 protected:
 	void SerializeObjectRef(FUnrealObjectRef& ObjectRef);
+
+	// Writes Value 7 bits at a time, low bits first, with the high bit of each byte flagging a continuation.
+	void SerializeVarint(uint64 Value);
+
+	// Bits the object ref would have taken with a fixed-width entity ID and offset and no path interning.
+	static int64 GetUncompressedObjectRefBits(const FUnrealObjectRef& ObjectRef);
+
+	// Paths already written to this buffer, mapped to their 1-based index. Repeated paths are written as the index only.
+	TMap<FString, uint32> PathIndices;
 };
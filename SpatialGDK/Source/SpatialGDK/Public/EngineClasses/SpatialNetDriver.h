@@ -4,12 +4,14 @@
 
 #include "EngineClasses/SpatialLoadBalanceEnforcer.h"
 #include "EngineClasses/SpatialVirtualWorkerTranslationManager.h"
+#include "EngineClasses/SpatialVirtualWorkerRoutingTable.h"
 #include "EngineClasses/SpatialVirtualWorkerTranslator.h"
 #include "Interop/Connection/ConnectionConfig.h"
 #include "Interop/SpatialDispatcher.h"
 #include "Interop/SpatialOutputDevice.h"
 #include "Interop/SpatialRPCService.h"
 #include "Interop/SpatialSnapshotManager.h"
+#include "Utils/DormancyWakeUpQueue.h"
 #include "Utils/InterestFactory.h"
 
 #include "LoadBalancing/AbstractLockingPolicy.h"
@@ -158,6 +160,7 @@ public:
 	TUniquePtr<SpatialGDK::InterestFactory> InterestFactory;
 	TUniquePtr<SpatialLoadBalanceEnforcer> LoadBalanceEnforcer;
 	TUniquePtr<SpatialVirtualWorkerTranslator> VirtualWorkerTranslator;
+	TUniquePtr<SpatialVirtualWorkerRoutingTable> VirtualWorkerRoutingTable;
 
 	Worker_EntityId WorkerEntityId = SpatialConstants::INVALID_ENTITY_ID;
 
@@ -198,6 +201,7 @@ private:
 	TArray<Worker_OpList*> QueuedStartupOpLists;
 	TSet<Worker_EntityId_Key> DormantEntities;
 	TSet<TWeakObjectPtr<USpatialActorChannel>> PendingDormantChannels;
+	FDormancyWakeUpQueue DormancyWakeUpQueue;
 
 	TMap<FString, TWeakObjectPtr<USpatialNetConnection>> WorkerConnections;
 
@@ -250,6 +254,11 @@ private:
 	int32 ServerReplicateActors_PrepConnections(const float DeltaSeconds);
 	int32 ServerReplicateActors_PrioritizeActors(UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, const TArray<FNetworkObjectInfo*> ConsiderList, const bool bCPUSaturated, FActorPriority*& OutPriorityList, FActorPriority**& OutPriorityActors);
 	void ServerReplicateActors_ProcessPrioritizedActors(UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, FActorPriority** PriorityActors, const int32 FinalSortedCount, int32& OutUpdated);
+
+	bool IsWakingFromDormancy(AActor* Actor, UActorChannel* Channel);
+	void StageDormancyWakeUp(AActor* Actor, const TArray<FNetViewer>& ConnectionViewers);
+	// Replicates staged dormancy wake ups, using up what is left of this tick's entity creation and actor replication rate limits.
+	void ProcessDormancyWakeUps(UNetConnection* Connection, int32& InOutEntitiesToCreateLeft, int32& InOutActorsToReplicateLeft, int32& OutUpdated);
 #endif
 
 	void ProcessRPC(AActor* Actor, UObject* SubObject, UFunction* Function, void* Parameters);
@@ -265,6 +274,18 @@ private:
 
 	float TimeWhenPositionLastUpdated;
 
+	// When this worker last reported its load, and the load balancing partition its interest was last updated for.
+	float TimeWhenLoadLastReported;
+	uint32 AppliedPartitionVersion;
+
+	void TickLoadBalancingPartition();
+	float GetLocalWorkerLoad() const;
+
+	// When this worker last looked for Actors the load balancing strategy predicts it will gain authority over.
+	float TimeWhenHandoverPrefetchLastEvaluated;
+
+	void TickHandoverPrefetch();
+
 	// Counter for giving each connected client a unique IP address to satisfy Unreal's requirement of
 	// each client having a unique IP address in the UNetDriver::MappedClientConnections map.
 	// The GDK does not use this address for any networked purpose, only bookkeeping.
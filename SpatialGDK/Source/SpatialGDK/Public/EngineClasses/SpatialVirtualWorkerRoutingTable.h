@@ -0,0 +1,52 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "SpatialCommonTypes.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+#include "CoreMinimal.h"
+
+class SpatialVirtualWorkerTranslator;
+
+struct VirtualWorkerRoute
+{
+	PhysicalWorkerName PhysicalWorker;
+	Worker_EntityId ServerWorkerEntityId;
+};
+
+/**
+ * Routes requests for a virtual worker to the server worker simulating it, from a cache of the translator's mapping.
+ *
+ * The cache is kept current from the translator's mapping change notifications, so a route resolves to the physical worker
+ * and its server worker entity in one lookup. A virtual worker the cache hasn't seen yet is looked up in the translator.
+ */
+class SPATIALGDK_API SpatialVirtualWorkerRoutingTable
+{
+public:
+	explicit SpatialVirtualWorkerRoutingTable(SpatialVirtualWorkerTranslator* InTranslator);
+	~SpatialVirtualWorkerRoutingTable();
+
+	// Returns the route to the virtual worker, or nullptr if no server worker simulates it. Only valid until the next mapping update.
+	const VirtualWorkerRoute* FindRoute(VirtualWorkerId Id);
+	Worker_EntityId GetServerWorkerEntity(VirtualWorkerId Id);
+
+	// For retrying a request to a virtual worker which was sent to SentToServerWorkerEntityId. Returns the server worker entity which
+	// simulates the virtual worker now, counting a stale-route retry if the virtual worker has moved since the request was sent.
+	Worker_EntityId GetServerWorkerEntityForRetry(VirtualWorkerId Id, Worker_EntityId SentToServerWorkerEntityId);
+
+	uint32 GetNumLookups() const { return NumLookups; }
+	uint32 GetNumStaleRouteRetries() const { return NumStaleRouteRetries; }
+
+private:
+	void UpdateRoute(VirtualWorkerId Id);
+
+	SpatialVirtualWorkerTranslator* Translator;
+	FDelegateHandle MappingChangedHandle;
+
+	TMap<VirtualWorkerId, VirtualWorkerRoute> Routes;
+
+	uint32 NumLookups;
+	uint32 NumStaleRouteRetries;
+};
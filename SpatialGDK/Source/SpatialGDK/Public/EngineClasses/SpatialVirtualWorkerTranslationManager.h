@@ -10,12 +10,14 @@
 #include <WorkerSDK/improbable/c_schema.h>
 
 #include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogSpatialVirtualWorkerTranslationManager, Log, All)
 
 class SpatialVirtualWorkerTranslator;
 class SpatialOSDispatcherInterface;
 class SpatialOSWorkerInterface;
+class UAbstractLBStrategy;
 
 //
 // The Translation Manager is responsible for querying SpatialOS for all UnrealWorker worker
@@ -26,6 +28,13 @@ class SpatialOSWorkerInterface;
 // One UnrealWorker is arbitrarily chosen by SpatialOS to be authoritative for the Translation
 // entity. This class will execute on that worker and will be idle on all other workers.
 //
+// The mapping is versioned: each update carries the entries which changed since the last full snapshot
+// of the mapping, and the manager writes a new snapshot once most of the entries have changed since.
+//
+// If the load balancing strategy's regions move at runtime, the manager also rebalances them from
+// the load each server worker reports on its worker entity, and writes them into the Translation
+// entity alongside the mapping.
+//
 // This class is currently implemented in the UnrealWorker, but none of the logic must be in
 // Unreal. It could be moved to an independent worker in the future in cloud deployments. It
 // lives here now for convenience and for fast iteration on local deployments.
@@ -40,6 +49,11 @@ public:
 
 	void SetNumberOfVirtualWorkers(const uint32 NumVirtualWorkers);
 
+	void SetLoadBalanceStrategy(UAbstractLBStrategy* InLoadBalanceStrategy) { LoadBalanceStrategy = InLoadBalanceStrategy; }
+
+	// Queries the load each server worker reported, and publishes the strategy's regions if rebalancing changed them.
+	void RebalanceFromReportedLoads();
+
 	// The translation manager only cares about changes to the authority of the translation mapping.
 	void AuthorityChanged(const Worker_AuthorityChangeOp& AuthChangeOp);
 
@@ -48,20 +62,31 @@ private:
 	SpatialOSWorkerInterface* Connection;
 
 	SpatialVirtualWorkerTranslator* Translator;
+	TWeakObjectPtr<UAbstractLBStrategy> LoadBalanceStrategy;
 
 	TMap<VirtualWorkerId, TPair<PhysicalWorkerName, Worker_EntityId>> VirtualToPhysicalWorkerMapping;
 	TMap<PhysicalWorkerName, VirtualWorkerId> PhysicalToVirtualWorkerMapping;
 	TQueue<VirtualWorkerId> UnassignedVirtualWorkers;
 
+	// The version of the mapping last published, the version its last snapshot was written at, and the version each entry last changed in.
+	uint32 MappingVersion;
+	uint32 SnapshotVersion;
+	TMap<VirtualWorkerId, uint32> EntryVersions;
+	// Entries changed since the mapping was last published.
+	TSet<VirtualWorkerId> PendingChanges;
+
 	bool bWorkerEntityQueryInFlight;
 
 	// Serialization and deserialization of the mapping.
-	void WriteMappingToSchema(Schema_Object* Object) const;
+	bool ShouldWriteSnapshot() const;
+	void WriteMappingToSchema(Schema_Object* Object, bool bWriteSnapshot) const;
 
 	// The following methods are used to query the Runtime for all worker entities and update the mapping
 	// based on the response.
 	void QueryForServerWorkerEntities();
+	Worker_RequestId SendServerWorkerEntityQuery();
 	void ServerWorkerEntityQueryDelegate(const Worker_EntityQueryResponseOp& Op);
+	void LoadReportQueryDelegate(const Worker_EntityQueryResponseOp& Op);
 	void ConstructVirtualWorkerMappingFromQueryResponse(const Worker_EntityQueryResponseOp& Op);
 	void SendVirtualWorkerMappingUpdate();
 
@@ -39,12 +39,27 @@ public:
 	// On receiving a version of the translation state, apply that to the internal mapping.
 	void ApplyVirtualWorkerManagerData(Schema_Object* ComponentObject);
 
+	// The version of the last mapping applied, or 0 if none has been or the mapping was not versioned.
+	uint32 GetMappingVersion() const { return MappingVersion; }
+
+	// Broadcast for each virtual worker whose physical worker or server worker entity changed, as a mapping is applied.
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnVirtualWorkerMappingChanged, VirtualWorkerId);
+	FOnVirtualWorkerMappingChanged OnVirtualWorkerMappingChanged;
+
 private:
+	struct MappingEntry
+	{
+		VirtualWorkerId Id;
+		PhysicalWorkerName Name;
+		Worker_EntityId ServerWorkerEntityId;
+	};
+
 	TWeakObjectPtr<UAbstractLBStrategy> LoadBalanceStrategy;
 
 	TMap<VirtualWorkerId, TPair<PhysicalWorkerName, Worker_EntityId>> VirtualToPhysicalWorkerMapping;
 
 	bool bIsReady;
+	uint32 MappingVersion;
 
 	// The WorkerId of this worker, for logging purposes.
 	PhysicalWorkerName LocalPhysicalWorkerName;
@@ -52,7 +67,11 @@ private:
 
 	// Serialization and deserialization of the mapping.
 	void ApplyMappingFromSchema(Schema_Object* Object);
-	bool IsValidMapping(Schema_Object* Object) const;
+	bool ApplyFullMappingFromSchema(Schema_Object* Object);
+	bool ApplyVersionedMappingFromSchema(Schema_Object* Object);
+	void ReadChangedEntries(Schema_Object* Object, Schema_FieldId FieldId, TArray<MappingEntry>& OutEntries, TSet<VirtualWorkerId>* OutIds) const;
+	bool IsValidMapping(const TArray<MappingEntry>& Entries) const;
 
 	void UpdateMapping(VirtualWorkerId Id, PhysicalWorkerName Name, Worker_EntityId ServerWorkerEntityId);
+	void RemoveMappingsNotIn(const TSet<VirtualWorkerId>& Ids);
 };
@@ -42,6 +42,19 @@ struct FHandoverPropertyInfo
 	int32 Offset;
 	int32 ArrayIdx;
 	UProperty* Property;
+
+	// Offset of this property in the handover shadow data kept by actor channels.
+	int32 ShadowOffset;
+};
+
+// A run of consecutive handover properties. POD runs are contiguous in both the object and the handover
+// shadow data, so they can be compared and copied bitwise. Other properties each get a run of their own.
+struct FHandoverPropertyRange
+{
+	int32 FirstIndex; // Index into FClassInfo::HandoverProperties
+	int32 Num;
+	int32 Size;
+	bool bIsPOD;
 };
 
 struct FInterestPropertyInfo
@@ -61,6 +74,7 @@ struct FClassInfo
 	TArray<UFunction*> RPCs;
 	TMap<UFunction*, FRPCInfo> RPCInfoMap;
 	TArray<FHandoverPropertyInfo> HandoverProperties;
+	TArray<FHandoverPropertyRange> HandoverPropertyRanges;
 	TArray<FInterestPropertyInfo> InterestProperties;
 
 	// For Actors and default Subobjects belonging to Actors
@@ -72,6 +86,9 @@ struct FClassInfo
 	// Only for default Subobjects belonging to Actors
 	FName SubobjectName;
 
+	// Only for Actors, when load balancing across Layers. Resolved once here, as authority checks look it up for every Actor.
+	FName LayerName;
+
 	// Only for Subobject classes
 	TArray<TSharedRef<const FClassInfo>> DynamicSubobjectInfo;
 };
@@ -98,6 +115,8 @@ public:
 	bool IsSupportedClass(const FString& PathName) const;
 
 	const FClassInfo& GetOrCreateClassInfoByClass(UClass* Class);
+	// Returns nullptr if no class info has been created for the class yet.
+	const FClassInfo* FindClassInfoByClass(const UClass* Class) const;
 	const FClassInfo& GetOrCreateClassInfoByObject(UObject* Object);
 	const FClassInfo& GetClassInfoByComponentId(Worker_ComponentId ComponentId);
 
@@ -128,6 +147,12 @@ public:
 	// Tries to find ClassInfo corresponding to an unused dynamic subobject on the given entity
 	const FClassInfo* GetClassInfoForNewSubobject(const UObject* Object, Worker_EntityId EntityId, USpatialPackageMapClient* PackageMapClient);
 
+	// Fills in the handover properties of a class, their shadow data layout and the ranges they can be diffed in.
+	static void CreateHandoverPropertyInfo(UClass* Class, FClassInfo& Info);
+
+	// True for properties where Identical is equivalent to a bitwise compare.
+	static bool IsBitwiseComparableHandoverProperty(const UProperty* Property);
+
 	UPROPERTY()
 	USchemaDatabase* SchemaDatabase;
 
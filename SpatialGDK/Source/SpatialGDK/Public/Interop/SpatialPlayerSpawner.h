@@ -56,6 +56,13 @@ private:
 		}
 	};
 
+	struct ForwardSpawnRequest
+	{
+		TUniquePtr<Schema_CommandRequest, ForwardSpawnRequestDeleter> Request;
+		// The virtual worker the request is forwarded to, so a retry can be routed to whichever server worker simulates it by then.
+		VirtualWorkerId SpawningVirtualWorker;
+	};
+
 	// Client
 	SpatialGDK::SpawnPlayerRequest ObtainPlayerParams() const;
 
@@ -72,7 +79,7 @@ private:
 
 	FTimerManager* TimerManager;
 	int NumberOfAttempts;
-	TMap<Worker_RequestId_Key, TUniquePtr<Schema_CommandRequest, ForwardSpawnRequestDeleter>> OutgoingForwardPlayerSpawnRequests;
+	TMap<Worker_RequestId_Key, ForwardSpawnRequest> OutgoingForwardPlayerSpawnRequests;
 
 	TSet<FString> WorkersWithPlayersSpawned;
 };
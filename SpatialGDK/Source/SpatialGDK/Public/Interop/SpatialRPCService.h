@@ -57,7 +57,7 @@ enum class EPushRPCResult : uint8
 class SPATIALGDK_API SpatialRPCService
 {
 public:
-	SpatialRPCService(ExtractRPCDelegate ExtractRPCCallback, const USpatialStaticComponentView* View, USpatialLatencyTracer* SpatialLatencyTracer);
+	SpatialRPCService(ExtractRPCDelegate ExtractRPCCallback, const USpatialStaticComponentView* View, USpatialLatencyTracer* SpatialLatencyTracer, bool bInBundleMulticastRPCs = false);
 
 	EPushRPCResult PushRPC(Worker_EntityId EntityId, ERPCType Type, RPCPayload Payload, bool bCreatedEntity);
 	void PushOverflowedRPCs();
@@ -81,6 +81,9 @@ public:
 	void OnEndpointAuthorityGained(Worker_EntityId EntityId, Worker_ComponentId ComponentId);
 	void OnEndpointAuthorityLost(Worker_EntityId EntityId, Worker_ComponentId ComponentId);
 
+	// If true, multicast RPCs pushed on the same entity are held until GetRPCsAndAcksToSend and sent as a single ring buffer element.
+	bool IsBundlingMulticastRPCs() const { return bBundleMulticastRPCs; }
+
 private:
 	// For now, we should drop overflowed RPCs when entity crosses the boundary.
 	// When locking works as intended, we should re-evaluate how this will work (drop after some time?).
@@ -90,6 +93,8 @@ private:
 
 	void ExtractRPCsForType(Worker_EntityId EntityId, ERPCType Type);
 
+	void WritePendingMulticastBundles();
+
 	void AddOverflowedRPC(EntityRPCType EntityType, RPCPayload&& Payload);
 
 	uint64 GetAckFromView(Worker_EntityId EntityId, ERPCType Type);
@@ -102,9 +107,12 @@ private:
 	ExtractRPCDelegate ExtractRPCCallback;
 	const USpatialStaticComponentView* View;
 	USpatialLatencyTracer* SpatialLatencyTracer;
+	bool bBundleMulticastRPCs;
 
 	// This is local, not written into schema.
 	TMap<Worker_EntityId_Key, uint64> LastSeenMulticastRPCIds;
+	// Number of RPCs already extracted from the multicast bundle after the last seen RPC ID, if extraction stopped midway through it.
+	TMap<Worker_EntityId_Key, int32> PartiallyExtractedMulticastBundles;
 
 	// Stored here for things we have authority over.
 	TMap<EntityRPCType, uint64> LastAckedRPCIds;
@@ -113,9 +121,18 @@ private:
 	TMap<EntityComponentId, Schema_ComponentData*> PendingRPCsOnEntityCreation;
 
 	TMap<EntityComponentId, Schema_ComponentUpdate*> PendingComponentUpdatesToSend;
+
+	struct PendingMulticastBundle
+	{
+		uint64 RPCId;
+		TArray<RPCPayload> Payloads;
+	};
+	TMap<Worker_EntityId_Key, PendingMulticastBundle> PendingMulticastBundles;
+
 	TMap<EntityRPCType, TArray<RPCPayload>> OverflowedRPCs;
 
 #if TRACE_LIB_ACTIVE
+	void AddPendingTrace(const EntityComponentId& EntityComponent, const TraceKey Trace);
 	void ProcessResultToLatencyTrace(const EPushRPCResult Result, const TraceKey Trace);
 	TMap<EntityComponentId, TraceKey> PendingTraces;
 #endif
@@ -10,8 +10,13 @@
 #include "Interop/SpatialRPCService.h"
 #include "Schema/RPCPayload.h"
 #include "TimerManager.h"
+#include "Utils/ComponentFactory.h"
+#include "Utils/EntityCreationBatch.h"
+#include "Utils/EntityPrototypeCache.h"
+#include "Utils/PositionUpdateFilter.h"
 #include "Utils/RepDataUtils.h"
 #include "Utils/RPCContainer.h"
+#include "Utils/UpdatesQueuedUntilAuthority.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
 #include <WorkerSDK/improbable/c_worker.h>
@@ -58,7 +63,6 @@ struct FPendingRPC
 // care for actor getting deleted before actor channel
 using FChannelObjectPair = TPair<TWeakObjectPtr<USpatialActorChannel>, TWeakObjectPtr<UObject>>;
 using FRPCsOnEntityCreationMap = TMap<TWeakObjectPtr<const UObject>, SpatialGDK::RPCsOnEntityCreation>;
-using FUpdatesQueuedUntilAuthority = TMap<Worker_EntityId_Key, TArray<FWorkerComponentUpdate>>;
 using FChannelsToUpdatePosition = TSet<TWeakObjectPtr<USpatialActorChannel>>;
 
 UCLASS()
@@ -72,6 +76,8 @@ public:
 	// Actor Updates
 	void SendComponentUpdates(UObject* Object, const FClassInfo& Info, USpatialActorChannel* Channel, const FRepChangeState* RepChanges, const FHandoverChangeState* HandoverChanges, uint32& OutBytesWritten);
 	void SendPositionUpdate(Worker_EntityId EntityId, const FVector& Location);
+	// Must be called when authority over the entity's Position changes, as another worker may have moved it since.
+	void ResetLastSentPosition(Worker_EntityId EntityId);
 	void SendAuthorityIntentUpdate(const AActor& Actor, VirtualWorkerId NewAuthoritativeVirtualWorkerId);
 	void SetAclWriteAuthority(const SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest& Request);
 	FRPCErrorInfo SendRPC(const FPendingRPCParams& Params);
@@ -90,6 +96,9 @@ public:
 	void SendActorTornOffUpdate(Worker_EntityId EntityId, Worker_ComponentId ComponentId);
 
 	void SendCreateEntityRequest(USpatialActorChannel* Channel, uint32& OutBytesWritten);
+	// Sends the create entity requests queued this tick when bBatchSpatialEntityCreation is enabled.
+	void FlushEntityCreations();
+	void OnCreateEntityResponse(const Worker_CreateEntityResponseOp& Op);
 	void RetireEntity(const Worker_EntityId EntityId, bool bIsNetStartupActor);
 
 	// Creates an entity containing just a tombstone component and the minimal data to resolve an actor.
@@ -113,6 +122,7 @@ public:
 
 	void ProcessOrQueueOutgoingRPC(const FUnrealObjectRef& InTargetObjectRef, SpatialGDK::RPCPayload&& InPayload);
 	void ProcessUpdatesQueuedUntilAuthority(Worker_EntityId EntityId, Worker_ComponentId ComponentId);
+	void ClearUpdatesQueuedUntilAuthority(Worker_EntityId EntityId);
 
 	void FlushRPCService();
 
@@ -124,6 +134,8 @@ public:
 	void CreateServerWorkerEntity();
 	void RetryServerWorkerEntityCreation(Worker_EntityId EntityId, int AttemptCounte);
 	void UpdateServerWorkerEntityInterestAndPosition();
+	// Reports this worker's load on its worker entity, for load balancing strategies which rebalance from it.
+	void UpdateServerWorkerEntityLoad(float Load);
 
 	void ClearPendingRPCs(const Worker_EntityId EntityId);
 
@@ -140,6 +152,7 @@ private:
 
 	// Actor Lifecycle
 	Worker_RequestId CreateEntity(USpatialActorChannel* Channel, uint32& OutBytesWritten);
+	TArray<FWorkerComponentData> CreateEntityComponentDatas(USpatialActorChannel* Channel, uint32& OutBytesWritten);
 	Worker_ComponentData CreateLevelComponentData(AActor* Actor);
 
 	void AddTombstoneToEntity(const Worker_EntityId EntityId);
@@ -153,10 +166,11 @@ private:
 	Worker_CommandRequest CreateRetryRPCCommandRequest(const FReliableRPCForRetry& RPC, uint32 TargetObjectOffset);
 	FWorkerComponentUpdate CreateRPCEventUpdate(UObject* TargetObject, const SpatialGDK::RPCPayload& Payload, Worker_ComponentId ComponentId, Schema_FieldId EventIndext);
 
+	// Writes every property of the object a component belongs to, keeping only that component's update.
+	bool CreateWholeComponentUpdate(Worker_EntityId EntityId, Worker_ComponentId ComponentId, FWorkerComponentUpdate& OutUpdate);
+
 	// RPC Tracking
-#if !UE_BUILD_SHIPPING
 	void TrackRPC(AActor* Actor, UFunction* Function, const SpatialGDK::RPCPayload& Payload, const ERPCType RPCType);
-#endif
 
 	bool WillHaveAuthorityOverActor(AActor* TargetActor, Worker_EntityId TargetEntity);
 
@@ -188,7 +202,18 @@ private:
 
 	TArray<TSharedRef<FReliableRPCForRetry>> RetryRPCs;
 
-	FUpdatesQueuedUntilAuthority UpdatesQueuedUntilAuthorityMap;
+	FUpdatesQueuedUntilAuthority UpdatesQueuedUntilAuthority;
+
+	FPositionUpdateFilter PositionUpdates;
 
 	FChannelsToUpdatePosition ChannelsToUpdatePosition;
+
+	FEntityCreationBatch PendingEntityCreations;
+
+	SpatialGDK::EntityPrototypeCache EntityPrototypes;
+
+	// Reused by every SendComponentUpdates call, along with the buffer its updates are written to, so that only the
+	// schema updates themselves are allocated per replicated object.
+	TUniquePtr<SpatialGDK::ComponentFactory> UpdateFactory;
+	TArray<FWorkerComponentUpdate> ComponentUpdatesScratch;
 };
@@ -6,6 +6,7 @@
 #include "SpatialConstants.h"
 
 #include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
 #include "Schema/Interest.h"
 #include "UObject/NoExportTypes.h"
 
@@ -20,8 +21,8 @@
  *      VirtualWorkerIds from GetVirtualWorkerIds() and begin assinging workers.
  *    (Other Workers): SetLocalVirtualWorkerId when assigned a VirtualWorkerId.
  * 4. For each Actor being replicated:
- *   a) Check if authority should be relinquished by calling ShouldHaveAuthority
- *   b) If true: Send authority change request to Translator/Enforcer passing in new
+ *   a) Check if authority should be relinquished by calling ShouldKeepAuthority
+ *   b) If false: Send authority change request to Translator/Enforcer passing in new
  *        VirtualWorkerId returned by WhoShouldHaveAuthority
  */
 UCLASS(abstract)
@@ -45,6 +46,20 @@ public:
 	virtual bool ShouldHaveAuthority(const AActor& Actor) const { return false; }
 	virtual VirtualWorkerId WhoShouldHaveAuthority(const AActor& Actor) const PURE_VIRTUAL(UAbstractLBStrategy::WhoShouldHaveAuthority, return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;)
 
+	/**
+	 * Called for Actors this worker is authoritative over, to decide whether to hand them over to WhoShouldHaveAuthority.
+	 * Strategies can keep authority for a while after ShouldHaveAuthority becomes false, so Actors moving back and forth
+	 * across a boundary aren't transferred every time. Defaults to ShouldHaveAuthority.
+	 */
+	virtual bool ShouldKeepAuthority(const AActor& Actor) { return ShouldHaveAuthority(Actor); }
+
+	/**
+	 * Predicts which virtual worker should have authority over the Actor in LookaheadSeconds, from where it is heading, so that
+	 * workers can prepare a handover before the Actor's authority intent changes. Returns SpatialConstants::INVALID_VIRTUAL_WORKER_ID
+	 * if the strategy can't predict it, which it doesn't by default.
+	 */
+	virtual VirtualWorkerId PredictWhoShouldHaveAuthority(const AActor& Actor, float LookaheadSeconds) const { return SpatialConstants::INVALID_VIRTUAL_WORKER_ID; }
+
 	/**
 	* Get the query constraints required by this worker based on the load balancing strategy used.
 	*/
@@ -65,7 +80,35 @@ public:
 	virtual uint32 GetMinimumRequiredWorkers() const PURE_VIRTUAL(UAbstractLBStrategy::GetMinimumRequiredWorkers, return 0;)
 	virtual void SetVirtualWorkerIds(const VirtualWorkerId& FirstVirtualWorkerId, const VirtualWorkerId& LastVirtualWorkerId) PURE_VIRTUAL(UAbstractLBStrategy::SetVirtualWorkerIds, return;)
 
+	/**
+	 * Strategies whose regions move at runtime return how often, in seconds, server workers should report their load so the
+	 * worker authoritative over the virtual worker translation can rebalance them. 0 means the regions are fixed.
+	 */
+	virtual float GetRebalanceInterval() const { return 0.f; }
+
+	/** Rebalances the regions from the load each virtual worker reported. Returns true if they changed. */
+	virtual bool RebalanceFromLoads(const TMap<VirtualWorkerId, float>& LoadPerVirtualWorker) { return false; }
+
+	/**
+	 * The worker authoritative over the virtual worker translation writes the regions into it, and every worker applies
+	 * them from it, so that all workers agree on them.
+	 */
+	virtual void WritePartitionToSchema(Schema_Object* TranslationObject) const {}
+	virtual void ApplyPartitionFromSchema(Schema_Object* TranslationObject) {}
+
+	/** Changes whenever the regions do, so workers know to update their interest and position. */
+	virtual uint32 GetPartitionVersion() const { return 0; }
+
+	/** Replaces the clock authority decisions are timed with, so that recorded workloads can be replayed faster than real time. */
+	virtual void SetClock(TFunction<double()> InClock) { Clock = MoveTemp(InClock); }
+
 protected:
 
+	double GetClockSeconds() const { return Clock ? Clock() : FPlatformTime::Seconds(); }
+
 	VirtualWorkerId LocalVirtualWorkerId;
+
+private:
+
+	TFunction<double()> Clock;
 };
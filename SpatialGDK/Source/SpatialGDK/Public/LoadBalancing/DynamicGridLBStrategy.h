@@ -0,0 +1,122 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "LoadBalancing/AbstractLBStrategy.h"
+
+#include "CoreMinimal.h"
+#include "Math/Box2D.h"
+#include "Math/Vector2D.h"
+
+#include "DynamicGridLBStrategy.generated.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogDynamicGridLBStrategy, Log, All)
+
+/**
+ * A load balancing strategy that divides the world into a grid of Rows * Cols cells, like UGridBasedLBStrategy, but moves
+ * the row and column boundaries at runtime so that each row and each column carries a similar share of the load.
+ *
+ * Given a Point, for each Cell:
+ * Point is inside Cell iff Min(Cell) <= Point < Max(Cell)
+ *
+ * Every RebalanceInterval, server workers report their load on their server worker entity. The worker authoritative over
+ * the virtual worker translation rebalances the boundaries from those reports and writes them into the translation, which
+ * every worker applies, so all workers agree on the cells. Each rebalance moves a boundary by at most
+ * MaxBoundaryMovePerRebalance, and never makes a cell narrower than MinimumCellSize.
+ *
+ * The outer edges of the grid stay at WorldWidth by WorldHeight around the origin.
+ */
+UCLASS(Blueprintable)
+class SPATIALGDK_API UDynamicGridLBStrategy : public UAbstractLBStrategy
+{
+	GENERATED_BODY()
+
+public:
+	UDynamicGridLBStrategy();
+
+/* UAbstractLBStrategy Interface */
+	virtual void Init() override;
+
+	virtual void SetLocalVirtualWorkerId(VirtualWorkerId InLocalVirtualWorkerId) override;
+	virtual TSet<VirtualWorkerId> GetVirtualWorkerIds() const override;
+
+	virtual bool ShouldHaveAuthority(const AActor& Actor) const override;
+	virtual VirtualWorkerId WhoShouldHaveAuthority(const AActor& Actor) const override;
+	virtual VirtualWorkerId PredictWhoShouldHaveAuthority(const AActor& Actor, float LookaheadSeconds) const override;
+
+	virtual SpatialGDK::QueryConstraint GetWorkerInterestQueryConstraint() const override;
+
+	virtual bool RequiresHandoverData() const override { return Rows * Cols > 1; }
+
+	virtual FVector GetWorkerEntityPosition() const override;
+
+	virtual uint32 GetMinimumRequiredWorkers() const override;
+	virtual void SetVirtualWorkerIds(const VirtualWorkerId& FirstVirtualWorkerId, const VirtualWorkerId& LastVirtualWorkerId) override;
+
+	virtual float GetRebalanceInterval() const override { return RebalanceInterval; }
+	virtual bool RebalanceFromLoads(const TMap<VirtualWorkerId, float>& LoadPerVirtualWorker) override;
+	virtual void WritePartitionToSchema(Schema_Object* TranslationObject) const override;
+	virtual void ApplyPartitionFromSchema(Schema_Object* TranslationObject) override;
+	virtual uint32 GetPartitionVersion() const override { return PartitionVersion; }
+/* End UAbstractLBStrategy Interface */
+
+	VirtualWorkerId WhoShouldHaveAuthorityForLocation(const FVector2D& Location) const;
+
+	// The X boundaries of the rows and the Y boundaries of the columns, from the lowest to the highest.
+	const TArray<float>& GetRowBoundaries() const { return RowBoundaries; }
+	const TArray<float>& GetColumnBoundaries() const { return ColumnBoundaries; }
+
+	FBox2D GetCell(int32 CellIndex) const;
+
+protected:
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "Dynamic Grid Load Balancing")
+	uint32 Rows;
+
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "Dynamic Grid Load Balancing")
+	uint32 Cols;
+
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "Dynamic Grid Load Balancing")
+	float WorldWidth;
+
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "Dynamic Grid Load Balancing")
+	float WorldHeight;
+
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0"), Category = "Dynamic Grid Load Balancing")
+	float InterestBorder;
+
+	/** How often, in seconds, workers report their load and the boundaries are rebalanced. 0 keeps the boundaries fixed. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0"), Category = "Dynamic Grid Load Balancing")
+	float RebalanceInterval;
+
+	/** How far, in cm, a boundary can move in one rebalance. Limits how many Actors change authority at once. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "Dynamic Grid Load Balancing")
+	float MaxBoundaryMovePerRebalance;
+
+	/** The narrowest, in cm, a row or column can become. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "Dynamic Grid Load Balancing")
+	float MinimumCellSize;
+
+	/** How much more load than the average, as a fraction of it, the busiest row or column can carry before the boundaries move. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0"), Category = "Dynamic Grid Load Balancing")
+	float ImbalanceThreshold;
+
+private:
+	TArray<VirtualWorkerId> VirtualWorkerIds;
+
+	TArray<float> RowBoundaries;
+	TArray<float> ColumnBoundaries;
+	uint32 PartitionVersion;
+
+	uint32 LocalCellId;
+	bool bIsStrategyUsedOnLocalWorker;
+
+	// Returns the index of the cell containing the location, column by column as in UGridBasedLBStrategy, or INDEX_NONE if it is outside the grid.
+	int32 GetCellIndex(const FVector2D& Location) const;
+
+	// Moves the interior boundaries towards splitting the load evenly between the intervals, within the movement and size limits.
+	// Returns true if any boundary moved.
+	bool RebalanceBoundaries(TArray<float>& Boundaries, const TArray<float>& IntervalLoads) const;
+
+	static int32 FindInterval(const TArray<float>& Boundaries, float Value);
+	static bool IsInside(const FBox2D& Box, const FVector2D& Location);
+};
@@ -7,6 +7,7 @@
 #include "CoreMinimal.h"
 #include "Math/Box2D.h"
 #include "Math/Vector2D.h"
+#include "UObject/WeakObjectPtr.h"
 
 #include "GridBasedLBStrategy.generated.h"
 
@@ -22,6 +23,13 @@ DECLARE_LOG_CATEGORY_EXTERN(LogGridBasedLBStrategy, Log, All)
  * Given a Point, for each Cell:
  * Point is inside Cell iff Min(Cell) <= Point < Max(Cell)
  *
+ * The cell containing a Point is found in constant time from the row and column boundaries, rather than by testing
+ * every cell.
+ *
+ * To avoid transferring Actors which move back and forth across a boundary, a worker keeps authority over an Actor
+ * until it is AuthorityHysteresisDistance past the worker's cell, and has stayed headed for the same cell for
+ * AuthorityTransferDwellTime.
+ *
  * Intended Usage: Create a data-only blueprint subclass and change
  * the Cols, Rows, WorldWidth, WorldHeight.
  */
@@ -43,6 +51,8 @@ public:
 
 	virtual bool ShouldHaveAuthority(const AActor& Actor) const override;
 	virtual VirtualWorkerId WhoShouldHaveAuthority(const AActor& Actor) const override;
+	virtual bool ShouldKeepAuthority(const AActor& Actor) override;
+	virtual VirtualWorkerId PredictWhoShouldHaveAuthority(const AActor& Actor, float LookaheadSeconds) const override;
 
 	virtual SpatialGDK::QueryConstraint GetWorkerInterestQueryConstraint() const override;
 
@@ -56,6 +66,28 @@ public:
 
 	LBStrategyRegions GetLBStrategyRegions() const;
 
+	/**
+	 * Batch versions of WhoShouldHaveAuthority, writing one result per location or actor into OutVirtualWorkerIds,
+	 * which must be the same size. Locations outside the grid get SpatialConstants::INVALID_VIRTUAL_WORKER_ID.
+	 */
+	void WhoShouldHaveAuthorityForLocations(TArrayView<const FVector2D> Locations, TArrayView<VirtualWorkerId> OutVirtualWorkerIds) const;
+	void WhoShouldHaveAuthorityForActors(TArrayView<const AActor* const> Actors, TArrayView<VirtualWorkerId> OutVirtualWorkerIds) const;
+
+	// Cells are convex, so if the location LookaheadSeconds ahead is in another cell, the boundary is crossed before then.
+	// With an AuthorityHysteresisDistance, locations that close to another cell aren't predicted, as the Actor is kept by whichever worker has it.
+	VirtualWorkerId PredictWhoShouldHaveAuthorityForLocation(const FVector2D& Location, const FVector2D& Velocity, float LookaheadSeconds) const;
+
+	// Counts of ShouldKeepAuthority calls which kept authority over an Actor outside this worker's cell, and which let it go.
+	struct FAuthorityTransferStats
+	{
+		uint32 NumSuppressedByHysteresis;
+		uint32 NumSuppressedByDwellTime;
+		uint32 NumTransfersAllowed;
+	};
+
+	const FAuthorityTransferStats& GetAuthorityTransferStats() const { return AuthorityTransferStats; }
+	int32 GetNumPendingTransfers() const { return PendingTransfers.Num(); }
+
 protected:
 	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "Grid Based Load Balancing")
 	uint32 Rows;
@@ -72,6 +104,24 @@ protected:
 	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0"), Category = "Grid Based Load Balancing")
 	float InterestBorder;
 
+	/** How far past its cell, in cm, an Actor can move before the worker gives up authority over it. Limited to InterestBorder, so the worker never loses sight of the Actors it keeps. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0"), Category = "Grid Based Load Balancing")
+	float AuthorityHysteresisDistance;
+
+	/** How long, in seconds, an Actor must stay past AuthorityHysteresisDistance and headed for the same cell before authority over it is handed over. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0"), Category = "Grid Based Load Balancing")
+	float AuthorityTransferDwellTime;
+
+	bool ShouldKeepAuthorityAtLocation(const AActor& Actor, const FVector2D& Location, double Now);
+
+	// Returns the index into WorkerCells of the cell containing the location, or INDEX_NONE if it is outside the grid.
+	int32 GetCellIndex(const FVector2D& Location) const;
+	// Also adds the number of row and column boundaries the location was compared against to InOutNumBoundariesTested.
+	int32 GetCellIndex(const FVector2D& Location, uint64& InOutNumBoundariesTested) const;
+
+	// Whether the location, in the cell at CellIndex, is within AuthorityHysteresisDistance of any other cell.
+	bool IsWithinHysteresisOfOtherCell(const FVector2D& Location, int32 CellIndex) const;
+
 private:
 
 	TArray<VirtualWorkerId> VirtualWorkerIds;
@@ -80,5 +130,27 @@ private:
 	uint32 LocalCellId;
 	bool bIsStrategyUsedOnLocalWorker;
 
+	// The X boundaries of the rows and the Y boundaries of the columns, accumulated exactly as the cells' Min and Max are,
+	// so that looking up a location between them gives the same cell as testing each cell with IsInside.
+	TArray<float> RowBoundaries;
+	TArray<float> ColumnBoundaries;
+	float InvRowHeight;
+	float InvColumnWidth;
+
+	// Actors which have left the hysteresis band and are waiting out the dwell time, by the cell they are headed for.
+	struct FPendingTransfer
+	{
+		int32 CellIndex;
+		double StartTime;
+	};
+
+	TMap<TWeakObjectPtr<const AActor>, FPendingTransfer> PendingTransfers;
+	double LastPendingTransfersPurgeTime;
+	FAuthorityTransferStats AuthorityTransferStats;
+
+	// Forgets Actors which were destroyed, or which this worker lost authority over, while their transfer was pending.
+	void PurgePendingTransfers(double Now);
+
+	static int32 FindInterval(const TArray<float>& Boundaries, float InvIntervalSize, float Value, uint64& InOutNumBoundariesTested);
 	static bool IsInside(const FBox2D& Box, const FVector2D& Location);
 };
@@ -12,6 +12,7 @@
 
 class SpatialVirtualWorkerTranslator;
 class UAbstractLockingPolicy;
+class USpatialClassInfoManager;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogLayeredLBStrategy, Log, All)
 
@@ -57,6 +58,8 @@ public:
 
 	virtual bool ShouldHaveAuthority(const AActor& Actor) const override;
 	virtual VirtualWorkerId WhoShouldHaveAuthority(const AActor& Actor) const override;
+	virtual bool ShouldKeepAuthority(const AActor& Actor) override;
+	virtual VirtualWorkerId PredictWhoShouldHaveAuthority(const AActor& Actor, float LookaheadSeconds) const override;
 
 	virtual SpatialGDK::QueryConstraint GetWorkerInterestQueryConstraint() const override;
 
@@ -66,6 +69,14 @@ public:
 
 	virtual uint32 GetMinimumRequiredWorkers() const override;
 	virtual void SetVirtualWorkerIds(const VirtualWorkerId& FirstVirtualWorkerId, const VirtualWorkerId& LastVirtualWorkerId) override;
+
+	virtual float GetRebalanceInterval() const override;
+	virtual bool RebalanceFromLoads(const TMap<VirtualWorkerId, float>& LoadPerVirtualWorker) override;
+	virtual void WritePartitionToSchema(Schema_Object* TranslationObject) const override;
+	virtual void ApplyPartitionFromSchema(Schema_Object* TranslationObject) override;
+	virtual uint32 GetPartitionVersion() const override;
+
+	virtual void SetClock(TFunction<double()> InClock) override;
 	/* End UAbstractLBStrategy Interface */
 
 	// This is provided to support the offloading interface in SpatialStatics. It should be removed once users
@@ -76,20 +87,31 @@ public:
 	// Currently, this is just the default strategy.
 	UAbstractLBStrategy* GetLBStrategyForVisualRendering() const;
 
+	// Returns the name of the first Layer that contains this, or a parent of this class,
+	// or the default actor group, if no mapping is found.
+	// Classes with class info return the Layer stored on it, so only classes without one walk their class hierarchy.
+	FName GetLayerNameForClass(TSubclassOf<AActor> Class) const;
+
+	// Walks up the class hierarchy to the first class explicitly added to a Layer.
+	// USpatialClassInfoManager calls this once per Actor class, as it creates the class info.
+	FName ResolveLayerNameForClass(const UClass* Class) const;
+
+	void SetClassInfoManager(USpatialClassInfoManager* InClassInfoManager) { ClassInfoManager = InClassInfoManager; }
+
 private:
 	TArray<VirtualWorkerId> VirtualWorkerIds;
 
-	mutable TMap<TSoftClassPtr<AActor>, FName> ClassPathToLayer;
+	// The Layer each class was explicitly added to. Classes are kept as paths, so configuring a Layer doesn't load them.
+	TMap<TSoftClassPtr<AActor>, FName> ClassPathToLayer;
+
+	UPROPERTY()
+	USpatialClassInfoManager* ClassInfoManager;
 
 	TMap<VirtualWorkerId, FName> VirtualWorkerIdToLayerName;
 
 	UPROPERTY()
 	TMap<FName, UAbstractLBStrategy* > LayerNameToLBStrategy;
 
-	// Returns the name of the first Layer that contains this, or a parent of this class,
-	// or the default actor group, if no mapping is found.
-	FName GetLayerNameForClass(TSubclassOf<AActor> Class) const;
-
 	// Returns true if ActorA and ActorB are contained in Layers that are
 	// on the same Server worker type.
 	bool IsSameWorkerType(const AActor* ActorA, const AActor* ActorB) const;
@@ -97,6 +119,9 @@ private:
 	// Returns the name of the Layer this Actor belongs to.
 	FName GetLayerNameForActor(const AActor& Actor) const;
 
+	// Returns the LBStrategy of the Layer this Actor belongs to if this worker is responsible for it, or nullptr otherwise.
+	UAbstractLBStrategy* GetLocalLBStrategyForActor(const AActor& Actor) const;
+
 	// Add a LBStrategy to our map and do bookkeeping around it.
 	void AddStrategyForLayer(const FName& LayerName, UAbstractLBStrategy* LBStrategy);
 };
@@ -32,6 +32,7 @@ private:
 	struct MigrationLockElement
 	{
 		int32 LockCount;
+		// The root of the ownership hierarchy the Actor is in, which is the Actor itself when it has no owner.
 		AActor* HierarchyRoot;
 	};
 
@@ -42,8 +43,6 @@ private:
 	};
 
 	bool CanAcquireLock(const AActor* Actor) const;
-	bool IsExplicitlyLocked(const AActor* Actor) const;
-	bool IsLockedHierarchyRoot(const AActor* Actor) const;
 
 	UFUNCTION()
 	void OnExplicitlyLockedActorDeleted(AActor* DestroyedActor);
@@ -54,15 +53,20 @@ private:
 	virtual bool AcquireLockFromDelegate(AActor* ActorToLock,    const FString& DelegateLockIdentifier) override;
 	virtual bool ReleaseLockFromDelegate(AActor* ActorToRelease, const FString& DelegateLockIdentifier) override;
 
-	void RecalculateAllExplicitlyLockedActorsInThisHierarchy(const AActor* HierarchyRoot);
-	void RecalculateLockedActorOwnershipHierarchyInformation(const AActor* ExplicitlyLockedActor);
-	void AddOwnershipHierarchyRootInformation(AActor* HierarchyRoot, const AActor* ExplicitlyLockedActor);
-	void RemoveOwnershipHierarchyRootInformation(AActor* HierarchyRoot, const AActor* ExplicitlyLockedActor);
+	void AddExplicitlyLockedActorToHierarchy(AActor* ExplicitlyLockedActor);
+	void RemoveExplicitlyLockedActorFromHierarchy(AActor* ExplicitlyLockedActor, AActor* HierarchyRoot);
+	void RecalculateLockedHierarchy(AActor* HierarchyRoot);
+	void AddLockedActors(const AActor* Actor, AActor* HierarchyRoot);
+	void RemoveLockedActors(const AActor* Actor, const AActor* HierarchyRoot);
 
 	TMap<const AActor*, MigrationLockElement> ActorToLockingState;
 	TMap<ActorLockToken, LockNameAndActor> TokenToNameAndActor;
 	TMap<FString, ActorLockToken> DelegateLockingIdentifierToActorLockToken;
-	TMap<const AActor*, TArray<const AActor*>> LockedOwnershipRootActorToExplicitlyLockedActors;
+	TMap<const AActor*, TArray<AActor*>> LockedHierarchyRootToExplicitlyLockedActors;
+
+	// Every Actor in an ownership hierarchy with an explicitly locked Actor, to the root of that hierarchy.
+	// Kept up to date as locks are acquired and released and owners change, so IsLocked doesn't walk the ownership chain.
+	TMap<const AActor*, AActor*> LockedActorToHierarchyRoot;
 
 	ActorLockToken NextToken = 1;
 };
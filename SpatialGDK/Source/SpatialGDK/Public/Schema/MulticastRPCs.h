@@ -24,7 +24,7 @@ struct MulticastRPCs : Component
 	uint32 InitiallyPresentMulticastRPCsCount = 0;
 
 private:
-	void ReadFromSchema(Schema_Object* SchemaObject);
+	void ReadFromSchema(Schema_Object* SchemaObject, uint64 SkipUpToRPCId);
 };
 
 } // namespace SpatialGDK
@@ -9,6 +9,7 @@
 #include "Utils/SchemaUtils.h"
 
 #include "Containers/UnrealString.h"
+#include "Misc/Optional.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
 #include <WorkerSDK/improbable/c_worker.h>
@@ -40,6 +41,10 @@ struct ServerWorker : Component
 
 		WorkerName = GetStringFromSchema(ComponentObject, SpatialConstants::SERVER_WORKER_NAME_ID);
 		bReadyToBeginPlay = GetBoolFromSchema(ComponentObject, SpatialConstants::SERVER_WORKER_READY_TO_BEGIN_PLAY_ID);
+		if (Schema_GetFloatCount(ComponentObject, SpatialConstants::SERVER_WORKER_LOAD_ID) == 1)
+		{
+			Load = Schema_GetFloat(ComponentObject, SpatialConstants::SERVER_WORKER_LOAD_ID);
+		}
 	}
 
 	Worker_ComponentData CreateServerWorkerData()
@@ -51,6 +56,10 @@ struct ServerWorker : Component
 
 		AddStringToSchema(ComponentObject, SpatialConstants::SERVER_WORKER_NAME_ID, WorkerName);
 		Schema_AddBool(ComponentObject, SpatialConstants::SERVER_WORKER_READY_TO_BEGIN_PLAY_ID, bReadyToBeginPlay);
+		if (Load.IsSet())
+		{
+			Schema_AddFloat(ComponentObject, SpatialConstants::SERVER_WORKER_LOAD_ID, Load.GetValue());
+		}
 
 		return Data;
 	}
@@ -64,6 +73,10 @@ struct ServerWorker : Component
 
 		AddStringToSchema(ComponentObject, SpatialConstants::SERVER_WORKER_NAME_ID, WorkerName);
 		Schema_AddBool(ComponentObject, SpatialConstants::SERVER_WORKER_READY_TO_BEGIN_PLAY_ID, bReadyToBeginPlay);
+		if (Load.IsSet())
+		{
+			Schema_AddFloat(ComponentObject, SpatialConstants::SERVER_WORKER_LOAD_ID, Load.GetValue());
+		}
 
 		return Update;
 	}
@@ -74,6 +87,11 @@ struct ServerWorker : Component
 
 		WorkerName = GetStringFromSchema(ComponentObject, SpatialConstants::SERVER_WORKER_NAME_ID);
 		bReadyToBeginPlay = GetBoolFromSchema(ComponentObject, SpatialConstants::SERVER_WORKER_READY_TO_BEGIN_PLAY_ID);
+
+		if (Schema_GetFloatCount(ComponentObject, SpatialConstants::SERVER_WORKER_LOAD_ID) == 1)
+		{
+			Load = Schema_GetFloat(ComponentObject, SpatialConstants::SERVER_WORKER_LOAD_ID);
+		}
 	}
 
 	static Worker_CommandRequest CreateForwardPlayerSpawnRequest(Schema_CommandRequest* SchemaCommandRequest)
@@ -112,6 +130,8 @@ struct ServerWorker : Component
 
 	PhysicalWorkerName WorkerName;
 	bool bReadyToBeginPlay;
+	// Unset until the worker first reports its load, so rebalancing can wait for every worker rather than treat it as idle.
+	TOptional<float> Load;
 };
 
 } // namespace SpatialGDK
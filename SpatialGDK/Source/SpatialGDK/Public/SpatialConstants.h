@@ -159,6 +159,19 @@ const Schema_FieldId UNREAL_RPC_PAYLOAD_OFFSET_ID						= 1;
 const Schema_FieldId UNREAL_RPC_PAYLOAD_RPC_INDEX_ID					= 2;
 const Schema_FieldId UNREAL_RPC_PAYLOAD_RPC_PAYLOAD_ID					= 3;
 const Schema_FieldId UNREAL_RPC_PAYLOAD_TRACE_ID						= 4;
+const Schema_FieldId UNREAL_RPC_PAYLOAD_BUNDLED_RPCS_ID				= 5;
+
+// FastArrayItemDelta Field IDs
+const Schema_FieldId FAST_ARRAY_ITEM_DELTA_CHANGED_ITEMS_ID			= 1;
+const Schema_FieldId FAST_ARRAY_ITEM_DELTA_REMOVED_IDS_ID				= 2;
+
+// FastArrayItem Field IDs
+const Schema_FieldId FAST_ARRAY_ITEM_REPLICATION_ID_ID					= 1;
+const Schema_FieldId FAST_ARRAY_ITEM_REPLICATION_KEY_ID				= 2;
+const Schema_FieldId FAST_ARRAY_ITEM_DATA_ID							= 3;
+
+// The item delta of a FastArray property is written to this field ID plus the rep handle of the property.
+const Schema_FieldId FAST_ARRAY_ITEM_DELTA_FIELD_ID_OFFSET				= 100000;
 
 const Schema_FieldId UNREAL_RPC_TRACE_ID								= 1;
 const Schema_FieldId UNREAL_RPC_SPAN_ID									= 2;
@@ -178,6 +191,15 @@ const Schema_FieldId VIRTUAL_WORKER_TRANSLATION_MAPPING_ID				= 1;
 const Schema_FieldId MAPPING_VIRTUAL_WORKER_ID							= 1;
 const Schema_FieldId MAPPING_PHYSICAL_WORKER_NAME						= 2;
 const Schema_FieldId MAPPING_SERVER_WORKER_ENTITY_ID					= 3;
+const Schema_FieldId MAPPING_VERSION_ID									= 4;
+const Schema_FieldId VIRTUAL_WORKER_TRANSLATION_GRID_PARTITIONS_ID		= 2;
+const Schema_FieldId VIRTUAL_WORKER_TRANSLATION_MAPPING_VERSION_ID		= 3;
+const Schema_FieldId VIRTUAL_WORKER_TRANSLATION_SNAPSHOT_VERSION_ID		= 4;
+const Schema_FieldId VIRTUAL_WORKER_TRANSLATION_MAPPING_CHANGES_ID		= 5;
+const Schema_FieldId GRID_PARTITION_FIRST_VIRTUAL_WORKER_ID				= 1;
+const Schema_FieldId GRID_PARTITION_VERSION_ID							= 2;
+const Schema_FieldId GRID_PARTITION_ROW_BOUNDARIES_ID					= 3;
+const Schema_FieldId GRID_PARTITION_COLUMN_BOUNDARIES_ID				= 4;
 const PhysicalWorkerName TRANSLATOR_UNSET_PHYSICAL_NAME = FString("UnsetWorkerName");
 
 // WorkerEntity Field IDs.
@@ -194,6 +216,7 @@ const Schema_FieldId SPATIAL_DEBUGGING_IS_LOCKED                         = 5;
 // ServerWorker Field IDs.
 const Schema_FieldId SERVER_WORKER_NAME_ID								 = 1;
 const Schema_FieldId SERVER_WORKER_READY_TO_BEGIN_PLAY_ID				 = 2;
+const Schema_FieldId SERVER_WORKER_LOAD_ID								 = 3;
 const Schema_FieldId SERVER_WORKER_FORWARD_SPAWN_REQUEST_COMMAND_ID		 = 1;
 
 // SpawnPlayerRequest type IDs.
@@ -122,6 +122,32 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (DisplayName = "Maximum entities created per tick"))
 	uint32 EntityCreationRateLimit;
 
+	/**
+	* Specifies the time in milliseconds spent per tick on the first replication of Actors woken from dormancy. Not respected when using the Replication Graph.
+	* Woken Actors are replicated in order of relevance to clients, and the rest are replicated on the following ticks, so many Actors waking up together don't spike the tick.
+	* Woken Actors also count towards the entity creation and Actor replication rate limits left over by the other Actors replicated that tick.
+	* Default: `0` (woken Actors are replicated along with other Actors, with no limit)
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (DisplayName = "Dormancy wake up time budget (ms)", ClampMin = "0"))
+	float DormancyWakeUpTimeBudgetMS;
+
+	/**
+	* Specifies the maximum number of entity ACL updates a server worker sends per tick to enforce load balancing decisions. Not used unless load balancing is enabled.
+	* Entities over the limit stay queued and are updated on the following ticks, in the order they were queued, so mass authority transfers don't spike the tick.
+	* Default: `0` per tick  (no limit)
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (DisplayName = "Maximum ACL assignments per tick"))
+	uint32 AclAssignmentRateLimit;
+
+	/**
+	* How far ahead, in seconds, server workers predict which worker each Actor is heading for when load balancing. Not used unless load balancing is enabled.
+	* An Actor approaching another worker's region is replicated every tick, so its handover data is up to date when authority over it changes,
+	* and the worker it approaches prepares its channel and replicates it as soon as it gains authority.
+	* Default: `0` (no prediction)
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (DisplayName = "Handover prefetch lookahead (s)", ClampMin = "0"))
+	float HandoverPrefetchLookaheadSeconds;
+
 	/**
 	 * When enabled, only entities which are in the net relevancy range of player controllers will be replicated to SpatialOS. Not respected when using the Replication Graph.
 	 * This should only be used in single server configurations. The state of the world in the inspector will no longer be up to date.
@@ -155,6 +181,10 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (DisplayName = "Wait Time Before Retrying Outoing RPC"))
 	float QueuedOutgoingRPCRetryTime;
 
+	/** Maximum bytes of component updates kept while waiting for authority. The least recently updated are dropped beyond this, and their components sent in full on authority gain. If 0 there is no limit. */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (DisplayName = "Maximum Bytes Of Updates Queued Until Authority"))
+	uint32 MaxBytesQueuedUntilAuthority;
+
 	/** Frequency for updating an Actor's SpatialOS Position. Updating position should have a low update rate since it is expensive.*/
 	UPROPERTY(EditAnywhere, config, Category = "SpatialOS Position Updates")
 	float PositionUpdateFrequency;
@@ -163,6 +193,10 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "SpatialOS Position Updates")
 	float PositionDistanceThreshold;
 
+	/** Grid size, in centimeters, that SpatialOS Positions are snapped to before sending. Updates that don't change the snapped Position are not sent. If 0 Positions are not snapped.*/
+	UPROPERTY(EditAnywhere, config, Category = "SpatialOS Position Updates")
+	float PositionQuantizationPrecision;
+
 	/** Metrics about client and server performance can be reported to SpatialOS to monitor a deployments health.*/
 	UPROPERTY(EditAnywhere, config, Category = "Metrics")
 	bool bEnableMetrics;
@@ -187,6 +221,10 @@ public:
 	UPROPERTY(config)
 	bool bBatchSpatialPositionUpdates;
 
+	/** Queue the create entity requests made while replicating actors and send them together at the end of the tick.*/
+	UPROPERTY(config)
+	bool bBatchSpatialEntityCreation;
+
 	/** Maximum number of ActorComponents/Subobjects of the same class that can be attached to an Actor.*/
 	UPROPERTY(EditAnywhere, config, Category = "Schema Generation", meta = (DisplayName = "Maximum Dynamically Attached Subobjects Per Class"))
 	uint32 MaxDynamicallyAttachedSubobjectsPerClass;
@@ -247,6 +285,14 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = "Replication", meta = (DisplayName = "Max RPC Ring Buffer Size"))
 	uint32 MaxRPCRingBufferSize;
 
+	/** EXPERIMENTAL: Sends the multicast RPCs called on an actor during a tick as a single ring buffer element, instead of one element each. Requires RPC ring buffers. */
+	UPROPERTY(EditAnywhere, Config, Category = "Replication", meta = (DisplayName = "Bundle Multicast RPCs"))
+	bool bBundleMulticastRPCs;
+
+	/** EXPERIMENTAL: Replicates FastArray properties as the items added, changed or removed since the whole array was last sent, keyed by ReplicationID. The whole array is resent once the deltas sent since outgrow it. Changing this requires schema to be regenerated, and every worker must use the same value. */
+	UPROPERTY(EditAnywhere, Config, Category = "Replication", meta = (DisplayName = "Replicate FastArray Item Deltas"))
+	bool bEnableFastArrayItemDeltas;
+
 	/** Only valid on Tcp connections - indicates if we should enable TCP_NODELAY - see c_worker.h */
 	UPROPERTY(Config)
 	bool bTcpNoDelay;
@@ -14,4 +14,10 @@ struct SPATIALGDK_API TestingSchemaHelpers
 	static Schema_Object* CreateTranslationComponentDataFields();
 	// Can be used to add a mapping between virtual work id and physical worker name.
 	static void AddTranslationComponentDataMapping(Schema_Object* ComponentDataFields, VirtualWorkerId VWId, const PhysicalWorkerName& WorkerName);
+	// Can be used to version the mapping.
+	static void SetTranslationComponentDataMappingVersion(Schema_Object* ComponentDataFields, uint32 MappingVersion);
+	// Can be used to mark the entries added with AddTranslationComponentDataMapping as a snapshot of the mapping.
+	static void SetTranslationComponentDataSnapshotVersion(Schema_Object* ComponentDataFields, uint32 SnapshotVersion);
+	// Can be used to add a mapping between virtual work id and physical worker name which changed in Version, after the snapshot.
+	static void AddTranslationComponentDataMappingChange(Schema_Object* ComponentDataFields, VirtualWorkerId VWId, const PhysicalWorkerName& WorkerName, uint32 Version, Worker_EntityId ServerWorkerEntityId = 0);
 };
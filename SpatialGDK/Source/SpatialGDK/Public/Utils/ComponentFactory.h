@@ -11,28 +11,54 @@
 
 DECLARE_LOG_CATEGORY_EXTERN(LogComponentFactory, Log, All);
 
+class USpatialActorChannel;
 class USpatialNetDriver;
 class USpatialPackageMap;
 class USpatialClassInfoManager;
 class USpatialLatencyTracer;
 class USpatialPackageMapClient;
 
+class FScriptArrayHelper;
+class UArrayProperty;
 class UNetDriver;
 class UProperty;
+class UScriptStruct;
 
 enum EReplicatedPropertyGroup : uint32;
 
 namespace SpatialGDK
 {
 
+class BandwidthProfiler;
+
 class SPATIALGDK_API ComponentFactory
 {
 public:
+	// Counts of the schema updates this factory has allocated, so callers can track allocations per replicated object.
+	struct AllocationStats
+	{
+		uint32 NumSchemaUpdatesCreated;
+		uint32 NumSchemaUpdatesDiscarded; // Created, then destroyed because nothing was written to them.
+		uint32 NumSchemaUpdatesSkipped; // Never created because there were no changes for the component.
+	};
+
 	ComponentFactory(bool bInterestDirty, USpatialNetDriver* InNetDriver, USpatialLatencyTracer* LatencyTracer);
 
+	// Prepares the factory for the next object, so a single factory and its scratch buffers can be reused across objects.
+	void Reset(bool bInterestDirty, USpatialLatencyTracer* InLatencyTracer);
+
 	TArray<FWorkerComponentData> CreateComponentDatas(UObject* Object, const FClassInfo& Info, const FRepChangeState& RepChangeState, const FHandoverChangeState& HandoverChangeState, uint32& OutBytesWritten);
 	TArray<FWorkerComponentUpdate> CreateComponentUpdates(UObject* Object, const FClassInfo& Info, Worker_EntityId EntityId, const FRepChangeState* RepChangeState, const FHandoverChangeState* HandoverChangeState, uint32& OutBytesWritten);
 
+	// Appends the updates to OutUpdates instead of allocating a new array, so callers can recycle one buffer across objects.
+	void CreateComponentUpdates(UObject* Object, const FClassInfo& Info, Worker_EntityId EntityId, const FRepChangeState* RepChangeState, const FHandoverChangeState* HandoverChangeState, TArray<FWorkerComponentUpdate>& OutUpdates, uint32& OutBytesWritten);
+
+	// Writes every property in ComponentId's group to one update, with FastArrays as new keyframes rather than item deltas, so
+	// it replaces whatever was sent for the component before. Nothing is written for the object's other components.
+	FWorkerComponentUpdate CreateWholeComponentUpdate(Worker_ComponentId ComponentId, UObject* Object, const FClassInfo& Info, Worker_EntityId EntityId, const FRepChangeState& RepChangeState, const FHandoverChangeState& HandoverChangeState, uint32& OutBytesWritten);
+
+	const AllocationStats& GetAllocationStats() const { return Allocations; }
+
 	FWorkerComponentData CreateHandoverComponentData(Worker_ComponentId ComponentId, UObject* Object, const FClassInfo& Info, const FHandoverChangeState& Changes, uint32& OutBytesWritten);
 
 	static FWorkerComponentData CreateEmptyComponentData(Worker_ComponentId ComponentId);
@@ -49,6 +75,12 @@ private:
 
 	void AddProperty(Schema_Object* Object, Schema_FieldId FieldId, UProperty* Property, const uint8* Data, TArray<Schema_FieldId>* ClearedIds);
 
+	// Writes the items of a FastArray changed since its last keyframe, or a new keyframe if the item delta would outgrow it.
+	void AddFastArrayItemDeltaOrKeyframe(Schema_Object* ComponentObject, Schema_FieldId FieldId, UObject* Object, const FRepParentCmd& Parent, UArrayProperty* ItemsProperty, UScriptStruct* NetDeltaStruct);
+
+	// Writes an array of primitives as a single schema list. Returns false if the inner property type is not supported.
+	bool AddPrimitiveArray(Schema_Object* Object, Schema_FieldId FieldId, UProperty* InnerProperty, FScriptArrayHelper& ArrayHelper);
+
 	USpatialNetDriver* NetDriver;
 	USpatialPackageMapClient* PackageMap;
 	USpatialClassInfoManager* ClassInfoManager;
@@ -56,6 +88,29 @@ private:
 	bool bInterestHasChanged;
 
 	USpatialLatencyTracer* LatencyTracer;
+
+	// Channel of the entity being updated, which holds the FastArray item delta state. Null when creating initial data.
+	USpatialActorChannel* UpdateChannel;
+
+	bool bFastArrayItemDeltas;
+
+	// Set while CreateWholeComponentUpdate writes a component.
+	bool bWritingWholeState;
+
+	// Set when bandwidth profiling is active for the lifetime of this factory.
+	BandwidthProfiler* Profiler;
+
+	// Scratch buffers reused when widening small integer arrays to their schema list types.
+	TArray<int32> Int32ListScratch;
+	TArray<uint32> Uint32ListScratch;
+
+	// Scratch string reused when converting FName properties for schema.
+	FString NameStringScratch;
+
+	// Scratch buffer for the fields cleared by a component update.
+	TArray<Schema_FieldId> ClearedIdsScratch;
+
+	AllocationStats Allocations;
 };
 
 } // namespace SpatialGDK
@@ -10,7 +10,7 @@ DECLARE_LOG_CATEGORY_EXTERN(LogSpatialComponentReader, All, All);
 namespace SpatialGDK
 {
 
-class ComponentReader
+class SPATIALGDK_API ComponentReader
 {
 public:
 	ComponentReader(class USpatialNetDriver* InNetDriver, FObjectReferencesMap& InObjectReferencesMap);
@@ -18,10 +18,16 @@ public:
 	void ApplyComponentData(const Worker_ComponentData& ComponentData, UObject& Object, USpatialActorChannel& Channel, bool bIsHandover, bool& bOutReferencesChanged);
 	void ApplyComponentUpdate(const Worker_ComponentUpdate& ComponentUpdate, UObject& Object, USpatialActorChannel& Channel, bool bIsHandover, bool& bOutReferencesChanged);
 
+	// Reads a schema list directly into an array of primitives. Returns false if the inner property type is not supported.
+	bool ApplyPrimitiveArray(Schema_Object* Object, Schema_FieldId FieldId, UProperty* InnerProperty, FScriptArrayHelper& ArrayHelper);
+
 private:
 	void ApplySchemaObject(Schema_Object* ComponentObject, UObject& Object, USpatialActorChannel& Channel, bool bIsInitialData, const TArray<Schema_FieldId>& UpdatedIds, Worker_ComponentId ComponentId, bool& bOutReferencesChanged);
 	void ApplyHandoverSchemaObject(Schema_Object* ComponentObject, UObject& Object, USpatialActorChannel& Channel, bool bIsInitialData, const TArray<Schema_FieldId>& UpdatedIds, Worker_ComponentId ComponentId, bool& bOutReferencesChanged);
 
+	// Applies the item delta of a FastArray on top of its keyframe, and keeps it to apply again if it references unresolved objects.
+	void ApplyFastArrayItemDelta(Schema_Object* DeltaObject, UObject& Object, USpatialActorChannel& Channel, Schema_FieldId FieldId, const FRepParentCmd& Parent, UArrayProperty* ArrayProperty, UScriptStruct* NetDeltaStruct, int32 Offset, int32 ShadowOffset, int32 ParentIndex, bool& bOutReferencesChanged);
+
 	void ApplyProperty(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, uint32 Index, UProperty* Property, uint8* Data, int32 Offset, int32 CmdIndex, int32 ParentIndex, bool& bOutReferencesChanged);
 	void ApplyArray(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, UArrayProperty* Property, uint8* Data, int32 Offset, int32 CmdIndex, int32 ParentIndex, bool& bOutReferencesChanged);
 
@@ -32,6 +38,10 @@ private:
 	class USpatialNetDriver* NetDriver;
 	class USpatialClassInfoManager* ClassInfoManager;
 	FObjectReferencesMap& RootObjectReferencesMap;
+
+	// Scratch buffers reused when narrowing schema lists into small integer arrays.
+	TArray<int32> Int32ListScratch;
+	TArray<uint32> Uint32ListScratch;
 };
 
 } // namespace SpatialGDK
@@ -0,0 +1,72 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "Templates/Function.h"
+#include "UObject/WeakObjectPtr.h"
+
+#include "CoreMinimal.h"
+
+class AActor;
+
+/**
+ * Actors woken from dormancy, waiting for their first replication since waking up.
+ *
+ * A woken actor has no actor channel, so its first replication serializes all of its state. When many dormant actors
+ * wake up together, Process spreads this work across ticks by stopping once the time budget is spent, or once it has
+ * replicated as many actors as the caller's per-tick rate limits have left.
+ *
+ * Staged actors are replicated in order of relevance: actors relevant to a client viewer first, then actors nearest
+ * to a viewer, then in the order they were staged.
+ */
+class SPATIALGDK_API FDormancyWakeUpQueue
+{
+public:
+	struct FStats
+	{
+		uint32 NumStaged;
+		uint32 NumReplicated;
+		uint32 NumTicksOverBudget;
+		uint32 NumTicksRateLimited; // Ticks which left actors staged because MaxActors was reached.
+		int32 PeakStaged;
+		double LastProcessSeconds;
+		double LongestProcessSeconds;
+	};
+
+	// A budget of 0 disables staging, so woken actors are replicated along with every other actor.
+	explicit FDormancyWakeUpQueue(float InTimeBudgetSeconds = 0.f);
+
+	void SetTimeBudget(float InTimeBudgetSeconds) { TimeBudgetSeconds = InTimeBudgetSeconds; }
+	bool IsEnabled() const { return TimeBudgetSeconds > 0.f; }
+
+	// Stages the actor, or updates its relevance if it's already staged.
+	void Stage(AActor* Actor, bool bRelevantToClients, float DistanceSqToNearestViewer);
+	bool IsStaged(const AActor* Actor) const { return Staged.Contains(Actor); }
+	void Remove(const AActor* Actor) { Staged.Remove(Actor); }
+
+	// Calls Replicate on at most MaxActors staged actors in order of relevance until the time budget is spent, and returns
+	// the number it returned true for. If MaxActors isn't 0, at least one actor is replicated per call, so the queue drains
+	// as long as the rate limits leave room for it.
+	int32 Process(int32 MaxActors, TFunctionRef<bool(AActor*)> Replicate);
+
+	int32 Num() const { return Staged.Num(); }
+	const FStats& GetStats() const { return Stats; }
+
+private:
+	struct FStagedActor
+	{
+		bool bRelevantToClients;
+		float DistanceSqToNearestViewer;
+		uint64 Sequence;
+	};
+
+	TMap<TWeakObjectPtr<AActor>, FStagedActor> Staged;
+
+	// Kept around to avoid reallocating the processing order every tick.
+	TArray<TPair<TWeakObjectPtr<AActor>, FStagedActor>> OrderScratch;
+
+	float TimeBudgetSeconds;
+	uint64 NextSequence;
+
+	FStats Stats;
+};
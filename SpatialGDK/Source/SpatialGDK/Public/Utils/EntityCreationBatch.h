@@ -0,0 +1,86 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "SpatialCommonTypes.h"
+
+#include "UObject/WeakObjectPtr.h"
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSpatialEntityCreationBatch, Log, All);
+
+class SpatialOSWorkerInterface;
+class USpatialActorChannel;
+
+/**
+ * Collects the create entity requests made during a tick so they can be submitted together once replication is done,
+ * and tracks the responses for each submitted batch as a whole.
+ *
+ * The Worker SDK has no batch create entity request, so a flush still sends one request per entity, back to back.
+ * Entity IDs are already reserved in bulk by the UEntityPool, so no reservation round-trip is needed per entity.
+ *
+ * Component data passed to Add is owned by the batch until it is flushed, and destroyed if the batch is destroyed first.
+ */
+class SPATIALGDK_API FEntityCreationBatch
+{
+public:
+	// Called for every request sent by Flush, in the order the creations were added.
+	using FOnRequestSent = TFunctionRef<void(Worker_RequestId RequestId, Worker_EntityId EntityId, const TWeakObjectPtr<USpatialActorChannel>& Channel)>;
+
+	struct FStats
+	{
+		uint32 NumBatches;
+		uint32 NumRequests;
+		uint32 NumSucceeded;
+		uint32 NumFailed;
+		// Time between the last completed batch being flushed and its final response arriving.
+		double LastBatchSeconds;
+		int32 LastBatchSize;
+	};
+
+	FEntityCreationBatch();
+	~FEntityCreationBatch();
+
+	FEntityCreationBatch(const FEntityCreationBatch&) = delete;
+	FEntityCreationBatch& operator=(const FEntityCreationBatch&) = delete;
+
+	void Add(Worker_EntityId EntityId, TArray<FWorkerComponentData>&& Components, USpatialActorChannel* Channel);
+
+	// Sends every queued creation through the connection. Returns the number of requests sent.
+	int32 Flush(SpatialOSWorkerInterface& Connection, FOnRequestSent OnRequestSent);
+
+	// Records a response to a request sent by Flush. Returns false if the request was not sent by this batch.
+	bool OnCreateEntityResponse(const Worker_CreateEntityResponseOp& Op);
+
+	int32 GetNumQueued() const { return Queued.Num(); }
+	int32 GetNumInFlight() const { return InFlightRequests.Num(); }
+	const FStats& GetStats() const { return Stats; }
+
+private:
+	struct FQueuedCreation
+	{
+		Worker_EntityId EntityId;
+		TArray<FWorkerComponentData> Components;
+		TWeakObjectPtr<USpatialActorChannel> Channel;
+	};
+
+	struct FInFlightBatch
+	{
+		double FlushTime;
+		int32 NumRequests;
+		int32 NumOutstanding;
+		int32 NumFailed;
+	};
+
+	TArray<FQueuedCreation> Queued;
+
+	// Maps each request sent by Flush to the batch it was sent in.
+	TMap<Worker_RequestId_Key, uint32> InFlightRequests;
+	TMap<uint32, FInFlightBatch> InFlightBatches;
+	uint32 NextBatchId;
+
+	FStats Stats;
+};
@@ -20,6 +20,7 @@ class USpatialPackageMapClient;
 namespace SpatialGDK
 {
 class SpatialRPCService;	
+class EntityPrototypeCache;
 
 struct RPCsOnEntityCreation;
 using FRPCsOnEntityCreationMap = TMap<TWeakObjectPtr<const UObject>, RPCsOnEntityCreation>;
@@ -27,7 +28,7 @@ using FRPCsOnEntityCreationMap = TMap<TWeakObjectPtr<const UObject>, RPCsOnEntit
 class SPATIALGDK_API EntityFactory
 {
 public:
-	EntityFactory(USpatialNetDriver* InNetDriver, USpatialPackageMapClient* InPackageMap, USpatialClassInfoManager* InClassInfoManager, SpatialRPCService* InRPCService);
+	EntityFactory(USpatialNetDriver* InNetDriver, USpatialPackageMapClient* InPackageMap, USpatialClassInfoManager* InClassInfoManager, SpatialRPCService* InRPCService, EntityPrototypeCache* InPrototypeCache = nullptr);
  
 	TArray<FWorkerComponentData> CreateEntityComponents(USpatialActorChannel* Channel, FRPCsOnEntityCreationMap& OutgoingOnCreateEntityRPCs, uint32& OutBytesWritten);
 	TArray<FWorkerComponentData> CreateTombstoneEntityComponents(AActor* Actor);
@@ -39,5 +40,8 @@ private:
 	USpatialPackageMapClient* PackageMap;
 	USpatialClassInfoManager* ClassInfoManager;
 	SpatialRPCService* RPCService;
+
+	// Optional, used to reuse the class-wide parts of entities created by CreateEntityComponents.
+	EntityPrototypeCache* PrototypeCache;
 };
 }  // namepsace SpatialGDK
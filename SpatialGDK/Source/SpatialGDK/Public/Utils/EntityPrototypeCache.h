@@ -0,0 +1,69 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "SpatialCommonTypes.h"
+
+#include "UObject/WeakObjectPtr.h"
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+struct FClassInfo;
+
+namespace SpatialGDK
+{
+
+// The parts of a new entity's components which only depend on the actor's class, and on settings which don't change
+// while this worker is running.
+struct EntityPrototype
+{
+	FString ClassName;
+	FString ClassPath;
+
+	bool bIsServerOnly;
+	bool bIsPlayerController;
+	bool bIsPersistent;
+
+	// Write ACL entries for every component the authoritative worker owns on all entities of this class.
+	WriteAclMap AuthoritativeWriteAcl;
+
+	// Components written by the owning client, which can only be added to the ACL per actor.
+	TArray<Worker_ComponentId> OwningClientComponentIds;
+};
+
+/**
+ * Cache of an EntityPrototype per actor class, so that creating an entity only has to copy the prototype's ACL and
+ * patch in the entries which depend on the actor instance (owning client, tombstone, queued RPCs and subobjects).
+ *
+ * The prototypes are rebuilt if the authoritative worker attribute or the RPC component setup changes.
+ */
+class SPATIALGDK_API EntityPrototypeCache
+{
+public:
+	EntityPrototypeCache();
+
+	const EntityPrototype& GetOrCreatePrototype(UClass* Class, const FClassInfo& Info, const TSet<uint32>& NetCullDistanceComponentIds,
+		const WorkerAttributeSet& AuthoritativeWorkerAttributeSet, bool bUseRingBufferRPCs);
+
+	static EntityPrototype CreatePrototype(UClass* Class, const FClassInfo& Info, const TSet<uint32>& NetCullDistanceComponentIds,
+		const WorkerAttributeSet& AuthoritativeWorkerAttributeSet, bool bUseRingBufferRPCs);
+
+	void Reset();
+
+	int32 Num() const { return Prototypes.Num(); }
+	uint32 GetNumHits() const { return NumHits; }
+	uint32 GetNumMisses() const { return NumMisses; }
+
+private:
+	TMap<TWeakObjectPtr<UClass>, EntityPrototype> Prototypes;
+
+	WorkerAttributeSet CachedAuthoritativeWorkerAttributeSet;
+	bool bCachedUseRingBufferRPCs;
+
+	uint32 NumHits;
+	uint32 NumMisses;
+};
+
+} // namespace SpatialGDK
@@ -0,0 +1,91 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Schema/UnrealObjectRef.h"
+#include "SpatialConstants.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+class UArrayProperty;
+class UProperty;
+class UScriptStruct;
+class USpatialNetDriver;
+
+namespace SpatialGDK
+{
+
+// What a worker has written for a FastArray property since it last wrote the whole array.
+struct FFastArrayItemDeltaSenderState
+{
+	// ReplicationKey of each item when the whole array was last written.
+	TMap<int32, int32> KeyframeItemKeys;
+
+	// Items added since the whole array was last written, so that their removal is written too.
+	TSet<int32> ItemsAddedSinceKeyframe;
+
+	int32 KeyframeBytes = 0;
+	int32 DeltaBytesSinceKeyframe = 0;
+	int32 LastWrittenArrayReplicationKey = INDEX_NONE;
+	bool bHasKeyframe = false;
+};
+
+// What a worker has applied for a FastArray property since it last received the whole array.
+struct FFastArrayItemDeltaReceiverState
+{
+	// ReplicationKey of each item applied from a delta, so that items which haven't changed since are skipped.
+	TMap<int32, int32> AppliedItemKeys;
+};
+
+// FastArrays replicated with item deltas are written as a keyframe, the whole array in the format used without item
+// deltas, and an item delta holding every item added, changed or removed since the keyframe, keyed by ReplicationID.
+// A component update replaces a field as a whole, so the item delta is cumulative. This keeps the keyframe and item delta
+// stored by the Runtime enough to rebuild the array on a worker that checks out the entity later. A new keyframe is
+// written once the item deltas written since the last one outgrow it.
+struct SPATIALGDK_API FFastArrayItemDelta
+{
+	static bool IsEnabled();
+
+	static Schema_FieldId GetDeltaFieldId(Schema_FieldId KeyframeFieldId) { return KeyframeFieldId + SpatialConstants::FAST_ARRAY_ITEM_DELTA_FIELD_ID_OFFSET; }
+	static Schema_FieldId GetKeyframeFieldId(Schema_FieldId DeltaFieldId) { return DeltaFieldId - SpatialConstants::FAST_ARRAY_ITEM_DELTA_FIELD_ID_OFFSET; }
+	static bool IsDeltaFieldId(Schema_FieldId FieldId) { return FieldId > SpatialConstants::FAST_ARRAY_ITEM_DELTA_FIELD_ID_OFFSET; }
+
+	// Whether the FastArray has been marked dirty since it was last written.
+	static bool HasChangedSinceLastWrite(const void* FastArray, const FFastArrayItemDeltaSenderState& State);
+
+	// Gives every item that hasn't been marked dirty yet a ReplicationID, so that it is keyed the same way in keyframes and item deltas.
+	static void AssignItemIds(void* FastArray, UArrayProperty* ItemsProperty);
+
+	// Records that the whole FastArray has been written, in KeyframeBytes.
+	static void RecordKeyframe(void* FastArray, UArrayProperty* ItemsProperty, int32 KeyframeBytes, FFastArrayItemDeltaSenderState& State);
+
+	// Writes the items changed since the last keyframe to the item delta field of the FastArray written at KeyframeFieldId.
+	// Returns false without writing anything if there is no keyframe yet, or the item delta would outgrow it.
+	static bool WriteDelta(USpatialNetDriver* NetDriver, Schema_Object* ComponentObject, Schema_FieldId KeyframeFieldId, void* FastArray, UArrayProperty* ItemsProperty, FFastArrayItemDeltaSenderState& State);
+
+	// Writes an empty item delta, clearing the one stored alongside the previous keyframe.
+	static void ClearDelta(Schema_Object* ComponentObject, Schema_FieldId KeyframeFieldId);
+
+	// Writes the whole FastArray at KeyframeFieldId with an empty item delta, and records it as the keyframe later item deltas
+	// are written against. Returns the size of the keyframe.
+	static int32 WriteKeyframe(USpatialNetDriver* NetDriver, Schema_Object* ComponentObject, Schema_FieldId KeyframeFieldId, UObject* Object, int32 ArrayIndex, UProperty* ParentProperty,
+		UArrayProperty* ItemsProperty, UScriptStruct* NetDeltaStruct, FFastArrayItemDeltaSenderState& State);
+
+	// Resets State after the whole FastArray has been applied.
+	static void OnKeyframeApplied(void* FastArray, UArrayProperty* ItemsProperty, FFastArrayItemDeltaReceiverState& State);
+
+	// Applies the items of DeltaObject that changed since they were last applied through State, or every item if State is null.
+	// Items are applied through the engine's FastArray serialization, so the item callbacks fire as they would without item deltas.
+	// Returns true if any item was added, changed or removed.
+	static bool ApplyDelta(USpatialNetDriver* NetDriver, Schema_Object* DeltaObject, void* FastArray, UArrayProperty* ItemsProperty, UScriptStruct* NetDeltaStruct,
+		FFastArrayItemDeltaReceiverState* State, TSet<FUnrealObjectRef>& OutMappedRefs, TSet<FUnrealObjectRef>& OutUnresolvedRefs);
+
+	// Copies an item delta out of its schema object, to apply it again once the object references it contains are resolved.
+	static TArray<uint8> SerializeDelta(Schema_Object* DeltaObject);
+	static bool ApplySerializedDelta(USpatialNetDriver* NetDriver, const TArray<uint8>& SerializedDelta, void* FastArray, UArrayProperty* ItemsProperty, UScriptStruct* NetDeltaStruct,
+		TSet<FUnrealObjectRef>& OutMappedRefs, TSet<FUnrealObjectRef>& OutUnresolvedRefs);
+};
+
+} // namespace SpatialGDK
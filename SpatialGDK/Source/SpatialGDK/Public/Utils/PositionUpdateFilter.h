@@ -0,0 +1,50 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "SpatialCommonTypes.h"
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+/**
+ * Quantizes outgoing Position updates and suppresses those which would not change the last position sent for the entity.
+ *
+ * Positions are snapped to a grid of Precision Unreal units (no snapping if 0), so movement within one grid cell, and
+ * repeated sends of the same position (e.g. a PlayerController and its Pawn in the same tick), are not resent.
+ *
+ * The last sent position is only valid while this worker stays authoritative over the entity's Position, so the owner
+ * must call RemoveEntity on authority changes and when the entity is removed.
+ */
+class SPATIALGDK_API FPositionUpdateFilter
+{
+public:
+	struct FStats
+	{
+		uint32 NumSent;
+		uint32 NumSuppressed;
+	};
+
+	explicit FPositionUpdateFilter(float InPrecision = 0.0f);
+
+	void SetPrecision(float InPrecision);
+	float GetPrecision() const { return Precision; }
+
+	// Returns false if the quantized position matches the last one sent for the entity. Otherwise records it and returns
+	// true, with the position to send in OutPosition.
+	bool ShouldSend(Worker_EntityId EntityId, const FVector& Position, FVector& OutPosition);
+
+	void RemoveEntity(Worker_EntityId EntityId);
+
+	const FStats& GetStats() const { return Stats; }
+
+	static FVector Quantize(const FVector& Position, float Precision);
+
+private:
+	float Precision;
+
+	TMap<Worker_EntityId_Key, FVector> LastSentPositions;
+
+	FStats Stats;
+};
@@ -21,8 +21,12 @@ struct RPCRingBuffer
 		return RingBuffer[(RPCId - 1) % RingBuffer.Num()];
 	}
 
+	// RPCs sent after the ring buffer element in the same bundle. Always empty for non-multicast buffers.
+	const TArray<RPCPayload>& GetBundledRPCs(uint64 RPCId) const;
+
 	ERPCType Type;
 	TArray<TOptional<RPCPayload>> RingBuffer;
+	TArray<TArray<RPCPayload>> BundledRPCs;
 	uint64 LastSentRPCId = 0;
 };
 
@@ -57,10 +61,14 @@ Schema_FieldId GetInitiallyPresentMulticastRPCsCountFieldId();
 
 bool ShouldQueueOverflowed(ERPCType Type);
 
-void ReadBufferFromSchema(Schema_Object* SchemaObject, RPCRingBuffer& OutBuffer);
+// Elements holding RPCs with an ID up to and including SkipUpToRPCId are left untouched instead of being read.
+void ReadBufferFromSchema(Schema_Object* SchemaObject, RPCRingBuffer& OutBuffer, uint64 SkipUpToRPCId = 0);
+uint64 GetRPCIdAtElementIndex(uint32 RingBufferIndex, uint32 RingBufferSize, uint64 LastSentRPCId);
 void ReadAckFromSchema(const Schema_Object* SchemaObject, ERPCType Type, uint64& OutAck);
 
 void WriteRPCToSchema(Schema_Object* SchemaObject, ERPCType Type, uint64 RPCId, const RPCPayload& Payload);
+// Writes all payloads into a single ring buffer element, the first one as the element itself and the rest as its bundled RPCs.
+void WriteRPCBundleToSchema(Schema_Object* SchemaObject, ERPCType Type, uint64 RPCId, const TArray<RPCPayload>& Payloads);
 void WriteAckToSchema(Schema_Object* SchemaObject, ERPCType Type, uint64 Ack);
 
 void MoveLastSentIdToInitiallyPresentCount(Schema_Object* SchemaObject, uint64 LastSentId);
@@ -18,19 +18,38 @@ namespace SpatialGDK
 
 inline void AddStringToSchema(Schema_Object* Object, Schema_FieldId Id, const FString& Value)
 {
-	FTCHARToUTF8 CStrConversion(*Value);
-	uint32 StringLength = CStrConversion.Length();
+	// Convert straight into the schema-owned buffer rather than through a temporary UTF-8 copy.
+	const int32 SourceLength = Value.Len();
+	const int32 StringLength = FTCHARToUTF8_Convert::ConvertedLength(*Value, SourceLength);
 	uint8* StringBuffer = Schema_AllocateBuffer(Object, sizeof(char) * StringLength);
-	FMemory::Memcpy(StringBuffer, CStrConversion.Get(), sizeof(char) * StringLength);
+	FTCHARToUTF8_Convert::Convert(reinterpret_cast<ANSICHAR*>(StringBuffer), StringLength, *Value, SourceLength);
 	Schema_AddBytes(Object, Id, StringBuffer, sizeof(char) * StringLength);
 }
 
+// Reads a string into OutString, reusing its existing allocation where possible.
+inline void IndexStringFromSchema(const Schema_Object* Object, Schema_FieldId Id, uint32 Index, FString& OutString)
+{
+	const int32 StringLength = (int32)Schema_IndexBytesLength(Object, Id, Index);
+	const ANSICHAR* Bytes = reinterpret_cast<const ANSICHAR*>(Schema_IndexBytes(Object, Id, Index));
+	const int32 ConvertedLength = FUTF8ToTCHAR_Convert::ConvertedLength(Bytes, StringLength);
+
+	TArray<TCHAR>& CharArray = OutString.GetCharArray();
+	if (ConvertedLength == 0)
+	{
+		CharArray.Reset();
+		return;
+	}
+
+	CharArray.SetNumUninitialized(ConvertedLength + 1, /* bAllowShrinking */ false);
+	FUTF8ToTCHAR_Convert::Convert(CharArray.GetData(), ConvertedLength, Bytes, StringLength);
+	CharArray[ConvertedLength] = TEXT('\0');
+}
+
 inline FString IndexStringFromSchema(const Schema_Object* Object, Schema_FieldId Id, uint32 Index)
 {
-	int32 StringLength = (int32)Schema_IndexBytesLength(Object, Id, Index);
-	const uint8_t* Bytes = Schema_IndexBytes(Object, Id, Index);
-	FUTF8ToTCHAR FStringConversion(reinterpret_cast<const ANSICHAR*>(Bytes), StringLength);
-	return FString(FStringConversion.Length(), FStringConversion.Get());
+	FString String;
+	IndexStringFromSchema(Object, Id, Index, String);
+	return String;
 }
 
 inline FString GetStringFromSchema(const Schema_Object* Object, Schema_FieldId Id)
@@ -38,6 +57,15 @@ inline FString GetStringFromSchema(const Schema_Object* Object, Schema_FieldId I
 	return IndexStringFromSchema(Object, Id, 0);
 }
 
+// Reads a string as an FName without going through an intermediate FString.
+inline FName IndexNameFromSchema(const Schema_Object* Object, Schema_FieldId Id, uint32 Index)
+{
+	const int32 StringLength = (int32)Schema_IndexBytesLength(Object, Id, Index);
+	const ANSICHAR* Bytes = reinterpret_cast<const ANSICHAR*>(Schema_IndexBytes(Object, Id, Index));
+	FUTF8ToTCHAR NameConversion(Bytes, StringLength);
+	return FName(NameConversion.Length(), NameConversion.Get());
+}
+
 inline bool GetBoolFromSchema(const Schema_Object* Object, Schema_FieldId Id)
 {
 	return !!Schema_GetBool(Object, Id);
@@ -55,6 +83,17 @@ inline void AddBytesToSchema(Schema_Object* Object, Schema_FieldId Id, FBitWrite
 	AddBytesToSchema(Object, Id, Writer.GetData(), Writer.GetNumBytes());
 }
 
+// Returns a view into the schema-owned bytes. Only valid for the lifetime of the schema object.
+inline TArrayView<const uint8> IndexBytesViewFromSchema(const Schema_Object* Object, Schema_FieldId Id, uint32 Index)
+{
+	return TArrayView<const uint8>((const uint8*)Schema_IndexBytes(Object, Id, Index), (int32)Schema_IndexBytesLength(Object, Id, Index));
+}
+
+inline TArrayView<const uint8> GetBytesViewFromSchema(const Schema_Object* Object, Schema_FieldId Id)
+{
+	return IndexBytesViewFromSchema(Object, Id, 0);
+}
+
 inline TArray<uint8> IndexBytesFromSchema(const Schema_Object* Object, Schema_FieldId Id, uint32 Index)
 {
 	int32 PayloadSize = (int32)Schema_IndexBytesLength(Object, Id, Index);
@@ -66,6 +105,17 @@ inline TArray<uint8> GetBytesFromSchema(const Schema_Object* Object, Schema_Fiel
 	return IndexBytesFromSchema(Object, Id, 0);
 }
 
+// Widens or narrows a contiguous buffer of integers element by element. Kept as a flat loop over
+// non-aliasing buffers so the compiler can vectorize it when packing arrays into schema lists.
+template<typename ToType, typename FromType>
+inline void ConvertIntegerBuffer(ToType* RESTRICT Out, const FromType* RESTRICT In, int32 Count)
+{
+	for (int32 i = 0; i < Count; i++)
+	{
+		Out[i] = static_cast<ToType>(In[i]);
+	}
+}
+
 inline void AddWorkerRequirementSetToSchema(Schema_Object* Object, Schema_FieldId Id, const WorkerRequirementSet& Value)
 {
 	Schema_Object* RequirementSetObject = Schema_AddObject(Object, Id);
@@ -83,4 +83,21 @@ inline FVector GetActorSpatialPosition(const AActor* InActor)
 	return FRepMovement::RebaseOntoZeroOrigin(Location, InActor);
 }
 
+// The velocity of whatever GetActorSpatialPosition follows, so where the Actor's SpatialOS position is heading.
+inline FVector GetActorSpatialVelocity(const AActor* InActor)
+{
+	const AController* Controller = Cast<AController>(InActor);
+	if (Controller != nullptr)
+	{
+		// Spectating and focal locations don't have a velocity.
+		return Controller->GetPawn() != nullptr ? Controller->GetPawn()->GetVelocity() : FVector::ZeroVector;
+	}
+	else if (InActor->GetOwner() != nullptr && InActor->GetOwner()->GetIsReplicated())
+	{
+		return GetActorSpatialVelocity(InActor->GetOwner());
+	}
+
+	return InActor->GetVelocity();
+}
+
 } // namespace SpatialGDK
@@ -0,0 +1,93 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace SpatialGDK
+{
+
+enum class EBandwidthCategory : uint8
+{
+	Data,
+	OwnerOnly,
+	Handover,
+	RPC,
+	Interest
+};
+
+/**
+ * Lightweight egress profiler that does not depend on the engine network profiler.
+ *
+ * Accumulates the number of schema bytes written, and how many times each entry was written, keyed by class,
+ * property (or RPC) name and category. It is compiled into every build and costs a single branch when disabled.
+ * It is toggled with the "SpatialStartBandwidthProfiler" and "SpatialStopBandwidthProfiler" console commands,
+ * and "SpatialDumpBandwidthProfile [csv|json]" writes a report to the profiling directory.
+ *
+ * The byte counts are the serialized schema sizes, so they don't include framing or compression done by the Runtime.
+ */
+class SPATIALGDK_API BandwidthProfiler
+{
+public:
+	struct FEntry
+	{
+		FName ClassName;
+		FName PropertyName;
+		EBandwidthCategory Category;
+		uint64 Bytes;
+		uint64 Count;
+	};
+
+	BandwidthProfiler();
+
+	void Start();
+	void Stop();
+	void Reset();
+
+	bool IsEnabled() const { return bEnabled; }
+
+	void Track(FName ClassName, FName PropertyName, EBandwidthCategory Category, uint32 Bytes);
+
+	// Returns all entries, with the largest byte counts first.
+	TArray<FEntry> GetEntries() const;
+
+	// Seconds spent recording, including the current session if still running.
+	double GetRecordedSeconds() const;
+
+	FString ToCSV() const;
+	FString ToJson() const;
+
+	static const TCHAR* GetCategoryName(EBandwidthCategory Category);
+
+private:
+	struct FKey
+	{
+		FName ClassName;
+		FName PropertyName;
+		EBandwidthCategory Category;
+
+		bool operator==(const FKey& Other) const
+		{
+			return ClassName == Other.ClassName && PropertyName == Other.PropertyName && Category == Other.Category;
+		}
+
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			return HashCombine(HashCombine(GetTypeHash(Key.ClassName), GetTypeHash(Key.PropertyName)), static_cast<uint32>(Key.Category));
+		}
+	};
+
+	struct FStat
+	{
+		uint64 Bytes;
+		uint64 Count;
+	};
+
+	TMap<FKey, FStat> Stats;
+
+	bool bEnabled;
+	double SessionStartTime;
+	double AccumulatedSeconds;
+};
+
+} // namespace SpatialGDK
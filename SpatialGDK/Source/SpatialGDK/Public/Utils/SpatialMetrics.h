@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 
 #include "SpatialConstants.h"
+#include "Utils/SpatialBandwidthProfiler.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
 #include <WorkerSDK/improbable/c_worker.h>
@@ -44,8 +45,20 @@ public:
 	void SpatialModifySetting(const FString& Name, float Value);
 	void OnModifySettingCommand(Schema_Object* CommandPayload);
 
+	UFUNCTION(Exec)
+	void SpatialStartBandwidthProfiler();
+
+	UFUNCTION(Exec)
+	void SpatialStopBandwidthProfiler();
+
+	UFUNCTION(Exec)
+	void SpatialDumpBandwidthProfile(const FString& Format);
+
 	void TrackSentRPC(UFunction* Function, ERPCType RPCType, int PayloadSize);
 
+	// Returns the bandwidth profiler if it is recording, otherwise nullptr.
+	SpatialGDK::BandwidthProfiler* GetActiveBandwidthProfiler() { return BandwidthProfiler.IsEnabled() ? &BandwidthProfiler : nullptr; }
+
 	void HandleWorkerMetrics(Worker_Op* Op);
 
 	// The user can bind their own delegate to handle worker metrics.
@@ -93,5 +106,8 @@ private:
 	TMap<FString, RPCStat> RecentRPCs;
 	bool bRPCTrackingEnabled;
 	float RPCTrackingStartTime;
+
+	// Bandwidth profiling is local to this worker, unlike RPC tracking which is forwarded to the server.
+	SpatialGDK::BandwidthProfiler BandwidthProfiler;
 };
 
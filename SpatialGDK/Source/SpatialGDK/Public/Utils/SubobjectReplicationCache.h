@@ -0,0 +1,70 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "SpatialCommonTypes.h"
+
+#include "UObject/WeakObjectPtr.h"
+
+#include "CoreMinimal.h"
+
+class UAbstractLBStrategy;
+struct FClassInfo;
+
+/**
+ * Per actor channel cache of what each replication pass needs to know about the channel's subobjects and
+ * load balancing state, which otherwise has to be looked up again every time the actor replicates.
+ *
+ * It caches:
+ *   - the class info of subobjects which have a valid object ref, so they can be replicated
+ *   - the subobjects which have handover properties
+ *   - whether this worker should evaluate the load balancing strategy for the actor
+ *
+ * The owning channel invalidates it when authority over the entity changes and when subobjects are attached
+ * or deleted. Load balancing eligibility is also invalidated when the strategy or local virtual worker changes.
+ */
+class SPATIALGDK_API FSubobjectReplicationCache
+{
+public:
+	typedef TArray<TPair<TWeakObjectPtr<UObject>, const FClassInfo*>> FHandoverSubobjects;
+
+	FSubobjectReplicationCache();
+
+	// Returns the class info of a subobject which has previously been found to be replicable, or nullptr on a miss.
+	const FClassInfo* FindSubobjectInfo(const UObject* Subobject);
+	void AddSubobjectInfo(const UObject* Subobject, const FClassInfo* Info);
+
+	// Returns nullptr on a miss, in which case the caller should resolve the subobjects and call SetHandoverSubobjects.
+	const FHandoverSubobjects* FindHandoverSubobjects();
+	void SetHandoverSubobjects(FHandoverSubobjects&& InHandoverSubobjects);
+
+	// Returns false on a miss, in which case the caller should evaluate eligibility and call SetLoadBalancingEligibility.
+	bool FindLoadBalancingEligibility(const UAbstractLBStrategy* Strategy, bool& bOutEligible);
+	void SetLoadBalancingEligibility(const UAbstractLBStrategy* Strategy, bool bEligible);
+
+	// Called when a subobject is attached to or removed from the actor.
+	void InvalidateSubobject(const UObject* Subobject);
+
+	// Called when authority over the entity changes, or the entity itself changes.
+	void Invalidate();
+
+	uint32 GetNumHits() const { return NumHits; }
+	uint32 GetNumMisses() const { return NumMisses; }
+
+private:
+	void RecordHit();
+	void RecordMiss();
+
+	TMap<TWeakObjectPtr<UObject>, const FClassInfo*> SubobjectInfos;
+
+	FHandoverSubobjects HandoverSubobjects;
+	bool bHandoverSubobjectsValid;
+
+	TWeakObjectPtr<const UAbstractLBStrategy> EligibilityStrategy;
+	VirtualWorkerId EligibilityLocalVirtualWorkerId;
+	bool bLoadBalancingEligible;
+	bool bLoadBalancingEligibilityValid;
+
+	uint32 NumHits;
+	uint32 NumMisses;
+};
@@ -0,0 +1,109 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "SpatialCommonTypes.h"
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSpatialUpdatesQueuedUntilAuthority, Log, All);
+
+class SpatialOSWorkerInterface;
+
+/**
+ * Component updates which were made while this worker did not have authority over the component, waiting to be sent
+ * once authority is gained.
+ *
+ * Only one update is kept per entity and component. A newer update is merged into the queued one with the schema merge
+ * semantics, so newer field values replace older ones and events are appended, and no stale intermediate state is
+ * replayed on authority gain.
+ *
+ * If MaxBytes is not 0, the store evicts the least recently updated entries once the queued schema data exceeds it.
+ * The values an evicted update held are not queued anywhere else, so the store remembers which components lost an
+ * update and Send resends their whole current state once authority is gained.
+ *
+ * The store owns the schema data of queued updates until they are popped.
+ */
+class SPATIALGDK_API FUpdatesQueuedUntilAuthority
+{
+public:
+	struct FStats
+	{
+		uint32 NumQueued;
+		uint32 NumMerged;
+		uint32 NumEvicted;
+		uint64 BytesEvicted;
+		uint32 NumWholeComponentsResent; // Sent in place of evicted updates.
+		uint32 PeakBytes;
+	};
+
+	explicit FUpdatesQueuedUntilAuthority(uint32 InMaxBytes = 0);
+	~FUpdatesQueuedUntilAuthority();
+
+	FUpdatesQueuedUntilAuthority(const FUpdatesQueuedUntilAuthority&) = delete;
+	FUpdatesQueuedUntilAuthority& operator=(const FUpdatesQueuedUntilAuthority&) = delete;
+
+	void SetMaxBytes(uint32 InMaxBytes);
+
+	// Takes ownership of the update's schema data.
+	void Add(Worker_EntityId EntityId, const FWorkerComponentUpdate& Update);
+
+	// Moves the queued update for the component into OutUpdate, transferring ownership. Returns false if there is none.
+	bool Pop(Worker_EntityId EntityId, Worker_ComponentId ComponentId, FWorkerComponentUpdate& OutUpdate);
+
+	// Sends the update queued for the component, if any. If an update for the component was evicted, also sends the update
+	// created by CreateWholeComponentUpdate, which should hold the component's current state. It returns false if it
+	// couldn't create one.
+	void Send(Worker_EntityId EntityId, Worker_ComponentId ComponentId, SpatialOSWorkerInterface& Connection, TFunctionRef<bool(FWorkerComponentUpdate& OutUpdate)> CreateWholeComponentUpdate);
+
+	// Whether an update queued for the component was evicted since the component was last sent.
+	bool WasEvicted(Worker_EntityId EntityId, Worker_ComponentId ComponentId) const;
+
+	// Destroys all updates queued for the entity, and forgets which of its updates were evicted.
+	void RemoveEntity(Worker_EntityId EntityId);
+
+	int32 Num() const { return NumEntries; }
+	uint32 GetQueuedBytes() const { return QueuedBytes; }
+	const FStats& GetStats() const { return Stats; }
+
+	static uint32 GetUpdateSize(const Worker_ComponentUpdate& Update);
+
+private:
+	struct FEntry
+	{
+		FWorkerComponentUpdate Update;
+		uint32 Bytes;
+		uint64 Sequence;
+	};
+
+	struct FEvictionCandidate
+	{
+		Worker_EntityId EntityId;
+		Worker_ComponentId ComponentId;
+		uint64 Sequence;
+	};
+
+	void RemoveEntry(Worker_EntityId EntityId, Worker_ComponentId ComponentId, bool bDestroyUpdate);
+	void EvictUntilUnderBudget();
+	void CompactEvictionOrder();
+	void UpdateQueuedBytesStat();
+
+	TMap<Worker_EntityId_Key, TMap<Worker_ComponentId, FEntry>> Entries;
+	int32 NumEntries;
+
+	// Components which had an update evicted, and so need their whole state sent on authority gain.
+	TMap<Worker_EntityId_Key, TSet<Worker_ComponentId>> EvictedComponents;
+
+	// Entries in the order they were last updated. Candidates whose sequence no longer matches their entry are stale and skipped.
+	TArray<FEvictionCandidate> EvictionOrder;
+	int32 EvictionHead;
+	uint64 NextSequence;
+
+	uint32 MaxBytes;
+	uint32 QueuedBytes;
+
+	FStats Stats;
+};
@@ -0,0 +1,562 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "LoadBalancing/LBStrategySimulator.h"
+
+#include "LoadBalancing/AbstractLBStrategy.h"
+#include "Schema/Interest.h"
+#include "SpatialConstants.h"
+#include "Utils/SpatialActorUtils.h"
+
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "Misc/FileHelper.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+DEFINE_LOG_CATEGORY(LogLBStrategySimulator);
+
+namespace
+{
+
+constexpr int32 CSV_FIELDS_PER_SAMPLE = 5;
+
+// As USpatialNetDriver::TickHandoverPrefetch, which evaluates its predictions this many times per lookahead.
+constexpr float PREFETCH_EVALUATIONS_PER_LOOKAHEAD = 4.f;
+
+bool ParseSample(const FString& Line, FLBTrace::FSample& OutSample)
+{
+	TArray<FString> Fields;
+	Line.ParseIntoArray(Fields, TEXT(","), false);
+	if (Fields.Num() != CSV_FIELDS_PER_SAMPLE)
+	{
+		return false;
+	}
+
+	for (FString& Field : Fields)
+	{
+		Field.TrimStartAndEndInline();
+	}
+
+	return LexTryParseString(OutSample.Time, *Fields[0])
+		&& LexTryParseString(OutSample.ActorId, *Fields[1])
+		&& LexTryParseString(OutSample.Location.X, *Fields[2])
+		&& LexTryParseString(OutSample.Location.Y, *Fields[3])
+		&& LexTryParseString(OutSample.Location.Z, *Fields[4]);
+}
+
+struct FSimulatedActor
+{
+	AActor* Actor;
+	VirtualWorkerId Authority;
+	VirtualWorkerId Intent;
+	int32 IntentFrame;
+	double LastSampleTime;
+	int32 NextReplicationFrame;
+	// The worker which predicted it would gain authority, and so prewarmed its channel.
+	VirtualWorkerId PrewarmedVirtualWorkerId;
+	double AuthorityGainTime;
+	bool bAwaitingFirstReplication;
+};
+
+// The first frame after Frame in the Actor's replication slot, so Actors sharing an interval are spread across frames.
+int32 GetNextReplicationFrame(int32 Frame, int32 ActorId, int32 ReplicationIntervalFrames)
+{
+	const int32 Interval = FMath::Max(ReplicationIntervalFrames, 1);
+	const int32 Slot = ((-ActorId % Interval) + Interval) % Interval;
+	return Frame + 1 + (((Slot - (Frame + 1)) % Interval) + Interval) % Interval;
+}
+
+AActor* SpawnSimulatedActor(UWorld& World, const FVector& Location)
+{
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.bNoFail = true;
+	AActor* Actor = World.SpawnActor<AActor>(SpawnParams);
+
+	// Strategies locate Actors through their root component.
+	USceneComponent* Root = NewObject<USceneComponent>(Actor);
+	Actor->SetRootComponent(Root);
+	Root->RegisterComponent();
+	Actor->SetActorLocation(Location);
+
+	return Actor;
+}
+
+// Rebalances the regions from each worker's Actor count on the strategy of the worker authoritative over the translation, and
+// sends them to every other worker through the translation, as SpatialVirtualWorkerTranslationManager and SpatialVirtualWorkerTranslator do.
+// Returns true if the regions changed.
+bool Rebalance(const TMap<VirtualWorkerId, UAbstractLBStrategy*>& Strategies, const TMap<VirtualWorkerId, int32>& ActorsPerWorker)
+{
+	TMap<VirtualWorkerId, float> LoadPerVirtualWorker;
+	for (const TPair<VirtualWorkerId, UAbstractLBStrategy*>& Worker : Strategies)
+	{
+		LoadPerVirtualWorker.Add(Worker.Key, static_cast<float>(ActorsPerWorker.FindRef(Worker.Key)));
+	}
+
+	const VirtualWorkerId TranslationVirtualWorkerId = SpatialConstants::INVALID_VIRTUAL_WORKER_ID + 1;
+	UAbstractLBStrategy* TranslationStrategy = Strategies[TranslationVirtualWorkerId];
+	if (!TranslationStrategy->RebalanceFromLoads(LoadPerVirtualWorker))
+	{
+		return false;
+	}
+
+	Schema_ComponentData* TranslationData = Schema_CreateComponentData();
+	Schema_Object* TranslationObject = Schema_GetComponentDataFields(TranslationData);
+	TranslationStrategy->WritePartitionToSchema(TranslationObject);
+
+	for (const TPair<VirtualWorkerId, UAbstractLBStrategy*>& Worker : Strategies)
+	{
+		if (Worker.Key != TranslationVirtualWorkerId)
+		{
+			Worker.Value->ApplyPartitionFromSchema(TranslationObject);
+		}
+	}
+
+	Schema_DestroyComponentData(TranslationData);
+
+	return true;
+}
+
+} // anonymous namespace
+
+bool FLBTrace::ParseCSV(const FString& CSV, FLBTrace& OutTrace, FString& OutError)
+{
+	TArray<FString> Lines;
+	CSV.ParseIntoArrayLines(Lines, false);
+
+	for (int32 LineIndex = 0; LineIndex < Lines.Num(); LineIndex++)
+	{
+		const FString Line = Lines[LineIndex].TrimStartAndEnd();
+		if (Line.IsEmpty())
+		{
+			continue;
+		}
+
+		FSample Sample;
+		if (!ParseSample(Line, Sample))
+		{
+			if (LineIndex == 0)
+			{
+				// A header.
+				continue;
+			}
+
+			OutError = FString::Printf(TEXT("Line %d is not a \"Time,ActorId,X,Y,Z\" sample: %s"), LineIndex + 1, *Line);
+			return false;
+		}
+
+		OutTrace.AddSample(Sample.Time, Sample.ActorId, Sample.Location);
+	}
+
+	return true;
+}
+
+bool FLBTrace::LoadCSVFile(const FString& Path, FLBTrace& OutTrace, FString& OutError)
+{
+	FString CSV;
+	if (!FFileHelper::LoadFileToString(CSV, *Path))
+	{
+		OutError = FString::Printf(TEXT("Could not read trace file %s"), *Path);
+		return false;
+	}
+
+	return ParseCSV(CSV, OutTrace, OutError);
+}
+
+FString FLBTrace::ToCSV() const
+{
+	FString CSV = TEXT("Time,ActorId,X,Y,Z\n");
+	for (const FSample& Sample : GetSamples())
+	{
+		CSV += FString::Printf(TEXT("%f,%d,%f,%f,%f\n"), Sample.Time, Sample.ActorId, Sample.Location.X, Sample.Location.Y, Sample.Location.Z);
+	}
+	return CSV;
+}
+
+void FLBTrace::AddSample(double Time, int32 ActorId, const FVector& Location)
+{
+	bSorted = bSorted && (Samples.Num() == 0 || Samples.Last().Time <= Time);
+	Samples.Add(FSample{ Time, ActorId, Location });
+}
+
+void FLBTrace::RecordWorld(UWorld* World, double Time)
+{
+	check(World != nullptr);
+
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		const AActor* Actor = *It;
+		if (!Actor->GetIsReplicated())
+		{
+			continue;
+		}
+
+		const int32* ExistingActorId = RecordedActorIds.Find(Actor);
+		const int32 ActorId = ExistingActorId != nullptr ? *ExistingActorId : RecordedActorIds.Add(Actor, RecordedActorIds.Num());
+		AddSample(Time, ActorId, SpatialGDK::GetActorSpatialPosition(Actor));
+	}
+}
+
+const TArray<FLBTrace::FSample>& FLBTrace::GetSamples() const
+{
+	if (!bSorted)
+	{
+		Samples.StableSort([](const FSample& A, const FSample& B) { return A.Time < B.Time; });
+		bSorted = true;
+	}
+	return Samples;
+}
+
+FString FLBStrategySimulator::FReport::ToString() const
+{
+	FString Result = FString::Printf(TEXT("%d actors over %d frames (%.2f s): %lld authority intent changes, %lld handovers (%.2f per second), %.1f cross-boundary interest per frame\n"),
+		NumActors, NumFrames, DurationSeconds, NumAuthorityIntentChanges, NumHandovers, HandoversPerSecond, AverageCrossBoundaryInterest);
+	Result += FString::Printf(TEXT("  %lld handovers prefetched, %.3f s from gaining authority to first replication on average, %lld replications deferred by the rate limit\n"),
+		NumPrefetchedHandovers, AverageTimeToFirstReplicationSeconds, NumReplicationsDeferred);
+	Result += FString::Printf(TEXT("  %lld rebalances\n"), NumRebalances);
+
+	for (const TPair<VirtualWorkerId, FWorkerReport>& Worker : Workers)
+	{
+		Result += FString::Printf(TEXT("  Virtual worker %d: %.1f actors on average, %d at peak, %.1f cross-boundary interest per frame\n"),
+			Worker.Key, Worker.Value.AverageActors, Worker.Value.PeakActors, Worker.Value.AverageCrossBoundaryInterest);
+	}
+
+	return Result;
+}
+
+FLBStrategySimulator::FLBStrategySimulator(FStrategyFactory InStrategyFactory)
+	: FLBStrategySimulator(MoveTemp(InStrategyFactory), FSettings())
+{
+}
+
+FLBStrategySimulator::FLBStrategySimulator(FStrategyFactory InStrategyFactory, const FSettings& InSettings)
+	: StrategyFactory(MoveTemp(InStrategyFactory))
+	, Settings(InSettings)
+{
+}
+
+FLBStrategySimulator::FReport FLBStrategySimulator::Run(const FLBTrace& Trace) const
+{
+	FReport Report;
+
+	const TArray<FLBTrace::FSample>& Samples = Trace.GetSamples();
+	if (Samples.Num() == 0)
+	{
+		return Report;
+	}
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	double Now = Samples[0].Time;
+
+	// One strategy per virtual worker, as each server worker would have, all timed by the trace.
+	TMap<VirtualWorkerId, UAbstractLBStrategy*> Strategies;
+	VirtualWorkerId NumVirtualWorkers = 0;
+	do
+	{
+		UAbstractLBStrategy* Strategy = StrategyFactory(World);
+		check(Strategy != nullptr);
+		Strategy->AddToRoot();
+		Strategy->Init();
+
+		if (NumVirtualWorkers == 0)
+		{
+			NumVirtualWorkers = Strategy->GetMinimumRequiredWorkers();
+		}
+
+		const VirtualWorkerId LocalVirtualWorkerId = SpatialConstants::INVALID_VIRTUAL_WORKER_ID + 1 + Strategies.Num();
+		Strategy->SetVirtualWorkerIds(SpatialConstants::INVALID_VIRTUAL_WORKER_ID + 1, NumVirtualWorkers);
+		Strategy->SetLocalVirtualWorkerId(LocalVirtualWorkerId);
+		Strategy->SetClock([&Now]() { return Now; });
+		Strategies.Add(LocalVirtualWorkerId, Strategy);
+	} while (Strategies.Num() < static_cast<int32>(NumVirtualWorkers));
+
+	UE_LOG(LogLBStrategySimulator, Log, TEXT("Simulating %d samples on %d virtual workers."), Samples.Num(), NumVirtualWorkers);
+
+	TMap<int32, FSimulatedActor> Actors;
+	TMap<VirtualWorkerId, int64> TotalActors;
+	TMap<VirtualWorkerId, int64> TotalCrossBoundaryInterest;
+	TMap<VirtualWorkerId, int32> ActorsThisFrame;
+	double TotalTimeToFirstReplication = 0.0;
+	int64 NumFirstReplications = 0;
+	const bool bHandoverPrefetch = Settings.HandoverPrefetchLookaheadSeconds > 0.f;
+	double LastPrefetchEvaluationTime = TNumericLimits<double>::Lowest();
+	const float RebalanceIntervalSeconds = Strategies[SpatialConstants::INVALID_VIRTUAL_WORKER_ID + 1]->GetRebalanceInterval();
+	double LastRebalanceTime = Now;
+
+	int32 SampleIndex = 0;
+	int32 Frame = 0;
+	for (; SampleIndex < Samples.Num(); Frame++)
+	{
+		Now = Samples[SampleIndex].Time;
+
+		// Move the Actors sampled this frame. New ones start on the worker the strategy picks, as if they were spawned there.
+		for (; SampleIndex < Samples.Num() && Samples[SampleIndex].Time == Now; SampleIndex++)
+		{
+			const FLBTrace::FSample& Sample = Samples[SampleIndex];
+			if (FSimulatedActor* SimulatedActor = Actors.Find(Sample.ActorId))
+			{
+				// Strategies predicting where an Actor is heading read its velocity from the root component.
+				const double DeltaTime = Now - SimulatedActor->LastSampleTime;
+				if (DeltaTime > 0.0)
+				{
+					USceneComponent* Root = SimulatedActor->Actor->GetRootComponent();
+					Root->ComponentVelocity = (Sample.Location - Root->GetComponentLocation()) / DeltaTime;
+				}
+				SimulatedActor->Actor->SetActorLocation(Sample.Location);
+				SimulatedActor->LastSampleTime = Now;
+			}
+			else
+			{
+				AActor* Actor = SpawnSimulatedActor(*World, Sample.Location);
+				Actors.Add(Sample.ActorId, FSimulatedActor{ Actor, SpatialConstants::INVALID_VIRTUAL_WORKER_ID, SpatialConstants::INVALID_VIRTUAL_WORKER_ID, Frame,
+					Now, Frame, SpatialConstants::INVALID_VIRTUAL_WORKER_ID, Now, false });
+			}
+		}
+
+		// Enforce the authority intents which have stood for the enforcer latency, so the gaining workers replicate this frame.
+		for (TPair<int32, FSimulatedActor>& Pair : Actors)
+		{
+			FSimulatedActor& SimulatedActor = Pair.Value;
+
+			if (SimulatedActor.Authority == SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
+			{
+				// Outside every worker's region so far.
+				SimulatedActor.Authority = Strategies[SpatialConstants::INVALID_VIRTUAL_WORKER_ID + 1]->WhoShouldHaveAuthority(*SimulatedActor.Actor);
+				SimulatedActor.Intent = SimulatedActor.Authority;
+				SimulatedActor.NextReplicationFrame = GetNextReplicationFrame(Frame, Pair.Key, Settings.ReplicationIntervalFrames);
+				continue;
+			}
+
+			if (SimulatedActor.Intent != SimulatedActor.Authority && Frame - SimulatedActor.IntentFrame >= Settings.EnforcerLatencyFrames)
+			{
+				SimulatedActor.Authority = SimulatedActor.Intent;
+				Report.NumHandovers++;
+
+				SimulatedActor.AuthorityGainTime = Now;
+				SimulatedActor.bAwaitingFirstReplication = true;
+				if (SimulatedActor.PrewarmedVirtualWorkerId == SimulatedActor.Authority)
+				{
+					// A prewarmed channel forces a net update as authority arrives, so the Actor is due this frame, though it still
+					// competes for the replication budget.
+					Report.NumPrefetchedHandovers++;
+					SimulatedActor.NextReplicationFrame = Frame;
+				}
+				else
+				{
+					SimulatedActor.NextReplicationFrame = GetNextReplicationFrame(Frame - 1, Pair.Key, Settings.ReplicationIntervalFrames);
+				}
+				SimulatedActor.PrewarmedVirtualWorkerId = SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+			}
+		}
+
+		// Each worker replicates the Actors it is authoritative over which are due, the longest overdue first, up to the rate limit.
+		for (const TPair<VirtualWorkerId, UAbstractLBStrategy*>& Worker : Strategies)
+		{
+			UAbstractLBStrategy* AuthoritativeStrategy = Worker.Value;
+
+			TArray<TPair<int32, FSimulatedActor*>> DueActors;
+			for (TPair<int32, FSimulatedActor>& Pair : Actors)
+			{
+				if (Pair.Value.Authority == Worker.Key && Frame >= Pair.Value.NextReplicationFrame)
+				{
+					DueActors.Emplace(Pair.Key, &Pair.Value);
+				}
+			}
+			DueActors.Sort([](const TPair<int32, FSimulatedActor*>& A, const TPair<int32, FSimulatedActor*>& B)
+			{
+				return A.Value->NextReplicationFrame != B.Value->NextReplicationFrame ? A.Value->NextReplicationFrame < B.Value->NextReplicationFrame : A.Key < B.Key;
+			});
+
+			const int32 NumToReplicate = Settings.ActorReplicationRateLimit > 0 ? FMath::Min(DueActors.Num(), Settings.ActorReplicationRateLimit) : DueActors.Num();
+			Report.NumReplicationsDeferred += DueActors.Num() - NumToReplicate;
+
+			for (int32 DueIndex = 0; DueIndex < NumToReplicate; DueIndex++)
+			{
+				const int32 ActorId = DueActors[DueIndex].Key;
+				FSimulatedActor& SimulatedActor = *DueActors[DueIndex].Value;
+
+				if (SimulatedActor.bAwaitingFirstReplication)
+				{
+					TotalTimeToFirstReplication += Now - SimulatedActor.AuthorityGainTime;
+					NumFirstReplications++;
+					SimulatedActor.bAwaitingFirstReplication = false;
+				}
+
+				// The authoritative worker only reconsiders an Actor while the intent is still its own.
+				if (SimulatedActor.Intent == SimulatedActor.Authority && !AuthoritativeStrategy->ShouldKeepAuthority(*SimulatedActor.Actor))
+				{
+					const VirtualWorkerId NewIntent = AuthoritativeStrategy->WhoShouldHaveAuthority(*SimulatedActor.Actor);
+					if (NewIntent != SpatialConstants::INVALID_VIRTUAL_WORKER_ID && NewIntent != SimulatedActor.Authority)
+					{
+						SimulatedActor.Intent = NewIntent;
+						SimulatedActor.IntentFrame = Frame;
+						Report.NumAuthorityIntentChanges++;
+					}
+				}
+
+				// An Actor heading for another worker is replicated every frame, as USpatialActorChannel::PrefetchHandover does, so
+				// its handover data is ready ahead of the intent.
+				const VirtualWorkerId PredictedAuthority = bHandoverPrefetch
+					? AuthoritativeStrategy->PredictWhoShouldHaveAuthority(*SimulatedActor.Actor, Settings.HandoverPrefetchLookaheadSeconds)
+					: SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+				const bool bHeadingElsewhere = PredictedAuthority != SpatialConstants::INVALID_VIRTUAL_WORKER_ID && PredictedAuthority != SimulatedActor.Authority;
+				SimulatedActor.NextReplicationFrame = bHeadingElsewhere ? Frame + 1 : GetNextReplicationFrame(Frame, ActorId, Settings.ReplicationIntervalFrames);
+			}
+		}
+
+		// Each worker prewarms the channels of the Actors its own strategy predicts it will gain, and cancels the prewarm of those
+		// it no longer does, as USpatialNetDriver::TickHandoverPrefetch does.
+		if (bHandoverPrefetch && Now - LastPrefetchEvaluationTime >= Settings.HandoverPrefetchLookaheadSeconds / PREFETCH_EVALUATIONS_PER_LOOKAHEAD)
+		{
+			LastPrefetchEvaluationTime = Now;
+			for (TPair<int32, FSimulatedActor>& Pair : Actors)
+			{
+				FSimulatedActor& SimulatedActor = Pair.Value;
+				for (const TPair<VirtualWorkerId, UAbstractLBStrategy*>& Worker : Strategies)
+				{
+					if (Worker.Key == SimulatedActor.Authority)
+					{
+						continue;
+					}
+
+					if (Worker.Value->PredictWhoShouldHaveAuthority(*SimulatedActor.Actor, Settings.HandoverPrefetchLookaheadSeconds) == Worker.Key)
+					{
+						SimulatedActor.PrewarmedVirtualWorkerId = Worker.Key;
+					}
+					else if (SimulatedActor.PrewarmedVirtualWorkerId == Worker.Key)
+					{
+						SimulatedActor.PrewarmedVirtualWorkerId = SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+					}
+				}
+			}
+		}
+
+		ActorsThisFrame.Reset();
+		for (const TPair<int32, FSimulatedActor>& Pair : Actors)
+		{
+			if (Pair.Value.Authority != SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
+			{
+				ActorsThisFrame.FindOrAdd(Pair.Value.Authority)++;
+			}
+		}
+
+		const bool bRebalanceDue = Settings.RebalanceIntervalFrames > 0
+			? (Frame + 1) % Settings.RebalanceIntervalFrames == 0
+			: RebalanceIntervalSeconds > 0.f && Now - LastRebalanceTime >= RebalanceIntervalSeconds;
+		if (bRebalanceDue)
+		{
+			LastRebalanceTime = Now;
+			if (Rebalance(Strategies, ActorsThisFrame))
+			{
+				Report.NumRebalances++;
+			}
+		}
+
+		for (const TPair<VirtualWorkerId, UAbstractLBStrategy*>& Worker : Strategies)
+		{
+			const int32 NumActors = ActorsThisFrame.FindRef(Worker.Key);
+			TotalActors.FindOrAdd(Worker.Key) += NumActors;
+
+			FWorkerReport& WorkerReport = Report.Workers.FindOrAdd(Worker.Key);
+			WorkerReport.PeakActors = FMath::Max(WorkerReport.PeakActors, NumActors);
+
+			const SpatialGDK::QueryConstraint Interest = Worker.Value->GetWorkerInterestQueryConstraint();
+			int64& CrossBoundaryInterest = TotalCrossBoundaryInterest.FindOrAdd(Worker.Key);
+			for (const TPair<int32, FSimulatedActor>& Pair : Actors)
+			{
+				if (Pair.Value.Authority != Worker.Key && IsInConstraint(Interest, SpatialGDK::GetActorSpatialPosition(Pair.Value.Actor)))
+				{
+					CrossBoundaryInterest++;
+				}
+			}
+		}
+	}
+
+	Report.NumFrames = Frame;
+	Report.NumActors = Actors.Num();
+	Report.DurationSeconds = Samples.Last().Time - Samples[0].Time;
+	Report.HandoversPerSecond = Report.DurationSeconds > 0.0 ? static_cast<float>(Report.NumHandovers / Report.DurationSeconds) : 0.f;
+
+	int64 AllCrossBoundaryInterest = 0;
+	for (TPair<VirtualWorkerId, FWorkerReport>& Worker : Report.Workers)
+	{
+		Worker.Value.AverageActors = static_cast<float>(TotalActors[Worker.Key]) / Frame;
+		Worker.Value.AverageCrossBoundaryInterest = static_cast<float>(TotalCrossBoundaryInterest[Worker.Key]) / Frame;
+		AllCrossBoundaryInterest += TotalCrossBoundaryInterest[Worker.Key];
+	}
+	Report.AverageCrossBoundaryInterest = static_cast<float>(AllCrossBoundaryInterest) / Frame;
+	Report.AverageTimeToFirstReplicationSeconds = NumFirstReplications > 0 ? static_cast<float>(TotalTimeToFirstReplication / NumFirstReplications) : 0.f;
+
+	for (const TPair<VirtualWorkerId, UAbstractLBStrategy*>& Worker : Strategies)
+	{
+		Worker.Value->RemoveFromRoot();
+	}
+	World->DestroyWorld(false);
+
+	return Report;
+}
+
+bool FLBStrategySimulator::IsInConstraint(const SpatialGDK::QueryConstraint& Constraint, const FVector& Location)
+{
+	if (!Constraint.IsValid())
+	{
+		return false;
+	}
+
+	const SpatialGDK::Coordinates Coords = SpatialGDK::Coordinates::FromFVector(Location);
+
+	if (Constraint.SphereConstraint.IsSet())
+	{
+		const SpatialGDK::SphereConstraint& Sphere = Constraint.SphereConstraint.GetValue();
+		if (FVector::Dist(SpatialGDK::Coordinates::ToFVector(Sphere.Center), Location) > Sphere.Radius * 100.0)
+		{
+			return false;
+		}
+	}
+
+	if (Constraint.CylinderConstraint.IsSet())
+	{
+		const SpatialGDK::CylinderConstraint& Cylinder = Constraint.CylinderConstraint.GetValue();
+		if (FVector::Dist2D(SpatialGDK::Coordinates::ToFVector(Cylinder.Center), Location) > Cylinder.Radius * 100.0)
+		{
+			return false;
+		}
+	}
+
+	if (Constraint.BoxConstraint.IsSet())
+	{
+		const SpatialGDK::BoxConstraint& Box = Constraint.BoxConstraint.GetValue();
+		if (FMath::Abs(Coords.X - Box.Center.X) > Box.EdgeLength.X / 2.0
+			|| FMath::Abs(Coords.Y - Box.Center.Y) > Box.EdgeLength.Y / 2.0
+			|| FMath::Abs(Coords.Z - Box.Center.Z) > Box.EdgeLength.Z / 2.0)
+		{
+			return false;
+		}
+	}
+
+	for (const SpatialGDK::QueryConstraint& AndConstraint : Constraint.AndConstraint)
+	{
+		if (!IsInConstraint(AndConstraint, Location))
+		{
+			return false;
+		}
+	}
+
+	if (Constraint.OrConstraint.Num() > 0)
+	{
+		bool bInAny = false;
+		for (const SpatialGDK::QueryConstraint& OrConstraint : Constraint.OrConstraint)
+		{
+			bInAny = bInAny || IsInConstraint(OrConstraint, Location);
+		}
+		if (!bInAny)
+		{
+			return false;
+		}
+	}
+
+	// Constraints on anything but location are not simulated.
+	return Constraint.SphereConstraint.IsSet() || Constraint.CylinderConstraint.IsSet() || Constraint.BoxConstraint.IsSet()
+		|| Constraint.AndConstraint.Num() > 0 || Constraint.OrConstraint.Num() > 0;
+}
@@ -12,6 +12,7 @@
 #include "Utils/CodeWriter.h"
 #include "Utils/ComponentIdGenerator.h"
 #include "Utils/DataTypeUtilities.h"
+#include "Utils/RepLayoutUtils.h"
 #include "SpatialGDKEditorSchemaGenerator.h"
 
 using namespace SpatialGDKEditor::Schema;
@@ -119,6 +120,12 @@ FString PropertyToSchemaType(UProperty* Property)
 	return DataType;
 }
 
+bool IsFastArrayWithItemDeltas(UProperty* Property)
+{
+	UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property);
+	return ArrayProperty != nullptr && GetDefault<USpatialGDKSettings>()->bEnableFastArrayItemDeltas && GetFastArraySerializerProperty(ArrayProperty) != nullptr;
+}
+
 void WriteSchemaRepField(FCodeWriter& Writer, const TSharedPtr<FUnrealProperty> RepProp, const int FieldCounter)
 {
 	Writer.Printf("{0} {1} = {2};",
@@ -126,6 +133,15 @@ void WriteSchemaRepField(FCodeWriter& Writer, const TSharedPtr<FUnrealProperty>
 		*SchemaFieldName(RepProp),
 		FieldCounter
 	);
+
+	// FastArrays replicated with item deltas also have a field holding the items changed since the whole array was last written.
+	if (IsFastArrayWithItemDeltas(RepProp->Property))
+	{
+		Writer.Printf("FastArrayItemDelta {0}_item_delta = {1};",
+			*SchemaFieldName(RepProp),
+			FieldCounter + SpatialConstants::FAST_ARRAY_ITEM_DELTA_FIELD_ID_OFFSET
+		);
+	}
 }
 
 void WriteSchemaHandoverField(FCodeWriter& Writer, const TSharedPtr<FUnrealProperty> HandoverProp, const int FieldCounter)
@@ -369,7 +385,7 @@ void GenerateSubobjectSchema(FComponentIdGenerator& IdGenerator, UClass* Class,
 		for (auto& PropertyPair : PropertyGroup.Value)
 		{
 			UProperty* Property = PropertyPair.Value->Property;
-			if (Property->IsA<UObjectPropertyBase>())
+			if (Property->IsA<UObjectPropertyBase>() || IsFastArrayWithItemDeltas(Property))
 			{
 				bShouldIncludeCoreTypes = true;
 			}
@@ -0,0 +1,146 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "SpatialCommonTypes.h"
+
+#include "CoreMinimal.h"
+#include "Math/Vector.h"
+#include "Templates/Function.h"
+#include "UObject/WeakObjectPtr.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogLBStrategySimulator, Log, All)
+
+class AActor;
+class UAbstractLBStrategy;
+class UWorld;
+
+namespace SpatialGDK
+{
+struct QueryConstraint;
+}
+
+/**
+ * A recorded workload: the positions of a set of Actors, sampled over time.
+ *
+ * As CSV, each line is a sample "Time,ActorId,X,Y,Z", with Time in seconds and the location in Unreal units.
+ * A first line which is not a sample, such as a header, is skipped.
+ */
+class SPATIALGDKEDITOR_API FLBTrace
+{
+public:
+	struct FSample
+	{
+		double Time;
+		int32 ActorId;
+		FVector Location;
+	};
+
+	static bool ParseCSV(const FString& CSV, FLBTrace& OutTrace, FString& OutError);
+	static bool LoadCSVFile(const FString& Path, FLBTrace& OutTrace, FString& OutError);
+	FString ToCSV() const;
+
+	void AddSample(double Time, int32 ActorId, const FVector& Location);
+
+	// Samples the location of every replicated Actor in the world, so a session can be recorded and replayed later.
+	void RecordWorld(UWorld* World, double Time);
+
+	// Sorted by time, then in the order they were added.
+	const TArray<FSample>& GetSamples() const;
+
+private:
+	mutable TArray<FSample> Samples;
+	mutable bool bSorted = true;
+
+	TMap<TWeakObjectPtr<const AActor>, int32> RecordedActorIds;
+};
+
+/**
+ * Replays an FLBTrace through a load balancing strategy without a deployment, to tune strategies and compare them.
+ *
+ * One instance of the strategy is created per virtual worker, as it would be on each server worker. Every frame of the trace:
+ * 1. Actors are moved to their sampled location. An Actor starts out on the virtual worker WhoShouldHaveAuthority chooses.
+ * 2. An authority intent which has stood for EnforcerLatencyFrames frames is enforced: the Actor's ACL is updated, and
+ *    authority is handed over to the new worker.
+ * 3. Each worker replicates its Actors which are due, up to ActorReplicationRateLimit, checking ShouldKeepAuthority for each
+ *    and if false setting the Actor's authority intent to WhoShouldHaveAuthority, as USpatialActorChannel does.
+ * 4. Each worker's interest, from GetWorkerInterestQueryConstraint, is checked against the Actors it is not authoritative over.
+ * 5. When a rebalance is due, the strategy of virtual worker 1, standing in for the worker authoritative over the translation,
+ *    rebalances from the number of Actors each worker is authoritative over with RebalanceFromLoads. If the regions changed,
+ *    it writes them with WritePartitionToSchema and every other worker applies them with ApplyPartitionFromSchema.
+ *
+ * Actors are replicated every ReplicationIntervalFrames frames, staggered by Actor, as NetUpdateFrequency would. Past the rate
+ * limit, the Actors which have waited longest are replicated first and the rest wait for the next frame. With a
+ * HandoverPrefetchLookaheadSeconds, handover prefetch is simulated as USpatialNetDriver does it: an Actor the authoritative
+ * worker predicts is heading for another worker is replicated every frame, and every other worker evaluates its own prediction
+ * to prewarm or cancel the prewarm of the Actor's channel. A prewarmed channel makes the Actor due as soon as authority arrives.
+ * Actors' velocities are taken from their consecutive samples.
+ *
+ * Only spatial constraints (sphere, cylinder, box and their combinations) are evaluated for interest.
+ */
+class SPATIALGDKEDITOR_API FLBStrategySimulator
+{
+public:
+	// Creates an uninitialized strategy. Outer is the simulation world, for strategies which read its settings.
+	using FStrategyFactory = TFunction<UAbstractLBStrategy*(UObject* Outer)>;
+
+	struct FSettings
+	{
+		// How many frames the enforcer takes to turn an authority intent into an ACL update.
+		int32 EnforcerLatencyFrames = 1;
+		// How many frames apart each Actor is replicated.
+		int32 ReplicationIntervalFrames = 1;
+		// As USpatialGDKSettings::HandoverPrefetchLookaheadSeconds. 0 disables handover prefetch.
+		float HandoverPrefetchLookaheadSeconds = 0.f;
+		// As USpatialGDKSettings::ActorReplicationRateLimit: how many Actors each worker replicates per frame. 0 is unlimited.
+		int32 ActorReplicationRateLimit = 0;
+		// How many frames apart the regions are rebalanced. 0 rebalances every GetRebalanceInterval of the strategy, timed by the trace.
+		int32 RebalanceIntervalFrames = 0;
+	};
+
+	struct FWorkerReport
+	{
+		float AverageActors = 0.f;
+		int32 PeakActors = 0;
+		// Actors this worker is interested in but not authoritative over, on average per frame.
+		float AverageCrossBoundaryInterest = 0.f;
+	};
+
+	struct FReport
+	{
+		int32 NumFrames = 0;
+		int32 NumActors = 0;
+		double DurationSeconds = 0.0;
+
+		TMap<VirtualWorkerId, FWorkerReport> Workers;
+
+		int64 NumAuthorityIntentChanges = 0;
+		// Each enforced intent updates the Actor's ACL and hands it over, so these are also the ACL updates.
+		int64 NumHandovers = 0;
+		float HandoversPerSecond = 0.f;
+		float AverageCrossBoundaryInterest = 0.f;
+
+		// Handovers the gaining worker had predicted, and so had prewarmed the Actor's channel for.
+		int64 NumPrefetchedHandovers = 0;
+		// Due replications put off to a later frame by the rate limit.
+		int64 NumReplicationsDeferred = 0;
+		// From a worker gaining authority over an Actor to first replicating it, on average over the handovers.
+		float AverageTimeToFirstReplicationSeconds = 0.f;
+
+		// Rebalances which changed the regions, and so were applied by every worker.
+		int64 NumRebalances = 0;
+
+		FString ToString() const;
+	};
+
+	explicit FLBStrategySimulator(FStrategyFactory InStrategyFactory);
+	FLBStrategySimulator(FStrategyFactory InStrategyFactory, const FSettings& InSettings);
+
+	FReport Run(const FLBTrace& Trace) const;
+
+	static bool IsInConstraint(const SpatialGDK::QueryConstraint& Constraint, const FVector& Location);
+
+private:
+	FStrategyFactory StrategyFactory;
+	FSettings Settings;
+};
@@ -0,0 +1,70 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "SimulateLoadBalancingCommandlet.h"
+#include "SpatialGDKEditorCommandletPrivate.h"
+
+#include "LoadBalancing/AbstractLBStrategy.h"
+#include "LoadBalancing/LBStrategySimulator.h"
+
+USimulateLoadBalancingCommandlet::USimulateLoadBalancingCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 USimulateLoadBalancingCommandlet::Main(const FString& Args)
+{
+	UE_LOG(LogSpatialGDKEditorCommandlet, Display, TEXT("Load Balancing Simulation Commandlet Started"));
+
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> Params;
+	ParseCommandLine(*Args, Tokens, Switches, Params);
+
+	const FString* TracePath = Params.Find(TEXT("Trace"));
+	const FString* StrategyPath = Params.Find(TEXT("Strategy"));
+	if (TracePath == nullptr || StrategyPath == nullptr)
+	{
+		UE_LOG(LogSpatialGDKEditorCommandlet, Error, TEXT("Usage: -run=SimulateLoadBalancing -Trace=<CSV file> -Strategy=<strategy class path> [-EnforcerLatencyFrames=<frames>] [-RebalanceIntervalFrames=<frames>]"));
+		return 1;
+	}
+
+	UClass* StrategyClass = LoadClass<UAbstractLBStrategy>(nullptr, **StrategyPath);
+	if (StrategyClass == nullptr || StrategyClass->HasAnyClassFlags(CLASS_Abstract))
+	{
+		UE_LOG(LogSpatialGDKEditorCommandlet, Error, TEXT("%s is not a load balancing strategy class"), **StrategyPath);
+		return 1;
+	}
+
+	FLBTrace Trace;
+	FString Error;
+	if (!FLBTrace::LoadCSVFile(*TracePath, Trace, Error))
+	{
+		UE_LOG(LogSpatialGDKEditorCommandlet, Error, TEXT("%s"), *Error);
+		return 1;
+	}
+
+	FLBStrategySimulator::FSettings Settings;
+	if (const FString* EnforcerLatencyFrames = Params.Find(TEXT("EnforcerLatencyFrames")))
+	{
+		Settings.EnforcerLatencyFrames = FCString::Atoi(**EnforcerLatencyFrames);
+	}
+	if (const FString* RebalanceIntervalFrames = Params.Find(TEXT("RebalanceIntervalFrames")))
+	{
+		Settings.RebalanceIntervalFrames = FCString::Atoi(**RebalanceIntervalFrames);
+	}
+
+	FLBStrategySimulator Simulator([StrategyClass](UObject* Outer)
+	{
+		return NewObject<UAbstractLBStrategy>(Outer, StrategyClass);
+	}, Settings);
+
+	const FLBStrategySimulator::FReport Report = Simulator.Run(Trace);
+	UE_LOG(LogSpatialGDKEditorCommandlet, Display, TEXT("%s with %s:\n%s"), **TracePath, *StrategyClass->GetName(), *Report.ToString());
+
+	UE_LOG(LogSpatialGDKEditorCommandlet, Display, TEXT("Load Balancing Simulation Commandlet Complete"));
+
+	return 0;
+}
@@ -0,0 +1,24 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+
+#include "SimulateLoadBalancingCommandlet.generated.h"
+
+/**
+ * Replays a recorded workload through a load balancing strategy, and logs per-worker load, handovers and interest.
+ * Usage: -run=SimulateLoadBalancing -Trace=<CSV file> -Strategy=<strategy class path> [-EnforcerLatencyFrames=<frames>] [-RebalanceIntervalFrames=<frames>]
+ * The strategy is configured from its class defaults, so a Blueprint subclass can hold the settings to try.
+ */
+UCLASS()
+class USimulateLoadBalancingCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	USimulateLoadBalancingCommandlet();
+
+public:
+	virtual int32 Main(const FString& Params) override;
+};
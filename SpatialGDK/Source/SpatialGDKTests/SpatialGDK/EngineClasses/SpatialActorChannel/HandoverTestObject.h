@@ -0,0 +1,57 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+
+#include "HandoverTestObject.generated.h"
+
+UENUM()
+enum class EHandoverTestEnum : uint8
+{
+	First,
+	Second,
+	Third
+};
+
+/**
+ * This class is for testing purposes only.
+ * Mixes POD and non-POD handover properties, with gaps between some of them.
+ */
+UCLASS()
+class UHandoverTestObject : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(Handover)
+	int32 IntA;
+
+	UPROPERTY(Handover)
+	int32 IntB;
+
+	UPROPERTY(Handover)
+	uint8 Byte;
+
+	UPROPERTY(Handover)
+	EHandoverTestEnum Enum;
+
+	UPROPERTY(Handover)
+	int64 Int64Array[3];
+
+	UPROPERTY(Handover)
+	float Float;
+
+	UPROPERTY(Handover)
+	FString String;
+
+	UPROPERTY(Handover)
+	int16 Short;
+
+	UPROPERTY()
+	int32 NotHandover;
+
+	UPROPERTY(Handover)
+	uint32 AfterGap;
+};
@@ -0,0 +1,27 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+
+#include "PrewarmTestActor.generated.h"
+
+/**
+ * This class is for testing purposes only.
+ * Counts the net updates forced on it.
+ */
+UCLASS(NotPlaceable)
+class APrewarmTestActor : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	virtual void ForceNetUpdate() override
+	{
+		NumForcedNetUpdates++;
+		Super::ForceNetUpdate();
+	}
+
+	int32 NumForcedNetUpdates = 0;
+};
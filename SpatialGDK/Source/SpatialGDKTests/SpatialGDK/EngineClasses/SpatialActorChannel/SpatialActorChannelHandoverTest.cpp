@@ -0,0 +1,164 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "EngineClasses/SpatialActorChannel.h"
+#include "HandoverTestObject.h"
+#include "Interop/SpatialClassInfoManager.h"
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+
+#define HANDOVER_TEST(TestName) \
+	GDK_TEST(Core, SpatialActorChannelHandover, TestName)
+
+namespace
+{
+
+// The per property diff used before handover properties were grouped into ranges, kept as a reference.
+FHandoverChangeState GetReferenceHandoverChangeList(const FClassInfo& ClassInfo, TArray<uint8>& ShadowData, const UObject* Object, bool bForceAllChanged)
+{
+	FHandoverChangeState HandoverChanged;
+
+	uint32 ShadowDataOffset = 0;
+	for (const FHandoverPropertyInfo& PropertyInfo : ClassInfo.HandoverProperties)
+	{
+		ShadowDataOffset = Align(ShadowDataOffset, PropertyInfo.Property->GetMinAlignment());
+
+		const uint8* Data = (const uint8*)Object + PropertyInfo.Offset;
+		uint8* StoredData = ShadowData.GetData() + ShadowDataOffset;
+		if (bForceAllChanged || !PropertyInfo.Property->Identical(StoredData, Data))
+		{
+			HandoverChanged.Add(PropertyInfo.Handle);
+			PropertyInfo.Property->CopySingleValue(StoredData, Data);
+		}
+		ShadowDataOffset += PropertyInfo.Property->ElementSize;
+	}
+
+	return HandoverChanged;
+}
+
+void DestroyHandoverShadowData(const FClassInfo& ClassInfo, TArray<uint8>& ShadowData)
+{
+	for (const FHandoverPropertyInfo& PropertyInfo : ClassInfo.HandoverProperties)
+	{
+		if (PropertyInfo.ArrayIdx == 0)
+		{
+			PropertyInfo.Property->DestroyValue(ShadowData.GetData() + PropertyInfo.ShadowOffset);
+		}
+	}
+}
+
+void MutateRandomProperties(UHandoverTestObject* Object, FRandomStream& Random)
+{
+	// Only touch a few properties per pass so there is a mix of changed and unchanged ranges.
+	switch (Random.RandRange(0, 9))
+	{
+	case 0: Object->IntA = Random.RandRange(0, 3); break;
+	case 1: Object->IntB = Random.RandRange(0, 3); break;
+	case 2: Object->Byte = static_cast<uint8>(Random.RandRange(0, 3)); break;
+	case 3: Object->Enum = static_cast<EHandoverTestEnum>(Random.RandRange(0, 2)); break;
+	case 4: Object->Int64Array[Random.RandRange(0, 2)] = Random.RandRange(0, 3); break;
+	case 5:
+	{
+		// Include values where Identical and a bitwise compare disagree.
+		const float Values[] = { 0.0f, -0.0f, 1.0f, FMath::Sqrt(-1.0f) };
+		Object->Float = Values[Random.RandRange(0, 3)];
+		break;
+	}
+	case 6: Object->String = FString::Printf(TEXT("Value%d"), Random.RandRange(0, 3)); break;
+	case 7: Object->Short = static_cast<int16>(Random.RandRange(0, 3)); break;
+	case 8: Object->NotHandover = Random.RandRange(0, 3); break;
+	default: Object->AfterGap = static_cast<uint32>(Random.RandRange(0, 3)); break;
+	}
+}
+
+} // anonymous namespace
+
+HANDOVER_TEST(GIVEN_class_with_handover_properties_WHEN_creating_class_info_THEN_pod_properties_are_grouped_into_ranges)
+{
+	FClassInfo Info;
+	USpatialClassInfoManager::CreateHandoverPropertyInfo(UHandoverTestObject::StaticClass(), Info);
+
+	// IntA, IntB, Byte, Enum, 3 x Int64Array, Float, String, Short, AfterGap
+	if (!TestEqual(TEXT("Every static array element is a handover property"), Info.HandoverProperties.Num(), 11))
+	{
+		return false;
+	}
+
+	int32 NextIndex = 0;
+	for (const FHandoverPropertyRange& Range : Info.HandoverPropertyRanges)
+	{
+		TestEqual(TEXT("Ranges cover the handover properties in order"), Range.FirstIndex, NextIndex);
+		NextIndex += Range.Num;
+
+		for (int32 Index = Range.FirstIndex; Index < Range.FirstIndex + Range.Num; Index++)
+		{
+			TestTrue(TEXT("Properties in a range share its POD-ness"), USpatialClassInfoManager::IsBitwiseComparableHandoverProperty(Info.HandoverProperties[Index].Property) == Range.bIsPOD);
+		}
+	}
+	TestEqual(TEXT("Ranges cover every handover property"), NextIndex, Info.HandoverProperties.Num());
+
+	if (!TestTrue(TEXT("POD and non-POD properties are split into ranges"), Info.HandoverPropertyRanges.Num() >= 5))
+	{
+		return false;
+	}
+
+	const FHandoverPropertyRange& FirstRange = Info.HandoverPropertyRanges[0];
+	TestTrue(TEXT("Adjacent integers, bytes and enums form one POD range"), FirstRange.bIsPOD && FirstRange.Num == 4);
+	TestEqual(TEXT("POD range size is the sum of its properties"), FirstRange.Size, 4 + 4 + 1 + 1);
+
+	const FHandoverPropertyRange& ArrayRange = Info.HandoverPropertyRanges[1];
+	TestTrue(TEXT("Static array elements form one POD range"), ArrayRange.bIsPOD && ArrayRange.Num == 3);
+
+	const FHandoverPropertyRange& FloatRange = Info.HandoverPropertyRanges[2];
+	TestTrue(TEXT("Floats are not POD"), !FloatRange.bIsPOD && FloatRange.Num == 1);
+
+	const FHandoverPropertyRange& StringRange = Info.HandoverPropertyRanges[3];
+	TestTrue(TEXT("Strings are not POD"), !StringRange.bIsPOD && StringRange.Num == 1);
+
+	const FHandoverPropertyRange& LastRange = Info.HandoverPropertyRanges.Last();
+	TestTrue(TEXT("A non-handover property splits POD ranges"), LastRange.bIsPOD && LastRange.Num == 1 && LastRange.FirstIndex == Info.HandoverProperties.Num() - 1);
+
+	return true;
+}
+
+HANDOVER_TEST(GIVEN_random_property_changes_WHEN_diffing_handover_properties_THEN_change_lists_match_the_per_property_path)
+{
+	FClassInfo Info;
+	USpatialClassInfoManager::CreateHandoverPropertyInfo(UHandoverTestObject::StaticClass(), Info);
+
+	UHandoverTestObject* Object = NewObject<UHandoverTestObject>();
+
+	TArray<uint8> ReferenceShadowData;
+	TArray<uint8> ShadowData;
+	USpatialActorChannel::InitializeHandoverShadowData(Info, ReferenceShadowData);
+	USpatialActorChannel::InitializeHandoverShadowData(Info, ShadowData);
+
+	TestTrue(TEXT("Initial change lists match"),
+		USpatialActorChannel::GetHandoverChangeList(Info, ShadowData, Object, true) == GetReferenceHandoverChangeList(Info, ReferenceShadowData, Object, true));
+
+	FRandomStream Random(0x5EED);
+	const int32 NumPasses = 500;
+	for (int32 Pass = 0; Pass < NumPasses; Pass++)
+	{
+		const int32 NumMutations = Random.RandRange(0, 3);
+		for (int32 i = 0; i < NumMutations; i++)
+		{
+			MutateRandomProperties(Object, Random);
+		}
+
+		const FHandoverChangeState Expected = GetReferenceHandoverChangeList(Info, ReferenceShadowData, Object, false);
+		const FHandoverChangeState Actual = USpatialActorChannel::GetHandoverChangeList(Info, ShadowData, Object, false);
+
+		if (!TestTrue(FString::Printf(TEXT("Change lists match on pass %d"), Pass), Actual == Expected))
+		{
+			break;
+		}
+	}
+
+	DestroyHandoverShadowData(Info, ReferenceShadowData);
+	DestroyHandoverShadowData(Info, ShadowData);
+
+	return true;
+}
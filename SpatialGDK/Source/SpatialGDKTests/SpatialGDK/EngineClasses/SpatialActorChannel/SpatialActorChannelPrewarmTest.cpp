@@ -0,0 +1,129 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "EngineClasses/SpatialActorChannel.h"
+#include "PrewarmTestActor.h"
+
+#include "CoreMinimal.h"
+#include "Engine/World.h"
+#include "Net/DataReplication.h"
+
+#define PREWARM_TEST(TestName) \
+	GDK_TEST(Core, SpatialActorChannelPrewarm, TestName)
+
+namespace
+{
+
+// A channel on a server worker which isn't authoritative over its Actor yet.
+struct FTestChannel
+{
+	// With bWithReplicator, the channel has created its entity. Such channels keep their shadow data, so they can be prewarmed
+	// without the replication layout a received Actor would need.
+	explicit FTestChannel(bool bWithReplicator)
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false);
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.bNoFail = true;
+		Actor = World->SpawnActor<APrewarmTestActor>(SpawnParams);
+
+		Channel = NewObject<USpatialActorChannel>();
+		Channel->Actor = Actor;
+		Channel->SetServerAuthority(false);
+		if (bWithReplicator)
+		{
+			Channel->bCreatedEntity = true;
+			Channel->ActorReplicator = MakeShared<FObjectReplicator>();
+		}
+	}
+
+	~FTestChannel()
+	{
+		World->DestroyWorld(false);
+	}
+
+	UWorld* World;
+	APrewarmTestActor* Actor;
+	USpatialActorChannel* Channel;
+};
+
+} // anonymous namespace
+
+PREWARM_TEST(GIVEN_prewarmed_channel_WHEN_authority_is_gained_THEN_a_net_update_is_forced_once)
+{
+	FTestChannel Test(true);
+
+	Test.Channel->PrewarmForAuthority();
+	TestTrue(TEXT("The channel is prewarmed"), Test.Channel->IsPrewarmedForAuthority());
+	TestEqual(TEXT("Prewarming doesn't force a net update"), Test.Actor->NumForcedNetUpdates, 0);
+
+	Test.Channel->SetServerAuthority(true);
+	TestEqual(TEXT("Gaining authority forces a net update"), Test.Actor->NumForcedNetUpdates, 1);
+
+	Test.Channel->SetServerAuthority(true);
+	TestEqual(TEXT("Refreshing authority doesn't force another net update"), Test.Actor->NumForcedNetUpdates, 1);
+
+	return true;
+}
+
+PREWARM_TEST(GIVEN_channel_not_prewarmed_WHEN_authority_is_gained_THEN_no_net_update_is_forced)
+{
+	FTestChannel Test(true);
+
+	Test.Channel->SetServerAuthority(true);
+
+	TestEqual(TEXT("No net update is forced"), Test.Actor->NumForcedNetUpdates, 0);
+
+	return true;
+}
+
+PREWARM_TEST(GIVEN_prewarm_cancelled_WHEN_authority_is_gained_THEN_no_net_update_is_forced)
+{
+	FTestChannel Test(true);
+
+	Test.Channel->PrewarmForAuthority();
+	Test.Channel->CancelPrewarmForAuthority();
+	TestFalse(TEXT("The channel is no longer prewarmed"), Test.Channel->IsPrewarmedForAuthority());
+
+	Test.Channel->SetServerAuthority(true);
+	TestEqual(TEXT("No net update is forced"), Test.Actor->NumForcedNetUpdates, 0);
+
+	return true;
+}
+
+PREWARM_TEST(GIVEN_channel_WHEN_prewarming_without_a_replicator_or_with_authority_THEN_it_is_not_prewarmed)
+{
+	FTestChannel WithoutReplicator(false);
+	WithoutReplicator.Channel->PrewarmForAuthority();
+	TestFalse(TEXT("A channel without a replicator is not prewarmed"), WithoutReplicator.Channel->IsPrewarmedForAuthority());
+
+	FTestChannel Authoritative(true);
+	Authoritative.Channel->SetServerAuthority(true);
+	Authoritative.Channel->PrewarmForAuthority();
+	TestFalse(TEXT("An authoritative channel is not prewarmed"), Authoritative.Channel->IsPrewarmedForAuthority());
+
+	return true;
+}
+
+PREWARM_TEST(GIVEN_channel_WHEN_authority_is_gained_and_lost_THEN_it_awaits_its_first_replication_only_while_authoritative)
+{
+	FTestChannel Received(false);
+	TestFalse(TEXT("Nothing is awaited before gaining authority"), Received.Channel->IsAwaitingFirstReplicationSinceAuthority());
+
+	Received.Channel->SetServerAuthority(true);
+	TestTrue(TEXT("The first replication is awaited after gaining authority"), Received.Channel->IsAwaitingFirstReplicationSinceAuthority());
+
+	Received.Channel->SetServerAuthority(false);
+	TestFalse(TEXT("Losing authority stops awaiting the first replication"), Received.Channel->IsAwaitingFirstReplicationSinceAuthority());
+
+	FTestChannel Created(true);
+	Created.Channel->PrewarmForAuthority();
+	Created.Channel->SetServerAuthority(false);
+	TestFalse(TEXT("Losing authority clears the prewarm"), Created.Channel->IsPrewarmedForAuthority());
+
+	Created.Channel->SetServerAuthority(true);
+	TestFalse(TEXT("A channel which created its entity doesn't await a first replication"), Created.Channel->IsAwaitingFirstReplicationSinceAuthority());
+
+	return true;
+}
@@ -0,0 +1,99 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "EngineClasses/SpatialNetBitReader.h"
+#include "EngineClasses/SpatialNetBitWriter.h"
+#include "Schema/UnrealObjectRef.h"
+#include "SpatialConstants.h"
+
+#include "CoreMinimal.h"
+
+#define SPATIALNETBITWRITER_TEST(TestName) \
+	GDK_TEST(Core, FSpatialNetBitWriter, TestName)
+
+namespace
+{
+
+class FTestObjectRefWriter : public FSpatialNetBitWriter
+{
+public:
+	FTestObjectRefWriter()
+		: FSpatialNetBitWriter(nullptr)
+	{}
+
+	using FSpatialNetBitWriter::SerializeObjectRef;
+	using FSpatialNetBitWriter::GetUncompressedObjectRefBits;
+};
+
+class FTestObjectRefReader : public FSpatialNetBitReader
+{
+public:
+	FTestObjectRefReader(FBitWriter& Writer, TSet<FUnrealObjectRef>& InDynamicRefs, TSet<FUnrealObjectRef>& InUnresolvedRefs)
+		: FSpatialNetBitReader(nullptr, Writer.GetData(), Writer.GetNumBits(), InDynamicRefs, InUnresolvedRefs)
+	{}
+
+	using FSpatialNetBitReader::DeserializeObjectRef;
+};
+
+FUnrealObjectRef MakeStablyNamedRef(const FString& Path, const FString& OuterPath)
+{
+	FUnrealObjectRef OuterRef(SpatialConstants::INVALID_ENTITY_ID, 0);
+	OuterRef.Path = OuterPath;
+
+	FUnrealObjectRef ObjectRef(SpatialConstants::INVALID_ENTITY_ID, 0);
+	ObjectRef.Path = Path;
+	ObjectRef.Outer = OuterRef;
+	return ObjectRef;
+}
+
+} // anonymous namespace
+
+SPATIALNETBITWRITER_TEST(GIVEN_object_refs_with_repeated_paths_WHEN_serialized_THEN_they_deserialize_to_the_same_refs)
+{
+	TArray<FUnrealObjectRef> Refs;
+	Refs.Add(FUnrealObjectRef(12345678901LL, 7));
+	Refs.Add(MakeStablyNamedRef(TEXT("Weapon_0"), TEXT("/Game/Maps/TestMap.TestMap:PersistentLevel")));
+	Refs.Add(MakeStablyNamedRef(TEXT("Weapon_1"), TEXT("/Game/Maps/TestMap.TestMap:PersistentLevel")));
+	Refs.Add(MakeStablyNamedRef(TEXT("Weapon_0"), TEXT("/Game/Maps/TestMap.TestMap:PersistentLevel")));
+	Refs.Add(FUnrealObjectRef::NULL_OBJECT_REF);
+
+	FTestObjectRefWriter Writer;
+	for (FUnrealObjectRef& Ref : Refs)
+	{
+		Writer.SerializeObjectRef(Ref);
+	}
+
+	TSet<FUnrealObjectRef> DynamicRefs;
+	TSet<FUnrealObjectRef> UnresolvedRefs;
+	FTestObjectRefReader Reader(Writer, DynamicRefs, UnresolvedRefs);
+	for (int32 i = 0; i < Refs.Num(); i++)
+	{
+		FUnrealObjectRef ReadRef;
+		Reader.DeserializeObjectRef(ReadRef);
+		TestTrue(FString::Printf(TEXT("Object ref %d round trips"), i), ReadRef == Refs[i]);
+	}
+
+	TestFalse("Reader did not hit an error", Reader.IsError());
+	TestEqual("Reader consumed all written bits", Reader.GetPosBits(), Writer.GetNumBits());
+
+	return true;
+}
+
+SPATIALNETBITWRITER_TEST(GIVEN_reference_heavy_payload_WHEN_serialized_THEN_it_is_smaller_than_uncompressed_encoding)
+{
+	FTestObjectRefWriter Writer;
+	int64 UncompressedBits = 0;
+
+	for (int32 i = 0; i < 100; i++)
+	{
+		FUnrealObjectRef Ref = MakeStablyNamedRef(FString::Printf(TEXT("Item_%d"), i % 10), TEXT("/Game/Maps/TestMap.TestMap:PersistentLevel"));
+		UncompressedBits += FTestObjectRefWriter::GetUncompressedObjectRefBits(Ref);
+		Writer.SerializeObjectRef(Ref);
+	}
+
+	AddInfo(FString::Printf(TEXT("100 stably named refs: %lld bytes compressed, %lld bytes uncompressed"), Writer.GetNumBytes(), UncompressedBits / 8));
+	TestTrue("Compressed encoding is smaller than uncompressed encoding", Writer.GetNumBits() < UncompressedBits);
+
+	return true;
+}
@@ -0,0 +1,118 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestingSchemaHelpers.h"
+
+#include "Tests/TestDefinitions.h"
+
+#include "EngineClasses/SpatialVirtualWorkerRoutingTable.h"
+#include "EngineClasses/SpatialVirtualWorkerTranslator.h"
+#include "SpatialCommonTypes.h"
+#include "SpatialConstants.h"
+
+#include "Templates/UniquePtr.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+#include <WorkerSDK/improbable/c_worker.h>
+
+#define VIRTUALWORKERROUTINGTABLE_TEST(TestName) \
+	GDK_TEST(Core, SpatialVirtualWorkerRoutingTable, TestName)
+
+namespace
+{
+
+// Applies a mapping at Version, in which virtual worker N is simulated by the Nth worker name and server worker entity.
+void ApplyMapping(SpatialVirtualWorkerTranslator& Translator, uint32 Version, const TArray<PhysicalWorkerName>& WorkerNames, const TArray<Worker_EntityId>& ServerWorkerEntityIds)
+{
+	Schema_Object* DataObject = TestingSchemaHelpers::CreateTranslationComponentDataFields();
+	TestingSchemaHelpers::SetTranslationComponentDataMappingVersion(DataObject, Version);
+	for (int32 i = 0; i < WorkerNames.Num(); i++)
+	{
+		TestingSchemaHelpers::AddTranslationComponentDataMappingChange(DataObject, i + 1, WorkerNames[i], Version, ServerWorkerEntityIds[i]);
+	}
+
+	Translator.ApplyVirtualWorkerManagerData(DataObject);
+}
+
+} // anonymous namespace
+
+VIRTUALWORKERROUTINGTABLE_TEST(GIVEN_a_mapping_WHEN_routing_to_a_virtual_worker_THEN_return_its_server_worker_and_count_the_lookup)
+{
+	SpatialVirtualWorkerTranslator Translator(nullptr, "ValidWorkerOne");
+	TUniquePtr<SpatialVirtualWorkerRoutingTable> RoutingTable = MakeUnique<SpatialVirtualWorkerRoutingTable>(&Translator);
+
+	ApplyMapping(Translator, 1, { "ValidWorkerOne", "ValidWorkerTwo" }, { 1001, 1002 });
+
+	const VirtualWorkerRoute* Route = RoutingTable->FindRoute(2);
+	TestNotNull("There is a route to virtual worker 2", Route);
+	TestEqual<FString>("Virtual worker 2 is routed to ValidWorkerTwo", Route->PhysicalWorker, "ValidWorkerTwo");
+	TestEqual<Worker_EntityId>("Virtual worker 2 is routed to its server worker entity", Route->ServerWorkerEntityId, 1002);
+
+	TestEqual<Worker_EntityId>("Virtual worker 1 is routed to its server worker entity", RoutingTable->GetServerWorkerEntity(1), 1001);
+	TestEqual<Worker_EntityId>("There is no route to virtual worker 3", RoutingTable->GetServerWorkerEntity(3), SpatialConstants::INVALID_ENTITY_ID);
+
+	TestEqual<uint32>("Every lookup was counted", RoutingTable->GetNumLookups(), 3);
+	TestEqual<uint32>("No stale route was retried", RoutingTable->GetNumStaleRouteRetries(), 0);
+
+	return true;
+}
+
+VIRTUALWORKERROUTINGTABLE_TEST(GIVEN_a_mapping_applied_before_the_table_was_created_WHEN_routing_THEN_route_from_the_translator)
+{
+	SpatialVirtualWorkerTranslator Translator(nullptr, "ValidWorkerOne");
+	ApplyMapping(Translator, 1, { "ValidWorkerOne", "ValidWorkerTwo" }, { 1001, 1002 });
+
+	TUniquePtr<SpatialVirtualWorkerRoutingTable> RoutingTable = MakeUnique<SpatialVirtualWorkerRoutingTable>(&Translator);
+
+	TestEqual<Worker_EntityId>("Virtual worker 2 is routed to its server worker entity", RoutingTable->GetServerWorkerEntity(2), 1002);
+
+	// Changes after the table was created still reach it.
+	ApplyMapping(Translator, 2, { "ValidWorkerOne", "ValidWorkerThree" }, { 1001, 1003 });
+
+	TestEqual<Worker_EntityId>("Virtual worker 2 is routed to its new server worker entity", RoutingTable->GetServerWorkerEntity(2), 1003);
+
+	return true;
+}
+
+VIRTUALWORKERROUTINGTABLE_TEST(GIVEN_a_request_routed_to_a_worker_WHEN_the_worker_is_replaced_before_the_retry_THEN_reroute_to_the_replacement)
+{
+	SpatialVirtualWorkerTranslator Translator(nullptr, "ValidWorkerOne");
+	TUniquePtr<SpatialVirtualWorkerRoutingTable> RoutingTable = MakeUnique<SpatialVirtualWorkerRoutingTable>(&Translator);
+
+	ApplyMapping(Translator, 1, { "ValidWorkerOne", "ValidWorkerTwo" }, { 1001, 1002 });
+
+	// A request is sent to virtual worker 2, whose worker is then replaced before the request fails.
+	const Worker_EntityId SentToServerWorkerEntityId = RoutingTable->GetServerWorkerEntity(2);
+	ApplyMapping(Translator, 2, { "ValidWorkerOne", "ValidWorkerThree" }, { 1001, 1003 });
+
+	const Worker_EntityId RetryServerWorkerEntityId = RoutingTable->GetServerWorkerEntityForRetry(2, SentToServerWorkerEntityId);
+	TestEqual<Worker_EntityId>("The retry is routed to the replacement worker", RetryServerWorkerEntityId, 1003);
+	TestEqual<FString>("Virtual worker 2 is routed to ValidWorkerThree", RoutingTable->FindRoute(2)->PhysicalWorker, "ValidWorkerThree");
+	TestEqual<uint32>("The stale route was counted", RoutingTable->GetNumStaleRouteRetries(), 1);
+
+	// Retrying the rerouted request again doesn't count as stale.
+	TestEqual<Worker_EntityId>("The next retry is routed to the replacement worker", RoutingTable->GetServerWorkerEntityForRetry(2, RetryServerWorkerEntityId), 1003);
+	TestEqual<uint32>("Only the stale route was counted", RoutingTable->GetNumStaleRouteRetries(), 1);
+
+	return true;
+}
+
+VIRTUALWORKERROUTINGTABLE_TEST(GIVEN_a_request_routed_to_a_worker_WHEN_the_virtual_worker_is_removed_before_the_retry_THEN_there_is_no_route)
+{
+	SpatialVirtualWorkerTranslator Translator(nullptr, "ValidWorkerOne");
+	TUniquePtr<SpatialVirtualWorkerRoutingTable> RoutingTable = MakeUnique<SpatialVirtualWorkerRoutingTable>(&Translator);
+
+	ApplyMapping(Translator, 1, { "ValidWorkerOne", "ValidWorkerTwo" }, { 1001, 1002 });
+	const Worker_EntityId SentToServerWorkerEntityId = RoutingTable->GetServerWorkerEntity(2);
+
+	// A new snapshot of the mapping no longer has virtual worker 2.
+	Schema_Object* SnapshotDataObject = TestingSchemaHelpers::CreateTranslationComponentDataFields();
+	TestingSchemaHelpers::SetTranslationComponentDataMappingVersion(SnapshotDataObject, 2);
+	TestingSchemaHelpers::SetTranslationComponentDataSnapshotVersion(SnapshotDataObject, 2);
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(SnapshotDataObject, 1, "ValidWorkerOne");
+	Translator.ApplyVirtualWorkerManagerData(SnapshotDataObject);
+
+	TestNull("There is no route to virtual worker 2", RoutingTable->FindRoute(2));
+	TestEqual<Worker_EntityId>("The retry has no server worker to go to", RoutingTable->GetServerWorkerEntityForRetry(2, SentToServerWorkerEntityId), SpatialConstants::INVALID_ENTITY_ID);
+
+	return true;
+}
@@ -5,9 +5,11 @@
 #include "EngineClasses/SpatialVirtualWorkerTranslator.h"
 #include "Interop/Connection/SpatialWorkerConnection.h"
 #include "Interop/SpatialReceiver.h"
+#include "Schema/ServerWorker.h"
 #include "SpatialConstants.h"
 #include "SpatialGDKTests/SpatialGDK/Interop/Connection/SpatialOSWorkerInterface/SpatialOSWorkerConnectionSpy.h"
 #include "SpatialGDKTests/SpatialGDK/Interop/SpatialOSDispatcherInterface/SpatialOSDispatcherSpy.h"
+#include "SpatialGDKTests/SpatialGDK/LoadBalancing/DynamicGridLBStrategy/TestDynamicGridLBStrategy.h"
 #include "Utils/SchemaUtils.h"
 #include "UObject/UObjectGlobals.h"
 
@@ -40,6 +42,19 @@ EntityQueryDelegate* SetupQueryDelegateTests(SpatialVirtualWorkerTranslationMana
 	return Delegate;
 }
 
+int32 CountSentMappingUpdates(const SpatialOSWorkerConnectionSpy& Connection)
+{
+	int32 NumMappingUpdates = 0;
+	for (const SpatialOSWorkerConnectionSpy::FSentComponentUpdate& Sent : Connection.GetSentComponentUpdates())
+	{
+		if (Sent.EntityId == SpatialConstants::INITIAL_VIRTUAL_WORKER_TRANSLATOR_ENTITY_ID && Sent.Update.component_id == SpatialConstants::VIRTUAL_WORKER_TRANSLATION_COMPONENT_ID)
+		{
+			NumMappingUpdates++;
+		}
+	}
+	return NumMappingUpdates;
+}
+
 }  // anonymous namespace
 
 VIRTUALWORKERTRANSLATIONMANAGER_TEST(Given_an_authority_change_THEN_query_for_worker_entities_when_appropriate)
@@ -140,3 +155,113 @@ VIRTUALWORKERTRANSLATIONMANAGER_TEST(Given_a_successful_query_with_invalid_worke
 
 	return true;
 }
+
+VIRTUALWORKERTRANSLATIONMANAGER_TEST(Given_a_successful_query_with_enough_workers_THEN_publish_a_versioned_mapping)
+{
+	TUniquePtr<SpatialOSWorkerConnectionSpy> Connection = MakeUnique<SpatialOSWorkerConnectionSpy>();
+	TUniquePtr<SpatialOSDispatcherSpy> Dispatcher = MakeUnique<SpatialOSDispatcherSpy>();
+	TUniquePtr<SpatialVirtualWorkerTranslator> Translator = MakeUnique<SpatialVirtualWorkerTranslator>(nullptr, "ValidWorkerOne");
+	TUniquePtr<SpatialVirtualWorkerTranslationManager> Manager = MakeUnique<SpatialVirtualWorkerTranslationManager>(Dispatcher.Get(), Connection.Get(), Translator.Get());
+
+	EntityQueryDelegate* Delegate = SetupQueryDelegateTests(Manager.Get(), Dispatcher.Get(), Connection.Get());
+
+	Worker_ComponentData FirstWorkerData = SpatialGDK::ServerWorker(TEXT("ValidWorkerOne"), true).CreateServerWorkerData();
+	Worker_ComponentData SecondWorkerData = SpatialGDK::ServerWorker(TEXT("ValidWorkerTwo"), true).CreateServerWorkerData();
+
+	Worker_Entity Workers[2];
+	Workers[0].entity_id = 1001;
+	Workers[0].component_count = 1;
+	Workers[0].components = &FirstWorkerData;
+	Workers[1].entity_id = 1002;
+	Workers[1].component_count = 1;
+	Workers[1].components = &SecondWorkerData;
+
+	Worker_EntityQueryResponseOp ResponseOp;
+	ResponseOp.status_code = WORKER_STATUS_CODE_SUCCESS;
+	ResponseOp.result_count = 2;
+	ResponseOp.message = "Successfully returned 2 entities";
+	ResponseOp.results = Workers;
+
+	Manager->SetNumberOfVirtualWorkers(2);
+
+	Delegate->ExecuteIfBound(ResponseOp);
+	TestTrue("With enough workers available, the TranslationManager didn't query again for server worker entities.", Connection->GetLastEntityQuery() == nullptr);
+
+	TestEqual<uint32>("The Translator applied the first version of the mapping.", Translator->GetMappingVersion(), 1);
+	TestTrue("The Translator found its virtual worker in the mapping.", Translator->IsReady());
+	TestEqual<Worker_EntityId>("Virtual worker 1 is simulated by the first server worker entity.", Translator->GetServerWorkerEntityForVirtualWorker(1), 1001);
+	TestEqual<Worker_EntityId>("Virtual worker 2 is simulated by the second server worker entity.", Translator->GetServerWorkerEntityForVirtualWorker(2), 1002);
+
+	Schema_DestroyComponentData(FirstWorkerData.schema_type);
+	Schema_DestroyComponentData(SecondWorkerData.schema_type);
+
+	return true;
+}
+
+VIRTUALWORKERTRANSLATIONMANAGER_TEST(Given_a_worker_which_has_not_reported_its_load_THEN_do_not_rebalance_until_it_has)
+{
+	TUniquePtr<SpatialOSWorkerConnectionSpy> Connection = MakeUnique<SpatialOSWorkerConnectionSpy>();
+	TUniquePtr<SpatialOSDispatcherSpy> Dispatcher = MakeUnique<SpatialOSDispatcherSpy>();
+	TUniquePtr<SpatialVirtualWorkerTranslator> Translator = MakeUnique<SpatialVirtualWorkerTranslator>(nullptr, "ValidWorkerOne");
+	TUniquePtr<SpatialVirtualWorkerTranslationManager> Manager = MakeUnique<SpatialVirtualWorkerTranslationManager>(Dispatcher.Get(), Connection.Get(), Translator.Get());
+
+	EntityQueryDelegate* Delegate = SetupQueryDelegateTests(Manager.Get(), Dispatcher.Get(), Connection.Get());
+
+	SpatialGDK::ServerWorker FirstWorker(TEXT("ValidWorkerOne"), true);
+	SpatialGDK::ServerWorker SecondWorker(TEXT("ValidWorkerTwo"), true);
+	Worker_ComponentData FirstWorkerData = FirstWorker.CreateServerWorkerData();
+	Worker_ComponentData SecondWorkerData = SecondWorker.CreateServerWorkerData();
+
+	Worker_Entity Workers[2];
+	Workers[0].entity_id = 1001;
+	Workers[0].component_count = 1;
+	Workers[0].components = &FirstWorkerData;
+	Workers[1].entity_id = 1002;
+	Workers[1].component_count = 1;
+	Workers[1].components = &SecondWorkerData;
+
+	Worker_EntityQueryResponseOp ResponseOp;
+	ResponseOp.status_code = WORKER_STATUS_CODE_SUCCESS;
+	ResponseOp.result_count = 2;
+	ResponseOp.message = "Successfully returned 2 entities";
+	ResponseOp.results = Workers;
+
+	Manager->SetNumberOfVirtualWorkers(2);
+	Delegate->ExecuteIfBound(ResponseOp);
+
+	UDynamicGridLBStrategy* Strategy = UTestDynamicGridLBStrategy::Create(2, 1, 200000.f, 200000.f, 5000.f, 10000.f);
+	Strategy->Init();
+	Strategy->SetVirtualWorkerIds(1, 2);
+	Manager->SetLoadBalanceStrategy(Strategy);
+
+	const int32 NumMappingUpdatesBeforeRebalance = CountSentMappingUpdates(*Connection);
+
+	// Only the first worker has reported its load; the second worker's entity still has no load set.
+	Schema_DestroyComponentData(FirstWorkerData.schema_type);
+	FirstWorker.Load = 100.f;
+	FirstWorkerData = FirstWorker.CreateServerWorkerData();
+
+	Manager->RebalanceFromReportedLoads();
+	EntityQueryDelegate* LoadDelegate = Dispatcher->GetEntityQueryDelegate(Connection->GetLastRequestId());
+	TestTrue("Rebalancing queried for the reported loads.", LoadDelegate != nullptr);
+	LoadDelegate->ExecuteIfBound(ResponseOp);
+
+	TestEqual("While a worker hasn't reported its load, the TranslationManager didn't rebalance.", CountSentMappingUpdates(*Connection), NumMappingUpdatesBeforeRebalance);
+
+	// Now the second worker reports a much lower load than the first.
+	Schema_DestroyComponentData(SecondWorkerData.schema_type);
+	SecondWorker.Load = 0.f;
+	SecondWorkerData = SecondWorker.CreateServerWorkerData();
+
+	Manager->RebalanceFromReportedLoads();
+	LoadDelegate = Dispatcher->GetEntityQueryDelegate(Connection->GetLastRequestId());
+	TestTrue("Rebalancing queried for the reported loads again.", LoadDelegate != nullptr);
+	LoadDelegate->ExecuteIfBound(ResponseOp);
+
+	TestEqual("Once every worker reported its load, the TranslationManager rebalanced and sent the new partition.", CountSentMappingUpdates(*Connection), NumMappingUpdatesBeforeRebalance + 1);
+
+	Schema_DestroyComponentData(FirstWorkerData.schema_type);
+	Schema_DestroyComponentData(SecondWorkerData.schema_type);
+
+	return true;
+}
@@ -252,3 +252,137 @@ VIRTUALWORKERTRANSLATOR_TEST(GIVEN_have_a_valid_mapping_WHEN_try_to_change_local
 
 	return true;
 }
+
+VIRTUALWORKERTRANSLATOR_TEST(GIVEN_have_a_versioned_mapping_WHEN_a_delta_is_received_THEN_only_apply_and_notify_the_changed_entries)
+{
+	ULBStrategyStub* LBStrategyStub = NewObject<ULBStrategyStub>();
+	TUniquePtr<SpatialVirtualWorkerTranslator> Translator = MakeUnique<SpatialVirtualWorkerTranslator>(LBStrategyStub, "ValidWorkerOne");
+
+	TArray<VirtualWorkerId> ChangedIds;
+	Translator->OnVirtualWorkerMappingChanged.AddLambda([&ChangedIds](VirtualWorkerId Id)
+	{
+		ChangedIds.Add(Id);
+	});
+
+	// Create a snapshot of the mapping at version 1.
+	Schema_Object* SnapshotDataObject = TestingSchemaHelpers::CreateTranslationComponentDataFields();
+	TestingSchemaHelpers::SetTranslationComponentDataMappingVersion(SnapshotDataObject, 1);
+	TestingSchemaHelpers::SetTranslationComponentDataSnapshotVersion(SnapshotDataObject, 1);
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(SnapshotDataObject, 1, "ValidWorkerOne");
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(SnapshotDataObject, 2, "ValidWorkerTwo");
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(SnapshotDataObject, 3, "ValidWorkerThree");
+
+	Translator->ApplyVirtualWorkerManagerData(SnapshotDataObject);
+
+	TestEqual<uint32>("The snapshot's version was applied.", Translator->GetMappingVersion(), 1);
+	TestEqual<int32>("Every virtual worker in the snapshot was notified.", ChangedIds.Num(), 3);
+	TestTrue("Translator with local virtual worker ID is ready.", Translator->IsReady());
+
+	// Create a delta at version 3, which carries every change since the snapshot. Only virtual worker 2 changed since version 1,
+	// virtual worker 3 was last changed before it.
+	ChangedIds.Empty();
+	Schema_Object* DeltaDataObject = TestingSchemaHelpers::CreateTranslationComponentDataFields();
+	TestingSchemaHelpers::SetTranslationComponentDataMappingVersion(DeltaDataObject, 3);
+	TestingSchemaHelpers::AddTranslationComponentDataMappingChange(DeltaDataObject, 2, "ValidWorkerFour", 3);
+	TestingSchemaHelpers::AddTranslationComponentDataMappingChange(DeltaDataObject, 3, "ValidWorkerThree", 1);
+
+	Translator->ApplyVirtualWorkerManagerData(DeltaDataObject);
+
+	TestEqual<uint32>("The delta's version was applied.", Translator->GetMappingVersion(), 3);
+	TestEqual<int32>("Only one virtual worker was notified.", ChangedIds.Num(), 1);
+	TestTrue("Virtual worker 2 was notified.", ChangedIds.Contains(2));
+
+	const PhysicalWorkerName* VirtualWorker2PhysicalName = Translator->GetPhysicalWorkerForVirtualWorker(2);
+	TestNotNull("There is a mapping for virtual worker 2", VirtualWorker2PhysicalName);
+	TestEqual<FString>("VirtualWorker 2 is ValidWorkerFour", *VirtualWorker2PhysicalName, "ValidWorkerFour");
+
+	const PhysicalWorkerName* VirtualWorker3PhysicalName = Translator->GetPhysicalWorkerForVirtualWorker(3);
+	TestNotNull("The delta didn't remove virtual worker 3", VirtualWorker3PhysicalName);
+	TestEqual<FString>("VirtualWorker 3 is still ValidWorkerThree", *VirtualWorker3PhysicalName, "ValidWorkerThree");
+
+	TestEqual<VirtualWorkerId>("Local virtual worker ID is still known.", Translator->GetLocalVirtualWorkerId(), 1);
+
+	return true;
+}
+
+VIRTUALWORKERTRANSLATOR_TEST(GIVEN_have_a_versioned_mapping_WHEN_an_older_version_is_received_THEN_ignore_it)
+{
+	ULBStrategyStub* LBStrategyStub = NewObject<ULBStrategyStub>();
+	TUniquePtr<SpatialVirtualWorkerTranslator> Translator = MakeUnique<SpatialVirtualWorkerTranslator>(LBStrategyStub, "ValidWorkerOne");
+
+	// A worker joining late gets the snapshot and the changes since it in the component data.
+	Schema_Object* LateJoinDataObject = TestingSchemaHelpers::CreateTranslationComponentDataFields();
+	TestingSchemaHelpers::SetTranslationComponentDataMappingVersion(LateJoinDataObject, 3);
+	TestingSchemaHelpers::SetTranslationComponentDataSnapshotVersion(LateJoinDataObject, 1);
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(LateJoinDataObject, 1, "ValidWorkerOne");
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(LateJoinDataObject, 2, "ValidWorkerTwo");
+	TestingSchemaHelpers::AddTranslationComponentDataMappingChange(LateJoinDataObject, 2, "ValidWorkerThree", 2);
+	TestingSchemaHelpers::AddTranslationComponentDataMappingChange(LateJoinDataObject, 3, "ValidWorkerFour", 3);
+
+	Translator->ApplyVirtualWorkerManagerData(LateJoinDataObject);
+
+	TestEqual<uint32>("The latest version was applied.", Translator->GetMappingVersion(), 3);
+	TestTrue("Translator with local virtual worker ID is ready.", Translator->IsReady());
+
+	TArray<VirtualWorkerId> ChangedIds;
+	Translator->OnVirtualWorkerMappingChanged.AddLambda([&ChangedIds](VirtualWorkerId Id)
+	{
+		ChangedIds.Add(Id);
+	});
+
+	// An update for version 2 arrives after version 3, as a query response sent before the last update would.
+	Schema_Object* StaleDataObject = TestingSchemaHelpers::CreateTranslationComponentDataFields();
+	TestingSchemaHelpers::SetTranslationComponentDataMappingVersion(StaleDataObject, 2);
+	TestingSchemaHelpers::SetTranslationComponentDataSnapshotVersion(StaleDataObject, 2);
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(StaleDataObject, 1, "ValidWorkerOne");
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(StaleDataObject, 2, "ValidWorkerThree");
+
+	Translator->ApplyVirtualWorkerManagerData(StaleDataObject);
+
+	TestEqual<uint32>("The latest version is still applied.", Translator->GetMappingVersion(), 3);
+	TestEqual<int32>("No virtual worker was notified.", ChangedIds.Num(), 0);
+
+	const PhysicalWorkerName* VirtualWorker2PhysicalName = Translator->GetPhysicalWorkerForVirtualWorker(2);
+	TestNotNull("There is a mapping for virtual worker 2", VirtualWorker2PhysicalName);
+	TestEqual<FString>("VirtualWorker 2 is ValidWorkerThree", *VirtualWorker2PhysicalName, "ValidWorkerThree");
+
+	const PhysicalWorkerName* VirtualWorker3PhysicalName = Translator->GetPhysicalWorkerForVirtualWorker(3);
+	TestNotNull("The stale snapshot didn't remove virtual worker 3", VirtualWorker3PhysicalName);
+	TestEqual<FString>("VirtualWorker 3 is ValidWorkerFour", *VirtualWorker3PhysicalName, "ValidWorkerFour");
+
+	return true;
+}
+
+VIRTUALWORKERTRANSLATOR_TEST(GIVEN_have_a_versioned_mapping_WHEN_a_new_snapshot_is_received_THEN_remove_the_entries_missing_from_it)
+{
+	ULBStrategyStub* LBStrategyStub = NewObject<ULBStrategyStub>();
+	TUniquePtr<SpatialVirtualWorkerTranslator> Translator = MakeUnique<SpatialVirtualWorkerTranslator>(LBStrategyStub, "ValidWorkerOne");
+
+	Schema_Object* FirstSnapshotDataObject = TestingSchemaHelpers::CreateTranslationComponentDataFields();
+	TestingSchemaHelpers::SetTranslationComponentDataMappingVersion(FirstSnapshotDataObject, 1);
+	TestingSchemaHelpers::SetTranslationComponentDataSnapshotVersion(FirstSnapshotDataObject, 1);
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(FirstSnapshotDataObject, 1, "ValidWorkerOne");
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(FirstSnapshotDataObject, 2, "ValidWorkerTwo");
+
+	Translator->ApplyVirtualWorkerManagerData(FirstSnapshotDataObject);
+
+	TArray<VirtualWorkerId> ChangedIds;
+	Translator->OnVirtualWorkerMappingChanged.AddLambda([&ChangedIds](VirtualWorkerId Id)
+	{
+		ChangedIds.Add(Id);
+	});
+
+	Schema_Object* SecondSnapshotDataObject = TestingSchemaHelpers::CreateTranslationComponentDataFields();
+	TestingSchemaHelpers::SetTranslationComponentDataMappingVersion(SecondSnapshotDataObject, 2);
+	TestingSchemaHelpers::SetTranslationComponentDataSnapshotVersion(SecondSnapshotDataObject, 2);
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(SecondSnapshotDataObject, 1, "ValidWorkerOne");
+
+	Translator->ApplyVirtualWorkerManagerData(SecondSnapshotDataObject);
+
+	TestNull("There is no mapping for virtual worker 2", Translator->GetPhysicalWorkerForVirtualWorker(2));
+	TestEqual<int32>("Only the removed virtual worker was notified.", ChangedIds.Num(), 1);
+	TestTrue("Virtual worker 2 was notified.", ChangedIds.Contains(2));
+	TestEqual<VirtualWorkerId>("Local virtual worker ID is still known.", Translator->GetLocalVirtualWorkerId(), 1);
+
+	return true;
+}
@@ -12,8 +12,18 @@
 SpatialOSWorkerConnectionSpy::SpatialOSWorkerConnectionSpy()
 	: NextRequestId(0)
 	, LastEntityQuery(nullptr)
+	, NumCreateEntityRequests(0)
+	, LastCreateEntityId(0)
 {}
 
+SpatialOSWorkerConnectionSpy::~SpatialOSWorkerConnectionSpy()
+{
+	for (FSentComponentUpdate& SentUpdate : SentComponentUpdates)
+	{
+		Schema_DestroyComponentUpdate(SentUpdate.Update.schema_type);
+	}
+}
+
 TArray<Worker_OpList*> SpatialOSWorkerConnectionSpy::GetOpList()
 {
 	return TArray<Worker_OpList*>();
@@ -26,6 +36,15 @@ Worker_RequestId SpatialOSWorkerConnectionSpy::SendReserveEntityIdsRequest(uint3
 
 Worker_RequestId SpatialOSWorkerConnectionSpy::SendCreateEntityRequest(TArray<FWorkerComponentData>&& Components, const Worker_EntityId* EntityId)
 {
+	NumCreateEntityRequests++;
+	LastCreateEntityId = EntityId != nullptr ? *EntityId : 0;
+
+	// The connection takes ownership of the component data.
+	for (FWorkerComponentData& Component : Components)
+	{
+		Schema_DestroyComponentData(Component.schema_type);
+	}
+
 	return NextRequestId++;
 }
 
@@ -41,7 +60,10 @@ void SpatialOSWorkerConnectionSpy::SendRemoveComponent(Worker_EntityId EntityId,
 {}
 
 void SpatialOSWorkerConnectionSpy::SendComponentUpdate(Worker_EntityId EntityId, const FWorkerComponentUpdate* ComponentUpdate)
-{}
+{
+	// The connection takes ownership of the update.
+	SentComponentUpdates.Add(FSentComponentUpdate{ EntityId, *ComponentUpdate });
+}
 
 Worker_RequestId SpatialOSWorkerConnectionSpy::SendCommandRequest(Worker_EntityId EntityId, const Worker_CommandRequest* Request, uint32_t CommandId)
 {
@@ -83,3 +105,18 @@ Worker_RequestId SpatialOSWorkerConnectionSpy::GetLastRequestId()
 {
 	return NextRequestId - 1;
 }
+
+int32 SpatialOSWorkerConnectionSpy::GetNumCreateEntityRequests() const
+{
+	return NumCreateEntityRequests;
+}
+
+Worker_EntityId SpatialOSWorkerConnectionSpy::GetLastCreateEntityId() const
+{
+	return LastCreateEntityId;
+}
+
+const TArray<SpatialOSWorkerConnectionSpy::FSentComponentUpdate>& SpatialOSWorkerConnectionSpy::GetSentComponentUpdates() const
+{
+	return SentComponentUpdates;
+}
@@ -21,6 +21,7 @@ class SpatialOSWorkerConnectionSpy : public SpatialOSWorkerInterface
 {
 public:
 	SpatialOSWorkerConnectionSpy();
+	virtual ~SpatialOSWorkerConnectionSpy();
 
 	virtual TArray<Worker_OpList*> GetOpList() override;
 	virtual Worker_RequestId SendReserveEntityIdsRequest(uint32_t NumOfEntities) override;
@@ -43,8 +44,25 @@ public:
 
 	Worker_RequestId GetLastRequestId();
 
+	int32 GetNumCreateEntityRequests() const;
+	Worker_EntityId GetLastCreateEntityId() const;
+
+	struct FSentComponentUpdate
+	{
+		Worker_EntityId EntityId;
+		FWorkerComponentUpdate Update;
+	};
+
+	// The spy owns the sent updates, like the connection it stands in for, and destroys them with itself.
+	const TArray<FSentComponentUpdate>& GetSentComponentUpdates() const;
+
 private:
 	Worker_RequestId NextRequestId;
 
 	const Worker_EntityQuery* LastEntityQuery;
+
+	int32 NumCreateEntityRequests;
+	Worker_EntityId LastCreateEntityId;
+
+	TArray<FSentComponentUpdate> SentComponentUpdates;
 };
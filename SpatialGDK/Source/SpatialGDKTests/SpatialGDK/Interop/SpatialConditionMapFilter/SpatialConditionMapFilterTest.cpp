@@ -0,0 +1,179 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "EngineClasses/SpatialActorChannel.h"
+#include "Interop/SpatialConditionMapFilter.h"
+
+#include "CoreMinimal.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+#define CONDITIONMAPFILTER_TEST(TestName) \
+	GDK_TEST(Core, FSpatialConditionMapFilter, TestName)
+
+namespace
+{
+
+// A world with simulated proxies and the channels they would be received through on a client.
+struct FTestProxies
+{
+	explicit FTestProxies(int32 NumProxies)
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false);
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.bNoFail = true;
+
+		for (int32 i = 0; i < NumProxies; i++)
+		{
+			AActor* Actor = World->SpawnActor<AActor>(SpawnParams);
+			Actor->Role = ROLE_SimulatedProxy;
+
+			USpatialActorChannel* Channel = NewObject<USpatialActorChannel>();
+			Channel->Actor = Actor;
+			Channel->SetClientAuthority(false);
+			Channels.Add(Channel);
+		}
+	}
+
+	~FTestProxies()
+	{
+		World->DestroyWorld(false);
+	}
+
+	UWorld* World;
+	TArray<USpatialActorChannel*> Channels;
+};
+
+} // anonymous namespace
+
+CONDITIONMAPFILTER_TEST(GIVEN_simulated_proxy_WHEN_getting_filter_twice_THEN_cached_filter_is_reused)
+{
+	FTestProxies Proxies(1);
+	USpatialActorChannel* Channel = Proxies.Channels[0];
+
+	const FSpatialConditionMapFilter* First = &Channel->GetConditionMapFilter(true);
+	const FSpatialConditionMapFilter* Second = &Channel->GetConditionMapFilter(true);
+
+	TestTrue(TEXT("The filter is reused"), First == Second);
+	TestEqual(TEXT("The filter is built once"), static_cast<int32>(Channel->GetNumConditionMapFiltersBuilt()), 1);
+	TestTrue(TEXT("Simulated only properties are relevant"), Second->IsRelevant(COND_SimulatedOnly));
+	TestFalse(TEXT("Autonomous only properties are not relevant"), Second->IsRelevant(COND_AutonomousOnly));
+
+	return true;
+}
+
+CONDITIONMAPFILTER_TEST(GIVEN_cached_filter_WHEN_role_changes_THEN_filter_is_rebuilt_once_invalidated)
+{
+	FTestProxies Proxies(1);
+	USpatialActorChannel* Channel = Proxies.Channels[0];
+
+	TestTrue(TEXT("Simulated only properties are relevant"), Channel->GetConditionMapFilter(true).IsRelevant(COND_SimulatedOnly));
+
+	// The filter isn't checked against the actor on every call, so a role change is only picked up once the filter is invalidated,
+	// as the receiver and ComponentReader do when a new role is received.
+	Channel->Actor->Role = ROLE_AutonomousProxy;
+	TestTrue(TEXT("The cached filter is used until invalidated"), Channel->GetConditionMapFilter(true).IsRelevant(COND_SimulatedOnly));
+	TestEqual(TEXT("The filter is not rebuilt before it is invalidated"), static_cast<int32>(Channel->GetNumConditionMapFiltersBuilt()), 1);
+
+	Channel->InvalidateConditionMapFilter();
+	TestFalse(TEXT("Simulated only properties are no longer relevant"), Channel->GetConditionMapFilter(true).IsRelevant(COND_SimulatedOnly));
+	TestTrue(TEXT("Autonomous only properties are relevant"), Channel->GetConditionMapFilter(true).IsRelevant(COND_AutonomousOnly));
+	TestEqual(TEXT("The filter is rebuilt once"), static_cast<int32>(Channel->GetNumConditionMapFiltersBuilt()), 2);
+
+	return true;
+}
+
+CONDITIONMAPFILTER_TEST(GIVEN_cached_filter_WHEN_client_authority_changes_THEN_filter_is_rebuilt)
+{
+	FTestProxies Proxies(1);
+	USpatialActorChannel* Channel = Proxies.Channels[0];
+
+	TestTrue(TEXT("Skip owner properties are relevant without client authority"), Channel->GetConditionMapFilter(true).IsRelevant(COND_SkipOwner));
+
+	Channel->SetClientAuthority(true);
+	TestFalse(TEXT("Skip owner properties are not relevant with client authority"), Channel->GetConditionMapFilter(true).IsRelevant(COND_SkipOwner));
+	TestEqual(TEXT("Gaining client authority invalidates the filter"), static_cast<int32>(Channel->GetNumConditionMapFiltersBuilt()), 2);
+
+	Channel->SetClientAuthority(true);
+	Channel->GetConditionMapFilter(true);
+	TestEqual(TEXT("Refreshing an unchanged client authority keeps the filter"), static_cast<int32>(Channel->GetNumConditionMapFiltersBuilt()), 2);
+
+	TestTrue(TEXT("Owner only properties are relevant on clients"), Channel->GetConditionMapFilter(true).IsRelevant(COND_OwnerOnly));
+	TestFalse(TEXT("Owner only properties are not relevant on servers"), Channel->GetConditionMapFilter(false).IsRelevant(COND_OwnerOnly));
+
+	return true;
+}
+
+CONDITIONMAPFILTER_TEST(GIVEN_rep_notifies_buffer_WHEN_reused_THEN_it_is_empty_and_keeps_its_allocation)
+{
+	FTestProxies Proxies(1);
+	USpatialActorChannel* Channel = Proxies.Channels[0];
+
+	UProperty* Property = AActor::StaticClass()->PropertyLink;
+
+	TArray<UProperty*>& First = Channel->GetRepNotifiesBuffer();
+	First.AddUnique(Property);
+	const int32 Capacity = First.Max();
+
+	TArray<UProperty*>& Second = Channel->GetRepNotifiesBuffer();
+	TestEqual(TEXT("The buffer is empty"), Second.Num(), 0);
+	TestEqual(TEXT("The buffer keeps its allocation"), Second.Max(), Capacity);
+
+	return true;
+}
+
+CONDITIONMAPFILTER_TEST(GIVEN_2k_simulated_proxies_WHEN_receiving_updates_THEN_filters_are_only_rebuilt_for_invalidated_proxies)
+{
+	const int32 NumProxies = 2000;
+	const int32 NumUpdates = 10;
+
+	FTestProxies Proxies(NumProxies);
+
+	const ELifetimeCondition Conditions[] = { COND_None, COND_SimulatedOnly, COND_SkipOwner, COND_SimulatedOrPhysics, COND_AutonomousOnly };
+
+	auto ReceiveUpdates = [&]()
+	{
+		bool bMatchesNewFilter = true;
+		for (int32 Update = 0; Update < NumUpdates; Update++)
+		{
+			for (USpatialActorChannel* Channel : Proxies.Channels)
+			{
+				const FSpatialConditionMapFilter& ConditionMap = Channel->GetConditionMapFilter(true);
+				const FSpatialConditionMapFilter NewConditionMap(Channel, true);
+
+				for (ELifetimeCondition Condition : Conditions)
+				{
+					bMatchesNewFilter &= ConditionMap.IsRelevant(Condition) == NewConditionMap.IsRelevant(Condition);
+				}
+			}
+		}
+		return bMatchesNewFilter;
+	};
+
+	auto GetNumFiltersBuilt = [&]()
+	{
+		int32 NumFiltersBuilt = 0;
+		for (USpatialActorChannel* Channel : Proxies.Channels)
+		{
+			NumFiltersBuilt += Channel->GetNumConditionMapFiltersBuilt();
+		}
+		return NumFiltersBuilt;
+	};
+
+	TestTrue(TEXT("Cached filters match newly built ones"), ReceiveUpdates());
+	TestEqual(TEXT("Each proxy builds its filter once"), GetNumFiltersBuilt(), NumProxies);
+
+	// Every other proxy becomes autonomous, as when a client gains authority over its pawns.
+	for (int32 i = 0; i < NumProxies; i += 2)
+	{
+		Proxies.Channels[i]->Actor->Role = ROLE_AutonomousProxy;
+		Proxies.Channels[i]->InvalidateConditionMapFilter();
+	}
+
+	TestTrue(TEXT("Rebuilt filters match newly built ones"), ReceiveUpdates());
+	TestEqual(TEXT("Only invalidated proxies rebuild their filter"), GetNumFiltersBuilt(), NumProxies + NumProxies / 2);
+
+	return true;
+}
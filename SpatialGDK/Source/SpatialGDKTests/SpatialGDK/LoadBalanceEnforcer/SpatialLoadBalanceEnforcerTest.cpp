@@ -56,6 +56,29 @@ void AddEntityToStaticComponentView(USpatialStaticComponentView& StaticComponent
 	}
 }
 
+constexpr int32 NumManyEntities = 10000;
+
+void SetComponentPresence(USpatialStaticComponentView& StaticComponentView, const Worker_EntityId EntityId, TArray<Worker_ComponentId> PresentComponentIds)
+{
+	Worker_ComponentUpdateOp UpdateOp;
+	UpdateOp.entity_id = EntityId;
+	UpdateOp.update.component_id = SpatialConstants::COMPONENT_PRESENCE_COMPONENT_ID;
+	UpdateOp.update.schema_type = Schema_CreateComponentUpdate();
+	Schema_Object* UpdateFields = Schema_GetComponentUpdateFields(UpdateOp.update.schema_type);
+	Schema_AddUint32List(UpdateFields, SpatialConstants::COMPONENT_PRESENCE_COMPONENT_LIST_ID, PresentComponentIds.GetData(), PresentComponentIds.Num());
+
+	StaticComponentView.OnComponentUpdate(UpdateOp);
+}
+
+// Entities 1 to NumManyEntities, alternately assigned to virtual workers one and two.
+void AddManyEntitiesToStaticComponentView(USpatialStaticComponentView& StaticComponentView)
+{
+	for (Worker_EntityId EntityId = 1; EntityId <= NumManyEntities; EntityId++)
+	{
+		AddEntityToStaticComponentView(StaticComponentView, EntityId, EntityId % 2 == 1 ? VirtualWorkerOne : VirtualWorkerTwo, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+	}
+}
+
 TUniquePtr<SpatialVirtualWorkerTranslator> CreateVirtualWorkerTranslator()
 {
 	ULBStrategyStub* LoadBalanceStrategy = NewObject<ULBStrategyStub>();
@@ -483,3 +506,176 @@ LOADBALANCEENFORCER_TEST(GIVEN_component_presence_component_removal_WHEN_request
 
 	return true;
 }
+
+LOADBALANCEENFORCER_TEST(GIVEN_many_entities_queued_twice_WHEN_asked_for_acl_assignments_THEN_return_one_request_per_entity_sharing_a_write_acl_per_worker)
+{
+	TUniquePtr<SpatialVirtualWorkerTranslator> VirtualWorkerTranslator = CreateVirtualWorkerTranslator();
+
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+	AddManyEntitiesToStaticComponentView(*StaticComponentView);
+
+	TUniquePtr<SpatialLoadBalanceEnforcer> LoadBalanceEnforcer = MakeUnique<SpatialLoadBalanceEnforcer>(ValidWorkerOne, StaticComponentView, VirtualWorkerTranslator.Get());
+
+	for (int32 Pass = 0; Pass < 2; Pass++)
+	{
+		for (Worker_EntityId EntityId = 1; EntityId <= NumManyEntities; EntityId++)
+		{
+			LoadBalanceEnforcer->MaybeQueueAclAssignmentRequest(EntityId);
+		}
+	}
+
+	TestEqual("Each entity is queued once", LoadBalanceEnforcer->GetNumQueuedAclAssignmentRequests(), NumManyEntities);
+
+	TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> ACLRequests = LoadBalanceEnforcer->ProcessQueuedAclAssignmentRequests();
+
+	bool bSuccess = ACLRequests.Num() == NumManyEntities;
+	for (int32 Index = 0; bSuccess && Index < ACLRequests.Num(); Index++)
+	{
+		const Worker_EntityId ExpectedEntityId = Index + 1;
+		bSuccess &= ACLRequests[Index].EntityId == ExpectedEntityId;
+		bSuccess &= ACLRequests[Index].OwningWorkerId == (ExpectedEntityId % 2 == 1 ? ValidWorkerOne : ValidWorkerTwo);
+		bSuccess &= ACLRequests[Index].WriteAcl == ACLRequests[Index % 2].WriteAcl;
+	}
+
+	TestTrue("LoadBalanceEnforcer returned one ACL assignment request per entity, in the order they were queued", bSuccess);
+	TestEqual("One write ACL is built per worker", LoadBalanceEnforcer->GetNumWriteAclTemplatesBuiltLastProcess(), 2);
+	TestEqual("No requests are left queued", LoadBalanceEnforcer->GetNumQueuedAclAssignmentRequests(), 0);
+
+	return true;
+}
+
+LOADBALANCEENFORCER_TEST(GIVEN_many_queued_entities_and_a_budget_WHEN_asked_for_acl_assignments_THEN_return_at_most_the_budget_per_call_in_queue_order)
+{
+	TUniquePtr<SpatialVirtualWorkerTranslator> VirtualWorkerTranslator = CreateVirtualWorkerTranslator();
+
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+	AddManyEntitiesToStaticComponentView(*StaticComponentView);
+
+	TUniquePtr<SpatialLoadBalanceEnforcer> LoadBalanceEnforcer = MakeUnique<SpatialLoadBalanceEnforcer>(ValidWorkerOne, StaticComponentView, VirtualWorkerTranslator.Get());
+
+	for (Worker_EntityId EntityId = 1; EntityId <= NumManyEntities; EntityId++)
+	{
+		LoadBalanceEnforcer->MaybeQueueAclAssignmentRequest(EntityId);
+	}
+
+	constexpr int32 Budget = 3000;
+
+	bool bSuccess = true;
+	int32 NumCalls = 0;
+	Worker_EntityId ExpectedEntityId = 1;
+	while (LoadBalanceEnforcer->GetNumQueuedAclAssignmentRequests() > 0 && NumCalls < NumManyEntities)
+	{
+		TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> ACLRequests = LoadBalanceEnforcer->ProcessQueuedAclAssignmentRequests(Budget);
+		NumCalls++;
+
+		bSuccess &= ACLRequests.Num() == FMath::Min(Budget, static_cast<int32>(NumManyEntities - ExpectedEntityId + 1));
+		for (const SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest& Request : ACLRequests)
+		{
+			bSuccess &= Request.EntityId == ExpectedEntityId++;
+		}
+	}
+
+	TestTrue("LoadBalanceEnforcer returned every ACL assignment request in the order they were queued", bSuccess && ExpectedEntityId == NumManyEntities + 1);
+	TestEqual("The queue is processed over several calls", NumCalls, 4);
+
+	return true;
+}
+
+LOADBALANCEENFORCER_TEST(GIVEN_many_queued_entities_WHEN_some_are_removed_and_queued_again_THEN_return_one_request_per_queued_entity)
+{
+	TUniquePtr<SpatialVirtualWorkerTranslator> VirtualWorkerTranslator = CreateVirtualWorkerTranslator();
+
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+	AddManyEntitiesToStaticComponentView(*StaticComponentView);
+
+	TUniquePtr<SpatialLoadBalanceEnforcer> LoadBalanceEnforcer = MakeUnique<SpatialLoadBalanceEnforcer>(ValidWorkerOne, StaticComponentView, VirtualWorkerTranslator.Get());
+
+	for (Worker_EntityId EntityId = 1; EntityId <= NumManyEntities; EntityId++)
+	{
+		LoadBalanceEnforcer->MaybeQueueAclAssignmentRequest(EntityId);
+	}
+
+	// Lose ACL authority over every third entity, then regain it over every sixth.
+	Worker_AuthorityChangeOp AuthOp;
+	AuthOp.component_id = SpatialConstants::ENTITY_ACL_COMPONENT_ID;
+	for (Worker_EntityId EntityId = 3; EntityId <= NumManyEntities; EntityId += 3)
+	{
+		AuthOp.entity_id = EntityId;
+		AuthOp.authority = WORKER_AUTHORITY_NOT_AUTHORITATIVE;
+		LoadBalanceEnforcer->OnAclAuthorityChanged(AuthOp);
+	}
+	for (Worker_EntityId EntityId = 6; EntityId <= NumManyEntities; EntityId += 6)
+	{
+		AuthOp.entity_id = EntityId;
+		AuthOp.authority = WORKER_AUTHORITY_AUTHORITATIVE;
+		LoadBalanceEnforcer->OnAclAuthorityChanged(AuthOp);
+	}
+
+	const int32 ExpectedNumRequests = NumManyEntities - NumManyEntities / 3 + NumManyEntities / 6;
+	TestEqual("Removed entities are no longer queued", LoadBalanceEnforcer->GetNumQueuedAclAssignmentRequests(), ExpectedNumRequests);
+
+	TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> ACLRequests = LoadBalanceEnforcer->ProcessQueuedAclAssignmentRequests();
+
+	TSet<Worker_EntityId> RequestedEntityIds;
+	bool bSuccess = ACLRequests.Num() == ExpectedNumRequests;
+	for (const SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest& Request : ACLRequests)
+	{
+		bool bAlreadyRequested = false;
+		RequestedEntityIds.Add(Request.EntityId, &bAlreadyRequested);
+		bSuccess &= !bAlreadyRequested;
+		bSuccess &= Request.EntityId % 3 != 0 || Request.EntityId % 6 == 0;
+	}
+
+	TestTrue("LoadBalanceEnforcer returned one ACL assignment request per queued entity", bSuccess);
+
+	return true;
+}
+
+LOADBALANCEENFORCER_TEST(GIVEN_entities_with_different_components_WHEN_asked_for_acl_assignments_THEN_write_acls_are_shared_by_entities_with_the_same_components)
+{
+	TUniquePtr<SpatialVirtualWorkerTranslator> VirtualWorkerTranslator = CreateVirtualWorkerTranslator();
+
+	constexpr Worker_EntityId EntityIdThree = 3;
+
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+	AddEntityToStaticComponentView(*StaticComponentView, EntityIdOne, VirtualWorkerTwo, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+	AddEntityToStaticComponentView(*StaticComponentView, EntityIdTwo, VirtualWorkerTwo, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+	AddEntityToStaticComponentView(*StaticComponentView, EntityIdThree, VirtualWorkerTwo, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+
+	// The same components in a different order share a write ACL.
+	SetComponentPresence(*StaticComponentView, EntityIdOne, { TestComponentIdOne, SpatialConstants::HEARTBEAT_COMPONENT_ID, SpatialConstants::ENTITY_ACL_COMPONENT_ID });
+	SetComponentPresence(*StaticComponentView, EntityIdTwo, { SpatialConstants::ENTITY_ACL_COMPONENT_ID, TestComponentIdOne, SpatialConstants::HEARTBEAT_COMPONENT_ID });
+	SetComponentPresence(*StaticComponentView, EntityIdThree, { TestComponentIdTwo });
+
+	TUniquePtr<SpatialLoadBalanceEnforcer> LoadBalanceEnforcer = MakeUnique<SpatialLoadBalanceEnforcer>(ValidWorkerOne, StaticComponentView, VirtualWorkerTranslator.Get());
+
+	LoadBalanceEnforcer->MaybeQueueAclAssignmentRequest(EntityIdOne);
+	LoadBalanceEnforcer->MaybeQueueAclAssignmentRequest(EntityIdTwo);
+	LoadBalanceEnforcer->MaybeQueueAclAssignmentRequest(EntityIdThree);
+
+	TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> ACLRequests = LoadBalanceEnforcer->ProcessQueuedAclAssignmentRequests();
+
+	bool bSuccess = ACLRequests.Num() == 3;
+	if (bSuccess)
+	{
+		bSuccess &= ACLRequests[0].WriteAcl.IsValid() && ACLRequests[0].WriteAcl == ACLRequests[1].WriteAcl;
+		bSuccess &= ACLRequests[2].WriteAcl.IsValid() && ACLRequests[0].WriteAcl != ACLRequests[2].WriteAcl;
+	}
+	TestTrue("Entities with the same components share a write ACL", bSuccess);
+	TestEqual("One write ACL is built per combination of worker and components", LoadBalanceEnforcer->GetNumWriteAclTemplatesBuiltLastProcess(), 2);
+
+	if (bSuccess)
+	{
+		const SpatialLoadBalanceEnforcer::WriteAclTemplate& WriteAcl = *ACLRequests[0].WriteAcl;
+		const WorkerRequirementSet OwningServerWorkerRequirementSet = { { FString::Printf(TEXT("workerId:%s"), *ValidWorkerTwo) } };
+		const WorkerRequirementSet* TestComponentAcl = WriteAcl.ServerWriteAcl.Find(TestComponentIdOne);
+		const WorkerRequirementSet* EntityAclAcl = WriteAcl.ServerWriteAcl.Find(SpatialConstants::ENTITY_ACL_COMPONENT_ID);
+
+		TestTrue("Components are written by the owning server worker", TestComponentAcl != nullptr && *TestComponentAcl == OwningServerWorkerRequirementSet);
+		TestTrue("The ACL is written by any server worker", EntityAclAcl != nullptr && *EntityAclAcl == WorkerRequirementSet{ SpatialConstants::UnrealServerAttributeSet });
+		TestTrue("The heartbeat is written by the owning client", WriteAcl.OwningClientComponentIds.Contains(SpatialConstants::HEARTBEAT_COMPONENT_ID)
+			&& !WriteAcl.ServerWriteAcl.Contains(SpatialConstants::HEARTBEAT_COMPONENT_ID));
+	}
+
+	return true;
+}
@@ -0,0 +1,287 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "LoadBalancing/DynamicGridLBStrategy.h"
+#include "SpatialConstants.h"
+#include "TestDynamicGridLBStrategy.h"
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+#include "Tests/TestDefinitions.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+#define DYNAMICGRIDLBSTRATEGY_TEST(TestName) \
+	GDK_TEST(Core, UDynamicGridLBStrategy, TestName)
+
+namespace
+{
+
+constexpr float WORLD_SIZE = 200000.f;
+constexpr float MAX_BOUNDARY_MOVE = 5000.f;
+constexpr float MINIMUM_CELL_SIZE = 10000.f;
+
+UDynamicGridLBStrategy* CreateStrategy(uint32 Rows, uint32 Cols)
+{
+	UDynamicGridLBStrategy* Strat = UTestDynamicGridLBStrategy::Create(Rows, Cols, WORLD_SIZE, WORLD_SIZE, MAX_BOUNDARY_MOVE, MINIMUM_CELL_SIZE);
+	Strat->Init();
+	Strat->SetVirtualWorkerIds(1, Strat->GetMinimumRequiredWorkers());
+	Strat->SetLocalVirtualWorkerId(1);
+	return Strat;
+}
+
+// Synthetic load: most of it clustered around a hotspot near one corner of the world, the rest spread evenly.
+TArray<FVector2D> CreateHotspotLoad(int32 NumPoints, const FVector2D& Hotspot, float HotspotRadius)
+{
+	FRandomStream Stream(1234);
+	TArray<FVector2D> Points;
+	Points.Reserve(NumPoints);
+	for (int32 i = 0; i < NumPoints; i++)
+	{
+		if (i % 5 == 0)
+		{
+			Points.Add(FVector2D(Stream.FRandRange(-WORLD_SIZE / 2.f, WORLD_SIZE / 2.f), Stream.FRandRange(-WORLD_SIZE / 2.f, WORLD_SIZE / 2.f)));
+		}
+		else
+		{
+			Points.Add(Hotspot + FVector2D(Stream.FRandRange(-HotspotRadius, HotspotRadius), Stream.FRandRange(-HotspotRadius, HotspotRadius)));
+		}
+	}
+	return Points;
+}
+
+// The load each virtual worker would report: one per point in its cell.
+TMap<VirtualWorkerId, float> MeasureLoads(const UDynamicGridLBStrategy& Strat, const TArray<FVector2D>& Points)
+{
+	TMap<VirtualWorkerId, float> Loads;
+	for (const VirtualWorkerId Id : Strat.GetVirtualWorkerIds())
+	{
+		Loads.Add(Id, 0.f);
+	}
+	for (const FVector2D& Point : Points)
+	{
+		const VirtualWorkerId Id = Strat.WhoShouldHaveAuthorityForLocation(Point);
+		if (Id != SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
+		{
+			Loads[Id] += 1.f;
+		}
+	}
+	return Loads;
+}
+
+// How much more load than the average the busiest row or column carries, as a fraction of the average.
+float GetImbalance(const TMap<VirtualWorkerId, float>& Loads, uint32 Rows, uint32 Cols)
+{
+	TArray<float> RowLoads;
+	TArray<float> ColumnLoads;
+	RowLoads.SetNumZeroed(Rows);
+	ColumnLoads.SetNumZeroed(Cols);
+
+	float TotalLoad = 0.f;
+	for (uint32 CellIndex = 0; CellIndex < Rows * Cols; CellIndex++)
+	{
+		// Virtual workers are assigned to cells in order, starting at 1.
+		const float Load = Loads.FindChecked(CellIndex + 1);
+		RowLoads[CellIndex % Rows] += Load;
+		ColumnLoads[CellIndex / Rows] += Load;
+		TotalLoad += Load;
+	}
+
+	const float MaxRowLoad = FMath::Max(RowLoads);
+	const float MaxColumnLoad = FMath::Max(ColumnLoads);
+	return FMath::Max(MaxRowLoad / (TotalLoad / Rows), MaxColumnLoad / (TotalLoad / Cols)) - 1.f;
+}
+
+float GetLargestMove(const TArray<float>& Before, const TArray<float>& After)
+{
+	float LargestMove = 0.f;
+	for (int32 i = 0; i < Before.Num(); i++)
+	{
+		LargestMove = FMath::Max(LargestMove, FMath::Abs(After[i] - Before[i]));
+	}
+	return LargestMove;
+}
+
+float GetSmallestInterval(const TArray<float>& Boundaries)
+{
+	float SmallestInterval = MAX_flt;
+	for (int32 i = 1; i < Boundaries.Num(); i++)
+	{
+		SmallestInterval = FMath::Min(SmallestInterval, Boundaries[i] - Boundaries[i - 1]);
+	}
+	return SmallestInterval;
+}
+
+} // anonymous namespace
+
+DYNAMICGRIDLBSTRATEGY_TEST(GIVEN_even_load_WHEN_rebalancing_THEN_boundaries_do_not_move)
+{
+	UDynamicGridLBStrategy* Strat = CreateStrategy(2, 2);
+	const TArray<float> RowBoundaries = Strat->GetRowBoundaries();
+	const TArray<float> ColumnBoundaries = Strat->GetColumnBoundaries();
+
+	const TMap<VirtualWorkerId, float> Loads = { { 1, 100.f }, { 2, 110.f }, { 3, 95.f }, { 4, 105.f } };
+
+	TestFalse(TEXT("Nothing is rebalanced"), Strat->RebalanceFromLoads(Loads));
+	TestTrue(TEXT("Row boundaries are unchanged"), Strat->GetRowBoundaries() == RowBoundaries);
+	TestTrue(TEXT("Column boundaries are unchanged"), Strat->GetColumnBoundaries() == ColumnBoundaries);
+	TestEqual(TEXT("The partition version is unchanged"), static_cast<int32>(Strat->GetPartitionVersion()), 0);
+
+	return true;
+}
+
+DYNAMICGRIDLBSTRATEGY_TEST(GIVEN_a_virtual_worker_has_not_reported_WHEN_rebalancing_THEN_boundaries_do_not_move)
+{
+	UDynamicGridLBStrategy* Strat = CreateStrategy(2, 2);
+
+	const TMap<VirtualWorkerId, float> Loads = { { 1, 1000.f }, { 2, 0.f }, { 3, 0.f } };
+
+	TestFalse(TEXT("Nothing is rebalanced"), Strat->RebalanceFromLoads(Loads));
+	TestEqual(TEXT("The partition version is unchanged"), static_cast<int32>(Strat->GetPartitionVersion()), 0);
+
+	return true;
+}
+
+DYNAMICGRIDLBSTRATEGY_TEST(GIVEN_a_hotspot_WHEN_rebalancing_repeatedly_THEN_loads_converge_within_the_movement_and_size_limits)
+{
+	constexpr uint32 Rows = 3;
+	constexpr uint32 Cols = 3;
+	constexpr int32 MaxRebalances = 100;
+
+	UDynamicGridLBStrategy* Strat = CreateStrategy(Rows, Cols);
+	const TArray<FVector2D> Points = CreateHotspotLoad(10000, FVector2D(-60000.f, 50000.f), 15000.f);
+
+	const float InitialImbalance = GetImbalance(MeasureLoads(*Strat, Points), Rows, Cols);
+
+	int32 NumRebalances = 0;
+	float LargestMove = 0.f;
+	float SmallestInterval = MAX_flt;
+	while (NumRebalances < MaxRebalances)
+	{
+		const TArray<float> RowBoundaries = Strat->GetRowBoundaries();
+		const TArray<float> ColumnBoundaries = Strat->GetColumnBoundaries();
+
+		if (!Strat->RebalanceFromLoads(MeasureLoads(*Strat, Points)))
+		{
+			break;
+		}
+		NumRebalances++;
+
+		LargestMove = FMath::Max(LargestMove, FMath::Max(GetLargestMove(RowBoundaries, Strat->GetRowBoundaries()), GetLargestMove(ColumnBoundaries, Strat->GetColumnBoundaries())));
+		SmallestInterval = FMath::Min(SmallestInterval, FMath::Min(GetSmallestInterval(Strat->GetRowBoundaries()), GetSmallestInterval(Strat->GetColumnBoundaries())));
+	}
+
+	const float FinalImbalance = GetImbalance(MeasureLoads(*Strat, Points), Rows, Cols);
+
+	TestTrue(TEXT("The hotspot starts out unbalanced"), InitialImbalance > 0.2f);
+	TestTrue(TEXT("The boundaries stop moving"), NumRebalances > 0 && NumRebalances < MaxRebalances);
+	TestTrue(TEXT("The load converges within the imbalance threshold"), FinalImbalance <= 0.2f);
+	TestTrue(TEXT("No boundary moves further than the limit in one rebalance"), LargestMove <= MAX_BOUNDARY_MOVE + KINDA_SMALL_NUMBER);
+	TestTrue(TEXT("No row or column becomes narrower than the minimum"), SmallestInterval >= MINIMUM_CELL_SIZE - 1.f);
+	TestEqual(TEXT("The grid keeps its outer edges"), Strat->GetRowBoundaries()[0], -WORLD_SIZE / 2.f);
+	TestEqual(TEXT("The grid keeps its outer edges"), Strat->GetColumnBoundaries().Last(), WORLD_SIZE / 2.f);
+	TestEqual(TEXT("Each rebalance is a new partition version"), static_cast<int32>(Strat->GetPartitionVersion()), NumRebalances);
+
+	AddInfo(FString::Printf(TEXT("Imbalance went from %.2f to %.2f over %d rebalances"), InitialImbalance, FinalImbalance, NumRebalances));
+
+	return true;
+}
+
+DYNAMICGRIDLBSTRATEGY_TEST(GIVEN_two_strategies_WHEN_rebalancing_from_the_same_loads_THEN_they_produce_the_same_boundaries)
+{
+	UDynamicGridLBStrategy* StratA = CreateStrategy(4, 2);
+	UDynamicGridLBStrategy* StratB = CreateStrategy(4, 2);
+	const TArray<FVector2D> Points = CreateHotspotLoad(5000, FVector2D(30000.f, -70000.f), 10000.f);
+
+	for (int32 i = 0; i < 10; i++)
+	{
+		const TMap<VirtualWorkerId, float> Loads = MeasureLoads(*StratA, Points);
+		TestEqual(TEXT("Both strategies rebalance"), StratA->RebalanceFromLoads(Loads), StratB->RebalanceFromLoads(Loads));
+	}
+
+	TestTrue(TEXT("Row boundaries are identical"), StratA->GetRowBoundaries() == StratB->GetRowBoundaries());
+	TestTrue(TEXT("Column boundaries are identical"), StratA->GetColumnBoundaries() == StratB->GetColumnBoundaries());
+
+	return true;
+}
+
+DYNAMICGRIDLBSTRATEGY_TEST(GIVEN_rebalanced_strategy_WHEN_partition_is_applied_from_schema_THEN_other_strategy_agrees_on_authority)
+{
+	UDynamicGridLBStrategy* Writer = CreateStrategy(2, 3);
+	UDynamicGridLBStrategy* Reader = CreateStrategy(2, 3);
+	const TArray<FVector2D> Points = CreateHotspotLoad(5000, FVector2D(-80000.f, -80000.f), 10000.f);
+
+	Schema_ComponentData* StaleData = Schema_CreateComponentData();
+	Writer->WritePartitionToSchema(Schema_GetComponentDataFields(StaleData));
+
+	Writer->RebalanceFromLoads(MeasureLoads(*Writer, Points));
+	Writer->RebalanceFromLoads(MeasureLoads(*Writer, Points));
+
+	Schema_ComponentData* Data = Schema_CreateComponentData();
+	Writer->WritePartitionToSchema(Schema_GetComponentDataFields(Data));
+	Reader->ApplyPartitionFromSchema(Schema_GetComponentDataFields(Data));
+
+	TestEqual(TEXT("The partition version is applied"), static_cast<int32>(Reader->GetPartitionVersion()), static_cast<int32>(Writer->GetPartitionVersion()));
+	TestTrue(TEXT("Row boundaries are applied"), Reader->GetRowBoundaries() == Writer->GetRowBoundaries());
+	TestTrue(TEXT("Column boundaries are applied"), Reader->GetColumnBoundaries() == Writer->GetColumnBoundaries());
+
+	bool bAgreeOnAuthority = true;
+	for (const FVector2D& Point : Points)
+	{
+		bAgreeOnAuthority &= Reader->WhoShouldHaveAuthorityForLocation(Point) == Writer->WhoShouldHaveAuthorityForLocation(Point);
+	}
+	TestTrue(TEXT("Both strategies choose the same virtual worker for every location"), bAgreeOnAuthority);
+
+	const TArray<float> AppliedRowBoundaries = Reader->GetRowBoundaries();
+	Reader->ApplyPartitionFromSchema(Schema_GetComponentDataFields(StaleData));
+	TestTrue(TEXT("An older partition is ignored"), Reader->GetRowBoundaries() == AppliedRowBoundaries);
+	TestEqual(TEXT("The partition version is kept"), static_cast<int32>(Reader->GetPartitionVersion()), static_cast<int32>(Writer->GetPartitionVersion()));
+
+	Schema_DestroyComponentData(StaleData);
+	Schema_DestroyComponentData(Data);
+
+	return true;
+}
+
+DYNAMICGRIDLBSTRATEGY_TEST(GIVEN_partition_for_a_different_grid_size_WHEN_applied_THEN_it_is_rejected)
+{
+	UDynamicGridLBStrategy* Writer = CreateStrategy(3, 3);
+	UDynamicGridLBStrategy* Reader = CreateStrategy(2, 2);
+	const TArray<float> RowBoundaries = Reader->GetRowBoundaries();
+
+	Writer->RebalanceFromLoads(MeasureLoads(*Writer, CreateHotspotLoad(1000, FVector2D(50000.f, 50000.f), 5000.f)));
+
+	Schema_ComponentData* Data = Schema_CreateComponentData();
+	Writer->WritePartitionToSchema(Schema_GetComponentDataFields(Data));
+
+	AddExpectedError(TEXT("Received grid partition with 4 row and 4 column boundaries, but the grid has 2 rows and 2 columns."), EAutomationExpectedErrorFlags::Contains, 1);
+	Reader->ApplyPartitionFromSchema(Schema_GetComponentDataFields(Data));
+
+	TestTrue(TEXT("Row boundaries are unchanged"), Reader->GetRowBoundaries() == RowBoundaries);
+	TestEqual(TEXT("The partition version is unchanged"), static_cast<int32>(Reader->GetPartitionVersion()), 0);
+
+	Schema_DestroyComponentData(Data);
+
+	return true;
+}
+
+DYNAMICGRIDLBSTRATEGY_TEST(GIVEN_rebalanced_strategy_WHEN_looking_up_authority_THEN_each_location_is_in_its_virtual_workers_cell)
+{
+	UDynamicGridLBStrategy* Strat = CreateStrategy(3, 2);
+	const TArray<FVector2D> Points = CreateHotspotLoad(5000, FVector2D(10000.f, 40000.f), 20000.f);
+
+	for (int32 i = 0; i < 5; i++)
+	{
+		Strat->RebalanceFromLoads(MeasureLoads(*Strat, Points));
+	}
+
+	bool bInsideCell = true;
+	for (const FVector2D& Point : Points)
+	{
+		const VirtualWorkerId Id = Strat->WhoShouldHaveAuthorityForLocation(Point);
+		const FBox2D Cell = Strat->GetCell(Id - 1);
+		bInsideCell &= Point.X >= Cell.Min.X && Point.Y >= Cell.Min.Y && Point.X < Cell.Max.X && Point.Y < Cell.Max.Y;
+	}
+	TestTrue(TEXT("Every location is inside the cell of the virtual worker chosen for it"), bInsideCell);
+
+	return true;
+}
@@ -0,0 +1,21 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestDynamicGridLBStrategy.h"
+
+UDynamicGridLBStrategy* UTestDynamicGridLBStrategy::Create(uint32 InRows, uint32 InCols, float WorldWidth, float WorldHeight,
+	float MaxBoundaryMovePerRebalance, float MinimumCellSize, float ImbalanceThreshold)
+{
+	UTestDynamicGridLBStrategy* Strat = NewObject<UTestDynamicGridLBStrategy>();
+
+	Strat->Rows = InRows;
+	Strat->Cols = InCols;
+
+	Strat->WorldWidth = WorldWidth;
+	Strat->WorldHeight = WorldHeight;
+
+	Strat->MaxBoundaryMovePerRebalance = MaxBoundaryMovePerRebalance;
+	Strat->MinimumCellSize = MinimumCellSize;
+	Strat->ImbalanceThreshold = ImbalanceThreshold;
+
+	return Strat;
+}
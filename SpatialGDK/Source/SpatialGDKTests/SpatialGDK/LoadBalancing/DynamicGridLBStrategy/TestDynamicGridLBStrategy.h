@@ -0,0 +1,21 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LoadBalancing/DynamicGridLBStrategy.h"
+#include "TestDynamicGridLBStrategy.generated.h"
+
+/**
+ * This class is for testing purposes only.
+ */
+UCLASS(HideDropdown, NotBlueprintable)
+class SPATIALGDKTESTS_API UTestDynamicGridLBStrategy : public UDynamicGridLBStrategy
+{
+	GENERATED_BODY()
+
+public:
+
+	static UDynamicGridLBStrategy* Create(uint32 Rows, uint32 Cols, float WorldWidth, float WorldHeight,
+		float MaxBoundaryMovePerRebalance, float MinimumCellSize, float ImbalanceThreshold = 0.2f);
+};
@@ -14,6 +14,10 @@
 #include "Tests/AutomationEditorCommon.h"
 #include "Tests/TestDefinitions.h"
 
+#include "Math/RandomStream.h"
+
+#include <cmath>
+
 #define GRIDBASEDLBSTRATEGY_TEST(TestName) \
 	GDK_TEST(Core, UGridBasedLBStrategy, TestName)
 
@@ -51,6 +55,90 @@ void CreateStrategy(uint32 Rows, uint32 Cols, float WorldWidth, float WorldHeigh
 	Strat->SetLocalVirtualWorkerId(LocalWorkerId);
 }
 
+// The lookup WhoShouldHaveAuthority used to do: test every cell in turn.
+VirtualWorkerId WhoShouldHaveAuthorityByScanningCells(const UGridBasedLBStrategy::LBStrategyRegions& Regions, const FVector2D& Location, uint64* OutNumCellsTested = nullptr)
+{
+	for (const TPair<VirtualWorkerId, FBox2D>& Region : Regions)
+	{
+		if (OutNumCellsTested != nullptr)
+		{
+			(*OutNumCellsTested)++;
+		}
+
+		const FBox2D& Cell = Region.Value;
+		if (Location.X >= Cell.Min.X && Location.Y >= Cell.Min.Y && Location.X < Cell.Max.X && Location.Y < Cell.Max.Y)
+		{
+			return Region.Key;
+		}
+	}
+
+	return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+}
+
+// Every cell boundary, and the floats either side of it.
+TArray<float> GetValuesAroundBoundaries(const UGridBasedLBStrategy::LBStrategyRegions& Regions, bool bX)
+{
+	TArray<float> Values;
+	for (const TPair<VirtualWorkerId, FBox2D>& Region : Regions)
+	{
+		for (const float Boundary : { bX ? Region.Value.Min.X : Region.Value.Min.Y, bX ? Region.Value.Max.X : Region.Value.Max.Y })
+		{
+			Values.AddUnique(std::nextafter(Boundary, -MAX_flt));
+			Values.AddUnique(Boundary);
+			Values.AddUnique(std::nextafter(Boundary, MAX_flt));
+		}
+	}
+	return Values;
+}
+
+// A strategy with two cells split at X = 0, running on the worker for the cell with negative X.
+UTestGridBasedLBStrategy* CreateDampedStrategy(float InterestBorder, float HysteresisDistance, float DwellTime, uint32 Rows = 2, uint32 Cols = 1)
+{
+	UTestGridBasedLBStrategy* DampedStrat = Cast<UTestGridBasedLBStrategy>(UTestGridBasedLBStrategy::Create(Rows, Cols, 10000.f, 10000.f, InterestBorder));
+	DampedStrat->SetAuthorityTransferDamping(HysteresisDistance, DwellTime);
+	DampedStrat->Init();
+	DampedStrat->SetVirtualWorkerIds(1, DampedStrat->GetMinimumRequiredWorkers());
+	DampedStrat->SetLocalVirtualWorkerId(1);
+	return DampedStrat;
+}
+
+// One step of an actor's scripted trajectory, with whether the worker should still keep authority over it after it.
+struct FTrajectoryStep
+{
+	double Time;
+	FVector2D Location;
+	bool bExpectKeepAuthority;
+};
+
+struct FTestActor
+{
+	FTestActor()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false);
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.bNoFail = true;
+		Actor = World->SpawnActor<AActor>(SpawnParams);
+	}
+
+	~FTestActor()
+	{
+		World->DestroyWorld(false);
+	}
+
+	UWorld* World;
+	AActor* Actor;
+};
+
+void RunTrajectory(FAutomationTestBase& Test, UTestGridBasedLBStrategy& DampedStrat, const AActor& Actor, const TArray<FTrajectoryStep>& Trajectory)
+{
+	for (const FTrajectoryStep& Step : Trajectory)
+	{
+		const bool bKeepAuthority = DampedStrat.ShouldKeepAuthorityAtLocation(Actor, Step.Location, Step.Time);
+		Test.TestEqual(FString::Printf(TEXT("Keeps authority at (%.1f, %.1f) after %.1f seconds"), Step.Location.X, Step.Location.Y, Step.Time), bKeepAuthority, Step.bExpectKeepAuthority);
+	}
+}
+
 DEFINE_LATENT_AUTOMATION_COMMAND(FCleanup);
 bool FCleanup::Update()
 {
@@ -257,6 +345,226 @@ GRIDBASEDLBSTRATEGY_TEST(GIVEN_more_than_one_column_WHEN_requires_handover_data_
 	return true;
 }
 
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_locations_on_and_around_cell_edges_WHEN_who_should_have_authority_for_locations_called_THEN_matches_testing_every_cell)
+{
+	// Sizes which don't divide evenly, so the cell boundaries carry rounding error.
+	CreateStrategy(3, 7, 1000.3f, 777.7f, 1);
+
+	const UGridBasedLBStrategy::LBStrategyRegions Regions = Strat->GetLBStrategyRegions();
+	const TArray<float> Xs = GetValuesAroundBoundaries(Regions, true);
+	const TArray<float> Ys = GetValuesAroundBoundaries(Regions, false);
+
+	TArray<FVector2D> Locations;
+	for (const float X : Xs)
+	{
+		for (const float Y : Ys)
+		{
+			Locations.Add(FVector2D(X, Y));
+		}
+	}
+	Locations.Add(FVector2D(NAN, 0.f));
+	Locations.Add(FVector2D(0.f, NAN));
+	Locations.Add(FVector2D(-MAX_flt, MAX_flt));
+
+	TArray<VirtualWorkerId> Actual;
+	Actual.SetNum(Locations.Num());
+	Strat->WhoShouldHaveAuthorityForLocations(Locations, Actual);
+
+	int32 NumInvalid = 0;
+	for (int32 i = 0; i < Locations.Num(); i++)
+	{
+		const VirtualWorkerId Expected = WhoShouldHaveAuthorityByScanningCells(Regions, Locations[i]);
+		if (Actual[i] != Expected)
+		{
+			AddError(FString::Printf(TEXT("Location (%.9g, %.9g): worker %d, expected %d"), Locations[i].X, Locations[i].Y, Actual[i], Expected));
+		}
+		NumInvalid += Expected == SpatialConstants::INVALID_VIRTUAL_WORKER_ID ? 1 : 0;
+	}
+
+	TestTrue(TEXT("Some locations are outside the grid"), NumInvalid > 0);
+	TestTrue(TEXT("Some locations are inside the grid"), NumInvalid < Locations.Num());
+
+	return true;
+}
+
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_moving_locations_WHEN_predict_who_should_have_authority_for_location_called_THEN_returns_the_cell_they_are_heading_for)
+{
+	// Two rows split at X = 0: virtual worker 1 has X < 0, virtual worker 2 has X >= 0.
+	CreateStrategy(2, 1, 1000.f, 1000.f, 1);
+
+	const FVector2D Location(-50.f, 0.f);
+	TestEqual(TEXT("Heading across the boundary"), Strat->PredictWhoShouldHaveAuthorityForLocation(Location, FVector2D(100.f, 0.f), 1.f), 2u);
+	TestEqual(TEXT("Not moving"), Strat->PredictWhoShouldHaveAuthorityForLocation(Location, FVector2D::ZeroVector, 1.f), 1u);
+	TestEqual(TEXT("Heading away from the boundary"), Strat->PredictWhoShouldHaveAuthorityForLocation(Location, FVector2D(-100.f, 0.f), 1.f), 1u);
+	TestEqual(TEXT("Not reaching the boundary within the lookahead"), Strat->PredictWhoShouldHaveAuthorityForLocation(Location, FVector2D(100.f, 0.f), 0.25f), 1u);
+	TestEqual(TEXT("Heading out of the grid"), Strat->PredictWhoShouldHaveAuthorityForLocation(Location, FVector2D(0.f, 10000.f), 1.f), 1u);
+	TestEqual(TEXT("Outside the grid"), Strat->PredictWhoShouldHaveAuthorityForLocation(FVector2D(5000.f, 0.f), FVector2D::ZeroVector, 1.f), SpatialConstants::INVALID_VIRTUAL_WORKER_ID);
+
+	return true;
+}
+
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_100k_actor_locations_on_a_16_by_16_grid_WHEN_who_should_have_authority_for_locations_called_THEN_matches_testing_every_cell_with_a_constant_number_of_tests)
+{
+	constexpr int32 NumActors = 100000;
+	constexpr float WorldSize = 1000000.f;
+
+	CreateStrategy(16, 16, WorldSize, WorldSize, 1);
+
+	// Spread the actors over a slightly larger area than the world, so some are outside the grid.
+	FRandomStream RandomStream(1234);
+	TArray<FVector2D> Locations;
+	Locations.Reserve(NumActors);
+	for (int32 i = 0; i < NumActors; i++)
+	{
+		Locations.Add(FVector2D(RandomStream.FRandRange(-0.55f * WorldSize, 0.55f * WorldSize), RandomStream.FRandRange(-0.55f * WorldSize, 0.55f * WorldSize)));
+	}
+
+	const UGridBasedLBStrategy::LBStrategyRegions Regions = Strat->GetLBStrategyRegions();
+	TArray<VirtualWorkerId> Expected;
+	Expected.SetNum(NumActors);
+
+	uint64 NumCellsTested = 0;
+	for (int32 i = 0; i < NumActors; i++)
+	{
+		Expected[i] = WhoShouldHaveAuthorityByScanningCells(Regions, Locations[i], &NumCellsTested);
+	}
+
+	TArray<VirtualWorkerId> Actual;
+	Actual.SetNum(NumActors);
+	Strat->WhoShouldHaveAuthorityForLocations(Locations, Actual);
+
+	// The same lookup WhoShouldHaveAuthorityForLocations makes, counting the boundaries it tests.
+	const UTestGridBasedLBStrategy* TestStrat = Cast<UTestGridBasedLBStrategy>(Strat);
+	uint64 NumBoundariesTested = 0;
+	for (const FVector2D& Location : Locations)
+	{
+		TestStrat->GetCellIndex(Location, NumBoundariesTested);
+	}
+
+	// Each axis tests its outer boundaries, and the boundaries either side of the estimated interval plus any it corrects by.
+	// Rounding moves the estimate by at most one interval.
+	const uint64 MaxBoundariesTestedPerLookup = 2 * (2 + 2 + 1);
+
+	TestTrue(TEXT("Every actor gets the same worker as testing every cell"), Actual == Expected);
+	TestTrue(TEXT("Each lookup tests a constant number of boundaries"), NumBoundariesTested <= MaxBoundariesTestedPerLookup * NumActors);
+	TestTrue(TEXT("The lookup tests fewer boundaries than testing every cell tests cells"), NumBoundariesTested < NumCellsTested);
+
+	return true;
+}
+
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_hysteresis_distance_WHEN_actor_oscillates_across_boundary_THEN_authority_is_kept_until_it_leaves_the_band)
+{
+	FTestActor TestActor;
+	UTestGridBasedLBStrategy* DampedStrat = CreateDampedStrategy(200.f, 100.f, 0.f);
+
+	RunTrajectory(*this, *DampedStrat, *TestActor.Actor, {
+		{ 0.0, FVector2D(-50.f, 0.f), true },
+		{ 0.1, FVector2D(50.f, 0.f), true },
+		{ 0.2, FVector2D(-50.f, 0.f), true },
+		{ 0.3, FVector2D(80.f, 0.f), true },
+		{ 0.4, FVector2D(-20.f, 0.f), true },
+		{ 0.5, FVector2D(99.f, 0.f), true },
+		{ 0.6, FVector2D(150.f, 0.f), false },
+	});
+
+	const UGridBasedLBStrategy::FAuthorityTransferStats& Stats = DampedStrat->GetAuthorityTransferStats();
+	TestEqual(TEXT("Crossings within the band are suppressed"), static_cast<int32>(Stats.NumSuppressedByHysteresis), 3);
+	TestEqual(TEXT("Leaving the band allows the transfer"), static_cast<int32>(Stats.NumTransfersAllowed), 1);
+
+	return true;
+}
+
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_hysteresis_distance_WHEN_stationary_actor_is_kept_inside_the_band_THEN_no_handover_is_predicted)
+{
+	FTestActor TestActor;
+	UTestGridBasedLBStrategy* DampedStrat = CreateDampedStrategy(200.f, 100.f, 0.f);
+
+	// Past the boundary, in the cell of virtual worker 2, but kept by virtual worker 1.
+	const FVector2D Location(50.f, 0.f);
+	TestTrue(TEXT("The actor is kept inside the band"), DampedStrat->ShouldKeepAuthorityAtLocation(*TestActor.Actor, Location, 0.0));
+
+	// Neither worker predicts a handover, so the keeping worker doesn't prefetch it and the other worker doesn't prewarm it.
+	TestEqual(TEXT("Standing still inside the band"), DampedStrat->PredictWhoShouldHaveAuthorityForLocation(Location, FVector2D::ZeroVector, 1.f), SpatialConstants::INVALID_VIRTUAL_WORKER_ID);
+	TestEqual(TEXT("Heading back inside the band"), DampedStrat->PredictWhoShouldHaveAuthorityForLocation(Location, FVector2D(-100.f, 0.f), 1.f), SpatialConstants::INVALID_VIRTUAL_WORKER_ID);
+	TestEqual(TEXT("Heading out of the band"), DampedStrat->PredictWhoShouldHaveAuthorityForLocation(Location, FVector2D(100.f, 0.f), 1.f), 2u);
+	TestEqual(TEXT("Standing still away from the band"), DampedStrat->PredictWhoShouldHaveAuthorityForLocation(FVector2D(-500.f, 0.f), FVector2D::ZeroVector, 1.f), 1u);
+
+	return true;
+}
+
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_dwell_time_WHEN_actor_returns_before_it_passes_THEN_the_dwell_time_restarts)
+{
+	FTestActor TestActor;
+	UTestGridBasedLBStrategy* DampedStrat = CreateDampedStrategy(0.f, 0.f, 1.f);
+
+	RunTrajectory(*this, *DampedStrat, *TestActor.Actor, {
+		{ 0.0, FVector2D(10.f, 0.f), true },
+		{ 0.5, FVector2D(-10.f, 0.f), true },
+		{ 0.6, FVector2D(10.f, 0.f), true },
+		{ 1.5, FVector2D(10.f, 0.f), true },
+		{ 1.7, FVector2D(10.f, 0.f), false },
+	});
+
+	const UGridBasedLBStrategy::FAuthorityTransferStats& Stats = DampedStrat->GetAuthorityTransferStats();
+	TestEqual(TEXT("Transfers within the dwell time are suppressed"), static_cast<int32>(Stats.NumSuppressedByDwellTime), 3);
+	TestEqual(TEXT("The transfer is allowed once the dwell time has passed"), static_cast<int32>(Stats.NumTransfersAllowed), 1);
+	TestEqual(TEXT("Nothing is left pending"), DampedStrat->GetNumPendingTransfers(), 0);
+
+	return true;
+}
+
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_dwell_time_WHEN_actor_heads_for_a_different_cell_THEN_the_dwell_time_restarts)
+{
+	FTestActor TestActor;
+	UTestGridBasedLBStrategy* DampedStrat = CreateDampedStrategy(0.f, 0.f, 1.f, 2, 2);
+
+	// The local cell is the one with negative X and Y, so the actor first heads for the cell with positive X, then the one with positive Y.
+	RunTrajectory(*this, *DampedStrat, *TestActor.Actor, {
+		{ 0.0, FVector2D(10.f, -10.f), true },
+		{ 0.8, FVector2D(-10.f, 10.f), true },
+		{ 1.5, FVector2D(-10.f, 10.f), true },
+		{ 1.9, FVector2D(-10.f, 10.f), false },
+	});
+
+	return true;
+}
+
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_hysteresis_distance_larger_than_interest_border_WHEN_initialized_THEN_it_is_limited_to_the_interest_border)
+{
+	AddExpectedError(TEXT("larger than InterestBorder"), EAutomationExpectedErrorFlags::Contains, 1);
+
+	FTestActor TestActor;
+	UTestGridBasedLBStrategy* DampedStrat = CreateDampedStrategy(100.f, 500.f, 0.f);
+
+	RunTrajectory(*this, *DampedStrat, *TestActor.Actor, {
+		{ 0.0, FVector2D(99.f, 0.f), true },
+		{ 0.1, FVector2D(101.f, 0.f), false },
+	});
+
+	return true;
+}
+
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_pending_transfers_WHEN_actors_are_destroyed_or_lose_authority_THEN_they_are_forgotten)
+{
+	FTestActor TestActor;
+	FTestActor DestroyedActor;
+	FTestActor NonAuthActor;
+	UTestGridBasedLBStrategy* DampedStrat = CreateDampedStrategy(0.f, 0.f, 100.f);
+
+	DampedStrat->ShouldKeepAuthorityAtLocation(*DestroyedActor.Actor, FVector2D(10.f, 0.f), 0.0);
+	DampedStrat->ShouldKeepAuthorityAtLocation(*NonAuthActor.Actor, FVector2D(10.f, 0.f), 0.0);
+	TestEqual(TEXT("Both transfers are pending"), DampedStrat->GetNumPendingTransfers(), 2);
+
+	DestroyedActor.World->DestroyActor(DestroyedActor.Actor);
+	NonAuthActor.Actor->Role = ROLE_SimulatedProxy;
+
+	// Evaluating any actor long enough later purges the stale transfers.
+	DampedStrat->ShouldKeepAuthorityAtLocation(*TestActor.Actor, FVector2D(-10.f, 0.f), 60.0);
+	TestEqual(TEXT("Stale transfers are forgotten"), DampedStrat->GetNumPendingTransfers(), 0);
+
+	return true;
+}
+
 }  // anonymous namespace
 
 GRIDBASEDLBSTRATEGY_TEST(GIVEN_a_single_cell_and_valid_local_id_WHEN_should_relinquish_called_THEN_returns_false)
@@ -16,3 +16,9 @@ UGridBasedLBStrategy* UTestGridBasedLBStrategy::Create(uint32 InRows, uint32 InC
 
 	return Strat;
 }
+
+void UTestGridBasedLBStrategy::SetAuthorityTransferDamping(float InAuthorityHysteresisDistance, float InAuthorityTransferDwellTime)
+{
+	AuthorityHysteresisDistance = InAuthorityHysteresisDistance;
+	AuthorityTransferDwellTime = InAuthorityTransferDwellTime;
+}
@@ -17,4 +17,10 @@ class SPATIALGDKTESTS_API UTestGridBasedLBStrategy : public UGridBasedLBStrategy
 public:
 
 	static UGridBasedLBStrategy* Create(uint32 Rows, uint32 Cols, float WorldWidth, float WorldHeight, float InterestBorder = 0.0f);
+
+	// Must be called before Init.
+	void SetAuthorityTransferDamping(float InAuthorityHysteresisDistance, float InAuthorityTransferDwellTime);
+
+	using UGridBasedLBStrategy::ShouldKeepAuthorityAtLocation;
+	using UGridBasedLBStrategy::GetCellIndex;
 };
@@ -0,0 +1,287 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "LoadBalancing/DynamicGridLBStrategy.h"
+#include "LoadBalancing/GridBasedLBStrategy.h"
+#include "LoadBalancing/LBStrategySimulator.h"
+#include "Schema/Interest.h"
+#include "SpatialGDKTests/SpatialGDK/LoadBalancing/DynamicGridLBStrategy/TestDynamicGridLBStrategy.h"
+#include "SpatialGDKTests/SpatialGDK/LoadBalancing/GridBasedLBStrategy/TestGridBasedLBStrategy.h"
+
+#include "CoreMinimal.h"
+#include "Tests/TestDefinitions.h"
+
+#define LBSTRATEGYSIMULATOR_TEST(TestName) \
+	GDK_TEST(Core, FLBStrategySimulator, TestName)
+
+namespace
+{
+
+// Two rows split at X = 0: virtual worker 1 has X < 0, virtual worker 2 has X >= 0.
+FLBStrategySimulator::FStrategyFactory CreateTwoRowGrid(float InterestBorder = 0.f, float AuthorityTransferDwellTime = 0.f)
+{
+	return [InterestBorder, AuthorityTransferDwellTime](UObject*) -> UAbstractLBStrategy*
+	{
+		UGridBasedLBStrategy* Strat = UTestGridBasedLBStrategy::Create(2, 1, 1000.f, 1000.f, InterestBorder);
+		Cast<UTestGridBasedLBStrategy>(Strat)->SetAuthorityTransferDamping(0.f, AuthorityTransferDwellTime);
+		return Strat;
+	};
+}
+
+// Actors sampled every 0.1 seconds, crossing the boundary at 100 units per second from different starting points.
+void AddCrossingActors(FLBTrace& Trace, int32 FirstActorId, int32 NumActors, int32 NumFrames)
+{
+	for (int32 Frame = 0; Frame < NumFrames; Frame++)
+	{
+		for (int32 Index = 0; Index < NumActors; Index++)
+		{
+			Trace.AddSample(Frame * 0.1, FirstActorId + Index, FVector(-300.f - 30.f * Index + 10.f * Frame, 0.f, 0.f));
+		}
+	}
+}
+
+// An Actor sampled every 0.1 seconds, alternating between either side of the boundary.
+FLBTrace CreateOscillatingTrace(int32 NumFrames)
+{
+	FLBTrace Trace;
+	for (int32 Frame = 0; Frame < NumFrames; Frame++)
+	{
+		Trace.AddSample(Frame * 0.1, 0, FVector(Frame % 2 == 0 ? -20.f : 20.f, 0.f, 0.f));
+	}
+	return Trace;
+}
+
+} // anonymous namespace
+
+LBSTRATEGYSIMULATOR_TEST(GIVEN_csv_with_header_WHEN_parsed_THEN_samples_are_sorted_by_time)
+{
+	const FString CSV = TEXT("Time,ActorId,X,Y,Z\n1.0, 7, 10, 20, 30\n0.5,3,-1.5,2,0\n\n");
+
+	FLBTrace Trace;
+	FString Error;
+	TestTrue(TEXT("The trace is parsed"), FLBTrace::ParseCSV(CSV, Trace, Error));
+
+	const TArray<FLBTrace::FSample>& Samples = Trace.GetSamples();
+	TestEqual(TEXT("Both samples are parsed"), Samples.Num(), 2);
+	TestEqual(TEXT("The earliest sample comes first"), Samples[0].ActorId, 3);
+	TestEqual(TEXT("Locations are parsed"), Samples[0].Location, FVector(-1.5f, 2.f, 0.f));
+	TestEqual(TEXT("Later samples come after"), Samples[1].ActorId, 7);
+
+	FLBTrace RoundTripped;
+	TestTrue(TEXT("The written trace is parsed"), FLBTrace::ParseCSV(Trace.ToCSV(), RoundTripped, Error));
+	TestEqual(TEXT("The written trace has every sample"), RoundTripped.GetSamples().Num(), 2);
+	TestEqual(TEXT("The written trace keeps locations"), RoundTripped.GetSamples()[1].Location, FVector(10.f, 20.f, 30.f));
+
+	return true;
+}
+
+LBSTRATEGYSIMULATOR_TEST(GIVEN_malformed_csv_line_WHEN_parsed_THEN_the_line_is_reported)
+{
+	FLBTrace Trace;
+	FString Error;
+	TestFalse(TEXT("The trace is rejected"), FLBTrace::ParseCSV(TEXT("0,1,0,0,0\n0.1,1,0,0\n"), Trace, Error));
+	TestTrue(TEXT("The error names the line"), Error.Contains(TEXT("Line 2")));
+
+	return true;
+}
+
+LBSTRATEGYSIMULATOR_TEST(GIVEN_static_actors_WHEN_simulated_THEN_load_is_reported_per_worker_without_handovers)
+{
+	FLBTrace Trace;
+	for (int32 Frame = 0; Frame < 10; Frame++)
+	{
+		Trace.AddSample(Frame, 0, FVector(-300.f, 0.f, 0.f));
+		Trace.AddSample(Frame, 1, FVector(-100.f, 100.f, 0.f));
+		Trace.AddSample(Frame, 2, FVector(-200.f, -100.f, 0.f));
+		Trace.AddSample(Frame, 3, FVector(250.f, 0.f, 0.f));
+	}
+
+	const FLBStrategySimulator::FReport Report = FLBStrategySimulator(CreateTwoRowGrid()).Run(Trace);
+
+	TestEqual(TEXT("Every frame is simulated"), Report.NumFrames, 10);
+	TestEqual(TEXT("Every actor is simulated"), Report.NumActors, 4);
+	TestEqual(TEXT("Both workers are reported"), Report.Workers.Num(), 2);
+	TestEqual(TEXT("Worker 1 has three actors"), Report.Workers[1].AverageActors, 3.f);
+	TestEqual(TEXT("Worker 2 has one actor"), Report.Workers[2].PeakActors, 1);
+	TestTrue(TEXT("No authority intent changes"), Report.NumAuthorityIntentChanges == 0);
+	TestTrue(TEXT("No handovers"), Report.NumHandovers == 0);
+
+	return true;
+}
+
+LBSTRATEGYSIMULATOR_TEST(GIVEN_actor_crossing_a_boundary_WHEN_simulated_THEN_it_is_handed_over_after_the_enforcer_latency)
+{
+	FLBTrace Trace;
+	for (int32 Frame = 0; Frame < 10; Frame++)
+	{
+		Trace.AddSample(Frame, 0, FVector(Frame < 5 ? -100.f : 100.f, 0.f, 0.f));
+	}
+
+	FLBStrategySimulator::FSettings Settings;
+	Settings.EnforcerLatencyFrames = 2;
+	const FLBStrategySimulator::FReport Report = FLBStrategySimulator(CreateTwoRowGrid(), Settings).Run(Trace);
+
+	TestTrue(TEXT("The authority intent changes once"), Report.NumAuthorityIntentChanges == 1);
+	TestTrue(TEXT("The actor is handed over once"), Report.NumHandovers == 1);
+	TestEqual(TEXT("Worker 1 keeps the actor until the intent is enforced"), Report.Workers[1].AverageActors, 0.7f);
+	TestEqual(TEXT("Handovers per second are reported"), Report.HandoversPerSecond, 1.f / 9.f);
+
+	return true;
+}
+
+LBSTRATEGYSIMULATOR_TEST(GIVEN_actor_oscillating_across_a_boundary_WHEN_simulated_with_a_dwell_time_THEN_handovers_are_suppressed)
+{
+	const FLBTrace Trace = CreateOscillatingTrace(100);
+
+	const FLBStrategySimulator::FReport Undamped = FLBStrategySimulator(CreateTwoRowGrid()).Run(Trace);
+	const FLBStrategySimulator::FReport Damped = FLBStrategySimulator(CreateTwoRowGrid(0.f, 1.f)).Run(Trace);
+
+	TestTrue(TEXT("Without damping the actor is handed over again and again"), Undamped.NumHandovers >= 30);
+	TestTrue(TEXT("A dwell time longer than the oscillation stops the handovers"), Damped.NumHandovers == 0);
+
+	AddInfo(FString::Printf(TEXT("Undamped:\n%sDamped:\n%s"), *Undamped.ToString(), *Damped.ToString()));
+
+	return true;
+}
+
+LBSTRATEGYSIMULATOR_TEST(GIVEN_actor_settling_across_a_boundary_WHEN_simulated_with_a_dwell_time_THEN_it_is_handed_over_in_trace_time)
+{
+	// The trace covers 5 seconds, but is replayed in far less: the dwell time must be measured on the trace's clock.
+	FLBTrace Trace;
+	for (int32 Frame = 0; Frame <= 50; Frame++)
+	{
+		Trace.AddSample(Frame * 0.1, 0, FVector(Frame < 10 ? -100.f : 100.f, 0.f, 0.f));
+	}
+
+	const FLBStrategySimulator::FReport Report = FLBStrategySimulator(CreateTwoRowGrid(0.f, 1.f)).Run(Trace);
+
+	TestTrue(TEXT("The actor is handed over once"), Report.NumHandovers == 1);
+	TestTrue(TEXT("The actor stays with worker 1 for the dwell time"), Report.Workers[1].AverageActors > 20.f / 51.f);
+
+	return true;
+}
+
+LBSTRATEGYSIMULATOR_TEST(GIVEN_actors_crossing_a_boundary_WHEN_simulated_with_handover_prefetch_THEN_they_are_replicated_sooner_after_authority_gain)
+{
+	FLBTrace Trace;
+	AddCrossingActors(Trace, 0, 4, 60);
+
+	FLBStrategySimulator::FSettings Settings;
+	Settings.ReplicationIntervalFrames = 5;
+	const FLBStrategySimulator::FReport WithoutPrefetch = FLBStrategySimulator(CreateTwoRowGrid(), Settings).Run(Trace);
+
+	Settings.HandoverPrefetchLookaheadSeconds = 0.5f;
+	const FLBStrategySimulator::FReport WithPrefetch = FLBStrategySimulator(CreateTwoRowGrid(), Settings).Run(Trace);
+
+	TestTrue(TEXT("Every actor is handed over without prefetch"), WithoutPrefetch.NumHandovers == 4);
+	TestTrue(TEXT("Every actor is handed over with prefetch"), WithPrefetch.NumHandovers == 4);
+	TestTrue(TEXT("Nothing is prefetched without a lookahead"), WithoutPrefetch.NumPrefetchedHandovers == 0);
+	TestTrue(TEXT("Every handover is predicted with a lookahead"), WithPrefetch.NumPrefetchedHandovers == 4);
+	TestTrue(TEXT("Prefetched actors are replicated sooner after authority gain"),
+		WithPrefetch.AverageTimeToFirstReplicationSeconds < WithoutPrefetch.AverageTimeToFirstReplicationSeconds);
+	TestTrue(TEXT("Prefetched actors are replicated in the frame authority arrives"), FMath::IsNearlyZero(WithPrefetch.AverageTimeToFirstReplicationSeconds));
+
+	AddInfo(FString::Printf(TEXT("Without prefetch:\n%sWith prefetch:\n%s"), *WithoutPrefetch.ToString(), *WithPrefetch.ToString()));
+
+	return true;
+}
+
+LBSTRATEGYSIMULATOR_TEST(GIVEN_busy_gaining_worker_WHEN_simulated_with_handover_prefetch_and_a_rate_limit_THEN_prefetched_actors_wait_their_turn)
+{
+	// Static actors keep worker 2 at its rate limit, and have lower ids so they win ties.
+	FLBTrace Trace;
+	for (int32 Frame = 0; Frame < 60; Frame++)
+	{
+		for (int32 ActorId = 0; ActorId < 16; ActorId++)
+		{
+			Trace.AddSample(Frame * 0.1, ActorId, FVector(250.f, -400.f + 50.f * ActorId, 0.f));
+		}
+	}
+	AddCrossingActors(Trace, 16, 4, 60);
+
+	FLBStrategySimulator::FSettings Settings;
+	Settings.HandoverPrefetchLookaheadSeconds = 0.5f;
+	const FLBStrategySimulator::FReport Unlimited = FLBStrategySimulator(CreateTwoRowGrid(), Settings).Run(Trace);
+
+	Settings.ActorReplicationRateLimit = 10;
+	const FLBStrategySimulator::FReport Limited = FLBStrategySimulator(CreateTwoRowGrid(), Settings).Run(Trace);
+
+	TestTrue(TEXT("Every crossing actor is handed over with prefetch"), Limited.NumHandovers == 4 && Limited.NumPrefetchedHandovers == 4);
+	TestTrue(TEXT("Nothing is deferred without a rate limit"), Unlimited.NumReplicationsDeferred == 0);
+	TestTrue(TEXT("The rate limit defers replications"), Limited.NumReplicationsDeferred > 0);
+	TestTrue(TEXT("Without a rate limit prefetched actors are replicated in the frame authority arrives"), FMath::IsNearlyZero(Unlimited.AverageTimeToFirstReplicationSeconds));
+	TestTrue(TEXT("Prefetched actors wait behind actors which are overdue"), Limited.AverageTimeToFirstReplicationSeconds > 0.f);
+
+	AddInfo(FString::Printf(TEXT("Unlimited:\n%sLimited:\n%s"), *Unlimited.ToString(), *Limited.ToString()));
+
+	return true;
+}
+
+LBSTRATEGYSIMULATOR_TEST(GIVEN_load_on_one_worker_of_a_dynamic_grid_WHEN_simulated_THEN_the_rebalanced_regions_are_applied_by_every_worker)
+{
+	// Every actor starts on virtual worker 1, which has X < 0.
+	FLBTrace Trace;
+	for (int32 Frame = 0; Frame < 20; Frame++)
+	{
+		for (int32 ActorId = 0; ActorId < 4; ActorId++)
+		{
+			Trace.AddSample(Frame, ActorId, FVector(-500.f - 500.f * ActorId, 0.f, 0.f));
+		}
+	}
+
+	// The default rebalance interval of 10 seconds rebalances once in the trace, moving the boundary to X = -5000.
+	const FLBStrategySimulator::FReport Report = FLBStrategySimulator([](UObject*) -> UAbstractLBStrategy*
+	{
+		return UTestDynamicGridLBStrategy::Create(2, 1, 200000.f, 200000.f, 5000.f, 10000.f);
+	}).Run(Trace);
+
+	TestTrue(TEXT("The regions are rebalanced once"), Report.NumRebalances == 1);
+	// Were the new regions not applied by worker 2, it would hand the actors back to worker 1.
+	TestTrue(TEXT("Every actor is handed over to worker 2 exactly once"), Report.NumHandovers == 4);
+	TestEqual(TEXT("Worker 2 ends up with every actor"), Report.Workers[2].PeakActors, 4);
+
+	return true;
+}
+
+LBSTRATEGYSIMULATOR_TEST(GIVEN_interest_border_WHEN_simulated_THEN_actors_seen_across_the_boundary_are_counted)
+{
+	FLBTrace Trace;
+	Trace.AddSample(0.0, 0, FVector(-50.f, 0.f, 0.f));
+	Trace.AddSample(0.0, 1, FVector(50.f, 0.f, 0.f));
+	Trace.AddSample(0.0, 2, FVector(-400.f, 0.f, 0.f));
+	Trace.AddSample(0.0, 3, FVector(400.f, 0.f, 0.f));
+
+	const FLBStrategySimulator::FReport Report = FLBStrategySimulator(CreateTwoRowGrid(100.f)).Run(Trace);
+
+	TestEqual(TEXT("Worker 1 sees one actor across the boundary"), Report.Workers[1].AverageCrossBoundaryInterest, 1.f);
+	TestEqual(TEXT("Worker 2 sees one actor across the boundary"), Report.Workers[2].AverageCrossBoundaryInterest, 1.f);
+	TestEqual(TEXT("Two actors are seen across the boundary in total"), Report.AverageCrossBoundaryInterest, 2.f);
+
+	return true;
+}
+
+LBSTRATEGYSIMULATOR_TEST(GIVEN_combined_constraints_WHEN_checking_locations_THEN_spatial_constraints_are_evaluated)
+{
+	SpatialGDK::QueryConstraint Box;
+	Box.BoxConstraint = SpatialGDK::BoxConstraint{ SpatialGDK::Coordinates::FromFVector(FVector::ZeroVector), SpatialGDK::EdgeLength::FromFVector(FVector(200.f, 200.f, 200.f)) };
+
+	SpatialGDK::QueryConstraint Sphere;
+	Sphere.SphereConstraint = SpatialGDK::SphereConstraint{ SpatialGDK::Coordinates::FromFVector(FVector(1000.f, 0.f, 0.f)), 1.0 };
+
+	SpatialGDK::QueryConstraint Or;
+	Or.OrConstraint = { Box, Sphere };
+
+	SpatialGDK::QueryConstraint And;
+	And.AndConstraint = { Box, Sphere };
+
+	SpatialGDK::QueryConstraint Component;
+	Component.ComponentConstraint = SpatialConstants::POSITION_COMPONENT_ID;
+
+	TestTrue(TEXT("Inside the box"), FLBStrategySimulator::IsInConstraint(Box, FVector(99.f, -99.f, 0.f)));
+	TestFalse(TEXT("Outside the box"), FLBStrategySimulator::IsInConstraint(Box, FVector(101.f, 0.f, 0.f)));
+	TestTrue(TEXT("Inside the sphere"), FLBStrategySimulator::IsInConstraint(Sphere, FVector(1050.f, 50.f, 0.f)));
+	TestTrue(TEXT("Inside either"), FLBStrategySimulator::IsInConstraint(Or, FVector(1000.f, 0.f, 0.f)));
+	TestFalse(TEXT("Not inside both"), FLBStrategySimulator::IsInConstraint(And, FVector(1000.f, 0.f, 0.f)));
+	TestFalse(TEXT("Non-spatial constraints are not simulated"), FLBStrategySimulator::IsInConstraint(Component, FVector::ZeroVector));
+
+	return true;
+}
@@ -7,9 +7,12 @@
 #include "SpatialGDKSettings.h"
 #include "TestLayeredLBStrategy.h"
 
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
 #include "Engine/Engine.h"
 #include "GameFramework/DefaultPawn.h"
 #include "GameFramework/GameStateBase.h"
+#include "Kismet2/KismetEditorUtilities.h"
 #include "Misc/Optional.h"
 #include "Tests/AutomationCommon.h"
 #include "Tests/AutomationEditorCommon.h"
@@ -25,6 +28,7 @@ struct TestData {
 	ULayeredLBStrategy* Strat{ nullptr };
 	UWorld* TestWorld{ nullptr };
 	TMap<FName, AActor*> TestActors{};
+	TMap<FName, UBlueprint*> TestBlueprints{};
 
 	TestData()
 	{}
@@ -33,6 +37,11 @@ struct TestData {
 	{
 		ASpatialWorldSettings* WorldSettings = Cast<ASpatialWorldSettings>(TestWorld->GetWorldSettings());
 		WorldSettings->WorkerLayers.Empty();
+
+		for (const TPair<FName, UBlueprint*>& Blueprint : TestBlueprints)
+		{
+			Blueprint.Value->RemoveFromRoot();
+		}
 	}
 };
 
@@ -242,6 +251,39 @@ bool FCheckShouldHaveAuthMatchesWhoShouldHaveAuth::Update()
 	return true;
 }
 
+DEFINE_LATENT_AUTOMATION_COMMAND_THREE_PARAMETER(FCreateBlueprintSubclass, TSharedPtr<TestData>, TestData, FName, Handle, UClass*, ParentClass);
+bool FCreateBlueprintSubclass::Update()
+{
+	UPackage* Package = GetTransientPackage();
+	UBlueprint* Blueprint = FKismetEditorUtilities::CreateBlueprint(ParentClass, Package, MakeUniqueObjectName(Package, UBlueprint::StaticClass(), Handle),
+		BPTYPE_Normal, UBlueprint::StaticClass(), UBlueprintGeneratedClass::StaticClass());
+	Blueprint->AddToRoot();
+	TestData->TestBlueprints.Add(Handle, Blueprint);
+
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_FOUR_PARAMETER(FCheckLayerNameForClass, TSharedPtr<TestData>, TestData, FAutomationTestBase*, Test, UClass*, Class, FName, Expected);
+bool FCheckLayerNameForClass::Update()
+{
+	const FName Actual = TestData->Strat->GetLayerNameForClass(Class);
+	Test->TestEqual(
+		FString::Printf(TEXT("Layer for class %s. Actual: %s, Expected: %s"), *Class->GetName(), *Actual.ToString(), *Expected.ToString()),
+		Actual, Expected);
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_FOUR_PARAMETER(FCheckLayerNameForBlueprint, TSharedPtr<TestData>, TestData, FAutomationTestBase*, Test, FName, Handle, FName, Expected);
+bool FCheckLayerNameForBlueprint::Update()
+{
+	UClass* Class = TestData->TestBlueprints[Handle]->GeneratedClass;
+	const FName Actual = TestData->Strat->GetLayerNameForClass(Class);
+	Test->TestEqual(
+		FString::Printf(TEXT("Layer for Blueprint %s. Actual: %s, Expected: %s"), *Handle.ToString(), *Actual.ToString(), *Expected.ToString()),
+		Actual, Expected);
+	return true;
+}
+
 LAYEREDLBSTRATEGY_TEST(GIVEN_strat_is_not_ready_WHEN_local_virtual_worker_id_is_set_THEN_is_ready)
 {
 	AutomationOpenMap("/Engine/Maps/Entry");
@@ -430,3 +472,53 @@ LAYEREDLBSTRATEGY_TEST(GIVEN_two_actors_of_different_types_and_same_positions_ma
 	return true;
 }
 
+
+LAYEREDLBSTRATEGY_TEST(GIVEN_deep_class_hierarchy_split_across_layers_WHEN_layer_name_for_class_called_THEN_nearest_configured_ancestor_wins)
+{
+	AutomationOpenMap("/Engine/Maps/Entry");
+
+	TSharedPtr<TestData> Data = TSharedPtr<TestData>(new TestData);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForWorld(Data));
+	ADD_LATENT_AUTOMATION_COMMAND(FCreateStrategy(Data));
+	ADD_LATENT_AUTOMATION_COMMAND(FSetDefaultLayer(Data, UGridBasedLBStrategy::StaticClass()));
+	ADD_LATENT_AUTOMATION_COMMAND(FAddLayer(Data, UGridBasedLBStrategy::StaticClass(), {ALayer1Pawn::StaticClass()}));
+	ADD_LATENT_AUTOMATION_COMMAND(FAddLayer(Data, UGridBasedLBStrategy::StaticClass(), {ALayer1PawnGrandchild::StaticClass()}));
+	ADD_LATENT_AUTOMATION_COMMAND(FSetupStrategy(Data, {}));
+	ADD_LATENT_AUTOMATION_COMMAND(FSetupStrategyLocalWorker(Data, 1));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckLayerNameForClass(Data, this, ALayer1Pawn::StaticClass(), TEXT("0")));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckLayerNameForClass(Data, this, ALayer1PawnChild::StaticClass(), TEXT("0")));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckLayerNameForClass(Data, this, ALayer1PawnGrandchild::StaticClass(), TEXT("1")));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckLayerNameForClass(Data, this, ALayer1PawnGreatGrandchild::StaticClass(), TEXT("1")));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckLayerNameForClass(Data, this, ALayer2Pawn::StaticClass(), SpatialConstants::DefaultLayer));
+
+	return true;
+}
+
+LAYEREDLBSTRATEGY_TEST(GIVEN_blueprint_subclasses_created_before_and_after_init_WHEN_layer_name_for_class_called_THEN_parent_layer_is_returned)
+{
+	AutomationOpenMap("/Engine/Maps/Entry");
+
+	TSharedPtr<TestData> Data = TSharedPtr<TestData>(new TestData);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForWorld(Data));
+	ADD_LATENT_AUTOMATION_COMMAND(FCreateStrategy(Data));
+	ADD_LATENT_AUTOMATION_COMMAND(FSetDefaultLayer(Data, UGridBasedLBStrategy::StaticClass()));
+	ADD_LATENT_AUTOMATION_COMMAND(FAddLayer(Data, UGridBasedLBStrategy::StaticClass(), {ALayer1Pawn::StaticClass()}));
+	ADD_LATENT_AUTOMATION_COMMAND(FAddLayer(Data, UGridBasedLBStrategy::StaticClass(), {ALayer2Pawn::StaticClass()}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FCreateBlueprintSubclass(Data, TEXT("BP_Layer1PawnChild"), ALayer1PawnChild::StaticClass()));
+	ADD_LATENT_AUTOMATION_COMMAND(FSetupStrategy(Data, {}));
+	ADD_LATENT_AUTOMATION_COMMAND(FSetupStrategyLocalWorker(Data, 1));
+
+	// Loaded after the strategy is initialized.
+	ADD_LATENT_AUTOMATION_COMMAND(FCreateBlueprintSubclass(Data, TEXT("BP_Layer2Pawn"), ALayer2Pawn::StaticClass()));
+	ADD_LATENT_AUTOMATION_COMMAND(FCreateBlueprintSubclass(Data, TEXT("BP_DefaultPawn"), ADefaultPawn::StaticClass()));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckLayerNameForBlueprint(Data, this, TEXT("BP_Layer1PawnChild"), TEXT("0")));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckLayerNameForBlueprint(Data, this, TEXT("BP_Layer2Pawn"), TEXT("1")));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckLayerNameForBlueprint(Data, this, TEXT("BP_DefaultPawn"), SpatialConstants::DefaultLayer));
+
+	return true;
+}
@@ -43,3 +43,24 @@ class SPATIALGDKTESTS_API ALayer2Pawn : public ADefaultPawn
 {
 	GENERATED_BODY()
 };
+
+/**
+ * A deeper hierarchy below ALayer1Pawn, for testing Layer resolution
+ */
+UCLASS(NotPlaceable)
+class SPATIALGDKTESTS_API ALayer1PawnChild : public ALayer1Pawn
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable)
+class SPATIALGDKTESTS_API ALayer1PawnGrandchild : public ALayer1PawnChild
+{
+	GENERATED_BODY()
+};
+
+UCLASS(NotPlaceable)
+class SPATIALGDKTESTS_API ALayer1PawnGreatGrandchild : public ALayer1PawnGrandchild
+{
+	GENERATED_BODY()
+};
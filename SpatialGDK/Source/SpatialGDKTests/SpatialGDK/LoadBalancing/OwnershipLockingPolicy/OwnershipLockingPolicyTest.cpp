@@ -3,6 +3,7 @@
 #include "LoadBalancing/OwnershipLockingPolicy.h"
 #include "SpatialConstants.h"
 #include "Tests/TestDefinitions.h"
+#include "Utils/SpatialActorUtils.h"
 
 #include "Containers/Array.h"
 #include "Containers/Map.h"
@@ -12,6 +13,7 @@
 #include "GameFramework/GameStateBase.h"
 #include "GameFramework/DefaultPawn.h"
 #include "Improbable/SpatialEngineDelegates.h"
+#include "Math/RandomStream.h"
 #include "Tests/AutomationCommon.h"
 #include "Templates/SharedPointer.h"
 #include "UObject/UObjectGlobals.h"
@@ -290,6 +292,132 @@ bool FTestIsLocked::Update()
 	return true;
 }
 
+FName GetNumberedActorHandle(int32 Index)
+{
+	return FName(*FString::Printf(TEXT("Actor%d"), Index));
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(FSetOwnershipChain, TSharedPtr<TestData>, Data, int32, NumActors);
+bool FSetOwnershipChain::Update()
+{
+	// Each numbered Actor owns the next, so the last one is at the bottom of a hierarchy NumActors deep.
+	for (int32 i = 1; i < NumActors; i++)
+	{
+		AActor* ActorBeingOwned = Data->TestActors[GetNumberedActorHandle(i)];
+		AActor* OldOwner = ActorBeingOwned->GetOwner();
+		ActorBeingOwned->SetOwner(Data->TestActors[GetNumberedActorHandle(i - 1)]);
+		Data->LockingPolicy->OnOwnerUpdated(ActorBeingOwned, OldOwner);
+	}
+	return true;
+}
+
+// Counts the Actors for which IsLocked disagrees with walking each Actor's ownership chain to its root.
+int32 CountIsLockedMismatches(FAutomationTestBase* Test, const UOwnershipLockingPolicy* LockingPolicy, const TArray<AActor*>& Actors, const TMap<AActor*, int32>& ExplicitLockCounts)
+{
+	auto GetRoot = [](const AActor* Actor) -> const AActor*
+	{
+		const AActor* Root = SpatialGDK::GetHierarchyRoot(Actor);
+		return Root != nullptr ? Root : Actor;
+	};
+
+	TSet<const AActor*> LockedRoots;
+	for (const TPair<AActor*, int32>& ExplicitLockCount : ExplicitLockCounts)
+	{
+		LockedRoots.Add(GetRoot(ExplicitLockCount.Key));
+	}
+
+	int32 NumMismatches = 0;
+	for (const AActor* Actor : Actors)
+	{
+		const bool bIsLockedExpected = LockedRoots.Contains(GetRoot(Actor));
+		if (LockingPolicy->IsLocked(Actor) != bIsLockedExpected)
+		{
+			Test->AddError(FString::Printf(TEXT("%s. Is locked. Expected: %d"), *Actor->GetName(), bIsLockedExpected));
+			NumMismatches++;
+		}
+	}
+	return NumMismatches;
+}
+
+// Randomly acquires and releases locks and changes owners, checking IsLocked for every Actor after each step.
+DEFINE_LATENT_AUTOMATION_COMMAND_FIVE_PARAMETER(FRunLockingStorm, FAutomationTestBase*, Test, TSharedPtr<TestData>, Data, int32, NumSteps, float, OwnerChangeProbability, int32, RandomSeed);
+bool FRunLockingStorm::Update()
+{
+	FRandomStream Random(RandomSeed);
+
+	TArray<AActor*> Actors;
+	Data->TestActors.GenerateValueArray(Actors);
+
+	TArray<TPair<ActorLockToken, AActor*>> HeldLocks;
+	TMap<AActor*, int32> ExplicitLockCounts;
+
+	for (int32 Step = 0; Step < NumSteps; Step++)
+	{
+		if (Random.FRand() < OwnerChangeProbability)
+		{
+			AActor* Actor = Actors[Random.RandHelper(Actors.Num())];
+			AActor* NewOwner = Random.RandHelper(4) == 0 ? nullptr : Actors[Random.RandHelper(Actors.Num())];
+			if (NewOwner != nullptr && NewOwner->IsOwnedBy(Actor))
+			{
+				// Would make an ownership loop.
+				NewOwner = nullptr;
+			}
+
+			AActor* OldOwner = Actor->GetOwner();
+			Actor->SetOwner(NewOwner);
+			Data->LockingPolicy->OnOwnerUpdated(Actor, OldOwner);
+		}
+		else if (HeldLocks.Num() > 0 && Random.RandHelper(2) == 0)
+		{
+			const int32 LockIndex = Random.RandHelper(HeldLocks.Num());
+			const TPair<ActorLockToken, AActor*> Lock = HeldLocks[LockIndex];
+			HeldLocks.RemoveAtSwap(LockIndex);
+
+			Test->TestTrue(TEXT("ReleaseLock succeeds"), Data->LockingPolicy->ReleaseLock(Lock.Key));
+			if (--ExplicitLockCounts[Lock.Value] == 0)
+			{
+				ExplicitLockCounts.Remove(Lock.Value);
+			}
+		}
+		else
+		{
+			AActor* Actor = Actors[Random.RandHelper(Actors.Num())];
+			const ActorLockToken Token = Data->LockingPolicy->AcquireLock(Actor, FString::Printf(TEXT("Lock %d"), Step));
+			Test->TestTrue(TEXT("AcquireLock succeeds"), Token != SpatialConstants::INVALID_ACTOR_LOCK_TOKEN);
+			HeldLocks.Emplace(Token, Actor);
+			ExplicitLockCounts.FindOrAdd(Actor)++;
+		}
+
+		if (CountIsLockedMismatches(Test, Data->LockingPolicy, Actors, ExplicitLockCounts) > 0)
+		{
+			Test->AddError(FString::Printf(TEXT("IsLocked diverged from the ownership hierarchy at step %d"), Step));
+			return true;
+		}
+	}
+
+	for (const TPair<ActorLockToken, AActor*>& Lock : HeldLocks)
+	{
+		Data->LockingPolicy->ReleaseLock(Lock.Key);
+	}
+	ExplicitLockCounts.Reset();
+
+	Test->TestEqual(TEXT("Nothing is locked once every lock is released"), CountIsLockedMismatches(Test, Data->LockingPolicy, Actors, ExplicitLockCounts), 0);
+
+	return true;
+}
+
+void SpawnNumberedActors(TSharedPtr<TestData> Data, int32 NumActors)
+{
+	for (int32 i = 0; i < NumActors; i++)
+	{
+		ADD_LATENT_AUTOMATION_COMMAND(FSpawnActor(Data, GetNumberedActorHandle(i)));
+	}
+	for (int32 i = 0; i < NumActors; i++)
+	{
+		ADD_LATENT_AUTOMATION_COMMAND(FWaitForActor(Data, GetNumberedActorHandle(i)));
+	}
+}
+
 void SpawnABCDHierarchy(FAutomationTestBase* Test, TSharedPtr<TestData> Data)
 {
 	//        A 
@@ -1061,3 +1189,36 @@ OWNERSHIPLOCKINGPOLICY_TEST(GIVEN_AcquireLockDelegate_and_ReleaseLockDelegate_ar
 
 	return true;
 }
+
+// Stress
+
+OWNERSHIPLOCKINGPOLICY_TEST(GIVEN_locks_are_held_WHEN_owners_change_repeatedly_THEN_IsLocked_matches_the_ownership_hierarchy)
+{
+	AutomationOpenMap("/Engine/Maps/Entry");
+
+	TSharedPtr<TestData> Data = MakeNewTestData();
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForWorld(Data));
+
+	SpawnNumberedActors(Data, 64);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FRunLockingStorm(this, Data, 5000, 0.8f, 1));
+
+	return true;
+}
+
+OWNERSHIPLOCKINGPOLICY_TEST(GIVEN_a_deep_ownership_hierarchy_WHEN_locks_are_acquired_and_released_repeatedly_THEN_IsLocked_matches_the_ownership_hierarchy)
+{
+	AutomationOpenMap("/Engine/Maps/Entry");
+
+	TSharedPtr<TestData> Data = MakeNewTestData();
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForWorld(Data));
+
+	SpawnNumberedActors(Data, 64);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FSetOwnershipChain(Data, 64));
+	ADD_LATENT_AUTOMATION_COMMAND(FRunLockingStorm(this, Data, 5000, 0.05f, 2));
+
+	return true;
+}
@@ -0,0 +1,181 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "EngineClasses/SpatialNetDriver.h"
+#include "Interop/SpatialClassInfoManager.h"
+#include "SpatialGDKTests/SpatialGDK/EngineClasses/SpatialActorChannel/HandoverTestObject.h"
+#include "Utils/ComponentFactory.h"
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+#define COMPONENTFACTORY_TEST(TestName) \
+	GDK_TEST(Core, ComponentFactory, TestName)
+
+using SpatialGDK::ComponentFactory;
+
+namespace
+{
+
+const Worker_ComponentId TestHandoverComponentId = 10000;
+const Worker_EntityId TestEntityId = 1000;
+
+FClassInfo CreateHandoverClassInfo()
+{
+	FClassInfo Info;
+	USpatialClassInfoManager::CreateHandoverPropertyInfo(UHandoverTestObject::StaticClass(), Info);
+	Info.SchemaComponents[SCHEMA_Handover] = TestHandoverComponentId;
+	return Info;
+}
+
+void DestroyUpdates(TArray<FWorkerComponentUpdate>& Updates)
+{
+	for (FWorkerComponentUpdate& Update : Updates)
+	{
+		Schema_DestroyComponentUpdate(Update.schema_type);
+	}
+	Updates.Reset();
+}
+
+} // anonymous namespace
+
+COMPONENTFACTORY_TEST(GIVEN_no_handover_changes_WHEN_creating_updates_THEN_no_schema_update_is_allocated)
+{
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	const FClassInfo Info = CreateHandoverClassInfo();
+	UHandoverTestObject* Object = NewObject<UHandoverTestObject>();
+
+	ComponentFactory Factory(false, NetDriver, nullptr);
+
+	const FHandoverChangeState NoChanges;
+	uint32 BytesWritten = 0;
+	TArray<FWorkerComponentUpdate> Updates;
+	Factory.CreateComponentUpdates(Object, Info, TestEntityId, nullptr, &NoChanges, Updates, BytesWritten);
+
+	TestEqual(TEXT("No updates are created"), Updates.Num(), 0);
+	TestEqual(TEXT("No bytes are written"), static_cast<int32>(BytesWritten), 0);
+	TestEqual(TEXT("No schema update is allocated"), static_cast<int32>(Factory.GetAllocationStats().NumSchemaUpdatesCreated), 0);
+	TestEqual(TEXT("The update is counted as skipped"), static_cast<int32>(Factory.GetAllocationStats().NumSchemaUpdatesSkipped), 1);
+
+	return true;
+}
+
+COMPONENTFACTORY_TEST(GIVEN_a_reused_buffer_WHEN_creating_updates_for_several_objects_THEN_updates_are_appended)
+{
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	const FClassInfo Info = CreateHandoverClassInfo();
+
+	UHandoverTestObject* First = NewObject<UHandoverTestObject>();
+	UHandoverTestObject* Second = NewObject<UHandoverTestObject>();
+	First->IntA = 1;
+	Second->IntB = 2;
+
+	ComponentFactory Factory(false, NetDriver, nullptr);
+
+	// Handles are 1-based, so these are IntA and IntB.
+	const FHandoverChangeState FirstChanges = { 1 };
+	const FHandoverChangeState SecondChanges = { 2 };
+
+	uint32 BytesWritten = 0;
+	TArray<FWorkerComponentUpdate> Updates;
+	Factory.CreateComponentUpdates(First, Info, TestEntityId, nullptr, &FirstChanges, Updates, BytesWritten);
+	const uint32 FirstBytesWritten = BytesWritten;
+
+	Factory.Reset(false, nullptr);
+	Factory.CreateComponentUpdates(Second, Info, TestEntityId + 1, nullptr, &SecondChanges, Updates, BytesWritten);
+
+	if (!TestEqual(TEXT("Both updates are in the buffer"), Updates.Num(), 2))
+	{
+		DestroyUpdates(Updates);
+		return false;
+	}
+
+	TestTrue(TEXT("Bytes are accumulated across objects"), FirstBytesWritten > 0 && BytesWritten > FirstBytesWritten);
+	TestEqual(TEXT("Updates are for the handover component"), static_cast<int32>(Updates[1].component_id), static_cast<int32>(TestHandoverComponentId));
+
+	Schema_Object* FirstFields = Schema_GetComponentUpdateFields(Updates[0].schema_type);
+	Schema_Object* SecondFields = Schema_GetComponentUpdateFields(Updates[1].schema_type);
+	TestEqual(TEXT("First update holds the first object's change"), static_cast<int32>(Schema_GetInt32Count(FirstFields, 1)), 1);
+	TestEqual(TEXT("Second update holds the second object's change"), static_cast<int32>(Schema_GetInt32Count(SecondFields, 2)), 1);
+	TestEqual(TEXT("Changes don't leak between objects"), static_cast<int32>(Schema_GetInt32Count(SecondFields, 1)), 0);
+
+	DestroyUpdates(Updates);
+
+	return true;
+}
+
+COMPONENTFACTORY_TEST(GIVEN_many_objects_with_few_changes_WHEN_reusing_factory_and_buffer_THEN_fewer_allocations_per_object)
+{
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	const FClassInfo Info = CreateHandoverClassInfo();
+
+	const int32 NumObjects = 100;
+	const int32 NumTicks = 10;
+
+	TArray<UHandoverTestObject*> Objects;
+	for (int32 i = 0; i < NumObjects; i++)
+	{
+		Objects.Add(NewObject<UHandoverTestObject>());
+	}
+
+	// One in five objects changes each tick, as replication is usually driven for many more actors than have changed.
+	const FHandoverChangeState Changed = { 1, 2 };
+	const FHandoverChangeState Unchanged;
+	auto GetChanges = [&](int32 Tick, int32 Index) -> const FHandoverChangeState&
+	{
+		return (Index + Tick) % 5 == 0 ? Changed : Unchanged;
+	};
+
+	// A factory and array per object, as SendComponentUpdates used to do. Every object allocated a schema update, and
+	// those with changes allocated the array returned to the sender.
+	uint32 BeforeSchemaAllocations = 0;
+	uint32 BeforeArrayAllocations = 0;
+	uint32 BeforeBytesWritten = 0;
+	for (int32 Tick = 0; Tick < NumTicks; Tick++)
+	{
+		for (int32 i = 0; i < NumObjects; i++)
+		{
+			ComponentFactory Factory(false, NetDriver, nullptr);
+			TArray<FWorkerComponentUpdate> Updates = Factory.CreateComponentUpdates(Objects[i], Info, TestEntityId + i, nullptr, &GetChanges(Tick, i), BeforeBytesWritten);
+
+			BeforeSchemaAllocations += Factory.GetAllocationStats().NumSchemaUpdatesCreated + Factory.GetAllocationStats().NumSchemaUpdatesSkipped;
+			BeforeArrayAllocations += Updates.Max() > 0 ? 1 : 0;
+			DestroyUpdates(Updates);
+		}
+	}
+
+	// One factory and buffer reused for every object, as the sender now does.
+	ComponentFactory Factory(false, NetDriver, nullptr);
+	TArray<FWorkerComponentUpdate> Updates;
+	uint32 AfterArrayAllocations = 0;
+	uint32 AfterBytesWritten = 0;
+	for (int32 Tick = 0; Tick < NumTicks; Tick++)
+	{
+		for (int32 i = 0; i < NumObjects; i++)
+		{
+			const int32 CapacityBefore = Updates.Max();
+
+			Factory.Reset(false, nullptr);
+			Factory.CreateComponentUpdates(Objects[i], Info, TestEntityId + i, nullptr, &GetChanges(Tick, i), Updates, AfterBytesWritten);
+
+			AfterArrayAllocations += Updates.Max() != CapacityBefore ? 1 : 0;
+			DestroyUpdates(Updates);
+		}
+	}
+
+	const uint32 AfterSchemaAllocations = Factory.GetAllocationStats().NumSchemaUpdatesCreated;
+	const uint32 ExpectedUpdates = NumObjects * NumTicks / 5;
+
+	TestEqual(TEXT("The same bytes are written"), static_cast<int32>(AfterBytesWritten), static_cast<int32>(BeforeBytesWritten));
+	TestEqual(TEXT("Only changed objects allocate a schema update"), static_cast<int32>(AfterSchemaAllocations), static_cast<int32>(ExpectedUpdates));
+	TestEqual(TEXT("No schema update is discarded"), static_cast<int32>(Factory.GetAllocationStats().NumSchemaUpdatesDiscarded), 0);
+	TestEqual(TEXT("The update buffer is allocated once"), static_cast<int32>(AfterArrayAllocations), 1);
+
+	TestEqual(TEXT("Every object used to allocate a schema update"), static_cast<int32>(BeforeSchemaAllocations), NumObjects * NumTicks);
+	TestEqual(TEXT("Every changed object used to allocate an array"), static_cast<int32>(BeforeArrayAllocations), static_cast<int32>(ExpectedUpdates));
+	TestTrue(TEXT("Fewer allocations are made per replicated object"), AfterSchemaAllocations + AfterArrayAllocations < BeforeSchemaAllocations + BeforeArrayAllocations);
+
+	return true;
+}
@@ -0,0 +1,168 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "EngineClasses/SpatialNetDriver.h"
+#include "Interop/SpatialClassInfoManager.h"
+#include "PrimitiveArrayTestObject.h"
+#include "Utils/ComponentFactory.h"
+#include "Utils/ComponentReader.h"
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+#define PRIMITIVEARRAYENCODING_TEST(TestName) \
+	GDK_TEST(Core, PrimitiveArrayEncoding, TestName)
+
+using SpatialGDK::ComponentFactory;
+using SpatialGDK::ComponentReader;
+
+namespace
+{
+
+const Worker_ComponentId TestHandoverComponentId = 10000;
+
+FClassInfo CreatePrimitiveArrayClassInfo()
+{
+	FClassInfo Info;
+	USpatialClassInfoManager::CreateHandoverPropertyInfo(UPrimitiveArrayTestObject::StaticClass(), Info);
+	Info.SchemaComponents[SCHEMA_Handover] = TestHandoverComponentId;
+	return Info;
+}
+
+const FHandoverPropertyInfo* FindHandoverProperty(const FClassInfo& Info, FName PropertyName)
+{
+	return Info.HandoverProperties.FindByPredicate([PropertyName](const FHandoverPropertyInfo& PropertyInfo)
+	{
+		return PropertyInfo.Property->GetFName() == PropertyName;
+	});
+}
+
+// Writes Values into the named array property with ComponentFactory, then reads it back with ComponentReader into an
+// array which already holds other values, as an update received by a worker would be.
+template <typename T>
+TArray<T> RoundTrip(FAutomationTestBase& Test, TArray<T> UPrimitiveArrayTestObject::* Member, FName PropertyName, const TArray<T>& Values)
+{
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	const FClassInfo Info = CreatePrimitiveArrayClassInfo();
+	const FHandoverPropertyInfo* PropertyInfo = FindHandoverProperty(Info, PropertyName);
+	check(PropertyInfo != nullptr);
+
+	UPrimitiveArrayTestObject* Source = NewObject<UPrimitiveArrayTestObject>();
+	Source->*Member = Values;
+
+	ComponentFactory Factory(false, NetDriver, nullptr);
+	uint32 BytesWritten = 0;
+	const FHandoverChangeState Changes = { PropertyInfo->Handle };
+	FWorkerComponentData Data = Factory.CreateHandoverComponentData(TestHandoverComponentId, Source, Info, Changes, BytesWritten);
+	Schema_Object* Fields = Schema_GetComponentDataFields(Data.schema_type);
+
+	UArrayProperty* ArrayProperty = CastChecked<UArrayProperty>(PropertyInfo->Property);
+
+	UPrimitiveArrayTestObject* Target = NewObject<UPrimitiveArrayTestObject>();
+	(Target->*Member).Init(T(1), Values.Num() + 3);
+
+	FObjectReferencesMap ObjectReferencesMap;
+	ComponentReader Reader(NetDriver, ObjectReferencesMap);
+	FScriptArrayHelper ArrayHelper(ArrayProperty, &(Target->*Member));
+	Test.TestTrue(FString::Printf(TEXT("%s is read as a primitive array"), *PropertyName.ToString()),
+		Reader.ApplyPrimitiveArray(Fields, PropertyInfo->Handle, ArrayProperty->Inner, ArrayHelper));
+
+	Schema_DestroyComponentData(Data.schema_type);
+
+	return Target->*Member;
+}
+
+template <typename T>
+void TestRoundTrip(FAutomationTestBase& Test, TArray<T> UPrimitiveArrayTestObject::* Member, FName PropertyName, const TArray<T>& Values)
+{
+	const TArray<T> Received = RoundTrip(Test, Member, PropertyName, Values);
+	Test.TestTrue(FString::Printf(TEXT("%s round trips through the factory and reader"), *PropertyName.ToString()), Received == Values);
+}
+
+} // anonymous namespace
+
+PRIMITIVEARRAYENCODING_TEST(GIVEN_signed_integer_arrays_WHEN_round_tripped_THEN_boundary_values_are_preserved)
+{
+	TestRoundTrip<int8>(*this, &UPrimitiveArrayTestObject::Int8s, GET_MEMBER_NAME_CHECKED(UPrimitiveArrayTestObject, Int8s), { MIN_int8, -1, 0, 1, MAX_int8 });
+	TestRoundTrip<int16>(*this, &UPrimitiveArrayTestObject::Int16s, GET_MEMBER_NAME_CHECKED(UPrimitiveArrayTestObject, Int16s), { MIN_int16, MIN_int8 - 1, -1, 0, 1, MAX_int8 + 1, MAX_int16 });
+	TestRoundTrip<int32>(*this, &UPrimitiveArrayTestObject::Int32s, GET_MEMBER_NAME_CHECKED(UPrimitiveArrayTestObject, Int32s), { MIN_int32, -1, 0, 1, MAX_int32 });
+	TestRoundTrip<int64>(*this, &UPrimitiveArrayTestObject::Int64s, GET_MEMBER_NAME_CHECKED(UPrimitiveArrayTestObject, Int64s), { MIN_int64, static_cast<int64>(MIN_int32) - 1, -1, 0, 1, static_cast<int64>(MAX_int32) + 1, MAX_int64 });
+
+	return true;
+}
+
+PRIMITIVEARRAYENCODING_TEST(GIVEN_unsigned_integer_arrays_WHEN_round_tripped_THEN_boundary_values_are_preserved)
+{
+	TestRoundTrip<uint8>(*this, &UPrimitiveArrayTestObject::UInt8s, GET_MEMBER_NAME_CHECKED(UPrimitiveArrayTestObject, UInt8s), { 0, 1, MAX_int8, MAX_int8 + 1, MAX_uint8 });
+	TestRoundTrip<uint16>(*this, &UPrimitiveArrayTestObject::UInt16s, GET_MEMBER_NAME_CHECKED(UPrimitiveArrayTestObject, UInt16s), { 0, 1, MAX_uint8 + 1, MAX_int16 + 1, MAX_uint16 });
+	TestRoundTrip<uint32>(*this, &UPrimitiveArrayTestObject::UInt32s, GET_MEMBER_NAME_CHECKED(UPrimitiveArrayTestObject, UInt32s), { 0, 1, static_cast<uint32>(MAX_int32) + 1, MAX_uint32 });
+	TestRoundTrip<uint64>(*this, &UPrimitiveArrayTestObject::UInt64s, GET_MEMBER_NAME_CHECKED(UPrimitiveArrayTestObject, UInt64s), { 0, 1, static_cast<uint64>(MAX_uint32) + 1, MAX_uint64 });
+
+	return true;
+}
+
+PRIMITIVEARRAYENCODING_TEST(GIVEN_floating_point_arrays_WHEN_round_tripped_THEN_boundary_values_are_preserved)
+{
+	TestRoundTrip<float>(*this, &UPrimitiveArrayTestObject::Floats, GET_MEMBER_NAME_CHECKED(UPrimitiveArrayTestObject, Floats), { -MAX_FLT, -1.5f, -0.0f, 0.0f, FLT_MIN, 1.5f, MAX_FLT });
+	TestRoundTrip<double>(*this, &UPrimitiveArrayTestObject::Doubles, GET_MEMBER_NAME_CHECKED(UPrimitiveArrayTestObject, Doubles), { -DBL_MAX, -1.5, -0.0, 0.0, DBL_MIN, 1.5, DBL_MAX });
+
+	return true;
+}
+
+PRIMITIVEARRAYENCODING_TEST(GIVEN_an_empty_array_WHEN_round_tripped_THEN_the_received_array_is_emptied)
+{
+	TestRoundTrip<int16>(*this, &UPrimitiveArrayTestObject::Int16s, GET_MEMBER_NAME_CHECKED(UPrimitiveArrayTestObject, Int16s), {});
+	TestRoundTrip<float>(*this, &UPrimitiveArrayTestObject::Floats, GET_MEMBER_NAME_CHECKED(UPrimitiveArrayTestObject, Floats), {});
+
+	return true;
+}
+
+PRIMITIVEARRAYENCODING_TEST(GIVEN_10k_element_arrays_WHEN_round_tripped_THEN_every_element_is_preserved)
+{
+	const int32 NumElements = 10000;
+
+	TArray<int8> Int8s;
+	TArray<uint16> UInt16s;
+	TArray<float> Floats;
+	for (int32 i = 0; i < NumElements; i++)
+	{
+		Int8s.Add(static_cast<int8>(i));
+		UInt16s.Add(static_cast<uint16>(i * 7));
+		Floats.Add(i * 0.25f);
+	}
+
+	TestRoundTrip<int8>(*this, &UPrimitiveArrayTestObject::Int8s, GET_MEMBER_NAME_CHECKED(UPrimitiveArrayTestObject, Int8s), Int8s);
+	TestRoundTrip<uint16>(*this, &UPrimitiveArrayTestObject::UInt16s, GET_MEMBER_NAME_CHECKED(UPrimitiveArrayTestObject, UInt16s), UInt16s);
+	TestRoundTrip<float>(*this, &UPrimitiveArrayTestObject::Floats, GET_MEMBER_NAME_CHECKED(UPrimitiveArrayTestObject, Floats), Floats);
+
+	return true;
+}
+
+PRIMITIVEARRAYENCODING_TEST(GIVEN_a_small_integer_array_written_by_the_factory_WHEN_read_element_wise_THEN_values_match)
+{
+	// Peers which read arrays one element at a time must still understand the widened list.
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	const FClassInfo Info = CreatePrimitiveArrayClassInfo();
+	const FHandoverPropertyInfo* PropertyInfo = FindHandoverProperty(Info, GET_MEMBER_NAME_CHECKED(UPrimitiveArrayTestObject, Int16s));
+
+	UPrimitiveArrayTestObject* Source = NewObject<UPrimitiveArrayTestObject>();
+	Source->Int16s = { MIN_int16, -1, 0, 1, MAX_int16 };
+
+	ComponentFactory Factory(false, NetDriver, nullptr);
+	uint32 BytesWritten = 0;
+	const FHandoverChangeState Changes = { PropertyInfo->Handle };
+	FWorkerComponentData Data = Factory.CreateHandoverComponentData(TestHandoverComponentId, Source, Info, Changes, BytesWritten);
+	Schema_Object* Fields = Schema_GetComponentDataFields(Data.schema_type);
+
+	TestEqual(TEXT("One schema value is written per element"), static_cast<int32>(Schema_GetInt32Count(Fields, PropertyInfo->Handle)), Source->Int16s.Num());
+	for (int32 i = 0; i < Source->Int16s.Num(); i++)
+	{
+		TestEqual(FString::Printf(TEXT("Element %d reads back element-wise"), i), static_cast<int16>(Schema_IndexInt32(Fields, PropertyInfo->Handle, i)), Source->Int16s[i]);
+	}
+
+	Schema_DestroyComponentData(Data.schema_type);
+
+	return true;
+}
@@ -0,0 +1,49 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+
+#include "PrimitiveArrayTestObject.generated.h"
+
+/**
+ * This class is for testing purposes only.
+ * Has a handover array of every numeric type, so they can be written by ComponentFactory and read back by ComponentReader.
+ */
+UCLASS()
+class UPrimitiveArrayTestObject : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(Handover)
+	TArray<int8> Int8s;
+
+	UPROPERTY(Handover)
+	TArray<int16> Int16s;
+
+	UPROPERTY(Handover)
+	TArray<int32> Int32s;
+
+	UPROPERTY(Handover)
+	TArray<int64> Int64s;
+
+	UPROPERTY(Handover)
+	TArray<uint8> UInt8s;
+
+	UPROPERTY(Handover)
+	TArray<uint16> UInt16s;
+
+	UPROPERTY(Handover)
+	TArray<uint32> UInt32s;
+
+	UPROPERTY(Handover)
+	TArray<uint64> UInt64s;
+
+	UPROPERTY(Handover)
+	TArray<float> Floats;
+
+	UPROPERTY(Handover)
+	TArray<double> Doubles;
+};
@@ -0,0 +1,233 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/DormancyWakeUpQueue.h"
+
+#include "CoreMinimal.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+
+#define DORMANCYWAKEUPQUEUE_TEST(TestName) \
+	GDK_TEST(Core, FDormancyWakeUpQueue, TestName)
+
+namespace
+{
+
+// A world with actors standing in for dormant actors which woke up.
+struct FTestActors
+{
+	explicit FTestActors(int32 NumActors)
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false);
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.bNoFail = true;
+
+		for (int32 i = 0; i < NumActors; i++)
+		{
+			Actors.Add(World->SpawnActor<AActor>(SpawnParams));
+		}
+	}
+
+	~FTestActors()
+	{
+		World->DestroyWorld(false);
+	}
+
+	UWorld* World;
+	TArray<AActor*> Actors;
+};
+
+void SimulateInitialSerialization(double Seconds)
+{
+	const double EndTime = FPlatformTime::Seconds() + Seconds;
+	while (FPlatformTime::Seconds() < EndTime)
+	{
+	}
+}
+
+} // anonymous namespace
+
+DORMANCYWAKEUPQUEUE_TEST(GIVEN_staged_actors_WHEN_processing_THEN_relevant_and_nearest_actors_are_replicated_first)
+{
+	FTestActors TestActors(4);
+	FDormancyWakeUpQueue Queue(1.0f);
+
+	Queue.Stage(TestActors.Actors[0], false, 100.f);
+	Queue.Stage(TestActors.Actors[1], true, 900.f);
+	Queue.Stage(TestActors.Actors[2], false, 100.f);
+	Queue.Stage(TestActors.Actors[3], true, 400.f);
+
+	TArray<AActor*> Replicated;
+	Queue.Process(MAX_int32, [&Replicated](AActor* Actor)
+	{
+		Replicated.Add(Actor);
+		return true;
+	});
+
+	const TArray<AActor*> Expected = { TestActors.Actors[3], TestActors.Actors[1], TestActors.Actors[0], TestActors.Actors[2] };
+	TestTrue(TEXT("Actors are replicated by relevance, then distance, then staging order"), Replicated == Expected);
+	TestEqual(TEXT("The queue is empty"), Queue.Num(), 0);
+
+	return true;
+}
+
+DORMANCYWAKEUPQUEUE_TEST(GIVEN_staged_actor_WHEN_staged_again_THEN_relevance_is_updated_without_duplicating_it)
+{
+	FTestActors TestActors(2);
+	FDormancyWakeUpQueue Queue(1.0f);
+
+	Queue.Stage(TestActors.Actors[0], false, 100.f);
+	Queue.Stage(TestActors.Actors[1], false, 200.f);
+	Queue.Stage(TestActors.Actors[1], true, 200.f);
+
+	TestEqual(TEXT("The actor is staged once"), Queue.Num(), 2);
+	TestEqual(TEXT("Re-staging isn't counted"), static_cast<int32>(Queue.GetStats().NumStaged), 2);
+
+	TArray<AActor*> Replicated;
+	Queue.Process(MAX_int32, [&Replicated](AActor* Actor)
+	{
+		Replicated.Add(Actor);
+		return true;
+	});
+
+	const TArray<AActor*> Expected = { TestActors.Actors[1], TestActors.Actors[0] };
+	TestTrue(TEXT("The updated relevance is used"), Replicated == Expected);
+
+	return true;
+}
+
+DORMANCYWAKEUPQUEUE_TEST(GIVEN_budget_smaller_than_one_replication_WHEN_processing_THEN_one_actor_is_replicated_per_call)
+{
+	FTestActors TestActors(3);
+	FDormancyWakeUpQueue Queue(0.000001f);
+
+	for (AActor* Actor : TestActors.Actors)
+	{
+		Queue.Stage(Actor, false, 0.f);
+	}
+
+	auto Replicate = [](AActor* Actor)
+	{
+		SimulateInitialSerialization(0.0001);
+		return true;
+	};
+
+	for (int32 Call = 1; Call <= 3; Call++)
+	{
+		TestEqual(TEXT("One actor is replicated"), Queue.Process(MAX_int32, Replicate), 1);
+		TestEqual(TEXT("The rest stay staged"), Queue.Num(), 3 - Call);
+	}
+
+	TestEqual(TEXT("Nothing is left to replicate"), Queue.Process(MAX_int32, Replicate), 0);
+	TestEqual(TEXT("Two calls left actors staged"), static_cast<int32>(Queue.GetStats().NumTicksOverBudget), 2);
+
+	return true;
+}
+
+DORMANCYWAKEUPQUEUE_TEST(GIVEN_staged_actors_WHEN_actors_are_destroyed_or_removed_THEN_they_are_not_replicated)
+{
+	FTestActors TestActors(3);
+	FDormancyWakeUpQueue Queue(1.0f);
+
+	for (AActor* Actor : TestActors.Actors)
+	{
+		Queue.Stage(Actor, false, 0.f);
+	}
+
+	TestActors.World->DestroyActor(TestActors.Actors[0]);
+	Queue.Remove(TestActors.Actors[1]);
+
+	TArray<AActor*> Replicated;
+	Queue.Process(MAX_int32, [&Replicated](AActor* Actor)
+	{
+		Replicated.Add(Actor);
+		return true;
+	});
+
+	const TArray<AActor*> Expected = { TestActors.Actors[2] };
+	TestTrue(TEXT("Only the remaining actor is replicated"), Replicated == Expected);
+	TestEqual(TEXT("The queue is empty"), Queue.Num(), 0);
+
+	return true;
+}
+
+DORMANCYWAKEUPQUEUE_TEST(GIVEN_no_rate_limit_left_WHEN_processing_THEN_nothing_is_replicated)
+{
+	FTestActors TestActors(2);
+	FDormancyWakeUpQueue Queue(1.0f);
+
+	for (AActor* Actor : TestActors.Actors)
+	{
+		Queue.Stage(Actor, false, 0.f);
+	}
+
+	int32 NumCalls = 0;
+	auto Replicate = [&NumCalls](AActor* Actor)
+	{
+		NumCalls++;
+		return true;
+	};
+
+	TestEqual(TEXT("Nothing is replicated"), Queue.Process(0, Replicate), 0);
+	TestEqual(TEXT("Replicate isn't called"), NumCalls, 0);
+	TestEqual(TEXT("Actors stay staged"), Queue.Num(), 2);
+	TestEqual(TEXT("The tick is rate limited"), static_cast<int32>(Queue.GetStats().NumTicksRateLimited), 1);
+
+	return true;
+}
+
+DORMANCYWAKEUPQUEUE_TEST(GIVEN_5000_dormant_actors_waking_together_WHEN_processing_with_a_rate_limit_THEN_they_are_spread_across_ticks_relevant_first)
+{
+	constexpr int32 NumActors = 5000;
+	constexpr int32 MaxActorsPerTick = 100;
+
+	FTestActors TestActors(NumActors);
+
+	// The time budget is never reached, so only the rate limit spreads the actors across ticks.
+	FDormancyWakeUpQueue Queue(MAX_flt);
+	for (int32 i = 0; i < NumActors; i++)
+	{
+		// Every tenth actor is relevant to a client, and should be replicated before any other.
+		Queue.Stage(TestActors.Actors[i], i % 10 == 0, static_cast<float>(i));
+	}
+
+	TMap<AActor*, int32> ActorIndices;
+	for (int32 i = 0; i < NumActors; i++)
+	{
+		ActorIndices.Add(TestActors.Actors[i], i);
+	}
+
+	int32 NumTicks = 0;
+	int32 NumReplicated = 0;
+	bool bWithinRateLimit = true;
+	bool bRelevantActorsFirst = true;
+	while (Queue.Num() > 0 && NumTicks < NumActors)
+	{
+		int32 Index = 0;
+		const int32 NumThisTick = Queue.Process(MaxActorsPerTick, [&](AActor* Actor)
+		{
+			// All relevant actors come before the first irrelevant one.
+			const int32 ActorIndex = ActorIndices.FindChecked(Actor);
+			const bool bExpectRelevant = NumReplicated + Index < NumActors / 10;
+			bRelevantActorsFirst &= (ActorIndex % 10 == 0) == bExpectRelevant;
+			Index++;
+			return true;
+		});
+
+		bWithinRateLimit &= NumThisTick <= MaxActorsPerTick;
+		NumReplicated += NumThisTick;
+		NumTicks++;
+	}
+
+	TestEqual(TEXT("All actors are replicated"), NumReplicated, NumActors);
+	TestTrue(TEXT("No tick replicates more actors than the rate limit"), bWithinRateLimit);
+	TestEqual(TEXT("Actors are spread across as few ticks as the rate limit allows"), NumTicks, NumActors / MaxActorsPerTick);
+	TestEqual(TEXT("Every tick but the last is rate limited"), static_cast<int32>(Queue.GetStats().NumTicksRateLimited), NumActors / MaxActorsPerTick - 1);
+	TestEqual(TEXT("No tick is over the time budget"), static_cast<int32>(Queue.GetStats().NumTicksOverBudget), 0);
+	TestTrue(TEXT("Actors relevant to clients are replicated first"), bRelevantActorsFirst);
+
+	return true;
+}
@@ -0,0 +1,164 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "SpatialGDKTests/SpatialGDK/Interop/Connection/SpatialOSWorkerInterface/SpatialOSWorkerConnectionSpy.h"
+#include "SpatialConstants.h"
+#include "Utils/ComponentFactory.h"
+#include "Utils/EntityCreationBatch.h"
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+
+#define ENTITYCREATIONBATCH_TEST(TestName) \
+	GDK_TEST(Core, FEntityCreationBatch, TestName)
+
+namespace
+{
+
+const Worker_EntityId FirstEntityId = 100;
+
+TArray<FWorkerComponentData> CreateTestComponents()
+{
+	TArray<FWorkerComponentData> Components;
+	Components.Add(SpatialGDK::ComponentFactory::CreateEmptyComponentData(SpatialConstants::POSITION_COMPONENT_ID));
+	Components.Add(SpatialGDK::ComponentFactory::CreateEmptyComponentData(SpatialConstants::NOT_STREAMED_COMPONENT_ID));
+	return Components;
+}
+
+Worker_CreateEntityResponseOp CreateResponseOp(Worker_RequestId RequestId, Worker_EntityId EntityId, uint8_t StatusCode)
+{
+	Worker_CreateEntityResponseOp Op = {};
+	Op.request_id = RequestId;
+	Op.entity_id = EntityId;
+	Op.status_code = StatusCode;
+	Op.message = "";
+	return Op;
+}
+
+} // anonymous namespace
+
+ENTITYCREATIONBATCH_TEST(GIVEN_queued_creations_WHEN_flushed_THEN_one_request_sent_per_entity_in_order)
+{
+	SpatialOSWorkerConnectionSpy Connection;
+	FEntityCreationBatch Batch;
+
+	Batch.Add(FirstEntityId, CreateTestComponents(), nullptr);
+	Batch.Add(FirstEntityId + 1, CreateTestComponents(), nullptr);
+	TestEqual(TEXT("Creations are queued until flushed"), Connection.GetNumCreateEntityRequests(), 0);
+
+	TArray<Worker_EntityId> SentEntityIds;
+	const int32 NumSent = Batch.Flush(Connection, [&SentEntityIds](Worker_RequestId RequestId, Worker_EntityId EntityId, const TWeakObjectPtr<USpatialActorChannel>& Channel)
+	{
+		SentEntityIds.Add(EntityId);
+	});
+
+	TestEqual(TEXT("Both creations were sent"), NumSent, 2);
+	TestEqual(TEXT("The connection received both requests"), Connection.GetNumCreateEntityRequests(), 2);
+	TestTrue(TEXT("Requests were sent in the order they were queued"), SentEntityIds == TArray<Worker_EntityId>({ FirstEntityId, FirstEntityId + 1 }));
+	TestEqual(TEXT("Nothing is left queued"), Batch.GetNumQueued(), 0);
+	TestEqual(TEXT("Both requests are in flight"), Batch.GetNumInFlight(), 2);
+
+	return true;
+}
+
+ENTITYCREATIONBATCH_TEST(GIVEN_empty_batch_WHEN_flushed_THEN_nothing_is_sent)
+{
+	SpatialOSWorkerConnectionSpy Connection;
+	FEntityCreationBatch Batch;
+
+	const int32 NumSent = Batch.Flush(Connection, [](Worker_RequestId RequestId, Worker_EntityId EntityId, const TWeakObjectPtr<USpatialActorChannel>& Channel) {});
+
+	TestEqual(TEXT("No requests were sent"), NumSent, 0);
+	TestEqual(TEXT("The connection received no requests"), Connection.GetNumCreateEntityRequests(), 0);
+	TestEqual(TEXT("No batch was recorded"), static_cast<int32>(Batch.GetStats().NumBatches), 0);
+
+	return true;
+}
+
+ENTITYCREATIONBATCH_TEST(GIVEN_flushed_batch_WHEN_all_responses_received_THEN_batch_completes_with_failures_counted)
+{
+	SpatialOSWorkerConnectionSpy Connection;
+	FEntityCreationBatch Batch;
+
+	Batch.Add(FirstEntityId, CreateTestComponents(), nullptr);
+	Batch.Add(FirstEntityId + 1, CreateTestComponents(), nullptr);
+
+	TArray<Worker_RequestId> RequestIds;
+	Batch.Flush(Connection, [&RequestIds](Worker_RequestId RequestId, Worker_EntityId EntityId, const TWeakObjectPtr<USpatialActorChannel>& Channel)
+	{
+		RequestIds.Add(RequestId);
+	});
+
+	TestTrue(TEXT("First response belongs to the batch"), Batch.OnCreateEntityResponse(CreateResponseOp(RequestIds[0], FirstEntityId, WORKER_STATUS_CODE_SUCCESS)));
+	TestEqual(TEXT("Batch is not complete after one response"), Batch.GetStats().LastBatchSize, 0);
+
+	TestTrue(TEXT("Second response belongs to the batch"), Batch.OnCreateEntityResponse(CreateResponseOp(RequestIds[1], FirstEntityId + 1, WORKER_STATUS_CODE_TIMEOUT)));
+	TestEqual(TEXT("Batch completes after the last response"), Batch.GetStats().LastBatchSize, 2);
+	TestEqual(TEXT("One request succeeded"), static_cast<int32>(Batch.GetStats().NumSucceeded), 1);
+	TestEqual(TEXT("One request failed"), static_cast<int32>(Batch.GetStats().NumFailed), 1);
+	TestEqual(TEXT("No requests are left in flight"), Batch.GetNumInFlight(), 0);
+
+	TestFalse(TEXT("Repeated response is not handled again"), Batch.OnCreateEntityResponse(CreateResponseOp(RequestIds[1], FirstEntityId + 1, WORKER_STATUS_CODE_SUCCESS)));
+	TestFalse(TEXT("Unknown request is ignored"), Batch.OnCreateEntityResponse(CreateResponseOp(RequestIds[1] + 100, 0, WORKER_STATUS_CODE_SUCCESS)));
+
+	return true;
+}
+
+ENTITYCREATIONBATCH_TEST(GIVEN_1000_creations_in_one_tick_WHEN_flushed_and_acknowledged_THEN_all_are_created)
+{
+	const int32 NumEntities = 1000;
+
+	SpatialOSWorkerConnectionSpy Connection;
+	FEntityCreationBatch Batch;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	for (int32 i = 0; i < NumEntities; i++)
+	{
+		Batch.Add(FirstEntityId + i, CreateTestComponents(), nullptr);
+	}
+
+	TArray<TPair<Worker_RequestId, Worker_EntityId>> SentRequests;
+	SentRequests.Reserve(NumEntities);
+	Batch.Flush(Connection, [&SentRequests](Worker_RequestId RequestId, Worker_EntityId EntityId, const TWeakObjectPtr<USpatialActorChannel>& Channel)
+	{
+		SentRequests.Emplace(RequestId, EntityId);
+	});
+
+	const double FlushedTime = FPlatformTime::Seconds();
+
+	for (const TPair<Worker_RequestId, Worker_EntityId>& Request : SentRequests)
+	{
+		Batch.OnCreateEntityResponse(CreateResponseOp(Request.Key, Request.Value, WORKER_STATUS_CODE_SUCCESS));
+	}
+
+	const double CreatedTime = FPlatformTime::Seconds();
+
+	TestEqual(TEXT("Every entity was sent"), Connection.GetNumCreateEntityRequests(), NumEntities);
+	TestTrue(TEXT("The last entity was sent last"), Connection.GetLastCreateEntityId() == FirstEntityId + NumEntities - 1);
+	TestEqual(TEXT("All creations were sent in a single batch"), static_cast<int32>(Batch.GetStats().NumBatches), 1);
+	TestEqual(TEXT("Every entity was created"), static_cast<int32>(Batch.GetStats().NumSucceeded), NumEntities);
+	TestEqual(TEXT("The batch completed"), Batch.GetStats().LastBatchSize, NumEntities);
+	TestEqual(TEXT("No requests are left in flight"), Batch.GetNumInFlight(), 0);
+
+	AddInfo(FString::Printf(TEXT("Queued and flushed %d creations in %.3f ms, all created after %.3f ms"),
+		NumEntities, (FlushedTime - StartTime) * 1000.0, (CreatedTime - StartTime) * 1000.0));
+
+	return true;
+}
+
+ENTITYCREATIONBATCH_TEST(GIVEN_unflushed_creations_WHEN_batch_destroyed_THEN_nothing_is_sent)
+{
+	SpatialOSWorkerConnectionSpy Connection;
+
+	{
+		FEntityCreationBatch Batch;
+		Batch.Add(FirstEntityId, CreateTestComponents(), nullptr);
+		TestEqual(TEXT("Creation is queued"), Batch.GetNumQueued(), 1);
+	}
+
+	TestEqual(TEXT("The connection received no requests"), Connection.GetNumCreateEntityRequests(), 0);
+
+	return true;
+}
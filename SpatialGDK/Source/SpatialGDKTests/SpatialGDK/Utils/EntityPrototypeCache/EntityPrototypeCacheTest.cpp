@@ -0,0 +1,204 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/SpatialClassInfoManager.h"
+#include "SpatialConstants.h"
+#include "Utils/EntityPrototypeCache.h"
+
+#include "CoreMinimal.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/PlatformTime.h"
+
+#define ENTITYPROTOTYPECACHE_TEST(TestName) \
+	GDK_TEST(Core, EntityPrototypeCache, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+const int32 NumBenchmarkActors = 10000;
+
+const WorkerAttributeSet AuthoritativeWorker = { TEXT("workerId:UnrealWorkerA") };
+const WorkerAttributeSet OwningClient = { TEXT("workerId:UnrealClientA") };
+
+TSet<uint32> CreateNetCullDistanceComponentIds()
+{
+	return TSet<uint32>({ 10000, 10001, 10002, 10003 });
+}
+
+FClassInfo CreateClassInfo(UClass* Class, Worker_ComponentId FirstComponentId)
+{
+	FClassInfo Info;
+	Info.Class = Class;
+	Info.SchemaComponents[SCHEMA_Data] = FirstComponentId;
+	Info.SchemaComponents[SCHEMA_OwnerOnly] = FirstComponentId + 1;
+	Info.SchemaComponents[SCHEMA_Handover] = FirstComponentId + 2;
+	return Info;
+}
+
+// Patches the per-actor entries into a copy of the prototype's write ACL, the way EntityFactory does.
+WriteAclMap CreateWriteAcl(const EntityPrototype& Prototype, bool bIsNetStartupActor)
+{
+	const WorkerRequirementSet AuthoritativeWorkerRequirementSet = { AuthoritativeWorker };
+	const WorkerRequirementSet OwningClientOnlyRequirementSet = { OwningClient };
+
+	WriteAclMap ComponentWriteAcl = Prototype.AuthoritativeWriteAcl;
+	for (const Worker_ComponentId ComponentId : Prototype.OwningClientComponentIds)
+	{
+		ComponentWriteAcl.Add(ComponentId, OwningClientOnlyRequirementSet);
+	}
+
+	if (bIsNetStartupActor)
+	{
+		ComponentWriteAcl.Add(SpatialConstants::TOMBSTONE_COMPONENT_ID, AuthoritativeWorkerRequirementSet);
+	}
+
+	return ComponentWriteAcl;
+}
+
+bool AclsAreEqual(const WriteAclMap& A, const WriteAclMap& B)
+{
+	if (A.Num() != B.Num())
+	{
+		return false;
+	}
+
+	for (const TPair<Worker_ComponentId, WorkerRequirementSet>& Pair : A)
+	{
+		const WorkerRequirementSet* Other = B.Find(Pair.Key);
+		if (Other == nullptr || *Other != Pair.Value)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+} // anonymous namespace
+
+ENTITYPROTOTYPECACHE_TEST(GIVEN_class_WHEN_prototype_created_THEN_contains_class_wide_acl_entries)
+{
+	const FClassInfo Info = CreateClassInfo(APawn::StaticClass(), 20000);
+
+	const EntityPrototype Prototype = EntityPrototypeCache::CreatePrototype(APawn::StaticClass(), Info, CreateNetCullDistanceComponentIds(), AuthoritativeWorker, true);
+
+	const WorkerRequirementSet AuthoritativeWorkerRequirementSet = { AuthoritativeWorker };
+	const WorkerRequirementSet* PositionAcl = Prototype.AuthoritativeWriteAcl.Find(SpatialConstants::POSITION_COMPONENT_ID);
+	TestTrue(TEXT("Position is written by the authoritative worker"), PositionAcl != nullptr && *PositionAcl == AuthoritativeWorkerRequirementSet);
+	TestTrue(TEXT("Class data component is in the ACL"), Prototype.AuthoritativeWriteAcl.Contains(20000));
+	TestTrue(TEXT("Net cull distance components are in the ACL"), Prototype.AuthoritativeWriteAcl.Contains(10003));
+	TestTrue(TEXT("Ring buffer server endpoint is in the ACL"), Prototype.AuthoritativeWriteAcl.Contains(SpatialConstants::SERVER_ENDPOINT_COMPONENT_ID));
+	TestFalse(TEXT("Legacy server endpoint is not in the ACL"), Prototype.AuthoritativeWriteAcl.Contains(SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID_LEGACY));
+	TestFalse(TEXT("Client endpoint is left for the owning client"), Prototype.AuthoritativeWriteAcl.Contains(SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID));
+	TestTrue(TEXT("Client endpoint is an owning client component"), Prototype.OwningClientComponentIds == TArray<Worker_ComponentId>({ SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID }));
+	TestTrue(TEXT("Class path is cached"), Prototype.ClassPath == APawn::StaticClass()->GetPathName());
+	TestFalse(TEXT("Pawn is not a player controller"), Prototype.bIsPlayerController);
+
+	return true;
+}
+
+ENTITYPROTOTYPECACHE_TEST(GIVEN_player_controller_class_WHEN_prototype_created_THEN_heartbeat_is_owned_by_client)
+{
+	const FClassInfo Info = CreateClassInfo(APlayerController::StaticClass(), 20000);
+
+	const EntityPrototype Prototype = EntityPrototypeCache::CreatePrototype(APlayerController::StaticClass(), Info, CreateNetCullDistanceComponentIds(), AuthoritativeWorker, false);
+
+	TestTrue(TEXT("Player controller is flagged"), Prototype.bIsPlayerController);
+	TestTrue(TEXT("Heartbeat is an owning client component"), Prototype.OwningClientComponentIds.Contains(SpatialConstants::HEARTBEAT_COMPONENT_ID));
+	TestTrue(TEXT("Legacy client endpoint is an owning client component"), Prototype.OwningClientComponentIds.Contains(SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID_LEGACY));
+	TestFalse(TEXT("Heartbeat is not written by the authoritative worker"), Prototype.AuthoritativeWriteAcl.Contains(SpatialConstants::HEARTBEAT_COMPONENT_ID));
+
+	return true;
+}
+
+ENTITYPROTOTYPECACHE_TEST(GIVEN_cached_prototype_WHEN_requested_again_THEN_cache_hits)
+{
+	EntityPrototypeCache Cache;
+	const FClassInfo Info = CreateClassInfo(AActor::StaticClass(), 20000);
+	const TSet<uint32> NetCullDistanceComponentIds = CreateNetCullDistanceComponentIds();
+
+	const EntityPrototype& First = Cache.GetOrCreatePrototype(AActor::StaticClass(), Info, NetCullDistanceComponentIds, AuthoritativeWorker, true);
+	const EntityPrototype& Second = Cache.GetOrCreatePrototype(AActor::StaticClass(), Info, NetCullDistanceComponentIds, AuthoritativeWorker, true);
+
+	TestTrue(TEXT("The same prototype is returned"), &First == &Second);
+	TestEqual(TEXT("One miss"), static_cast<int32>(Cache.GetNumMisses()), 1);
+	TestEqual(TEXT("One hit"), static_cast<int32>(Cache.GetNumHits()), 1);
+
+	return true;
+}
+
+ENTITYPROTOTYPECACHE_TEST(GIVEN_cached_prototype_WHEN_authoritative_worker_changes_THEN_prototype_is_rebuilt)
+{
+	EntityPrototypeCache Cache;
+	const FClassInfo Info = CreateClassInfo(AActor::StaticClass(), 20000);
+	const TSet<uint32> NetCullDistanceComponentIds = CreateNetCullDistanceComponentIds();
+	const WorkerAttributeSet OtherWorker = { TEXT("workerId:UnrealWorkerB") };
+
+	Cache.GetOrCreatePrototype(AActor::StaticClass(), Info, NetCullDistanceComponentIds, AuthoritativeWorker, true);
+	const EntityPrototype& Rebuilt = Cache.GetOrCreatePrototype(AActor::StaticClass(), Info, NetCullDistanceComponentIds, OtherWorker, true);
+
+	const WorkerRequirementSet OtherWorkerRequirementSet = { OtherWorker };
+	const WorkerRequirementSet* PositionAcl = Rebuilt.AuthoritativeWriteAcl.Find(SpatialConstants::POSITION_COMPONENT_ID);
+	TestTrue(TEXT("Position is written by the new worker"), PositionAcl != nullptr && *PositionAcl == OtherWorkerRequirementSet);
+	TestEqual(TEXT("Both requests missed"), static_cast<int32>(Cache.GetNumMisses()), 2);
+
+	Cache.GetOrCreatePrototype(AActor::StaticClass(), Info, NetCullDistanceComponentIds, OtherWorker, false);
+	TestEqual(TEXT("Changing the RPC setup also misses"), static_cast<int32>(Cache.GetNumMisses()), 3);
+	TestEqual(TEXT("Stale prototypes were dropped"), Cache.Num(), 1);
+
+	return true;
+}
+
+ENTITYPROTOTYPECACHE_TEST(GIVEN_10000_actors_of_a_few_classes_WHEN_acls_built_THEN_cached_matches_uncached_and_report_timing)
+{
+	TArray<UClass*> Classes = { AActor::StaticClass(), APawn::StaticClass(), ACharacter::StaticClass(), APlayerController::StaticClass() };
+	TArray<FClassInfo> Infos;
+	for (int32 i = 0; i < Classes.Num(); i++)
+	{
+		Infos.Add(CreateClassInfo(Classes[i], 20000 + i * 3));
+	}
+
+	const TSet<uint32> NetCullDistanceComponentIds = CreateNetCullDistanceComponentIds();
+
+	for (int32 i = 0; i < Classes.Num(); i++)
+	{
+		EntityPrototypeCache Cache;
+		const WriteAclMap Uncached = CreateWriteAcl(EntityPrototypeCache::CreatePrototype(Classes[i], Infos[i], NetCullDistanceComponentIds, AuthoritativeWorker, true), true);
+		const WriteAclMap Cached = CreateWriteAcl(Cache.GetOrCreatePrototype(Classes[i], Infos[i], NetCullDistanceComponentIds, AuthoritativeWorker, true), true);
+		TestTrue(*FString::Printf(TEXT("Cached ACL matches uncached ACL for %s"), *Classes[i]->GetName()), AclsAreEqual(Uncached, Cached));
+	}
+
+	int32 NumEntries = 0;
+
+	const double UncachedStart = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumBenchmarkActors; i++)
+	{
+		const int32 ClassIndex = i % Classes.Num();
+		const EntityPrototype Prototype = EntityPrototypeCache::CreatePrototype(Classes[ClassIndex], Infos[ClassIndex], NetCullDistanceComponentIds, AuthoritativeWorker, true);
+		NumEntries += CreateWriteAcl(Prototype, false).Num() + Prototype.ClassPath.Len();
+	}
+	const double UncachedSeconds = FPlatformTime::Seconds() - UncachedStart;
+
+	EntityPrototypeCache Cache;
+	const double CachedStart = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumBenchmarkActors; i++)
+	{
+		const int32 ClassIndex = i % Classes.Num();
+		const EntityPrototype& Prototype = Cache.GetOrCreatePrototype(Classes[ClassIndex], Infos[ClassIndex], NetCullDistanceComponentIds, AuthoritativeWorker, true);
+		NumEntries -= CreateWriteAcl(Prototype, false).Num() + Prototype.ClassPath.Len();
+	}
+	const double CachedSeconds = FPlatformTime::Seconds() - CachedStart;
+
+	TestEqual(TEXT("Both paths produced the same number of entries"), NumEntries, 0);
+	TestEqual(TEXT("Only one prototype was built per class"), static_cast<int32>(Cache.GetNumMisses()), Classes.Num());
+
+	AddInfo(FString::Printf(TEXT("Class-wide entity data for %d actors of %d classes: uncached %.3f ms, cached %.3f ms"),
+		NumBenchmarkActors, Classes.Num(), UncachedSeconds * 1000.0, CachedSeconds * 1000.0));
+
+	return true;
+}
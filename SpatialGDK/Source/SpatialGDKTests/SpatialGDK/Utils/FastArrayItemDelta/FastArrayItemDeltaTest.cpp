@@ -0,0 +1,391 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "EngineClasses/SpatialFastArrayNetSerialize.h"
+#include "EngineClasses/SpatialNetBitReader.h"
+#include "EngineClasses/SpatialNetBitWriter.h"
+#include "EngineClasses/SpatialNetDriver.h"
+#include "FastArrayItemDeltaTestObject.h"
+#include "SpatialGDKTests/SpatialGDK/Interop/Connection/SpatialOSWorkerInterface/SpatialOSWorkerConnectionSpy.h"
+#include "Utils/FastArrayItemDelta.h"
+#include "Utils/SchemaUtils.h"
+#include "Utils/UpdatesQueuedUntilAuthority.h"
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+#define FASTARRAYITEMDELTA_TEST(TestName) \
+	GDK_TEST(Core, FastArrayItemDelta, TestName)
+
+using SpatialGDK::FFastArrayItemDelta;
+using SpatialGDK::FFastArrayItemDeltaReceiverState;
+using SpatialGDK::FFastArrayItemDeltaSenderState;
+
+namespace
+{
+
+const Schema_FieldId KeyframeFieldId = 1;
+const Worker_EntityId TestEntityId = 1000;
+const Worker_ComponentId TestComponentId = 12345;
+const int32 NumItems = 500;
+const int32 NumItemsChangedPerUpdate = 5; // 1% churn
+
+UStructProperty* GetArrayProperty()
+{
+	return FindField<UStructProperty>(UFastArrayItemDeltaTestObject::StaticClass(), GET_MEMBER_NAME_CHECKED(UFastArrayItemDeltaTestObject, Array));
+}
+
+UArrayProperty* GetItemsProperty()
+{
+	return FindField<UArrayProperty>(FFastArrayItemDeltaTestArray::StaticStruct(), GET_MEMBER_NAME_CHECKED(FFastArrayItemDeltaTestArray, Items));
+}
+
+UFastArrayItemDeltaTestObject* CreateSender()
+{
+	UFastArrayItemDeltaTestObject* Sender = NewObject<UFastArrayItemDeltaTestObject>();
+	for (int32 i = 0; i < NumItems; i++)
+	{
+		FFastArrayItemDeltaTestItem& Item = Sender->Array.Items.AddDefaulted_GetRef();
+		Item.Value = i;
+		Sender->Array.MarkItemDirty(Item);
+	}
+	return Sender;
+}
+
+void ChangeItems(UFastArrayItemDeltaTestObject* Sender, int32 FirstIndex, int32 NumToChange)
+{
+	for (int32 Index = FirstIndex; Index < FirstIndex + NumToChange; Index++)
+	{
+		FFastArrayItemDeltaTestItem& Item = Sender->Array.Items[Index];
+		Item.Value += NumItems;
+		Sender->Array.MarkItemDirty(Item);
+	}
+}
+
+TMap<int32, int32> GetValuesById(const UFastArrayItemDeltaTestObject* Object)
+{
+	TMap<int32, int32> ValuesById;
+	for (const FFastArrayItemDeltaTestItem& Item : Object->Array.Items)
+	{
+		ValuesById.Add(Item.ReplicationID, Item.Value);
+	}
+	return ValuesById;
+}
+
+bool HaveSameItems(const UFastArrayItemDeltaTestObject* A, const UFastArrayItemDeltaTestObject* B)
+{
+	return GetValuesById(A).OrderIndependentCompareEqual(GetValuesById(B));
+}
+
+// A component update holding whatever ComponentFactory would write for the FastArray of one object.
+class FTestUpdate
+{
+public:
+	FTestUpdate()
+		: Update(Schema_CreateComponentUpdate())
+	{ }
+
+	~FTestUpdate()
+	{
+		Schema_DestroyComponentUpdate(Update);
+	}
+
+	Schema_Object* GetFields() const { return Schema_GetComponentUpdateFields(Update); }
+	uint32 GetNumBytes() const { return Schema_GetWriteBufferLength(GetFields()); }
+
+private:
+	Schema_ComponentUpdate* Update;
+};
+
+// Writes the keyframe as ComponentFactory does, including when it resends a component's whole state.
+int32 WriteKeyframe(USpatialNetDriver* NetDriver, UFastArrayItemDeltaTestObject* Sender, Schema_Object* Fields, FFastArrayItemDeltaSenderState& State)
+{
+	return FFastArrayItemDelta::WriteKeyframe(NetDriver, Fields, KeyframeFieldId, Sender, 0, GetArrayProperty(), GetItemsProperty(), FFastArrayItemDeltaTestArray::StaticStruct(), State);
+}
+
+int32 WriteKeyframe(USpatialNetDriver* NetDriver, UFastArrayItemDeltaTestObject* Sender, const FTestUpdate& Update, FFastArrayItemDeltaSenderState& State)
+{
+	return WriteKeyframe(NetDriver, Sender, Update.GetFields(), State);
+}
+
+bool WriteDelta(USpatialNetDriver* NetDriver, UFastArrayItemDeltaTestObject* Sender, Schema_Object* Fields, FFastArrayItemDeltaSenderState& State)
+{
+	return FFastArrayItemDelta::WriteDelta(NetDriver, Fields, KeyframeFieldId, &Sender->Array, GetItemsProperty(), State);
+}
+
+bool WriteDelta(USpatialNetDriver* NetDriver, UFastArrayItemDeltaTestObject* Sender, const FTestUpdate& Update, FFastArrayItemDeltaSenderState& State)
+{
+	return WriteDelta(NetDriver, Sender, Update.GetFields(), State);
+}
+
+void ApplyKeyframe(USpatialNetDriver* NetDriver, UFastArrayItemDeltaTestObject* Receiver, Schema_Object* Fields, FFastArrayItemDeltaReceiverState& State)
+{
+	TArrayView<const uint8> ValueData = SpatialGDK::GetBytesViewFromSchema(Fields, KeyframeFieldId);
+	TSet<FUnrealObjectRef> MappedRefs;
+	TSet<FUnrealObjectRef> UnresolvedRefs;
+	FSpatialNetBitReader Reader(nullptr, ValueData.GetData(), ValueData.Num() * 8, MappedRefs, UnresolvedRefs);
+	SpatialGDK::FSpatialNetDeltaSerializeInfo::DeltaSerializeRead(NetDriver, Reader, Receiver, 0, GetArrayProperty(), FFastArrayItemDeltaTestArray::StaticStruct());
+	FFastArrayItemDelta::OnKeyframeApplied(&Receiver->Array, GetItemsProperty(), State);
+}
+
+void ApplyKeyframe(USpatialNetDriver* NetDriver, UFastArrayItemDeltaTestObject* Receiver, const FTestUpdate& Update, FFastArrayItemDeltaReceiverState& State)
+{
+	ApplyKeyframe(NetDriver, Receiver, Update.GetFields(), State);
+}
+
+bool ApplyDelta(USpatialNetDriver* NetDriver, UFastArrayItemDeltaTestObject* Receiver, Schema_Object* Fields, FFastArrayItemDeltaReceiverState* State)
+{
+	Schema_Object* DeltaObject = Schema_GetObject(Fields, FFastArrayItemDelta::GetDeltaFieldId(KeyframeFieldId));
+	TSet<FUnrealObjectRef> MappedRefs;
+	TSet<FUnrealObjectRef> UnresolvedRefs;
+	return FFastArrayItemDelta::ApplyDelta(NetDriver, DeltaObject, &Receiver->Array, GetItemsProperty(), FFastArrayItemDeltaTestArray::StaticStruct(), State, MappedRefs, UnresolvedRefs);
+}
+
+bool ApplyDelta(USpatialNetDriver* NetDriver, UFastArrayItemDeltaTestObject* Receiver, const FTestUpdate& Update, FFastArrayItemDeltaReceiverState* State)
+{
+	return ApplyDelta(NetDriver, Receiver, Update.GetFields(), State);
+}
+
+} // anonymous namespace
+
+FASTARRAYITEMDELTA_TEST(GIVEN_500_items_WHEN_1_percent_change_THEN_only_the_changed_items_are_written_and_applied)
+{
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	UFastArrayItemDeltaTestObject* Sender = CreateSender();
+	UFastArrayItemDeltaTestObject* Receiver = NewObject<UFastArrayItemDeltaTestObject>();
+	FFastArrayItemDeltaSenderState SenderState;
+	FFastArrayItemDeltaReceiverState ReceiverState;
+
+	uint32 KeyframeUpdateBytes = 0;
+	{
+		FTestUpdate Update;
+		WriteKeyframe(NetDriver, Sender, Update, SenderState);
+		KeyframeUpdateBytes = Update.GetNumBytes();
+		ApplyKeyframe(NetDriver, Receiver, Update, ReceiverState);
+	}
+	TestTrue("Keyframe applies the whole array", HaveSameItems(Sender, Receiver));
+
+	uint32 FirstDeltaBytes = 0;
+	{
+		ChangeItems(Sender, 0, NumItemsChangedPerUpdate);
+		Receiver->Array.ResetCallbackCounts();
+
+		FTestUpdate Update;
+		TestTrue("Item delta is written", WriteDelta(NetDriver, Sender, Update, SenderState));
+		FirstDeltaBytes = Update.GetNumBytes();
+		ApplyDelta(NetDriver, Receiver, Update, &ReceiverState);
+	}
+	TestEqual("Every changed item is applied", Receiver->Array.NumChanged, NumItemsChangedPerUpdate);
+	TestEqual("No item is added", Receiver->Array.NumAdded, 0);
+	TestTrue("Item delta matches the sender", HaveSameItems(Sender, Receiver));
+
+	uint32 SecondDeltaBytes = 0;
+	{
+		ChangeItems(Sender, NumItemsChangedPerUpdate, NumItemsChangedPerUpdate);
+		Receiver->Array.ResetCallbackCounts();
+
+		FTestUpdate Update;
+		TestTrue("Item delta is written", WriteDelta(NetDriver, Sender, Update, SenderState));
+		SecondDeltaBytes = Update.GetNumBytes();
+		ApplyDelta(NetDriver, Receiver, Update, &ReceiverState);
+	}
+	// The item delta is cumulative, but the items applied by the previous update are skipped.
+	TestEqual("Only the newly changed items are applied", Receiver->Array.NumChanged, NumItemsChangedPerUpdate);
+	TestTrue("Item delta matches the sender", HaveSameItems(Sender, Receiver));
+
+	TestTrue("Item delta is a small fraction of the keyframe", FirstDeltaBytes * 10 < KeyframeUpdateBytes);
+	TestTrue("Cumulative item delta grows with the items changed since the keyframe", SecondDeltaBytes > FirstDeltaBytes);
+
+	AddInfo(FString::Printf(TEXT("%d items, %d changed per update: keyframe %u bytes, first item delta %u bytes, second item delta %u bytes"),
+		NumItems, NumItemsChangedPerUpdate, KeyframeUpdateBytes, FirstDeltaBytes, SecondDeltaBytes));
+
+	return true;
+}
+
+FASTARRAYITEMDELTA_TEST(GIVEN_items_added_and_removed_WHEN_item_delta_applied_THEN_add_and_remove_callbacks_fire_once)
+{
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	UFastArrayItemDeltaTestObject* Sender = CreateSender();
+	UFastArrayItemDeltaTestObject* Receiver = NewObject<UFastArrayItemDeltaTestObject>();
+	FFastArrayItemDeltaSenderState SenderState;
+	FFastArrayItemDeltaReceiverState ReceiverState;
+
+	{
+		FTestUpdate Update;
+		WriteKeyframe(NetDriver, Sender, Update, SenderState);
+		ApplyKeyframe(NetDriver, Receiver, Update, ReceiverState);
+	}
+
+	Sender->Array.Items.RemoveAt(0);
+	Sender->Array.MarkArrayDirty();
+	FFastArrayItemDeltaTestItem& AddedItem = Sender->Array.Items.AddDefaulted_GetRef();
+	AddedItem.Value = -1;
+	Sender->Array.MarkItemDirty(AddedItem);
+
+	Receiver->Array.ResetCallbackCounts();
+	{
+		FTestUpdate Update;
+		TestTrue("Item delta is written", WriteDelta(NetDriver, Sender, Update, SenderState));
+		ApplyDelta(NetDriver, Receiver, Update, &ReceiverState);
+	}
+	TestEqual("Added item is applied", Receiver->Array.NumAdded, 1);
+	TestEqual("Removed item is applied", Receiver->Array.NumRemoved, 1);
+	TestEqual("No other item is applied", Receiver->Array.NumChanged, 0);
+	TestTrue("Item delta matches the sender", HaveSameItems(Sender, Receiver));
+
+	// The next item delta still holds the addition and removal, which the receiver has already applied.
+	ChangeItems(Sender, 0, 1);
+	Receiver->Array.ResetCallbackCounts();
+	{
+		FTestUpdate Update;
+		TestTrue("Item delta is written", WriteDelta(NetDriver, Sender, Update, SenderState));
+		ApplyDelta(NetDriver, Receiver, Update, &ReceiverState);
+	}
+	TestEqual("Added item is not applied again", Receiver->Array.NumAdded, 0);
+	TestEqual("Removed item is not removed again", Receiver->Array.NumRemoved, 0);
+	TestEqual("Changed item is applied", Receiver->Array.NumChanged, 1);
+	TestTrue("Item delta matches the sender", HaveSameItems(Sender, Receiver));
+
+	return true;
+}
+
+FASTARRAYITEMDELTA_TEST(GIVEN_keyframe_and_latest_item_delta_WHEN_applied_by_a_new_worker_THEN_it_has_the_whole_array)
+{
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	UFastArrayItemDeltaTestObject* Sender = CreateSender();
+	FFastArrayItemDeltaSenderState SenderState;
+
+	// What the Runtime stores for the entity: the last keyframe and the last item delta written.
+	FTestUpdate Keyframe;
+	WriteKeyframe(NetDriver, Sender, Keyframe, SenderState);
+
+	for (int32 Round = 0; Round < 3; Round++)
+	{
+		ChangeItems(Sender, Round * NumItemsChangedPerUpdate, NumItemsChangedPerUpdate);
+		FTestUpdate Update;
+		TestTrue("Item delta is written", WriteDelta(NetDriver, Sender, Update, SenderState));
+
+		if (Round == 2)
+		{
+			UFastArrayItemDeltaTestObject* LateReceiver = NewObject<UFastArrayItemDeltaTestObject>();
+			FFastArrayItemDeltaReceiverState LateReceiverState;
+			ApplyKeyframe(NetDriver, LateReceiver, Keyframe, LateReceiverState);
+			ApplyDelta(NetDriver, LateReceiver, Update, &LateReceiverState);
+
+			TestTrue("Keyframe and latest item delta rebuild the array", HaveSameItems(Sender, LateReceiver));
+		}
+	}
+
+	return true;
+}
+
+FASTARRAYITEMDELTA_TEST(GIVEN_item_deltas_WHEN_they_outgrow_the_keyframe_THEN_a_new_keyframe_is_needed)
+{
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	UFastArrayItemDeltaTestObject* Sender = CreateSender();
+	FFastArrayItemDeltaSenderState SenderState;
+
+	int32 KeyframeBytes = 0;
+	{
+		FTestUpdate Update;
+		KeyframeBytes = WriteKeyframe(NetDriver, Sender, Update, SenderState);
+	}
+
+	TestFalse("Unchanged array isn't written again", FFastArrayItemDelta::HasChangedSinceLastWrite(&Sender->Array, SenderState));
+
+	int32 NumDeltasWritten = 0;
+	for (int32 FirstIndex = 0; FirstIndex + NumItemsChangedPerUpdate <= NumItems; FirstIndex += NumItemsChangedPerUpdate)
+	{
+		ChangeItems(Sender, FirstIndex, NumItemsChangedPerUpdate);
+		TestTrue("Changed array is written", FFastArrayItemDelta::HasChangedSinceLastWrite(&Sender->Array, SenderState));
+
+		FTestUpdate Update;
+		if (!WriteDelta(NetDriver, Sender, Update, SenderState))
+		{
+			TestEqual("Nothing is written when a keyframe is needed", Update.GetNumBytes(), 0u);
+			break;
+		}
+
+		NumDeltasWritten++;
+		TestTrue("Item deltas since the keyframe stay within its size", SenderState.DeltaBytesSinceKeyframe <= KeyframeBytes);
+	}
+
+	TestTrue("Several item deltas are written before a new keyframe", NumDeltasWritten > 1);
+	TestTrue("A new keyframe is needed before every item has changed", NumDeltasWritten < NumItems / NumItemsChangedPerUpdate);
+
+	{
+		FTestUpdate Update;
+		WriteKeyframe(NetDriver, Sender, Update, SenderState);
+	}
+	TestEqual("New keyframe resets the item delta", SenderState.DeltaBytesSinceKeyframe, 0);
+
+	AddInfo(FString::Printf(TEXT("Keyframe %d bytes, %d item deltas of %d items written before the next keyframe"), KeyframeBytes, NumDeltasWritten, NumItemsChangedPerUpdate));
+
+	return true;
+}
+
+FASTARRAYITEMDELTA_TEST(GIVEN_queued_item_delta_WHEN_evicted_and_whole_state_resent_THEN_the_resend_holds_every_item)
+{
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	UFastArrayItemDeltaTestObject* Sender = CreateSender();
+	UFastArrayItemDeltaTestObject* Receiver = NewObject<UFastArrayItemDeltaTestObject>();
+	FFastArrayItemDeltaSenderState SenderState;
+	FFastArrayItemDeltaReceiverState ReceiverState;
+
+	{
+		FTestUpdate Update;
+		WriteKeyframe(NetDriver, Sender, Update, SenderState);
+		ApplyKeyframe(NetDriver, Receiver, Update, ReceiverState);
+	}
+
+	// The item delta is queued while the worker isn't authoritative, then evicted by another entity's update.
+	ChangeItems(Sender, 0, NumItemsChangedPerUpdate);
+	FWorkerComponentUpdate DeltaUpdate = {};
+	DeltaUpdate.component_id = TestComponentId;
+	DeltaUpdate.schema_type = Schema_CreateComponentUpdate();
+	TestTrue("Item delta is written", WriteDelta(NetDriver, Sender, Schema_GetComponentUpdateFields(DeltaUpdate.schema_type), SenderState));
+
+	FUpdatesQueuedUntilAuthority Store(FUpdatesQueuedUntilAuthority::GetUpdateSize(DeltaUpdate));
+	Store.Add(TestEntityId, DeltaUpdate);
+
+	FWorkerComponentUpdate OtherUpdate = {};
+	OtherUpdate.component_id = TestComponentId;
+	OtherUpdate.schema_type = Schema_CreateComponentUpdate();
+	Schema_AddUint32(Schema_GetComponentUpdateFields(OtherUpdate.schema_type), KeyframeFieldId, 1);
+	Store.Add(TestEntityId + 1, OtherUpdate);
+
+	TestTrue("Item delta was evicted", Store.WasEvicted(TestEntityId, TestComponentId));
+	TestFalse("The array hasn't changed since the evicted item delta was written", FFastArrayItemDelta::HasChangedSinceLastWrite(&Sender->Array, SenderState));
+
+	SpatialOSWorkerConnectionSpy Connection;
+	Store.Send(TestEntityId, TestComponentId, Connection, [&](FWorkerComponentUpdate& OutUpdate)
+	{
+		OutUpdate = {};
+		OutUpdate.component_id = TestComponentId;
+		OutUpdate.schema_type = Schema_CreateComponentUpdate();
+		WriteKeyframe(NetDriver, Sender, Schema_GetComponentUpdateFields(OutUpdate.schema_type), SenderState);
+		return true;
+	});
+
+	const TArray<SpatialOSWorkerConnectionSpy::FSentComponentUpdate>& SentUpdates = Connection.GetSentComponentUpdates();
+	TestEqual("Whole state was resent", SentUpdates.Num(), 1);
+	if (SentUpdates.Num() == 1)
+	{
+		Schema_Object* Fields = Schema_GetComponentUpdateFields(SentUpdates[0].Update.schema_type);
+
+		UFastArrayItemDeltaTestObject* LateReceiver = NewObject<UFastArrayItemDeltaTestObject>();
+		FFastArrayItemDeltaReceiverState LateReceiverState;
+		ApplyKeyframe(NetDriver, LateReceiver, Fields, LateReceiverState);
+		TestEqual("Resend holds every item", LateReceiver->Array.Items.Num(), NumItems);
+		TestTrue("Resend holds the items changed by the evicted item delta", HaveSameItems(Sender, LateReceiver));
+
+		ApplyKeyframe(NetDriver, Receiver, Fields, ReceiverState);
+		TestFalse("Resend clears the item delta stored alongside the previous keyframe", ApplyDelta(NetDriver, Receiver, Fields, &ReceiverState));
+		TestTrue("Resend brings the receiver up to date", HaveSameItems(Sender, Receiver));
+	}
+	TestEqual("Later item deltas are written against the resent keyframe", SenderState.DeltaBytesSinceKeyframe, 0);
+
+	return true;
+}
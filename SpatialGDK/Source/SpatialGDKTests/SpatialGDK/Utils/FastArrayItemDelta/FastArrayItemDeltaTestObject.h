@@ -0,0 +1,91 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/NetSerialization.h"
+#include "UObject/Object.h"
+
+#include "FastArrayItemDeltaTestObject.generated.h"
+
+struct FFastArrayItemDeltaTestArray;
+
+/**
+ * This struct is for testing purposes only.
+ * Counts the item callbacks fired on its array, so tests can tell which items were applied.
+ */
+USTRUCT()
+struct FFastArrayItemDeltaTestItem : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Value = 0;
+
+	void PostReplicatedAdd(const FFastArrayItemDeltaTestArray& InArraySerializer);
+	void PostReplicatedChange(const FFastArrayItemDeltaTestArray& InArraySerializer);
+	void PreReplicatedRemove(const FFastArrayItemDeltaTestArray& InArraySerializer);
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+	{
+		Ar << Value;
+		bOutSuccess = true;
+		return true;
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FFastArrayItemDeltaTestItem> : public TStructOpsTypeTraitsBase2<FFastArrayItemDeltaTestItem>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
+
+USTRUCT()
+struct FFastArrayItemDeltaTestArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FFastArrayItemDeltaTestItem> Items;
+
+	mutable int32 NumAdded = 0;
+	mutable int32 NumChanged = 0;
+	mutable int32 NumRemoved = 0;
+
+	void ResetCallbackCounts() { NumAdded = NumChanged = NumRemoved = 0; }
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FFastArrayItemDeltaTestItem, FFastArrayItemDeltaTestArray>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FFastArrayItemDeltaTestArray> : public TStructOpsTypeTraitsBase2<FFastArrayItemDeltaTestArray>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
+
+inline void FFastArrayItemDeltaTestItem::PostReplicatedAdd(const FFastArrayItemDeltaTestArray& InArraySerializer) { InArraySerializer.NumAdded++; }
+inline void FFastArrayItemDeltaTestItem::PostReplicatedChange(const FFastArrayItemDeltaTestArray& InArraySerializer) { InArraySerializer.NumChanged++; }
+inline void FFastArrayItemDeltaTestItem::PreReplicatedRemove(const FFastArrayItemDeltaTestArray& InArraySerializer) { InArraySerializer.NumRemoved++; }
+
+/**
+ * This class is for testing purposes only.
+ * Holds a FastArray, so it can be written and applied as it would be on a replicated object.
+ */
+UCLASS()
+class UFastArrayItemDeltaTestObject : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	FFastArrayItemDeltaTestArray Array;
+};
@@ -0,0 +1,144 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Schema/StandardLibrary.h"
+#include "Utils/PositionUpdateFilter.h"
+#include "Utils/UpdatesQueuedUntilAuthority.h"
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+#define POSITIONUPDATEFILTER_TEST(TestName) \
+	GDK_TEST(Core, FPositionUpdateFilter, TestName)
+
+namespace
+{
+
+const Worker_EntityId TestEntityId = 1000;
+
+uint32 GetPositionUpdateSize(const FVector& Location)
+{
+	Worker_ComponentUpdate Update = SpatialGDK::Position::CreatePositionUpdate(SpatialGDK::Coordinates::FromFVector(Location));
+	const uint32 Size = FUpdatesQueuedUntilAuthority::GetUpdateSize(Update);
+	Schema_DestroyComponentUpdate(Update.schema_type);
+	return Size;
+}
+
+} // anonymous namespace
+
+POSITIONUPDATEFILTER_TEST(GIVEN_no_precision_WHEN_position_repeated_THEN_only_first_is_sent)
+{
+	FPositionUpdateFilter Filter;
+
+	FVector Sent;
+	TestTrue(TEXT("First position is sent"), Filter.ShouldSend(TestEntityId, FVector(1.5f, 2.5f, 3.5f), Sent));
+	TestTrue(TEXT("Position is not snapped"), Sent == FVector(1.5f, 2.5f, 3.5f));
+	TestFalse(TEXT("Same position is not resent"), Filter.ShouldSend(TestEntityId, FVector(1.5f, 2.5f, 3.5f), Sent));
+	TestTrue(TEXT("Any movement is sent"), Filter.ShouldSend(TestEntityId, FVector(1.5f, 2.5f, 3.6f), Sent));
+	TestTrue(TEXT("Other entities are tracked separately"), Filter.ShouldSend(TestEntityId + 1, FVector(1.5f, 2.5f, 3.6f), Sent));
+
+	return true;
+}
+
+POSITIONUPDATEFILTER_TEST(GIVEN_precision_WHEN_moving_within_a_cell_THEN_not_resent)
+{
+	FPositionUpdateFilter Filter(10.0f);
+
+	FVector Sent;
+	TestTrue(TEXT("First position is sent"), Filter.ShouldSend(TestEntityId, FVector(101.0f, -49.0f, 0.0f), Sent));
+	TestTrue(TEXT("Position is snapped to the grid"), Sent == FVector(100.0f, -50.0f, 0.0f));
+	TestFalse(TEXT("Movement within the cell is not sent"), Filter.ShouldSend(TestEntityId, FVector(104.0f, -46.0f, 1.0f), Sent));
+	TestTrue(TEXT("Movement into another cell is sent"), Filter.ShouldSend(TestEntityId, FVector(106.0f, -46.0f, 1.0f), Sent));
+	TestTrue(TEXT("New cell is sent"), Sent == FVector(110.0f, -50.0f, 0.0f));
+	TestEqual(TEXT("Two updates sent"), static_cast<int32>(Filter.GetStats().NumSent), 2);
+	TestEqual(TEXT("One update suppressed"), static_cast<int32>(Filter.GetStats().NumSuppressed), 1);
+
+	return true;
+}
+
+POSITIONUPDATEFILTER_TEST(GIVEN_sent_position_WHEN_entity_removed_THEN_same_position_is_sent_again)
+{
+	FPositionUpdateFilter Filter;
+
+	FVector Sent;
+	Filter.ShouldSend(TestEntityId, FVector(1.0f, 2.0f, 3.0f), Sent);
+	Filter.RemoveEntity(TestEntityId);
+
+	TestTrue(TEXT("Position is resent after authority changed"), Filter.ShouldSend(TestEntityId, FVector(1.0f, 2.0f, 3.0f), Sent));
+
+	return true;
+}
+
+POSITIONUPDATEFILTER_TEST(GIVEN_sent_position_WHEN_precision_changed_THEN_same_position_is_sent_again)
+{
+	FPositionUpdateFilter Filter;
+
+	FVector Sent;
+	Filter.ShouldSend(TestEntityId, FVector(100.0f, 200.0f, 300.0f), Sent);
+	Filter.SetPrecision(100.0f);
+
+	TestTrue(TEXT("Position is resent with the new precision"), Filter.ShouldSend(TestEntityId, FVector(100.0f, 200.0f, 300.0f), Sent));
+
+	return true;
+}
+
+POSITIONUPDATEFILTER_TEST(GIVEN_10000_moving_entities_WHEN_filtered_THEN_report_byte_savings)
+{
+	const int32 NumEntities = 10000;
+	const int32 NumTicks = 30;
+	const float Precision = 25.0f;
+
+	// Most entities in a crowd idle with small jitter, the rest walk a few centimeters each tick.
+	FRandomStream Random(1234);
+	TArray<FVector> Positions;
+	TArray<FVector> Velocities;
+	for (int32 i = 0; i < NumEntities; i++)
+	{
+		Positions.Add(FVector(Random.FRandRange(-50000.0f, 50000.0f), Random.FRandRange(-50000.0f, 50000.0f), 0.0f));
+		Velocities.Add(i % 10 < 3 ? FVector(Random.FRandRange(-8.0f, 8.0f), Random.FRandRange(-8.0f, 8.0f), 0.0f) : FVector::ZeroVector);
+	}
+
+	FPositionUpdateFilter Unquantized;
+	FPositionUpdateFilter Quantized(Precision);
+
+	uint64 BaselineBytes = 0;
+	uint64 UnquantizedBytes = 0;
+	uint64 QuantizedBytes = 0;
+	float MaxError = 0.0f;
+
+	for (int32 Tick = 0; Tick < NumTicks; Tick++)
+	{
+		for (int32 i = 0; i < NumEntities; i++)
+		{
+			const FVector Jitter(Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f), 0.0f);
+			const FVector Position = Positions[i] + Velocities[i] * Tick + Jitter;
+			const uint32 UpdateSize = GetPositionUpdateSize(Position);
+
+			BaselineBytes += UpdateSize;
+
+			FVector Sent;
+			if (Unquantized.ShouldSend(TestEntityId + i, Position, Sent))
+			{
+				UnquantizedBytes += UpdateSize;
+			}
+			if (Quantized.ShouldSend(TestEntityId + i, Position, Sent))
+			{
+				QuantizedBytes += UpdateSize;
+				MaxError = FMath::Max(MaxError, FMath::Max3(FMath::Abs(Sent.X - Position.X), FMath::Abs(Sent.Y - Position.Y), FMath::Abs(Sent.Z - Position.Z)));
+			}
+		}
+	}
+
+	TestTrue(TEXT("Quantized error is within half the precision"), MaxError <= Precision * 0.5f + KINDA_SMALL_NUMBER);
+	TestTrue(TEXT("Quantizing sends fewer bytes"), QuantizedBytes < UnquantizedBytes);
+	TestEqual(TEXT("Every update is sent or suppressed"), static_cast<int32>(Quantized.GetStats().NumSent + Quantized.GetStats().NumSuppressed), NumEntities * NumTicks);
+
+	AddInfo(FString::Printf(TEXT("%d entities over %d ticks: every update %llu bytes, unquantized %llu bytes, quantized to %.0fcm %llu bytes (%.1f%% saved)"),
+		NumEntities, NumTicks, BaselineBytes, UnquantizedBytes, Precision, QuantizedBytes,
+		BaselineBytes > 0 ? 100.0 * (BaselineBytes - QuantizedBytes) / BaselineBytes : 0.0));
+
+	return true;
+}
@@ -0,0 +1,223 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Schema/RPCPayload.h"
+#include "Utils/SchemaUtils.h"
+
+#include "CoreMinimal.h"
+#include "HAL/MemoryBase.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+#define SCHEMAALLOCATION_TEST(TestName) \
+	GDK_TEST(Core, SchemaAllocation, TestName)
+
+namespace
+{
+
+const Schema_FieldId TestFieldId = 1;
+
+// Forwards to the allocator it replaces and counts the heap allocations made by the thread that installed it.
+// Schema buffers come from the Worker SDK's own allocator, so they are not counted.
+class FCountingMalloc : public FMalloc
+{
+public:
+	void Install()
+	{
+		InnerMalloc = GMalloc;
+		OwningThreadId = FPlatformTLS::GetCurrentThreadId();
+		Allocations = 0;
+		GMalloc = this;
+	}
+
+	void Uninstall()
+	{
+		GMalloc = InnerMalloc;
+	}
+
+	uint32 GetAllocations() const { return Allocations; }
+
+	virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+	{
+		CountAllocation();
+		return InnerMalloc->Malloc(Count, Alignment);
+	}
+
+	virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+	{
+		CountAllocation();
+		return InnerMalloc->TryMalloc(Count, Alignment);
+	}
+
+	virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		if (Count > 0)
+		{
+			CountAllocation();
+		}
+		return InnerMalloc->Realloc(Original, Count, Alignment);
+	}
+
+	virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		if (Count > 0)
+		{
+			CountAllocation();
+		}
+		return InnerMalloc->TryRealloc(Original, Count, Alignment);
+	}
+
+	virtual void Free(void* Original) override { InnerMalloc->Free(Original); }
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return InnerMalloc->QuantizeSize(Count, Alignment); }
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return InnerMalloc->GetAllocationSize(Original, SizeOut); }
+	virtual void Trim(bool bTrimThreadCaches) override { InnerMalloc->Trim(bTrimThreadCaches); }
+	virtual void SetupTLSCachesOnCurrentThread() override { InnerMalloc->SetupTLSCachesOnCurrentThread(); }
+	virtual void ClearAndDisableTLSCachesOnCurrentThread() override { InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread(); }
+	virtual bool IsInternallyThreadSafe() const override { return InnerMalloc->IsInternallyThreadSafe(); }
+	virtual bool ValidateHeap() override { return InnerMalloc->ValidateHeap(); }
+	virtual const TCHAR* GetDescriptiveName() override { return InnerMalloc->GetDescriptiveName(); }
+
+private:
+	void CountAllocation()
+	{
+		if (FPlatformTLS::GetCurrentThreadId() == OwningThreadId)
+		{
+			Allocations++;
+		}
+	}
+
+	FMalloc* InnerMalloc = nullptr;
+	uint32 OwningThreadId = 0;
+	uint32 Allocations = 0;
+};
+
+// Other threads may still be calling through the proxy when it is uninstalled, so it is never destroyed.
+FCountingMalloc& GetCountingMalloc()
+{
+	static FCountingMalloc* CountingMalloc = new FCountingMalloc();
+	return *CountingMalloc;
+}
+
+template <typename TFunction>
+uint32 CountAllocations(TFunction&& Function)
+{
+	FCountingMalloc& CountingMalloc = GetCountingMalloc();
+	CountingMalloc.Install();
+	Function();
+	CountingMalloc.Uninstall();
+	return CountingMalloc.GetAllocations();
+}
+
+// Longer than the inline buffer of FTCHARToUTF8, so converting it through a temporary allocates.
+FString CreateLongString()
+{
+	return FString::ChrN(256, TEXT('a'));
+}
+
+} // anonymous namespace
+
+SCHEMAALLOCATION_TEST(GIVEN_long_string_WHEN_added_to_schema_THEN_it_is_converted_without_a_heap_allocation)
+{
+	const FString Value = CreateLongString();
+
+	Schema_ComponentData* Data = Schema_CreateComponentData();
+	Schema_Object* Fields = Schema_GetComponentDataFields(Data);
+
+	const uint32 AllocationsThroughTemporary = CountAllocations([&]
+	{
+		FTCHARToUTF8 CStrConversion(*Value);
+		uint8* StringBuffer = Schema_AllocateBuffer(Fields, CStrConversion.Length());
+		FMemory::Memcpy(StringBuffer, CStrConversion.Get(), CStrConversion.Length());
+		Schema_AddBytes(Fields, TestFieldId, StringBuffer, CStrConversion.Length());
+	});
+	const uint32 Allocations = CountAllocations([&]
+	{
+		SpatialGDK::AddStringToSchema(Fields, TestFieldId, Value);
+	});
+
+	TestEqual("Converting through a temporary allocates once", AllocationsThroughTemporary, 1u);
+	TestEqual("AddStringToSchema does not allocate", Allocations, 0u);
+	TestEqual("String round trips", SpatialGDK::IndexStringFromSchema(Fields, TestFieldId, 1), Value);
+
+	Schema_DestroyComponentData(Data);
+
+	return true;
+}
+
+SCHEMAALLOCATION_TEST(GIVEN_string_with_enough_capacity_WHEN_read_from_schema_THEN_it_does_not_allocate)
+{
+	const FString Value = CreateLongString();
+
+	Schema_ComponentData* Data = Schema_CreateComponentData();
+	Schema_Object* Fields = Schema_GetComponentDataFields(Data);
+	SpatialGDK::AddStringToSchema(Fields, TestFieldId, Value);
+
+	FString Destination = CreateLongString() + CreateLongString();
+
+	const uint32 AllocationsForNewString = CountAllocations([&]
+	{
+		FString NewString = SpatialGDK::IndexStringFromSchema(Fields, TestFieldId, 0);
+	});
+	const uint32 AllocationsForExistingString = CountAllocations([&]
+	{
+		SpatialGDK::IndexStringFromSchema(Fields, TestFieldId, 0, Destination);
+	});
+
+	TestEqual("Reading into a new string allocates once", AllocationsForNewString, 1u);
+	TestEqual("Reading into an existing string does not allocate", AllocationsForExistingString, 0u);
+	TestEqual("String was read correctly", Destination, Value);
+
+	Schema_DestroyComponentData(Data);
+
+	return true;
+}
+
+SCHEMAALLOCATION_TEST(GIVEN_bytes_in_schema_WHEN_read_as_a_view_THEN_it_does_not_allocate)
+{
+	const uint8 Payload[] = { 1, 2, 3, 4, 5 };
+
+	Schema_ComponentData* Data = Schema_CreateComponentData();
+	Schema_Object* Fields = Schema_GetComponentDataFields(Data);
+	SpatialGDK::AddBytesToSchema(Fields, TestFieldId, Payload, sizeof(Payload));
+
+	const uint32 AllocationsForArray = CountAllocations([&]
+	{
+		TArray<uint8> Bytes = SpatialGDK::GetBytesFromSchema(Fields, TestFieldId);
+	});
+	const uint32 AllocationsForView = CountAllocations([&]
+	{
+		TArrayView<const uint8> View = SpatialGDK::GetBytesViewFromSchema(Fields, TestFieldId);
+	});
+
+	TestEqual("Reading into an array allocates once", AllocationsForArray, 1u);
+	TestEqual("Reading a view does not allocate", AllocationsForView, 0u);
+
+	Schema_DestroyComponentData(Data);
+
+	return true;
+}
+
+SCHEMAALLOCATION_TEST(GIVEN_rpc_payload_in_schema_WHEN_read_THEN_its_data_is_copied_exactly_once)
+{
+	const TArray<uint8> PayloadData = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+	Schema_ComponentData* Data = Schema_CreateComponentData();
+	Schema_Object* Fields = Schema_GetComponentDataFields(Data);
+	SpatialGDK::RPCPayload::WriteToSchemaObject(Fields, 1, 2, PayloadData.GetData(), PayloadData.Num());
+
+	// Queued RPCs and ring buffer views outlive the schema object, so the payload must own one copy of its data.
+	TOptional<SpatialGDK::RPCPayload> Payload;
+	const uint32 Allocations = CountAllocations([&]
+	{
+		Payload.Emplace(Fields);
+	});
+
+	TestEqual("Reading the payload allocates once", Allocations, 1u);
+	TestTrue("Payload data matches", Payload.GetValue().PayloadData == PayloadData);
+	TestTrue("Payload owns its data", Payload.GetValue().PayloadData.GetData() != Schema_GetBytes(Fields, SpatialConstants::UNREAL_RPC_PAYLOAD_RPC_PAYLOAD_ID));
+
+	Schema_DestroyComponentData(Data);
+
+	return true;
+}
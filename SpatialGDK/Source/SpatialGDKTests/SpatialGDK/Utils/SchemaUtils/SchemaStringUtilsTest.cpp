@@ -0,0 +1,79 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/SchemaUtils.h"
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+#define SCHEMASTRINGUTILS_TEST(TestName) \
+	GDK_TEST(Core, SchemaStringUtils, TestName)
+
+namespace
+{
+
+const Schema_FieldId TestFieldId = 1;
+
+} // anonymous namespace
+
+SCHEMASTRINGUTILS_TEST(GIVEN_ansi_and_non_ansi_strings_WHEN_added_and_read_back_THEN_they_match)
+{
+	TArray<FString> Strings = { FString(), TEXT("PersistentLevel"), TEXT("Grüße 你好") };
+
+	Schema_ComponentData* Data = Schema_CreateComponentData();
+	Schema_Object* Fields = Schema_GetComponentDataFields(Data);
+	for (const FString& String : Strings)
+	{
+		SpatialGDK::AddStringToSchema(Fields, TestFieldId, String);
+	}
+
+	for (int32 i = 0; i < Strings.Num(); i++)
+	{
+		TestEqual(FString::Printf(TEXT("String %d round trips"), i), SpatialGDK::IndexStringFromSchema(Fields, TestFieldId, i), Strings[i]);
+		TestEqual(FString::Printf(TEXT("String %d round trips as an FName"), i), SpatialGDK::IndexNameFromSchema(Fields, TestFieldId, i), FName(*Strings[i]));
+	}
+
+	Schema_DestroyComponentData(Data);
+
+	return true;
+}
+
+SCHEMASTRINGUTILS_TEST(GIVEN_string_with_enough_capacity_WHEN_read_into_THEN_its_allocation_is_reused)
+{
+	Schema_ComponentData* Data = Schema_CreateComponentData();
+	Schema_Object* Fields = Schema_GetComponentDataFields(Data);
+	SpatialGDK::AddStringToSchema(Fields, TestFieldId, TEXT("ShortValue"));
+
+	FString Destination = TEXT("A considerably longer value that is already allocated");
+	const TCHAR* AllocationBefore = Destination.GetCharArray().GetData();
+
+	SpatialGDK::IndexStringFromSchema(Fields, TestFieldId, 0, Destination);
+
+	TestEqual("String was read correctly", Destination, FString(TEXT("ShortValue")));
+	TestEqual("String reused its existing allocation", Destination.GetCharArray().GetData(), AllocationBefore);
+
+	Schema_DestroyComponentData(Data);
+
+	return true;
+}
+
+SCHEMASTRINGUTILS_TEST(GIVEN_bytes_in_schema_WHEN_read_as_a_view_THEN_view_points_at_schema_owned_memory)
+{
+	const uint8 Payload[] = { 1, 2, 3, 4, 5 };
+
+	Schema_ComponentData* Data = Schema_CreateComponentData();
+	Schema_Object* Fields = Schema_GetComponentDataFields(Data);
+	SpatialGDK::AddBytesToSchema(Fields, TestFieldId, Payload, sizeof(Payload));
+
+	TArrayView<const uint8> View = SpatialGDK::GetBytesViewFromSchema(Fields, TestFieldId);
+
+	TestEqual("View has the payload length", View.Num(), (int32)sizeof(Payload));
+	TestTrue("View points at the schema-owned bytes", View.GetData() == Schema_GetBytes(Fields, TestFieldId));
+	TestTrue("View contents match the payload", FMemory::Memcmp(View.GetData(), Payload, sizeof(Payload)) == 0);
+
+	Schema_DestroyComponentData(Data);
+
+	return true;
+}
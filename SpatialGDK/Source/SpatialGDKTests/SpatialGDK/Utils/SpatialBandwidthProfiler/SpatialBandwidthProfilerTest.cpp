@@ -0,0 +1,170 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "EngineClasses/SpatialNetDriver.h"
+#include "GameFramework/Actor.h"
+#include "Interop/SpatialClassInfoManager.h"
+#include "SpatialGDKTests/SpatialGDK/EngineClasses/SpatialActorChannel/HandoverTestObject.h"
+#include "Utils/ComponentFactory.h"
+#include "Utils/SpatialBandwidthProfiler.h"
+#include "Utils/SpatialMetrics.h"
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+#define BANDWIDTHPROFILER_TEST(TestName) \
+	GDK_TEST(Core, SpatialBandwidthProfiler, TestName)
+
+using SpatialGDK::BandwidthProfiler;
+using SpatialGDK::EBandwidthCategory;
+
+namespace
+{
+
+const Worker_ComponentId TestHandoverComponentId = 10000;
+
+USpatialNetDriver* CreateNetDriverRecordingBandwidth()
+{
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	NetDriver->SpatialMetrics = NewObject<USpatialMetrics>();
+	NetDriver->SpatialMetrics->SpatialStartBandwidthProfiler();
+	return NetDriver;
+}
+
+const BandwidthProfiler::FEntry* FindEntry(const TArray<BandwidthProfiler::FEntry>& Entries, FName ClassName, FName PropertyName, EBandwidthCategory Category)
+{
+	return Entries.FindByPredicate([ClassName, PropertyName, Category](const BandwidthProfiler::FEntry& Entry)
+	{
+		return Entry.ClassName == ClassName && Entry.PropertyName == PropertyName && Entry.Category == Category;
+	});
+}
+
+} // anonymous namespace
+
+BANDWIDTHPROFILER_TEST(GIVEN_profiler_not_started_WHEN_tracking_THEN_nothing_is_recorded)
+{
+	BandwidthProfiler Profiler;
+
+	Profiler.Track(TEXT("Character"), TEXT("Health"), EBandwidthCategory::Data, 4);
+
+	TestEqual(TEXT("No entries are recorded"), Profiler.GetEntries().Num(), 0);
+
+	return true;
+}
+
+BANDWIDTHPROFILER_TEST(GIVEN_started_profiler_WHEN_tracking_THEN_bytes_and_counts_accumulate_per_class_property_and_category)
+{
+	BandwidthProfiler Profiler;
+	Profiler.Start();
+
+	Profiler.Track(TEXT("Character"), TEXT("Health"), EBandwidthCategory::Data, 4);
+	Profiler.Track(TEXT("Character"), TEXT("Health"), EBandwidthCategory::Data, 6);
+	Profiler.Track(TEXT("Character"), TEXT("Health"), EBandwidthCategory::Handover, 3);
+	Profiler.Track(TEXT("Character"), TEXT("Ammo"), EBandwidthCategory::OwnerOnly, 20);
+	Profiler.Track(TEXT("Pawn"), TEXT("Health"), EBandwidthCategory::Data, 1);
+
+	Profiler.Stop();
+	Profiler.Track(TEXT("Character"), TEXT("Health"), EBandwidthCategory::Data, 100);
+
+	const TArray<BandwidthProfiler::FEntry> Entries = Profiler.GetEntries();
+	if (!TestEqual(TEXT("One entry per class, property and category"), Entries.Num(), 4))
+	{
+		return false;
+	}
+
+	TestTrue(TEXT("Largest entry is sorted first"), Entries[0].PropertyName == FName(TEXT("Ammo")));
+	TestEqual(TEXT("Data bytes accumulate"), Entries[1].Bytes, static_cast<uint64>(10));
+	TestEqual(TEXT("Data writes are counted"), Entries[1].Count, static_cast<uint64>(2));
+	TestTrue(TEXT("Handover is tracked separately"), Entries[2].Category == EBandwidthCategory::Handover);
+	TestTrue(TEXT("Classes are tracked separately"), Entries[3].ClassName == FName(TEXT("Pawn")));
+
+	Profiler.Reset();
+	TestEqual(TEXT("Reset clears all entries"), Profiler.GetEntries().Num(), 0);
+
+	return true;
+}
+
+BANDWIDTHPROFILER_TEST(GIVEN_recorded_entries_WHEN_exported_THEN_csv_and_json_contain_them)
+{
+	BandwidthProfiler Profiler;
+	Profiler.Start();
+
+	Profiler.Track(TEXT("Character"), TEXT("ServerFire"), EBandwidthCategory::RPC, 12);
+	Profiler.Track(TEXT("Character"), TEXT("ServerFire"), EBandwidthCategory::RPC, 8);
+	Profiler.Track(TEXT("Character"), NAME_None, EBandwidthCategory::Interest, 30);
+
+	const FString CSV = Profiler.ToCSV();
+	TArray<FString> Lines;
+	CSV.ParseIntoArrayLines(Lines);
+
+	if (!TestEqual(TEXT("CSV has a header and a line per entry"), Lines.Num(), 3))
+	{
+		return false;
+	}
+
+	TestEqual(TEXT("CSV header"), Lines[0], FString(TEXT("Class,Property,Category,Bytes,Count,AvgBytes")));
+	TestEqual(TEXT("Interest line"), Lines[1], FString(TEXT("Character,None,Interest,30,1,30.00")));
+	TestEqual(TEXT("RPC line"), Lines[2], FString(TEXT("Character,ServerFire,RPC,20,2,10.00")));
+
+	const FString Json = Profiler.ToJson();
+	TestTrue(TEXT("JSON contains the RPC entry"), Json.Contains(TEXT("{\"class\":\"Character\",\"property\":\"ServerFire\",\"category\":\"RPC\",\"bytes\":20,\"count\":2}")));
+	TestTrue(TEXT("JSON is closed"), Json.EndsWith(TEXT("]}")));
+
+	return true;
+}
+
+BANDWIDTHPROFILER_TEST(GIVEN_recording_profiler_WHEN_component_factory_writes_a_property_THEN_its_bytes_are_attributed_to_the_class_and_property)
+{
+	USpatialNetDriver* NetDriver = CreateNetDriverRecordingBandwidth();
+
+	FClassInfo Info;
+	USpatialClassInfoManager::CreateHandoverPropertyInfo(UHandoverTestObject::StaticClass(), Info);
+	Info.SchemaComponents[SCHEMA_Handover] = TestHandoverComponentId;
+
+	UHandoverTestObject* Object = NewObject<UHandoverTestObject>();
+	Object->IntA = 42;
+
+	// Handles are 1-based, so this is IntA.
+	const FHandoverChangeState Changes = { 1 };
+	uint32 BytesWritten = 0;
+	SpatialGDK::ComponentFactory Factory(false, NetDriver, nullptr);
+	FWorkerComponentData Data = Factory.CreateHandoverComponentData(TestHandoverComponentId, Object, Info, Changes, BytesWritten);
+	Schema_DestroyComponentData(Data.schema_type);
+
+	const TArray<BandwidthProfiler::FEntry> Entries = NetDriver->SpatialMetrics->GetActiveBandwidthProfiler()->GetEntries();
+	const BandwidthProfiler::FEntry* Entry = FindEntry(Entries, UHandoverTestObject::StaticClass()->GetFName(), GET_MEMBER_NAME_CHECKED(UHandoverTestObject, IntA), EBandwidthCategory::Handover);
+	if (!TestNotNull(TEXT("The written property is attributed"), Entry))
+	{
+		return false;
+	}
+
+	TestEqual(TEXT("Every byte written is attributed to the property"), Entry->Bytes, static_cast<uint64>(BytesWritten));
+	TestEqual(TEXT("The write is counted once"), Entry->Count, static_cast<uint64>(1));
+	TestEqual(TEXT("Only the written property is attributed"), Entries.Num(), 1);
+
+	return true;
+}
+
+BANDWIDTHPROFILER_TEST(GIVEN_recording_profiler_WHEN_an_rpc_is_sent_THEN_its_payload_is_attributed_to_the_function)
+{
+	USpatialNetDriver* NetDriver = CreateNetDriverRecordingBandwidth();
+
+	// USpatialSender reports every RPC it sends, in every build configuration, through TrackSentRPC.
+	UFunction* Function = AActor::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(AActor, K2_DestroyActor));
+	NetDriver->SpatialMetrics->TrackSentRPC(Function, ERPCType::ServerReliable, 16);
+	NetDriver->SpatialMetrics->TrackSentRPC(Function, ERPCType::ServerReliable, 8);
+
+	const TArray<BandwidthProfiler::FEntry> Entries = NetDriver->SpatialMetrics->GetActiveBandwidthProfiler()->GetEntries();
+	const BandwidthProfiler::FEntry* Entry = FindEntry(Entries, AActor::StaticClass()->GetFName(), Function->GetFName(), EBandwidthCategory::RPC);
+	if (!TestNotNull(TEXT("The RPC is attributed"), Entry))
+	{
+		return false;
+	}
+
+	TestEqual(TEXT("Payload bytes accumulate"), Entry->Bytes, static_cast<uint64>(24));
+	TestEqual(TEXT("Every send is counted"), Entry->Count, static_cast<uint64>(2));
+
+	return true;
+}
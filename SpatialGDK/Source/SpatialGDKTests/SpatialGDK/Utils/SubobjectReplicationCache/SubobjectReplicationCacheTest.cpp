@@ -0,0 +1,165 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "SpatialGDKTests/SpatialGDK/LoadBalancing/AbstractLBStrategy/LBStrategyStub.h"
+#include "Interop/SpatialClassInfoManager.h"
+#include "Utils/SubobjectReplicationCache.h"
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/Package.h"
+
+#define SUBOBJECTREPLICATIONCACHE_TEST(TestName) \
+	GDK_TEST(Core, FSubobjectReplicationCache, TestName)
+
+namespace
+{
+
+const int32 NumBenchmarkSubobjects = 24;
+const int32 NumBenchmarkPasses = 10000;
+
+TArray<UObject*> CreateSubobjects(int32 Num)
+{
+	TArray<UObject*> Subobjects;
+	for (int32 i = 0; i < Num; i++)
+	{
+		Subobjects.Add(NewObject<UPackage>(GetTransientPackage()));
+	}
+	return Subobjects;
+}
+
+} // anonymous namespace
+
+SUBOBJECTREPLICATIONCACHE_TEST(GIVEN_cached_subobject_WHEN_invalidated_THEN_lookup_misses)
+{
+	FSubobjectReplicationCache Cache;
+	FClassInfo Info;
+	TArray<UObject*> Subobjects = CreateSubobjects(2);
+
+	TestNull(TEXT("Uncached subobject misses"), Cache.FindSubobjectInfo(Subobjects[0]));
+
+	Cache.AddSubobjectInfo(Subobjects[0], &Info);
+	Cache.AddSubobjectInfo(Subobjects[1], &Info);
+	TestTrue(TEXT("Cached subobject hits"), Cache.FindSubobjectInfo(Subobjects[0]) == &Info);
+
+	Cache.InvalidateSubobject(Subobjects[0]);
+	TestNull(TEXT("Removed subobject misses"), Cache.FindSubobjectInfo(Subobjects[0]));
+	TestNotNull(TEXT("Other subobjects stay cached"), Cache.FindSubobjectInfo(Subobjects[1]));
+
+	Cache.Invalidate();
+	TestNull(TEXT("Authority change clears all subobjects"), Cache.FindSubobjectInfo(Subobjects[1]));
+
+	TestEqual(TEXT("Hits are counted"), static_cast<int32>(Cache.GetNumHits()), 2);
+	TestEqual(TEXT("Misses are counted"), static_cast<int32>(Cache.GetNumMisses()), 3);
+
+	return true;
+}
+
+SUBOBJECTREPLICATIONCACHE_TEST(GIVEN_cached_handover_subobjects_WHEN_subobject_changes_THEN_lookup_misses)
+{
+	FSubobjectReplicationCache Cache;
+	FClassInfo Info;
+	TArray<UObject*> Subobjects = CreateSubobjects(2);
+
+	TestNull(TEXT("Handover subobjects are not cached initially"), Cache.FindHandoverSubobjects());
+
+	FSubobjectReplicationCache::FHandoverSubobjects HandoverSubobjects;
+	HandoverSubobjects.Emplace(Subobjects[0], &Info);
+	Cache.SetHandoverSubobjects(MoveTemp(HandoverSubobjects));
+
+	const FSubobjectReplicationCache::FHandoverSubobjects* Cached = Cache.FindHandoverSubobjects();
+	if (TestNotNull(TEXT("Handover subobjects are cached"), Cached))
+	{
+		TestEqual(TEXT("Cached handover subobjects match"), Cached->Num(), 1);
+	}
+
+	Cache.InvalidateSubobject(Subobjects[1]);
+	TestNull(TEXT("Attaching or removing any subobject invalidates the handover subobjects"), Cache.FindHandoverSubobjects());
+
+	HandoverSubobjects.Reset();
+	HandoverSubobjects.Emplace(Subobjects[0], &Info);
+	Cache.SetHandoverSubobjects(MoveTemp(HandoverSubobjects));
+	Subobjects[0]->MarkPendingKill();
+	TestNull(TEXT("Destroyed handover subobjects invalidate the cache"), Cache.FindHandoverSubobjects());
+
+	return true;
+}
+
+SUBOBJECTREPLICATIONCACHE_TEST(GIVEN_cached_load_balancing_eligibility_WHEN_strategy_is_reconfigured_THEN_lookup_misses)
+{
+	FSubobjectReplicationCache Cache;
+	ULBStrategyStub* Strategy = NewObject<ULBStrategyStub>();
+	ULBStrategyStub* OtherStrategy = NewObject<ULBStrategyStub>();
+	Strategy->SetLocalVirtualWorkerId(1);
+
+	bool bEligible = false;
+	TestFalse(TEXT("Eligibility is not cached initially"), Cache.FindLoadBalancingEligibility(Strategy, bEligible));
+
+	Cache.SetLoadBalancingEligibility(Strategy, true);
+	TestTrue(TEXT("Eligibility is cached"), Cache.FindLoadBalancingEligibility(Strategy, bEligible));
+	TestTrue(TEXT("Cached eligibility matches"), bEligible);
+
+	TestFalse(TEXT("A different strategy misses"), Cache.FindLoadBalancingEligibility(OtherStrategy, bEligible));
+	TestFalse(TEXT("No strategy misses"), Cache.FindLoadBalancingEligibility(nullptr, bEligible));
+
+	Strategy->SetLocalVirtualWorkerId(2);
+	TestFalse(TEXT("Changing the local virtual worker misses"), Cache.FindLoadBalancingEligibility(Strategy, bEligible));
+
+	Cache.SetLoadBalancingEligibility(Strategy, true);
+	Cache.Invalidate();
+	TestFalse(TEXT("Authority change misses"), Cache.FindLoadBalancingEligibility(Strategy, bEligible));
+
+	return true;
+}
+
+SUBOBJECTREPLICATIONCACHE_TEST(GIVEN_actor_with_many_subobjects_WHEN_replicating_repeatedly_THEN_cache_hit_rate_is_high)
+{
+	FSubobjectReplicationCache Cache;
+	TArray<FClassInfo> Infos;
+	Infos.SetNum(NumBenchmarkSubobjects);
+	TArray<UObject*> Subobjects = CreateSubobjects(NumBenchmarkSubobjects);
+
+	// Baseline: the per pass lookups replaced by the cache, approximated by a map from object to class info
+	// keyed by path name, like the package map and class info manager lookups.
+	TMap<FString, const FClassInfo*> PathToInfo;
+	for (int32 i = 0; i < NumBenchmarkSubobjects; i++)
+	{
+		PathToInfo.Add(Subobjects[i]->GetPathName(), &Infos[i]);
+	}
+
+	const double UncachedStart = FPlatformTime::Seconds();
+	int32 NumFound = 0;
+	for (int32 Pass = 0; Pass < NumBenchmarkPasses; Pass++)
+	{
+		for (UObject* Subobject : Subobjects)
+		{
+			NumFound += PathToInfo.Contains(Subobject->GetPathName()) ? 1 : 0;
+		}
+	}
+	const double UncachedSeconds = FPlatformTime::Seconds() - UncachedStart;
+
+	const double CachedStart = FPlatformTime::Seconds();
+	for (int32 Pass = 0; Pass < NumBenchmarkPasses; Pass++)
+	{
+		for (int32 i = 0; i < NumBenchmarkSubobjects; i++)
+		{
+			if (Cache.FindSubobjectInfo(Subobjects[i]) == nullptr)
+			{
+				Cache.AddSubobjectInfo(Subobjects[i], &Infos[i]);
+			}
+		}
+	}
+	const double CachedSeconds = FPlatformTime::Seconds() - CachedStart;
+
+	const double HitRate = static_cast<double>(Cache.GetNumHits()) / (Cache.GetNumHits() + Cache.GetNumMisses());
+
+	AddInfo(FString::Printf(TEXT("%d subobjects x %d passes: uncached %.3f ms, cached %.3f ms, hit rate %.4f"),
+		NumBenchmarkSubobjects, NumBenchmarkPasses, UncachedSeconds * 1000.0, CachedSeconds * 1000.0, HitRate));
+
+	TestEqual(TEXT("Baseline resolved every subobject"), NumFound, NumBenchmarkSubobjects * NumBenchmarkPasses);
+	TestEqual(TEXT("Each subobject misses exactly once"), static_cast<int32>(Cache.GetNumMisses()), NumBenchmarkSubobjects);
+	TestTrue(TEXT("Hit rate is high"), HitRate > 0.99);
+
+	return true;
+}
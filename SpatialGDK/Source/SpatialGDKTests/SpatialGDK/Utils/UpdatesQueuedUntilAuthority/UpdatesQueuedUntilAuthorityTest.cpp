@@ -0,0 +1,262 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "SpatialGDKTests/SpatialGDK/Interop/Connection/SpatialOSWorkerInterface/SpatialOSWorkerConnectionSpy.h"
+#include "Utils/UpdatesQueuedUntilAuthority.h"
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+#include <WorkerSDK/improbable/c_worker.h>
+
+#define UPDATESQUEUEDUNTILAUTHORITY_TEST(TestName) \
+	GDK_TEST(Core, FUpdatesQueuedUntilAuthority, TestName)
+
+namespace
+{
+
+const Worker_EntityId TestEntityId = 1000;
+const Worker_ComponentId TestComponentId = 12345;
+const Worker_ComponentId OtherComponentId = 12346;
+
+const Schema_FieldId ValueFieldId = 1;
+const Schema_FieldId OtherValueFieldId = 2;
+const Schema_FieldId EventFieldId = 1;
+
+FWorkerComponentUpdate CreateUpdate(Worker_ComponentId ComponentId, Schema_FieldId FieldId, uint32 Value, bool bAddEvent = false)
+{
+	FWorkerComponentUpdate Update = {};
+	Update.component_id = ComponentId;
+	Update.schema_type = Schema_CreateComponentUpdate();
+	Schema_AddUint32(Schema_GetComponentUpdateFields(Update.schema_type), FieldId, Value);
+
+	if (bAddEvent)
+	{
+		Schema_Object* Event = Schema_AddObject(Schema_GetComponentUpdateEvents(Update.schema_type), EventFieldId);
+		Schema_AddUint32(Event, ValueFieldId, Value);
+	}
+
+	return Update;
+}
+
+uint32 GetSize(Worker_ComponentId ComponentId, Schema_FieldId FieldId, uint32 Value)
+{
+	FWorkerComponentUpdate Update = CreateUpdate(ComponentId, FieldId, Value);
+	const uint32 Size = FUpdatesQueuedUntilAuthority::GetUpdateSize(Update);
+	Schema_DestroyComponentUpdate(Update.schema_type);
+	return Size;
+}
+
+uint32 GetValue(const FWorkerComponentUpdate& Update, Schema_FieldId FieldId)
+{
+	return Schema_GetUint32(Schema_GetComponentUpdateFields(Update.schema_type), FieldId);
+}
+
+} // anonymous namespace
+
+UPDATESQUEUEDUNTILAUTHORITY_TEST(GIVEN_no_queued_update_WHEN_popped_THEN_nothing_returned)
+{
+	FUpdatesQueuedUntilAuthority Store;
+
+	FWorkerComponentUpdate Update;
+	TestFalse(TEXT("Nothing to pop"), Store.Pop(TestEntityId, TestComponentId, Update));
+
+	return true;
+}
+
+UPDATESQUEUEDUNTILAUTHORITY_TEST(GIVEN_updates_for_same_component_WHEN_queued_THEN_merged_into_latest_state)
+{
+	FUpdatesQueuedUntilAuthority Store;
+
+	Store.Add(TestEntityId, CreateUpdate(TestComponentId, ValueFieldId, 1, true));
+	Store.Add(TestEntityId, CreateUpdate(TestComponentId, OtherValueFieldId, 7, true));
+	Store.Add(TestEntityId, CreateUpdate(TestComponentId, ValueFieldId, 3, true));
+
+	TestEqual(TEXT("Only one update is queued"), Store.Num(), 1);
+	TestEqual(TEXT("Two updates were merged"), static_cast<int32>(Store.GetStats().NumMerged), 2);
+
+	FWorkerComponentUpdate Update;
+	TestTrue(TEXT("Update can be popped"), Store.Pop(TestEntityId, TestComponentId, Update));
+	TestEqual(TEXT("Older values of the same field are replaced"), static_cast<int32>(Schema_GetUint32Count(Schema_GetComponentUpdateFields(Update.schema_type), ValueFieldId)), 1);
+	TestEqual(TEXT("Latest value is kept"), static_cast<int32>(GetValue(Update, ValueFieldId)), 3);
+	TestEqual(TEXT("Fields only set by earlier updates are kept"), static_cast<int32>(GetValue(Update, OtherValueFieldId)), 7);
+	TestEqual(TEXT("Events from every update are kept"), static_cast<int32>(Schema_GetObjectCount(Schema_GetComponentUpdateEvents(Update.schema_type), EventFieldId)), 3);
+	TestEqual(TEXT("Store is empty"), Store.Num(), 0);
+	TestEqual(TEXT("No bytes are queued"), static_cast<int32>(Store.GetQueuedBytes()), 0);
+
+	Schema_DestroyComponentUpdate(Update.schema_type);
+
+	return true;
+}
+
+UPDATESQUEUEDUNTILAUTHORITY_TEST(GIVEN_updates_for_different_components_WHEN_popped_THEN_only_that_component_returned)
+{
+	FUpdatesQueuedUntilAuthority Store;
+
+	Store.Add(TestEntityId, CreateUpdate(TestComponentId, ValueFieldId, 1));
+	Store.Add(TestEntityId, CreateUpdate(OtherComponentId, ValueFieldId, 2));
+
+	FWorkerComponentUpdate Update;
+	TestTrue(TEXT("Other component can be popped"), Store.Pop(TestEntityId, OtherComponentId, Update));
+	TestTrue(TEXT("Popped the right component"), Update.component_id == OtherComponentId);
+	TestEqual(TEXT("Popped the right value"), static_cast<int32>(GetValue(Update, ValueFieldId)), 2);
+	TestEqual(TEXT("The first component is still queued"), Store.Num(), 1);
+
+	Schema_DestroyComponentUpdate(Update.schema_type);
+
+	return true;
+}
+
+UPDATESQUEUEDUNTILAUTHORITY_TEST(GIVEN_queued_updates_WHEN_entity_removed_THEN_all_its_updates_dropped)
+{
+	FUpdatesQueuedUntilAuthority Store;
+
+	Store.Add(TestEntityId, CreateUpdate(TestComponentId, ValueFieldId, 1));
+	Store.Add(TestEntityId, CreateUpdate(OtherComponentId, ValueFieldId, 2));
+	Store.Add(TestEntityId + 1, CreateUpdate(TestComponentId, ValueFieldId, 3));
+
+	Store.RemoveEntity(TestEntityId);
+
+	FWorkerComponentUpdate Update;
+	TestFalse(TEXT("Removed entity has no updates"), Store.Pop(TestEntityId, TestComponentId, Update));
+	TestEqual(TEXT("Other entity is still queued"), Store.Num(), 1);
+
+	return true;
+}
+
+UPDATESQUEUEDUNTILAUTHORITY_TEST(GIVEN_memory_cap_WHEN_exceeded_THEN_least_recently_updated_entries_evicted)
+{
+	const uint32 UpdateSize = GetSize(TestComponentId, ValueFieldId, 1);
+	FUpdatesQueuedUntilAuthority Store(UpdateSize * 2);
+
+	Store.Add(TestEntityId, CreateUpdate(TestComponentId, ValueFieldId, 1));
+	Store.Add(TestEntityId + 1, CreateUpdate(TestComponentId, ValueFieldId, 2));
+	// Touching the first entity makes the second one the least recently updated.
+	Store.Add(TestEntityId, CreateUpdate(TestComponentId, ValueFieldId, 3));
+	Store.Add(TestEntityId + 2, CreateUpdate(TestComponentId, ValueFieldId, 4));
+
+	TestEqual(TEXT("One entry was evicted"), static_cast<int32>(Store.GetStats().NumEvicted), 1);
+	TestTrue(TEXT("Queued bytes are within the cap"), Store.GetQueuedBytes() <= UpdateSize * 2);
+
+	FWorkerComponentUpdate Update;
+	TestFalse(TEXT("Least recently updated entity was evicted"), Store.Pop(TestEntityId + 1, TestComponentId, Update));
+	TestTrue(TEXT("Recently updated entity was kept"), Store.Pop(TestEntityId, TestComponentId, Update));
+	TestEqual(TEXT("Kept entity has its latest value"), static_cast<int32>(GetValue(Update, ValueFieldId)), 3);
+	Schema_DestroyComponentUpdate(Update.schema_type);
+
+	return true;
+}
+
+UPDATESQUEUEDUNTILAUTHORITY_TEST(GIVEN_evicted_update_WHEN_authority_gained_THEN_final_value_of_component_sent)
+{
+	const uint32 UpdateSize = GetSize(TestComponentId, ValueFieldId, 1);
+	FUpdatesQueuedUntilAuthority Store(UpdateSize);
+
+	// The second entity's update evicts the first's, which held the only change to OtherValueFieldId.
+	Store.Add(TestEntityId, CreateUpdate(TestComponentId, OtherValueFieldId, 7));
+	Store.Add(TestEntityId + 1, CreateUpdate(TestComponentId, ValueFieldId, 2));
+	TestTrue(TEXT("Evicted component is remembered"), Store.WasEvicted(TestEntityId, TestComponentId));
+
+	SpatialOSWorkerConnectionSpy Connection;
+	int32 NumWholeComponentUpdates = 0;
+	auto CreateWholeComponentUpdate = [&NumWholeComponentUpdates](FWorkerComponentUpdate& OutUpdate)
+	{
+		NumWholeComponentUpdates++;
+		OutUpdate = CreateUpdate(TestComponentId, OtherValueFieldId, 8);
+		Schema_AddUint32(Schema_GetComponentUpdateFields(OutUpdate.schema_type), ValueFieldId, 9);
+		return true;
+	};
+
+	Store.Send(TestEntityId, TestComponentId, Connection, CreateWholeComponentUpdate);
+
+	const TArray<SpatialOSWorkerConnectionSpy::FSentComponentUpdate>& SentUpdates = Connection.GetSentComponentUpdates();
+	TestEqual(TEXT("Whole component was created once"), NumWholeComponentUpdates, 1);
+	TestEqual(TEXT("Whole component was sent"), SentUpdates.Num(), 1);
+	if (SentUpdates.Num() == 1)
+	{
+		TestTrue(TEXT("Sent for the evicted entity"), SentUpdates[0].EntityId == TestEntityId);
+		TestTrue(TEXT("Sent for the evicted component"), SentUpdates[0].Update.component_id == TestComponentId);
+		TestEqual(TEXT("Final value of the evicted field is sent"), static_cast<int32>(GetValue(SentUpdates[0].Update, OtherValueFieldId)), 8);
+		TestEqual(TEXT("Final value of every other field is sent"), static_cast<int32>(GetValue(SentUpdates[0].Update, ValueFieldId)), 9);
+	}
+	TestFalse(TEXT("Evicted component is forgotten once sent"), Store.WasEvicted(TestEntityId, TestComponentId));
+	TestEqual(TEXT("Resend is counted"), static_cast<int32>(Store.GetStats().NumWholeComponentsResent), 1);
+
+	// The update that was kept is sent as it was queued, without creating the whole component.
+	Store.Send(TestEntityId + 1, TestComponentId, Connection, CreateWholeComponentUpdate);
+	TestEqual(TEXT("Whole component is only created for evicted components"), NumWholeComponentUpdates, 1);
+	TestEqual(TEXT("Kept update was sent"), SentUpdates.Num(), 2);
+	if (SentUpdates.Num() == 2)
+	{
+		TestEqual(TEXT("Kept update has its queued value"), static_cast<int32>(GetValue(SentUpdates[1].Update, ValueFieldId)), 2);
+	}
+
+	// Sending again has nothing left to send.
+	Store.Send(TestEntityId, TestComponentId, Connection, CreateWholeComponentUpdate);
+	TestEqual(TEXT("Nothing else is sent"), SentUpdates.Num(), 2);
+
+	return true;
+}
+
+UPDATESQUEUEDUNTILAUTHORITY_TEST(GIVEN_evicted_update_WHEN_entity_removed_THEN_eviction_forgotten)
+{
+	const uint32 UpdateSize = GetSize(TestComponentId, ValueFieldId, 1);
+	FUpdatesQueuedUntilAuthority Store(UpdateSize);
+
+	Store.Add(TestEntityId, CreateUpdate(TestComponentId, ValueFieldId, 1));
+	Store.Add(TestEntityId + 1, CreateUpdate(TestComponentId, ValueFieldId, 2));
+	TestTrue(TEXT("Evicted component is remembered"), Store.WasEvicted(TestEntityId, TestComponentId));
+
+	Store.RemoveEntity(TestEntityId);
+	TestFalse(TEXT("Removed entity has no evicted components"), Store.WasEvicted(TestEntityId, TestComponentId));
+
+	return true;
+}
+
+UPDATESQUEUEDUNTILAUTHORITY_TEST(GIVEN_handover_storm_WHEN_authority_gained_THEN_one_update_per_component_with_latest_state)
+{
+	const int32 NumEntities = 200;
+	const int32 NumUpdatesPerEntity = 50;
+	const Worker_ComponentId ComponentIds[] = { TestComponentId, OtherComponentId };
+
+	FUpdatesQueuedUntilAuthority Store;
+
+	for (int32 Round = 0; Round < NumUpdatesPerEntity; Round++)
+	{
+		for (int32 i = 0; i < NumEntities; i++)
+		{
+			for (Worker_ComponentId ComponentId : ComponentIds)
+			{
+				Store.Add(TestEntityId + i, CreateUpdate(ComponentId, ValueFieldId, Round));
+			}
+		}
+	}
+
+	TestEqual(TEXT("One entry per entity and component"), Store.Num(), NumEntities * 2);
+
+	const uint32 UpdateSize = GetSize(TestComponentId, ValueFieldId, NumUpdatesPerEntity - 1);
+	TestTrue(TEXT("Memory does not grow with the number of updates"), Store.GetStats().PeakBytes <= UpdateSize * NumEntities * 2);
+
+	int32 NumSent = 0;
+	bool bAllLatest = true;
+	for (int32 i = 0; i < NumEntities; i++)
+	{
+		for (Worker_ComponentId ComponentId : ComponentIds)
+		{
+			FWorkerComponentUpdate Update;
+			while (Store.Pop(TestEntityId + i, ComponentId, Update))
+			{
+				NumSent++;
+				bAllLatest &= GetValue(Update, ValueFieldId) == NumUpdatesPerEntity - 1;
+				Schema_DestroyComponentUpdate(Update.schema_type);
+			}
+		}
+	}
+
+	TestEqual(TEXT("One update sent per entity and component"), NumSent, NumEntities * 2);
+	TestTrue(TEXT("Every sent update has the latest state"), bAllLatest);
+	TestEqual(TEXT("Store is empty"), Store.Num(), 0);
+
+	return true;
+}